@@ -1580,6 +1580,18 @@ function clear_scene(...) end
 color = {}
 
 
+---@class debug_draw
+debug_draw = {}
+
+function debug_draw.circle(...) end
+
+function debug_draw.line(...) end
+
+function debug_draw.rect(...) end
+
+function debug_draw.text(...) end
+
+
 ---@class entity
 entity = {}
 
@@ -1646,6 +1658,8 @@ function input.on_mouse_wheel(...) end
 function input.unbind(...) end
 
 
+function invalidate_static_sprites(...) end
+
 function load_asset(...) end
 
 function load_entity(...) end
@@ -1664,6 +1678,20 @@ function log_w(...) end
 name_component = {}
 
 
+---@class particle_emitter_component
+particle_emitter_component = {}
+
+
+---@class particles
+particles = {}
+
+function particles.clear(...) end
+
+function particles.count(...) end
+
+function particles.total(...) end
+
+
 function play_sound(...) end
 
 ---@class position_component
@@ -1707,6 +1735,8 @@ function registry.get_name(...) end
 
 function registry.get_parent(...) end
 
+function registry.get_particle_emitter(...) end
+
 function registry.get_position(...) end
 
 function registry.get_projectile_emitter(...) end
@@ -1749,6 +1779,8 @@ function registry.has_health(...) end
 
 function registry.has_name(...) end
 
+function registry.has_particle_emitter(...) end
+
 function registry.has_position(...) end
 
 function registry.has_projectile_emitter(...) end
@@ -1808,6 +1840,20 @@ function set_position(...) end
 
 function set_sprite_src_rect(...) end
 
+---@class spatial
+spatial = {}
+
+function spatial.nearest(...) end
+
+function spatial.query_aabb(...) end
+
+function spatial.query_circle(...) end
+
+function spatial.raycast(...) end
+
+function spatial.raycast_all(...) end
+
+
 ---@class sprite_component
 sprite_component = {}
 
@@ -1840,6 +1886,18 @@ function storage.write_table(...) end
 text_label_component = {}
 
 
+---@class tilemap
+tilemap = {}
+
+function tilemap.get_tile(...) end
+
+function tilemap.is_solid(...) end
+
+function tilemap.set_tile(...) end
+
+function tilemap.world_to_tile(...) end
+
+
 function toggle_perf_overlay(...) end
 
 ---@class ui
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "General/Rect.h"
+
+enum class AnimationPlayMode { Once, Loop, PingPong };
+
+inline AnimationPlayMode AnimationPlayModeFromString(const std::string_view name,
+                                                     const AnimationPlayMode fallback = AnimationPlayMode::Loop) {
+  if (name == "once") return AnimationPlayMode::Once;
+  if (name == "loop") return AnimationPlayMode::Loop;
+  if (name == "ping_pong") return AnimationPlayMode::PingPong;
+  return fallback;
+}
+
+inline const char* ToString(const AnimationPlayMode mode) {
+  switch (mode) {
+    case AnimationPlayMode::Once:
+      return "once";
+    case AnimationPlayMode::Loop:
+      return "loop";
+    case AnimationPlayMode::PingPong:
+      return "ping_pong";
+  }
+  return "loop";
+}
+
+// Authoring form of a clip, as read from a `.anim` file (AnimationClipStore::Parse): frames in
+// order with their source rect and duration, and named events keyed to a frame.
+struct AnimationClipDesc {
+  struct Frame {
+    octarine::Rect rect;
+    float duration = 0.1F;  // seconds
+  };
+  struct Event {
+    std::size_t frame = 0;  // index into frames
+    std::string name;
+  };
+
+  std::vector<Frame> frames;
+  std::vector<Event> events;
+  AnimationPlayMode mode = AnimationPlayMode::Loop;
+};
+
+// A clip baked for playback: one step per frame shown, in play order, each with its source rect
+// and the clip time it ends at. Ping-pong is unrolled into the forward-then-back sequence, so every
+// mode plays as a straight walk over the steps. Events are bucketed per step (CSR offsets into
+// one index list), so entering a step fires its events without a search. No SDL and no Lua —
+// AnimationSystem evaluates it on the worker threads.
+class AnimationClip {
+ public:
+  // Floor on a frame's duration, so a clip always has length and Advance always makes progress.
+  static constexpr float kMinFrameDuration = 1e-3F;
+  // Cursor step of a clip that hasn't started playing; see Advance.
+  static constexpr std::uint32_t kUnstarted = UINT32_MAX;
+
+  AnimationClip() = default;
+
+  explicit AnimationClip(const AnimationClipDesc& desc) : mode_(desc.mode) {
+    const std::size_t frames = desc.frames.size();
+    std::vector<std::size_t> order;
+    for (std::size_t f = 0; f < frames; ++f) order.push_back(f);
+    // 0 1 2 3 -> 0 1 2 3 2 1: the end frames show once per pass, not twice.
+    if (mode_ == AnimationPlayMode::PingPong) {
+      for (std::size_t f = frames >= 2 ? frames - 2 : 0; f > 0; --f) order.push_back(f);
+    }
+
+    std::vector<std::vector<std::uint32_t>> frameEvents(frames);
+    for (const AnimationClipDesc::Event& event : desc.events) {
+      if (event.frame >= frames) continue;
+      frameEvents[event.frame].push_back(static_cast<std::uint32_t>(event_names_.size()));
+      event_names_.push_back(event.name);
+    }
+
+    float end = 0.0F;
+    event_offsets_.push_back(0);
+    for (const std::size_t f : order) {
+      end += std::max(desc.frames[f].duration, kMinFrameDuration);
+      rects_.push_back(desc.frames[f].rect);
+      ends_.push_back(end);
+      step_events_.insert(step_events_.end(), frameEvents[f].begin(), frameEvents[f].end());
+      event_offsets_.push_back(static_cast<std::uint32_t>(step_events_.size()));
+    }
+    length_ = end;
+  }
+
+  [[nodiscard]] bool Empty() const { return rects_.empty(); }
+  [[nodiscard]] std::size_t Steps() const { return rects_.size(); }
+  [[nodiscard]] float Length() const { return length_; }
+  [[nodiscard]] AnimationPlayMode Mode() const { return mode_; }
+  [[nodiscard]] const octarine::Rect& Rect(const std::size_t step) const { return rects_[step]; }
+
+  // Move a playback cursor (`time` into the clip, current `step`) on by `dt` seconds, calling
+  // `onEvent(name)` for every event on each step entered. `step == kUnstarted` starts the clip,
+  // firing the first step's events. A cursor past the end of the clip (it was swapped for a
+  // shorter one) restarts too. Returns true once a Once clip has reached its end; the cursor then
+  // holds the last step. A looping cursor more than a full cycle behind skips the whole cycles
+  // without firing their events.
+  template <typename OnEvent>
+  bool Advance(float& time, std::uint32_t& step, const float dt, OnEvent&& onEvent) const {
+    const auto count = static_cast<std::uint32_t>(ends_.size());
+    if (count == 0) return true;
+    if (step >= count) {
+      time = 0.0F;
+      step = 0;
+      FireEvents(step, onEvent);
+    }
+    time += dt;
+    if (mode_ != AnimationPlayMode::Once && time >= 2.0F * length_) {
+      time = std::fmod(time, length_);
+      step = static_cast<std::uint32_t>(std::upper_bound(ends_.begin(), ends_.end(), time) - ends_.begin());
+      step = std::min(step, count - 1);
+      return false;
+    }
+    while (time >= ends_[step]) {
+      if (step + 1 < count) {
+        ++step;
+      } else if (mode_ == AnimationPlayMode::Once) {
+        time = length_;
+        return true;
+      } else {
+        step = 0;
+        time -= length_;
+      }
+      FireEvents(step, onEvent);
+    }
+    return false;
+  }
+
+ private:
+  template <typename OnEvent>
+  void FireEvents(const std::uint32_t step, OnEvent& onEvent) const {
+    for (std::uint32_t e = event_offsets_[step]; e < event_offsets_[step + 1]; ++e) {
+      onEvent(event_names_[step_events_[e]]);
+    }
+  }
+
+  std::vector<octarine::Rect> rects_;
+  std::vector<float> ends_;
+  std::vector<std::uint32_t> event_offsets_;  // steps + 1 entries into step_events_
+  std::vector<std::uint32_t> step_events_;    // indices into event_names_
+  std::vector<std::string> event_names_;
+  float length_ = 0.0F;
+  AnimationPlayMode mode_ = AnimationPlayMode::Loop;
+};
@@ -0,0 +1,113 @@
+#include "AssetManager/AnimationClipStore.h"
+
+#include <sol/sol.hpp>
+
+#include "General/Logger.h"
+
+namespace {
+
+constexpr float kDefaultFps = 10.0F;
+
+// Source rect of zero-based cell `index` on the clip's frame grid, row-major. `columns` <= 0 is a
+// single row.
+octarine::Rect GridRect(const int index, const int columns, const float width, const float height) {
+  const int column = columns > 0 ? index % columns : index;
+  const int row = columns > 0 ? index / columns : 0;
+  return {static_cast<float>(column) * width, static_cast<float>(row) * height, width, height};
+}
+
+}  // namespace
+
+std::optional<AnimationClipDesc> AnimationClipStore::Parse(const std::string& source, const std::string& chunkName) {
+  sol::state lua;
+  lua.open_libraries(sol::lib::base);
+  sol::protected_function_result result = lua.safe_script(source, sol::script_pass_on_error, "@" + chunkName);
+  if (!result.valid()) {
+    const sol::error err = result;
+    Logger::Error("AnimationClipStore: failed to load " + chunkName + ": " + err.what());
+    return std::nullopt;
+  }
+  if (result.return_count() == 0 || !result[0].is<sol::table>()) {
+    Logger::Error("AnimationClipStore: " + chunkName + " must return a table");
+    return std::nullopt;
+  }
+  const sol::table clip = result[0];
+
+  AnimationClipDesc desc;
+  const std::string mode = clip.get_or<std::string>("mode", "loop");
+  desc.mode = AnimationPlayModeFromString(mode);
+  if (ToString(desc.mode) != mode) Logger::Warn("AnimationClipStore: " + chunkName + ": unknown mode '" + mode + "'");
+  const float fps = clip.get_or("fps", kDefaultFps);
+  const float defaultDuration = fps > 0.0F ? 1.0F / fps : 1.0F / kDefaultFps;
+  const float frameWidth = clip.get_or("frame_width", 0.0F);
+  const float frameHeight = clip.get_or("frame_height", 0.0F);
+  const int columns = clip.get_or("columns", 0);
+
+  // Each frame is a grid index, { index = n, duration = s }, or an explicit { x, y, w, h, duration }.
+  const sol::optional<sol::table> frames = clip["frames"];
+  for (std::size_t i = 1; frames && i <= frames->size(); ++i) {
+    const sol::object value = (*frames)[i];
+    AnimationClipDesc::Frame frame;
+    frame.duration = defaultDuration;
+    if (value.is<int>()) {
+      frame.rect = GridRect(value.as<int>(), columns, frameWidth, frameHeight);
+    } else if (value.is<sol::table>()) {
+      const auto t = value.as<sol::table>();
+      if (const sol::optional<int> index = t["index"]; index) {
+        frame.rect = GridRect(*index, columns, frameWidth, frameHeight);
+      } else {
+        frame.rect = {t.get_or("x", 0.0F), t.get_or("y", 0.0F), t.get_or("w", frameWidth), t.get_or("h", frameHeight)};
+      }
+      frame.duration = t.get_or("duration", defaultDuration);
+    } else {
+      Logger::Warn("AnimationClipStore: " + chunkName + ": frame " + std::to_string(i) + " is not a number or table");
+      continue;
+    }
+    desc.frames.push_back(frame);
+  }
+  if (desc.frames.empty()) {
+    Logger::Error("AnimationClipStore: " + chunkName + " has no frames");
+    return std::nullopt;
+  }
+
+  // Events name a frame by its position in `frames`, counted from 1 like any Lua list.
+  if (const sol::optional<sol::table> events = clip["events"]; events) {
+    for (std::size_t i = 1; i <= events->size(); ++i) {
+      const sol::optional<sol::table> event = (*events)[i];
+      if (!event) continue;
+      const int frame = event->get_or("frame", 0);
+      const std::string name = event->get_or<std::string>("name", "");
+      if (frame < 1 || static_cast<std::size_t>(frame) > desc.frames.size() || name.empty()) {
+        Logger::Warn("AnimationClipStore: " + chunkName + ": event " + std::to_string(i) +
+                     " needs a name and a frame between 1 and " + std::to_string(desc.frames.size()));
+        continue;
+      }
+      desc.events.push_back({static_cast<std::size_t>(frame - 1), name});
+    }
+  }
+  return desc;
+}
+
+const AnimationClip& AnimationClipStore::Add(const std::string& id, const AnimationClipDesc& desc) {
+  ++generation_;
+  auto [it, inserted] = clips_.insert_or_assign(id, AnimationClip(desc));
+  Logger::Info(std::string(inserted ? "Added" : "Replaced") + " animation clip: " + id + " (" +
+               std::to_string(it->second.Steps()) + " steps)");
+  return it->second;
+}
+
+const AnimationClip* AnimationClipStore::Get(const std::string& id) const {
+  const auto it = clips_.find(id);
+  return it == clips_.end() ? nullptr : &it->second;
+}
+
+bool AnimationClipStore::Remove(const std::string& id) {
+  if (clips_.erase(id) == 0) return false;
+  ++generation_;
+  return true;
+}
+
+void AnimationClipStore::Clear() {
+  if (!clips_.empty()) ++generation_;
+  clips_.clear();
+}
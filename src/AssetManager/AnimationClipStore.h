@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+#include "AssetManager/AnimationClip.h"
+
+// Owns the resident baked AnimationClips keyed by asset id, plus the generation counter
+// AnimationSystem polls to know when a cached clip pointer may have gone stale. Like the other
+// stores it knows nothing about the catalog or paks: AssetManager reads the `.anim` bytes and
+// hands them to Parse, then Adds the baked clip.
+class AnimationClipStore {
+ public:
+  AnimationClipStore() = default;
+  AnimationClipStore(const AnimationClipStore&) = delete;
+  AnimationClipStore& operator=(const AnimationClipStore&) = delete;
+  AnimationClipStore(AnimationClipStore&&) noexcept = default;
+  AnimationClipStore& operator=(AnimationClipStore&&) noexcept = default;
+
+  // Parse a `.anim` file's Lua source (see docs/asset-pipeline.md for the format) into its
+  // authoring form. Runs in a private Lua state, so clip files can't reach the game's globals.
+  // Nullopt, with the reason logged, on a script error or a clip without frames. `chunkName`
+  // names the file in error messages.
+  static std::optional<AnimationClipDesc> Parse(const std::string& source, const std::string& chunkName);
+
+  // Bake and store `desc` under `id`, replacing any prior clip, and bump the generation.
+  const AnimationClip& Add(const std::string& id, const AnimationClipDesc& desc);
+
+  [[nodiscard]] const AnimationClip* Get(const std::string& id) const;
+  [[nodiscard]] bool Contains(const std::string& id) const { return clips_.contains(id); }
+
+  // Erase the clip under `id`, bumping the generation. Returns whether an entry was removed.
+  bool Remove(const std::string& id);
+  void Clear();
+
+  [[nodiscard]] std::uint64_t Generation() const { return generation_; }
+  [[nodiscard]] const std::map<std::string, AnimationClip>& All() const { return clips_; }
+
+ private:
+  // std::map: a clip's address stays put while other clips come and go, so a pointer cached by an
+  // AnimationComponent is only stale when the generation says so.
+  std::map<std::string, AnimationClip> clips_;
+  std::uint64_t generation_{0};
+};
@@ -27,6 +27,7 @@ std::optional<AssetType> ClassifyByExtension(const fs::path& path) {
   if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp") return AssetType::Texture;
   if (ext == ".ttf" || ext == ".otf") return AssetType::Font;
   if (ext == ".wav" || ext == ".ogg" || ext == ".mp3" || ext == ".flac") return AssetType::Audio;
+  if (ext == ".anim") return AssetType::AnimationClip;
   return std::nullopt;
 }
 
@@ -42,6 +43,7 @@ std::optional<AssetType> ParseAssetType(const std::string& s) {
   if (s == "texture") return AssetType::Texture;
   if (s == "font") return AssetType::Font;
   if (s == "audio_clip") return AssetType::Audio;
+  if (s == "animation_clip") return AssetType::AnimationClip;
   return std::nullopt;
 }
 
@@ -99,6 +101,12 @@ AudioMeta ParseAudioMeta(const sol::table& t) {
   return meta;
 }
 
+AnimationClipMeta ParseAnimationClipMeta(const sol::table& t) {
+  AnimationClipMeta meta;
+  if (const sol::optional<std::string> id = t["id"]; id) meta.id = *id;
+  return meta;
+}
+
 // Load `<file>.meta` next to an asset, if present, into a Lua table. Returns nullopt when there
 // is no sidecar or it fails to produce a table (errors are logged and treated as "use defaults").
 std::optional<sol::table> LoadSidecar(sol::state& lua, const fs::path& assetPath) {
@@ -250,6 +258,16 @@ bool AssetCatalog::ScanFilesystem(const std::string& basePath, sol::state& lua,
         insert(std::move(entry));
         break;
       }
+      case AssetType::AnimationClip: {
+        AnimationClipMeta meta = sidecar ? ParseAnimationClipMeta(*sidecar) : AnimationClipMeta{};
+        meta.applyDefaults();
+        CatalogEntry entry;
+        entry.type = AssetType::AnimationClip;
+        entry.id = meta.id.value_or(stem);
+        entry.fullPath = fullPath;
+        insert(std::move(entry));
+        break;
+      }
     }
   }
 
@@ -343,6 +361,8 @@ bool AssetCatalog::LoadManifest(const std::string& manifestPath, sol::state& lua
         entry.stream = e["stream"].get_or(false);
         entry.normalize = e["normalize"].get_or(false);
         break;
+      case AssetType::AnimationClip:
+        break;  // nothing beyond type + file
     }
     entries_.emplace(std::move(id), std::move(entry));
   }
@@ -430,6 +450,8 @@ bool AssetCatalog::WriteManifest(const std::string& outPath, const std::string&
         out << ", stream = " << (entry.stream ? "true" : "false");
         out << ", normalize = " << (entry.normalize ? "true" : "false");
         break;
+      case AssetType::AnimationClip:
+        break;
     }
 
     out << " },\n";
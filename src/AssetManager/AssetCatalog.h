@@ -14,7 +14,7 @@ class state;
 
 class GameConfig;
 
-enum class AssetType { Texture, Font, Audio };
+enum class AssetType { Texture, Font, Audio, AnimationClip };
 
 inline const char* toAssetTypeString(AssetType type) {
   switch (type) {
@@ -24,6 +24,8 @@ inline const char* toAssetTypeString(AssetType type) {
       return "font";
     case AssetType::Audio:
       return "audio_clip";
+    case AssetType::AnimationClip:
+      return "animation_clip";
   }
   return "unknown";
 }
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+// Interned reference to an asset id: an index into AssetManager's dense handle table plus the
+// generation of the table that issued it. Components carry one next to their string id so hot
+// paths resolve with an array index instead of hashing the string every frame; the string stays
+// the authored name (Lua, inspectors, serialization). A default handle is invalid and a handle
+// from a cleared table fails the generation check; both make the consumer fall back to the id.
+struct AssetHandle {
+  static constexpr std::uint32_t kInvalidIndex = UINT32_MAX;
+
+  std::uint32_t index = kInvalidIndex;
+  std::uint32_t generation = 0;
+
+  [[nodiscard]] bool IsValid() const { return index != kInvalidIndex; }
+
+  friend bool operator==(const AssetHandle&, const AssetHandle&) = default;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <SDL3_mixer/SDL_mixer.h>
+#include <SDL3_ttf/SDL_ttf.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "AssetManager/AssetHandle.h"
+
+// What an interned id currently resolves to. The id names one asset, so only the field of its
+// type is set; the rest stay null.
+struct ResolvedAsset {
+  SDL_Texture* texture = nullptr;
+  SDL_FRect atlasOffset{};  // slice origin inside the atlas page; zero for a loose texture
+  TTF_Font* font = nullptr;
+  MIX_Audio* audio = nullptr;
+};
+
+// The dense table behind AssetHandle: one slot per interned id, holding the id and its resolved
+// store handles. Intern find-or-inserts (main thread — Lua component binds, scene loads); Refresh
+// re-resolves the slots through the caller's resolver when the stores' combined generation moves,
+// and resolves newly interned slots otherwise; Resolve is an index plus two compares and never
+// writes, so the parallel sprite emit may call it.
+//
+// Slots are never recycled: a project names a bounded set of ids (its catalog), so a handle stays
+// good for the table's lifetime. Clear drops every slot and bumps the table generation, which is
+// what makes handles issued before it miss instead of aliasing a new slot.
+class AssetHandleTable {
+ public:
+  // Handle for `id`, adding an unresolved slot the first time it is seen.
+  AssetHandle Intern(const std::string_view id) {
+    if (const auto it = index_.find(id); it != index_.end()) return {it->second, generation_};
+    const auto index = static_cast<std::uint32_t>(slots_.size());
+    slots_.push_back(Slot{std::string(id), ResolvedAsset{}, kUnresolved});
+    index_.emplace(slots_.back().id, index);
+    return {index, generation_};
+  }
+
+  // The slot behind `handle` when this table issued it and it was resolved at `storeGeneration`;
+  // nullptr for an invalid or foreign handle and for a slot the stores have moved past.
+  [[nodiscard]] const ResolvedAsset* Resolve(const AssetHandle handle, const std::uint64_t storeGeneration) const {
+    if (handle.generation != generation_ || handle.index >= slots_.size()) return nullptr;
+    const Slot& slot = slots_[handle.index];
+    return slot.resolvedAt == storeGeneration ? &slot.resolved : nullptr;
+  }
+
+  // The id `handle` was interned from; empty for a handle this table did not issue.
+  [[nodiscard]] std::string_view Id(const AssetHandle handle) const {
+    if (handle.generation != generation_ || handle.index >= slots_.size()) return {};
+    return slots_[handle.index].id;
+  }
+
+  // Bring every slot up to `storeGeneration`, calling `resolve(id, ResolvedAsset&)` on a cleared
+  // entry for each slot that is behind. All slots when the generation moved, otherwise only the
+  // ones interned since the last call — so the per-frame call is a compare when nothing changed.
+  template <typename Resolver>
+  void Refresh(const std::uint64_t storeGeneration, Resolver&& resolve) {
+    if (storeGeneration != refreshed_at_) {
+      refreshed_at_ = storeGeneration;
+      resolved_count_ = 0;
+    }
+    for (; resolved_count_ < slots_.size(); ++resolved_count_) {
+      Slot& slot = slots_[resolved_count_];
+      slot.resolved = ResolvedAsset{};
+      resolve(std::string_view(slot.id), slot.resolved);
+      slot.resolvedAt = storeGeneration;
+    }
+  }
+
+  void Clear() {
+    slots_.clear();
+    index_.clear();
+    resolved_count_ = 0;
+    ++generation_;
+  }
+
+  [[nodiscard]] std::size_t Size() const { return slots_.size(); }
+
+ private:
+  static constexpr std::uint64_t kUnresolved = UINT64_MAX;
+
+  struct Slot {
+    std::string id;
+    ResolvedAsset resolved;
+    std::uint64_t resolvedAt = kUnresolved;  // store generation `resolved` was taken at
+  };
+
+  std::vector<Slot> slots_;
+  std::map<std::string, std::uint32_t, std::less<>> index_;  // transparent: Intern looks up by string_view
+  std::size_t resolved_count_ = 0;                            // slots [0, n) are resolved at refreshed_at_
+  std::uint64_t refreshed_at_ = kUnresolved;
+  // Starts at 1 so a default AssetHandle (generation 0) never resolves.
+  std::uint32_t generation_ = 1;
+};
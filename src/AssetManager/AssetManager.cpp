@@ -1,6 +1,7 @@
 #include "AssetManager.h"
 
 #include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
 
 #include <filesystem>
 #include <set>
@@ -30,13 +31,56 @@ void AssetManager::LoadGameConfig(const GameConfig &config) {
   if (config.GetDefaultScaleMode().has_value()) {
     SetDefaultScaleMode(config.GetDefaultScaleMode().value());
   }
+  const EngineOptions &options = config.GetEngineOptions();
+  dynamic_atlas_.Configure(options.dynamicAtlas, static_cast<std::size_t>(options.dynamicAtlasBudgetMB) << 20);
 }
 
 void AssetManager::ClearAssets() {
   texture_store_.Clear();
+  dynamic_atlas_.Clear();
   font_store_.Clear();
   audio_store_.Clear();
+  animation_store_.Clear();
   refcounter_.Clear();
+  handles_.Clear();
+}
+
+AssetHandle AssetManager::Intern(const std::string_view assetId) {
+  const AssetHandle handle = handles_.Intern(assetId);
+  RefreshHandles();
+  return handle;
+}
+
+void AssetManager::RefreshHandles() {
+  handles_.Refresh(HandleGeneration(), [this](const std::string_view id, ResolvedAsset &resolved) {
+    const std::string key(id);
+    resolved.texture = GetTexture(key);
+    if (resolved.texture != nullptr) {
+      const auto slice = GetAtlasSlice(key);
+      resolved.atlasOffset = slice.has_value() ? *slice : SDL_FRect{0, 0, 0, 0};
+    }
+    resolved.font = font_store_.Get(key);
+    resolved.audio = audio_store_.Get(key);
+  });
+}
+
+ResolvedAsset AssetManager::ResolveTexture(const AssetHandle handle, const std::string &assetId) const {
+  if (const ResolvedAsset *resolved = Resolve(handle)) return *resolved;
+  ResolvedAsset resolved;
+  resolved.texture = GetTexture(assetId);
+  const auto slice = GetAtlasSlice(assetId);
+  resolved.atlasOffset = slice.has_value() ? *slice : SDL_FRect{0, 0, 0, 0};
+  return resolved;
+}
+
+TTF_Font *AssetManager::GetFont(const AssetHandle handle, const std::string &assetId) const {
+  if (const ResolvedAsset *resolved = Resolve(handle)) return resolved->font;
+  return GetFont(assetId);
+}
+
+MIX_Audio *AssetManager::GetAudioClip(const AssetHandle handle, const std::string &assetId) const {
+  if (const ResolvedAsset *resolved = Resolve(handle)) return resolved->audio;
+  return GetAudioClip(assetId);
 }
 
 // Recurses into Acquire(atlasId) when an atlas member is requested (one hop — atlases do not nest).
@@ -49,7 +93,8 @@ bool AssetManager::Acquire(const std::string &assetId, SDL_Renderer *renderer, M
   }
 
   // Already resident with no refcount (legacy load_asset path) — adopt at count 1.
-  if (texture_store_.Contains(assetId) || font_store_.Contains(assetId) || audio_store_.Contains(assetId)) {
+  if (texture_store_.Contains(assetId) || dynamic_atlas_.Contains(assetId) || font_store_.Contains(assetId) ||
+      audio_store_.Contains(assetId) || animation_store_.Contains(assetId)) {
     refcounter_.Adopt(assetId);
     return true;
   }
@@ -74,6 +119,12 @@ bool AssetManager::Acquire(const std::string &assetId, SDL_Renderer *renderer, M
     return true;
   }
 
+  // Released earlier but its dynamic-atlas slot is still cached: reuse the pixels, skip the load.
+  if (entry->type == AssetType::Texture && dynamic_atlas_.Revive(assetId)) {
+    refcounter_.Adopt(assetId);
+    return true;
+  }
+
   const bool loaded = LoadFromCatalog(*entry, assetId, renderer, mixer);
   if (loaded) refcounter_.Adopt(assetId);
   return loaded;
@@ -83,15 +134,13 @@ bool AssetManager::LoadFromCatalog(const CatalogEntry &entry, const std::string
                                    MIX_Mixer *mixer) {
   switch (entry.type) {
     case AssetType::Texture: {
-      AddTexture(renderer, assetId, entry.fullPath);
-      // Per-asset scale mode from the catalog overrides the project default applied in AddTexture.
+      // Per-asset scale mode from the catalog overrides the project default.
+      std::optional<SDL_ScaleMode> scaleMode;
       if (entry.scaleMode.has_value()) {
-        if (SDL_Texture *texture = texture_store_.Get(assetId)) {
-          SDL_SetTextureScaleMode(texture,
-                                  *entry.scaleMode == ScaleMode::Linear ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_NEAREST);
-        }
+        scaleMode = *entry.scaleMode == ScaleMode::Linear ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_NEAREST;
       }
-      return texture_store_.Contains(assetId);
+      LoadTexture(renderer, assetId, entry.fullPath, scaleMode, !entry.noAtlas);
+      return texture_store_.Contains(assetId) || dynamic_atlas_.Contains(assetId);
     }
     case AssetType::Font:
       AddFont(assetId, entry.fullPath, entry.fontSize);
@@ -106,6 +155,9 @@ bool AssetManager::LoadFromCatalog(const CatalogEntry &entry, const std::string
       }
       AddAudioClip(mixer, assetId, entry.fullPath, entry.stream);
       return audio_store_.Contains(assetId);
+    case AssetType::AnimationClip:
+      LoadAnimationClip(assetId, entry.fullPath);
+      return animation_store_.Contains(assetId);
   }
   return false;
 }
@@ -131,8 +183,9 @@ bool AssetManager::Reload(const std::string &assetId, SDL_Renderer *renderer, MI
   }
   // Only refresh assets that are actually resident — nothing to reload otherwise, and we must
   // not pull in something no scene currently references.
-  const bool resident =
-      texture_store_.Contains(assetId) || font_store_.Contains(assetId) || audio_store_.Contains(assetId);
+  const bool resident = texture_store_.Contains(assetId) || dynamic_atlas_.Contains(assetId) ||
+                        font_store_.Contains(assetId) || audio_store_.Contains(assetId) ||
+                        animation_store_.Contains(assetId);
   if (!resident) return false;
 
   // Drop the live handle (refcount untouched), then re-run the catalog load so the new bytes on
@@ -158,13 +211,17 @@ int AssetManager::ReloadByPath(const std::string &absPath, SDL_Renderer *rendere
     if (entryPath == target) ids.push_back(id);
   }
   for (const auto &id : ids) {
-    if (Reload(id, renderer, mixer)) ++reloaded;
+    if (Reload(id, renderer, mixer)) {
+      ++reloaded;
+    } else {
+      dynamic_atlas_.Remove(id);  // released but cached in the atlas: never revive the old pixels
+    }
   }
   return reloaded;
 }
 
 std::vector<std::string> AssetManager::ResidentSourcePaths() const {
-  // Walk the three handle stores, map each resident id back to its catalog source file, and dedupe.
+  // Walk the handle stores, map each resident id back to its catalog source file, and dedupe.
   // One file can back several ids (atlas members share a backing texture), so a set collapses them;
   // ReloadByPath re-expands a path to every id it backs on reload.
   std::set<std::string> paths;
@@ -176,8 +233,14 @@ std::vector<std::string> AssetManager::ResidentSourcePaths() const {
     }
   };
   collect(texture_store_.All());
+  for (const std::string &id : dynamic_atlas_.LiveIds()) {
+    if (const CatalogEntry *entry = catalog_.Find(id); entry != nullptr && !entry->fullPath.empty()) {
+      paths.insert(entry->fullPath);
+    }
+  }
   collect(font_store_.All());
   collect(audio_store_.All());
+  collect(animation_store_.All());
   return {paths.begin(), paths.end()};
 }
 
@@ -198,12 +261,21 @@ void AssetManager::UnloadAsset(const std::string &assetId) {
     Logger::Info("Unloaded texture: " + assetId);
     return;
   }
+  // Dynamic-atlas slot: released but left cached on its page for a later re-acquire.
+  if (dynamic_atlas_.Release(assetId)) {
+    Logger::Info("Unloaded atlased texture: " + assetId);
+    return;
+  }
   if (font_store_.Remove(assetId)) {
     Logger::Info("Unloaded font: " + assetId);
     return;
   }
   if (audio_store_.Remove(assetId)) {
     Logger::Info("Unloaded audio clip: " + assetId);
+    return;
+  }
+  if (animation_store_.Remove(assetId)) {
+    Logger::Info("Unloaded animation clip: " + assetId);
   }
 }
 
@@ -243,6 +315,11 @@ int AssetManager::Validate(const std::vector<AssetReference> &refs) const {
 }
 
 void AssetManager::AddTexture(SDL_Renderer *renderer, const std::string &assetId, const std::string &path) {
+  LoadTexture(renderer, assetId, path, std::nullopt, true);
+}
+
+void AssetManager::LoadTexture(SDL_Renderer *renderer, const std::string &assetId, const std::string &path,
+                               const std::optional<SDL_ScaleMode> scaleMode, const bool allowAtlas) {
   const std::string fullPath = GetFullPath(path);
 
   // Route through OpenAssetIO so the same path resolves on desktop, an APK asset root, a .app
@@ -252,13 +329,41 @@ void AssetManager::AddTexture(SDL_Renderer *renderer, const std::string &assetId
     Logger::Error("Failed to open texture file " + fullPath + ": " + std::string(SDL_GetError()));
     return;
   }
-  texture_store_.Add(renderer, assetId, io, fullPath);
+
+  SDL_Texture *texture = nullptr;
+  if (allowAtlas && dynamic_atlas_.Enabled()) {
+    // Decode to a surface first so the atlas can copy it into a page; a texture it declines (too
+    // big, or no room within the budget) is uploaded loose from the same surface.
+    SDL_Surface *surface = IMG_Load_IO(io, true);  // closes the stream
+    if (!surface) {
+      Logger::Error("Failed to load texture " + fullPath + ": " + std::string(SDL_GetError()));
+      return;
+    }
+    const SDL_ScaleMode atlasScaleMode =
+        scaleMode.value_or(texture_store_.DefaultScaleMode().value_or(SDL_SCALEMODE_LINEAR));
+    if (dynamic_atlas_.Add(renderer, assetId, surface, atlasScaleMode)) {
+      SDL_DestroySurface(surface);
+      texture_store_.Remove(assetId);  // an earlier loose copy under the same id
+      Logger::Info("Added texture: " + assetId + " from path: " + fullPath + " (dynamic atlas)");
+      return;
+    }
+    texture = texture_store_.AddSurface(renderer, assetId, surface, fullPath);
+    SDL_DestroySurface(surface);
+  } else {
+    texture = texture_store_.Add(renderer, assetId, io, fullPath);
+  }
+  if (texture == nullptr) return;
+  dynamic_atlas_.Remove(assetId);  // a previous atlased copy under the same id
+  if (scaleMode.has_value()) SDL_SetTextureScaleMode(texture, *scaleMode);
 }
 
 SDL_Texture *AssetManager::GetTexture(const std::string &assetId) const {
   if (SDL_Texture *texture = texture_store_.Get(assetId)) {
     return texture;
   }
+  if (const DynamicTextureAtlas::Slice *slice = dynamic_atlas_.Find(assetId)) {
+    return slice->texture;
+  }
   // Atlas members are never inserted into the texture store directly — resolve the catalog redirect
   // to the backing atlas's SDL_Texture*. One-hop only (atlases do not nest).
   if (const CatalogEntry *e = catalog_.Find(assetId); e != nullptr && e->atlasId.has_value()) {
@@ -270,6 +375,9 @@ SDL_Texture *AssetManager::GetTexture(const std::string &assetId) const {
 }
 
 std::optional<SDL_FRect> AssetManager::GetAtlasSlice(const std::string &assetId) const {
+  if (const DynamicTextureAtlas::Slice *slice = dynamic_atlas_.Find(assetId)) {
+    return slice->rect;
+  }
   if (const CatalogEntry *e = catalog_.Find(assetId); e != nullptr) {
     return e->atlasSlice;
   }
@@ -326,6 +434,28 @@ void AssetManager::AddAudioClip(MIX_Mixer *mixer, const std::string &assetId, co
 
 MIX_Audio *AssetManager::GetAudioClip(const std::string &assetId) const { return audio_store_.Get(assetId); }
 
+void AssetManager::LoadAnimationClip(const std::string &assetId, const std::string &path) {
+  const std::string fullPath = GetFullPath(path);
+  SDL_IOStream *io = OpenAssetIO(fullPath);
+  if (!io) {
+    Logger::Error("Failed to open animation clip " + assetId + " from " + fullPath + ": " +
+                  std::string(SDL_GetError()));
+    return;
+  }
+  std::size_t size = 0;
+  void *bytes = SDL_LoadFile_IO(io, &size, true);  // closes the stream
+  if (bytes == nullptr) {
+    Logger::Error("Failed to read animation clip " + assetId + " from " + fullPath + ": " +
+                  std::string(SDL_GetError()));
+    return;
+  }
+  const std::string source(static_cast<const char *>(bytes), size);
+  SDL_free(bytes);
+  if (const std::optional<AnimationClipDesc> desc = AnimationClipStore::Parse(source, fullPath)) {
+    animation_store_.Add(assetId, *desc);
+  }
+}
+
 TTF_Font *AssetManager::GetFont(const std::string &assetId) const { return font_store_.Get(assetId); }
 
 std::string AssetManager::GetFullPath(const std::string &relativePath) const {
@@ -8,12 +8,17 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "AssetManager/AnimationClipStore.h"
 #include "AssetManager/AssetCatalog.h"
+#include "AssetManager/AssetHandle.h"
+#include "AssetManager/AssetHandleTable.h"
 #include "AssetManager/AssetRefcounter.h"
 #include "AssetManager/AssetReference.h"
 #include "AssetManager/AudioClipStore.h"
+#include "AssetManager/DynamicTextureAtlas.h"
 #include "AssetManager/FontStore.h"
 #include "AssetManager/TextureStore.h"
 
@@ -21,24 +26,31 @@ class AssetPak;
 class GameConfig;
 class GlyphAtlas;
 
-// Composes the asset subsystem: the AssetCatalog (what exists + how to load it), three typed handle
-// stores (TextureStore / FontStore / AudioClipStore — the resident SDL/TTF/MIX handles), and an
-// AssetRefcounter (acquire counts). AssetManager itself owns only the cross-cutting concerns the
-// pieces can't: the project base path, the optional shipped-bundle pak, IO resolution, and the
-// Acquire/Release orchestration that ties refcounts to catalog-driven loads. Public API is
-// unchanged from the pre-split monolith — consumers see the same surface.
+// Composes the asset subsystem: the AssetCatalog (what exists + how to load it), the typed handle
+// stores (TextureStore / FontStore / AudioClipStore — the resident SDL/TTF/MIX handles — plus
+// AnimationClipStore's baked clips), and an AssetRefcounter (acquire counts). AssetManager itself
+// owns only the cross-cutting concerns the pieces can't: the project base path, the optional
+// shipped-bundle pak, IO resolution, and the Acquire/Release orchestration that ties refcounts to
+// catalog-driven loads. Public API is unchanged from the pre-split monolith — consumers see the
+// same surface.
 class AssetManager {
   std::string base_path_;
   // Index of every discoverable asset (id -> file + metadata). Loads nothing on its own; Acquire
   // consults it to load on demand.
   AssetCatalog catalog_;
   TextureStore texture_store_;
+  // Opt-in runtime atlas (config.ini DynamicAtlas=) that small loose textures are packed into on
+  // load instead of getting their own SDL_Texture. Resolved like a baked atlas member.
+  DynamicTextureAtlas dynamic_atlas_;
   FontStore font_store_;
   AudioClipStore audio_store_;
+  AnimationClipStore animation_store_;
   // Per-id acquire count. The 0 -> 1 transition loads the underlying handle; the N -> 0 transition
   // unloads it. Assets loaded via the legacy load_asset path are adopted at refcount 1 on first
   // Acquire.
   AssetRefcounter refcounter_;
+  // Interned ids behind the AssetHandles components carry, each with its resolved store handles.
+  AssetHandleTable handles_;
   // Optional shipped-bundle archive (Stage 14 / B4). When set, AssetManager prefers reading each
   // asset's bytes from the pak over the loose file at `fullPath`. Non-owning — the Registry owns
   // the AssetPak instance.
@@ -102,10 +114,11 @@ class AssetManager {
   // Resolves to the SDL_Texture under `assetId`. For atlas-member ids this walks the catalog to
   // the backing atlas (whose SDL_Texture* lives in the texture store) — members themselves never
   // appear in the store, which is what lets one atlas keep one SDL handle even with N member ids.
+  // Textures packed into the dynamic atlas resolve to their page the same way.
   [[nodiscard]] SDL_Texture* GetTexture(const std::string& assetId) const;
-  // Pixel-rect of `assetId` within its atlas, when `assetId` is an atlas member. Nullopt for
-  // loose textures and non-textures. Sprite render adds slice.x/y to the sprite's logical
-  // src_rect to compose the final source rect into the atlas.
+  // Pixel-rect of `assetId` within its atlas, when `assetId` is an atlas member or was packed into
+  // the dynamic atlas. Nullopt for loose textures and non-textures. Sprite render adds slice.x/y to
+  // the sprite's logical src_rect to compose the final source rect into the atlas.
   [[nodiscard]] std::optional<SDL_FRect> GetAtlasSlice(const std::string& assetId) const;
   void AddFont(const std::string& assetId, const std::string& path, float fontSize);
   // Register a font from an in-memory TTF buffer (e.g. the embedded debug font) rather than a
@@ -119,9 +132,46 @@ class AssetManager {
   // = decode-as-played, keeps the loading footprint flat at the cost of a touch more per-play cost).
   void AddAudioClip(MIX_Mixer* mixer, const std::string& assetId, const std::string& path, bool stream = false);
   [[nodiscard]] MIX_Audio* GetAudioClip(const std::string& assetId) const;
+  // Baked clip under `assetId`, or nullptr when it isn't resident. The pointer stays valid until
+  // AnimationClipGeneration() next changes (a clip loaded, reloaded or dropped).
+  [[nodiscard]] const AnimationClip* GetAnimationClip(const std::string& assetId) const {
+    return animation_store_.Get(assetId);
+  }
+  [[nodiscard]] std::uint64_t AnimationClipGeneration() const { return animation_store_.Generation(); }
   [[nodiscard]] std::string GetFullPath(const std::string& relativePath) const;
   void SetDefaultScaleMode(const std::string& scaleMode);
-  [[nodiscard]] std::uint64_t TextureGeneration() const { return texture_store_.Generation(); }
+  // Changes whenever a texture handle or an atlas slice may have: both counters only grow, so
+  // their sum moves whenever either does.
+  [[nodiscard]] std::uint64_t TextureGeneration() const {
+    return texture_store_.Generation() + dynamic_atlas_.Generation();
+  }
+  [[nodiscard]] const DynamicTextureAtlas& GetDynamicAtlas() const { return dynamic_atlas_; }
+
+  // Interned handles (see AssetHandle.h). Intern is find-or-insert and may run before the asset is
+  // resident: the slot resolves on the next RefreshHandles and follows later loads, reloads and
+  // unloads. Main thread only, like every other mutation here.
+  AssetHandle Intern(std::string_view assetId);
+  // Re-resolve the interned slots when any store changed since the last call, and resolve the ones
+  // interned since. A compare when nothing moved; FrameLoop calls it before the systems run and
+  // RenderSpriteSystem again before its parallel emit.
+  void RefreshHandles();
+  // Sum of the texture, atlas, font and audio store generations — moves whenever any resolved
+  // handle might have.
+  [[nodiscard]] std::uint64_t HandleGeneration() const {
+    return TextureGeneration() + font_store_.Generation() + audio_store_.Generation();
+  }
+  // The slot behind `handle`, or nullptr when it is invalid, from a cleared table, or stale (a
+  // store changed since the last RefreshHandles). Read-only: safe from parallel emit.
+  [[nodiscard]] const ResolvedAsset* Resolve(const AssetHandle handle) const {
+    return handles_.Resolve(handle, HandleGeneration());
+  }
+  [[nodiscard]] std::string_view HandleId(const AssetHandle handle) const { return handles_.Id(handle); }
+  // Handle-first lookups for components carrying both: through the table when the handle resolves,
+  // else by `assetId` (a component built without interning, or a store change this frame). The
+  // texture variant returns the atlas slice origin alongside, as the sprite emit needs both.
+  [[nodiscard]] ResolvedAsset ResolveTexture(AssetHandle handle, const std::string& assetId) const;
+  [[nodiscard]] TTF_Font* GetFont(AssetHandle handle, const std::string& assetId) const;
+  [[nodiscard]] MIX_Audio* GetAudioClip(AssetHandle handle, const std::string& assetId) const;
 
   [[nodiscard]] AssetCatalog& GetCatalog() { return catalog_; }
   [[nodiscard]] const AssetCatalog& GetCatalog() const { return catalog_; }
@@ -150,6 +200,14 @@ class AssetManager {
   // where no pak has been baked yet.
   [[nodiscard]] SDL_IOStream* OpenAssetIO(const std::string& fullPath) const;
 
+  // AddTexture with the catalog's per-asset scale mode (nullopt = project default) and whether the
+  // texture may go into the dynamic atlas (false for `no_atlas` sidecars).
+  void LoadTexture(SDL_Renderer* renderer, const std::string& assetId, const std::string& path,
+                   std::optional<SDL_ScaleMode> scaleMode, bool allowAtlas);
+
+  // Read, parse and bake a `.anim` clip into the animation store.
+  void LoadAnimationClip(const std::string& assetId, const std::string& path);
+
   // Perform the actual SDL/MIX load for a catalog entry (no refcount bookkeeping). Returns whether
   // the handle is resident afterwards.
   bool LoadFromCatalog(const CatalogEntry& entry, const std::string& assetId, SDL_Renderer* renderer, MIX_Mixer* mixer);
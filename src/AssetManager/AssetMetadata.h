@@ -54,3 +54,9 @@ struct AudioMeta {
 
   void applyDefaults() {}  // `stream`/`normalize` already carry their defaults
 };
+
+struct AnimationClipMeta {
+  std::optional<std::string> id;  // override the derived id (filename stem)
+
+  void applyDefaults() {}
+};
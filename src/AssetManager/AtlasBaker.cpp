@@ -45,7 +45,7 @@ bool AtlasBaker::Bake(TTF_Font* font, float fontSize, const std::vector<std::uin
     int minx = 0, maxx = 0, miny = 0, maxy = 0, advance = 0;
     if (!TTF_GetGlyphMetrics(font, cp, &minx, &maxx, &miny, &maxy, &advance)) {
       // Glyph not in the face; skip rather than fail — caller's codepoint list might be
-      // over-broad. Whoever later renders an unknown codepoint will hit the TTF fallback.
+      // over-broad. Whoever later renders an unknown codepoint gets it from the runtime GlyphCache.
       continue;
     }
     SDL_Surface* surf = TTF_RenderGlyph_Blended(font, cp, kWhite);
@@ -116,6 +116,23 @@ bool AtlasBaker::Bake(TTF_Font* font, float fontSize, const std::vector<std::uin
         << ", advance=" << g.advance << ", minx=" << g.minx << ", miny=" << g.miny << " },\n";
   }
   lua << "  },\n";
+  // Pair kerning between baked glyphs, non-zero pairs only (most faces kern a few hundred pairs
+  // at most). Keyed [previous][codepoint] so the loader can walk it as nested tables.
+  lua << "  kerning = {\n";
+  for (const auto& prev : staged) {
+    bool open = false;
+    for (const auto& g : staged) {
+      int kerning = 0;
+      if (!TTF_GetGlyphKerning(font, prev.cp, g.cp, &kerning) || kerning == 0) continue;
+      if (!open) {
+        lua << "    [" << prev.cp << "] = {";
+        open = true;
+      }
+      lua << " [" << g.cp << "]=" << kerning << ",";
+    }
+    if (open) lua << " },\n";
+  }
+  lua << "  },\n";
   lua << "}\n";
   if (!lua) {
     Logger::Error("AtlasBaker::Bake: write error on " + outLuaPath);
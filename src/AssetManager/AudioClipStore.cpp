@@ -20,6 +20,7 @@ MIX_Audio* AudioClipStore::Add(MIX_Mixer* mixer, const std::string& id, SDL_IOSt
   } else {
     audio_clips_.emplace(id, clip);
   }
+  ++generation_;
 
   Logger::Info("Added audio clip: " + id + " from path: " + logPath);
   return clip;
@@ -35,6 +36,7 @@ bool AudioClipStore::Remove(const std::string& id) {
   if (it == audio_clips_.end()) return false;
   MIX_DestroyAudio(it->second);
   audio_clips_.erase(it);
+  ++generation_;
   return true;
 }
 
@@ -42,5 +44,6 @@ void AudioClipStore::Clear() {
   for (const auto& [id, clip] : audio_clips_) {
     MIX_DestroyAudio(clip);
   }
+  if (!audio_clips_.empty()) ++generation_;
   audio_clips_.clear();
 }
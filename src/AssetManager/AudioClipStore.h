@@ -3,6 +3,7 @@
 #include <SDL3/SDL.h>
 #include <SDL3_mixer/SDL_mixer.h>
 
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -30,8 +31,11 @@ class AudioClipStore {
   bool Remove(const std::string& id);
   void Clear();
 
+  // Bumped whenever a clip is added, replaced or removed (see FontStore::Generation).
+  [[nodiscard]] std::uint64_t Generation() const { return generation_; }
   [[nodiscard]] const std::map<std::string, MIX_Audio*>& All() const { return audio_clips_; }
 
  private:
   std::map<std::string, MIX_Audio*> audio_clips_;
+  std::uint64_t generation_{0};
 };
@@ -0,0 +1,228 @@
+#include "AssetManager/DynamicTextureAtlas.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "General/Logger.h"
+
+void DynamicTextureAtlas::Configure(const bool enabled, const std::size_t budgetBytes, const int pageSize) {
+  enabled_ = enabled;
+  budget_bytes_ = budgetBytes;
+  if (pages_.empty()) {
+    page_size_ = std::max(kMaxEntrySize + 2 * kPaddingPx, pageSize);
+    page_size_clamped_ = false;
+  }
+}
+
+bool DynamicTextureAtlas::Add(SDL_Renderer* renderer, const std::string& id, SDL_Surface* surface,
+                              const SDL_ScaleMode scaleMode) {
+  if (!enabled_ || renderer == nullptr || surface == nullptr) return false;
+  const int w = surface->w;
+  const int h = surface->h;
+  if (w <= 0 || h <= 0 || w > kMaxEntrySize || h > kMaxEntrySize) return false;
+
+  if (!page_size_clamped_) {
+    const auto maxSize = static_cast<int>(SDL_GetNumberProperty(
+        SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0));
+    if (maxSize > 0) page_size_ = std::min(page_size_, maxSize);
+    page_size_clamped_ = true;
+  }
+
+  if (const auto it = entries_.find(id); it != entries_.end()) DropEntry(it);
+
+  SDL_Surface* rgba = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+  if (rgba == nullptr) {
+    Logger::Warn("DynamicTextureAtlas: cannot convert '" + id + "': " + std::string(SDL_GetError()));
+    return false;
+  }
+  const int paddedW = w + 2 * kPaddingPx;
+  const int paddedH = h + 2 * kPaddingPx;
+  const std::size_t pagesBefore = pages_.size();
+  SkylinePacker::Spot spot;
+  Page* page = FindRoom(renderer, paddedW, paddedH, scaleMode, spot);
+  if (page == nullptr) {
+    SDL_DestroySurface(rgba);
+    return false;
+  }
+
+  // Extrude the edge pixels into the padding so filtering at the slice border reads the texture's
+  // own edge instead of whatever sits next to it on the page.
+  std::vector<Uint32> pixels(static_cast<size_t>(paddedW) * static_cast<size_t>(paddedH));
+  const auto* source = static_cast<const unsigned char*>(rgba->pixels);
+  for (int y = 0; y < paddedH; ++y) {
+    const int sy = std::clamp(y - kPaddingPx, 0, h - 1);
+    const unsigned char* row = source + static_cast<std::ptrdiff_t>(sy) * rgba->pitch;
+    for (int x = 0; x < paddedW; ++x) {
+      const int sx = std::clamp(x - kPaddingPx, 0, w - 1);
+      std::memcpy(&pixels[static_cast<size_t>(y) * static_cast<size_t>(paddedW) + static_cast<size_t>(x)],
+                  row + static_cast<std::ptrdiff_t>(sx) * 4, sizeof(Uint32));
+    }
+  }
+  SDL_DestroySurface(rgba);
+  // The spot is only placed once the copy lands, so a failed upload leaves the packer as it was;
+  // a page created for this texture alone is destroyed rather than left resident and empty.
+  const SDL_Rect region{spot.at.x, spot.at.y, paddedW, paddedH};
+  if (!SDL_UpdateTexture(page->texture, &region, pixels.data(), paddedW * static_cast<int>(sizeof(Uint32)))) {
+    Logger::Error("DynamicTextureAtlas: SDL_UpdateTexture failed for '" + id + "': " + std::string(SDL_GetError()));
+    if (pages_.size() > pagesBefore) {
+      SDL_DestroyTexture(pages_.back().texture);
+      pages_.pop_back();
+    }
+    return false;
+  }
+  const SkylinePacker::Point at = page->packer.Place(spot);
+
+  Entry entry;
+  entry.slice.texture = page->texture;
+  entry.slice.rect = {static_cast<float>(at.x + kPaddingPx), static_cast<float>(at.y + kPaddingPx),
+                      static_cast<float>(w), static_cast<float>(h)};
+  entry.page = static_cast<size_t>(page - pages_.data());
+  entry.live = true;
+  entries_[id] = entry;
+  ++page->liveEntries;
+  page->lastUsed = ++tick_;
+  ++stats_.packs;
+  ++generation_;
+  return true;
+}
+
+DynamicTextureAtlas::Page* DynamicTextureAtlas::FindRoom(SDL_Renderer* renderer, const int w, const int h,
+                                                         const SDL_ScaleMode scaleMode, SkylinePacker::Spot& spot) {
+  for (Page& page : pages_) {
+    if (page.texture == nullptr || page.scaleMode != scaleMode) continue;
+    if (const auto found = page.packer.Find(w, h)) {
+      spot = *found;
+      return &page;
+    }
+  }
+
+  // Grow while the budget allows: drained pages stay resident as a revival cache until then.
+  if ((pages_.size() + 1) * PageBytes() <= budget_bytes_) {
+    if (Page* page = CreatePage(renderer, scaleMode)) {
+      if (const auto found = page->packer.Find(w, h)) {
+        spot = *found;
+        return page;
+      }
+    }
+    return nullptr;
+  }
+
+  size_t victim = pages_.size();
+  std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+  for (size_t i = 0; i < pages_.size(); ++i) {
+    if (pages_[i].liveEntries == 0 && pages_[i].lastUsed < oldest) {
+      victim = i;
+      oldest = pages_[i].lastUsed;
+    }
+  }
+  if (victim == pages_.size()) return nullptr;
+  RecyclePage(victim);
+  Page& page = pages_[victim];
+  page.scaleMode = scaleMode;
+  SDL_SetTextureScaleMode(page.texture, scaleMode);
+  ++stats_.evictions;
+  if (const auto found = page.packer.Find(w, h)) {
+    spot = *found;
+    return &page;
+  }
+  return nullptr;
+}
+
+DynamicTextureAtlas::Page* DynamicTextureAtlas::CreatePage(SDL_Renderer* renderer, const SDL_ScaleMode scaleMode) {
+  SDL_Texture* texture =
+      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, page_size_, page_size_);
+  if (texture == nullptr) {
+    Logger::Error("DynamicTextureAtlas: cannot create a " + std::to_string(page_size_) +
+                  "px page: " + std::string(SDL_GetError()));
+    return nullptr;
+  }
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  SDL_SetTextureScaleMode(texture, scaleMode);
+  Page& page = pages_.emplace_back();
+  page.texture = texture;
+  page.packer = SkylinePacker(page_size_, page_size_);
+  page.scaleMode = scaleMode;
+  Logger::Info("DynamicTextureAtlas: page " + std::to_string(pages_.size()) + " created (" +
+               std::to_string(page_size_) + "px).");
+  return &page;
+}
+
+void DynamicTextureAtlas::RecyclePage(const std::size_t index) {
+  std::erase_if(entries_, [index](const auto& item) { return item.second.page == index; });
+  pages_[index].packer.Reset();
+  ++generation_;
+}
+
+bool DynamicTextureAtlas::Revive(const std::string& id) {
+  const auto it = entries_.find(id);
+  if (it == entries_.end()) return false;
+  Entry& entry = it->second;
+  Page& page = pages_[entry.page];
+  if (!entry.live) {
+    entry.live = true;
+    ++page.liveEntries;
+    ++stats_.revivals;
+    ++generation_;
+  }
+  page.lastUsed = ++tick_;
+  return true;
+}
+
+bool DynamicTextureAtlas::Release(const std::string& id) {
+  const auto it = entries_.find(id);
+  if (it == entries_.end() || !it->second.live) return false;
+  it->second.live = false;
+  --pages_[it->second.page].liveEntries;
+  ++generation_;
+  return true;
+}
+
+bool DynamicTextureAtlas::Remove(const std::string& id) {
+  const auto it = entries_.find(id);
+  if (it == entries_.end()) return false;
+  DropEntry(it);
+  return true;
+}
+
+void DynamicTextureAtlas::DropEntry(const std::unordered_map<std::string, Entry>::iterator it) {
+  if (it->second.live) --pages_[it->second.page].liveEntries;
+  entries_.erase(it);
+  ++generation_;
+}
+
+void DynamicTextureAtlas::Clear() {
+  if (pages_.empty() && entries_.empty()) return;
+  for (const Page& page : pages_) {
+    if (page.texture != nullptr) SDL_DestroyTexture(page.texture);
+  }
+  pages_.clear();
+  entries_.clear();
+  ++generation_;
+}
+
+const DynamicTextureAtlas::Slice* DynamicTextureAtlas::Find(const std::string& id) const {
+  const auto it = entries_.find(id);
+  return it != entries_.end() && it->second.live ? &it->second.slice : nullptr;
+}
+
+std::vector<std::string> DynamicTextureAtlas::LiveIds() const {
+  std::vector<std::string> ids;
+  for (const auto& [id, entry] : entries_) {
+    if (entry.live) ids.push_back(id);
+  }
+  return ids;
+}
+
+DynamicTextureAtlas::Stats DynamicTextureAtlas::GetStats() const {
+  Stats stats = stats_;
+  stats.pages = pages_.size();
+  stats.residentBytes = pages_.size() * PageBytes();
+  stats.liveEntries = 0;
+  for (const Page& page : pages_) stats.liveEntries += page.liveEntries;
+  return stats;
+}
+
+std::size_t DynamicTextureAtlas::PageBytes() const {
+  return static_cast<std::size_t>(page_size_) * static_cast<std::size_t>(page_size_) * sizeof(Uint32);
+}
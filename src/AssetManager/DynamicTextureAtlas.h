@@ -0,0 +1,121 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "AssetManager/SkylinePacker.h"
+
+// Runtime counterpart of TextureAtlasBaker: packs small loose textures into a few large page
+// textures as they load, so sprites drawn from different source images share one SDL_Texture
+// (and one RenderKey batch hash) and stop breaking SpriteBatcher runs. AssetManager routes an
+// eligible texture here instead of TextureStore and resolves it the same way it resolves a baked
+// atlas member: GetTexture returns the page, GetAtlasSlice the texture's rect inside it.
+//
+// Pages are packed online with SkylinePacker; each entry carries kPaddingPx of extruded edge
+// pixels so linear filtering never samples a neighbour. Pages only hold textures of one scale
+// mode (it is per-SDL_Texture). Releasing a texture keeps its pixels resident: a re-acquire of the
+// same id revives it without touching disk. Pages whose textures have all been released are the
+// eviction candidates, least recently used first, whenever a new page would exceed the memory
+// budget; pages holding live textures are never evicted, so a texture that finds no room stays
+// loose. Space freed by a release is only reclaimed once its whole page drains.
+//
+// Owns its SDL handles, like TextureStore. Not thread-safe; AssetManager calls it from the main
+// thread.
+class DynamicTextureAtlas {
+ public:
+  static constexpr int kDefaultPageSize = 2048;
+  // Textures wider or taller than this stay loose: large images gain little from sharing a page
+  // and would fragment it.
+  static constexpr int kMaxEntrySize = 256;
+  static constexpr int kPaddingPx = 1;
+  static constexpr std::size_t kDefaultBudgetBytes = std::size_t{64} << 20;  // four 2048^2 pages
+
+  struct Slice {
+    SDL_Texture* texture = nullptr;
+    SDL_FRect rect{};
+  };
+
+  struct Stats {
+    std::size_t pages = 0;
+    std::size_t liveEntries = 0;
+    std::size_t residentBytes = 0;  // page textures, 4 bytes per texel
+    std::uint64_t packs = 0;        // textures copied into a page
+    std::uint64_t revivals = 0;     // released textures re-acquired from their cached pixels
+    std::uint64_t evictions = 0;    // pages recycled or destroyed to stay under the budget
+  };
+
+  DynamicTextureAtlas() = default;
+  DynamicTextureAtlas(const DynamicTextureAtlas&) = delete;
+  DynamicTextureAtlas& operator=(const DynamicTextureAtlas&) = delete;
+  DynamicTextureAtlas(DynamicTextureAtlas&&) noexcept = default;
+  DynamicTextureAtlas& operator=(DynamicTextureAtlas&&) noexcept = default;
+  ~DynamicTextureAtlas() { Clear(); }
+
+  // Off by default (config.ini DynamicAtlas=). Disabling only stops new packs; resident entries
+  // keep resolving until released. `pageSize` is clamped to the renderer's maximum on first use.
+  void Configure(bool enabled, std::size_t budgetBytes, int pageSize = kDefaultPageSize);
+  [[nodiscard]] bool Enabled() const { return enabled_; }
+
+  // Copy `surface` into a page under `id` (replacing any previous entry for it). False when the
+  // atlas is off, the surface is too large, or no page has room within the budget — the caller
+  // then keeps the texture loose. The surface stays owned by the caller.
+  bool Add(SDL_Renderer* renderer, const std::string& id, SDL_Surface* surface, SDL_ScaleMode scaleMode);
+
+  // Make a released entry live again if its page is still resident.
+  bool Revive(const std::string& id);
+  // Mark a live entry released (its pixels stay cached until the page is evicted).
+  bool Release(const std::string& id);
+  // Drop an entry outright, live or released — its pixels will never be revived (hot reload).
+  bool Remove(const std::string& id);
+  void Clear();
+
+  // The live entry for `id`, or nullptr.
+  [[nodiscard]] const Slice* Find(const std::string& id) const;
+  [[nodiscard]] bool Contains(const std::string& id) const { return Find(id) != nullptr; }
+  [[nodiscard]] std::vector<std::string> LiveIds() const;
+
+  // Bumped whenever an entry is added, revived, released or removed; folded into
+  // AssetManager::TextureGeneration so cached page pointers and slices re-resolve.
+  [[nodiscard]] std::uint64_t Generation() const { return generation_; }
+  [[nodiscard]] Stats GetStats() const;
+
+ private:
+  struct Page {
+    SDL_Texture* texture = nullptr;
+    SkylinePacker packer;
+    SDL_ScaleMode scaleMode = SDL_SCALEMODE_LINEAR;
+    std::size_t liveEntries = 0;
+    std::uint64_t lastUsed = 0;
+  };
+
+  struct Entry {
+    Slice slice;
+    std::size_t page = 0;
+    bool live = false;
+  };
+
+  // A page of `scaleMode` with room for a w x h rect: an existing one, a new one within the
+  // budget, or the least recently used drained page recycled. Writes the unplaced spot to `spot`;
+  // Add places it once the pixels are on the page.
+  Page* FindRoom(SDL_Renderer* renderer, int w, int h, SDL_ScaleMode scaleMode, SkylinePacker::Spot& spot);
+  Page* CreatePage(SDL_Renderer* renderer, SDL_ScaleMode scaleMode);
+  // Forget every entry on page `index` (all released) and empty its packer.
+  void RecyclePage(std::size_t index);
+  void DropEntry(std::unordered_map<std::string, Entry>::iterator it);
+  [[nodiscard]] std::size_t PageBytes() const;
+
+  bool enabled_ = false;
+  std::size_t budget_bytes_ = kDefaultBudgetBytes;
+  int page_size_ = kDefaultPageSize;
+  bool page_size_clamped_ = false;
+  std::vector<Page> pages_;
+  std::unordered_map<std::string, Entry> entries_;
+  std::uint64_t tick_ = 0;
+  std::uint64_t generation_ = 0;
+  Stats stats_;
+};
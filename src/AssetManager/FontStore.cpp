@@ -27,6 +27,7 @@ TTF_Font* FontStore::Add(const std::string& id, SDL_IOStream* io, const float fo
   } else {
     fonts_.emplace(id, font);
   }
+  ++generation_;
 
   Logger::Info("Added font: " + id);
 
@@ -61,6 +62,7 @@ bool FontStore::Remove(const std::string& id) {
   if (it == fonts_.end()) return false;
   TTF_CloseFont(it->second);
   fonts_.erase(it);
+  ++generation_;
   return true;
 }
 
@@ -68,5 +70,6 @@ void FontStore::Clear() {
   for (const auto& [id, font] : fonts_) {
     TTF_CloseFont(font);
   }
+  if (!fonts_.empty()) ++generation_;
   fonts_.clear();
 }
@@ -3,6 +3,7 @@
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -12,7 +13,7 @@ class GlyphAtlas;
 // Owns the resident TTF_Font* handles keyed by asset id, plus the per-font glyph atlases probed
 // alongside them. Like TextureStore it is pak-agnostic: AssetManager opens the font's IO stream and
 // passes it in, along with the project base path used to probe for an `atlases/<id>.atlas.{png,lua}`
-// sidecar pair (the glyph-atlas opt-in consumed by RenderTextSystem's compose path).
+// sidecar pair (the glyph-atlas opt-in consumed by RenderTextSystem's glyph-quad path).
 class FontStore {
  public:
   FontStore();
@@ -42,6 +43,9 @@ class FontStore {
   // ClearAssets, which only cleared the font handles); they are freed when the store is destroyed.
   void Clear();
 
+  // Bumped whenever a font is added, replaced or removed, so AssetManager's interned handles know
+  // to re-resolve their TTF_Font*.
+  [[nodiscard]] std::uint64_t Generation() const { return generation_; }
   [[nodiscard]] const std::map<std::string, TTF_Font*>& All() const { return fonts_; }
 
  private:
@@ -50,4 +54,5 @@ class FontStore {
   // GlyphAtlas pinned across the map's rehashes (its surface wraps a vector<uint8_t> that must not
   // move underneath SDL).
   std::map<std::string, std::unique_ptr<GlyphAtlas>> glyph_atlases_;
+  std::uint64_t generation_{0};
 };
@@ -12,28 +12,34 @@
 GlyphAtlas::GlyphAtlas(GlyphAtlas&& other) noexcept
     : pixels_(std::move(other.pixels_)),
       source_surface_(other.source_surface_),
-      glyphs_(std::move(other.glyphs_)),
-      line_skip_(other.line_skip_),
+      texture_(other.texture_),
+      texture_failed_(other.texture_failed_),
+      metrics_(std::move(other.metrics_)),
       atlas_width_(other.atlas_width_),
       atlas_height_(other.atlas_height_) {
   other.source_surface_ = nullptr;
+  other.texture_ = nullptr;
 }
 
 GlyphAtlas& GlyphAtlas::operator=(GlyphAtlas&& other) noexcept {
   if (this != &other) {
+    if (texture_ != nullptr) SDL_DestroyTexture(texture_);
     if (source_surface_ != nullptr) SDL_DestroySurface(source_surface_);
     pixels_ = std::move(other.pixels_);
     source_surface_ = other.source_surface_;
-    glyphs_ = std::move(other.glyphs_);
-    line_skip_ = other.line_skip_;
+    texture_ = other.texture_;
+    texture_failed_ = other.texture_failed_;
+    metrics_ = std::move(other.metrics_);
     atlas_width_ = other.atlas_width_;
     atlas_height_ = other.atlas_height_;
     other.source_surface_ = nullptr;
+    other.texture_ = nullptr;
   }
   return *this;
 }
 
 GlyphAtlas::~GlyphAtlas() {
+  if (texture_ != nullptr) SDL_DestroyTexture(texture_);
   if (source_surface_ != nullptr) SDL_DestroySurface(source_surface_);
 }
 
@@ -87,9 +93,9 @@ bool GlyphAtlas::Load(const std::string& pngFullPath, const std::string& luaFull
     return false;
   }
   const sol::table table = rc;
-  line_skip_ = table.get_or("line_skip", 0);
+  metrics_.Clear();
+  metrics_.SetLineSkip(table.get_or("line_skip", 0));
 
-  glyphs_.clear();
   const sol::optional<sol::table> g = table["glyphs"];
   if (!g.has_value()) {
     Logger::Error("GlyphAtlas::Load: " + luaFullPath + " missing `glyphs` table");
@@ -108,13 +114,28 @@ bool GlyphAtlas::Load(const std::string& pngFullPath, const std::string& luaFull
     out.advance = entry.get_or("advance", 0.0F);
     out.minx = entry.get_or("minx", 0.0F);
     out.miny = entry.get_or("miny", 0.0F);
-    glyphs_.emplace(cp, out);
+    metrics_.Add(cp, out);
   }
-  Logger::Info("GlyphAtlas: loaded " + std::to_string(glyphs_.size()) + " glyphs from " + pngFullPath);
+  // Optional (older sidecars predate it): kerning = { [prev] = { [cp] = adjust, ... }, ... }.
+  if (const sol::optional<sol::table> kerning = table["kerning"]; kerning.has_value()) {
+    for (const auto& [prev, row] : *kerning) {
+      for (const auto& [cp, adjust] : row.as<sol::table>()) {
+        metrics_.AddKerning(prev.as<std::uint32_t>(), cp.as<std::uint32_t>(), adjust.as<float>());
+      }
+    }
+  }
+  Logger::Info("GlyphAtlas: loaded " + std::to_string(metrics_.Size()) + " glyphs from " + pngFullPath);
   return true;
 }
 
-const GlyphAtlas::Glyph* GlyphAtlas::Find(std::uint32_t codepoint) const {
-  const auto it = glyphs_.find(codepoint);
-  return it == glyphs_.end() ? nullptr : &it->second;
+SDL_Texture* GlyphAtlas::Texture(SDL_Renderer* renderer) const {
+  if (texture_ != nullptr || texture_failed_ || source_surface_ == nullptr || renderer == nullptr) return texture_;
+  texture_ = SDL_CreateTextureFromSurface(renderer, source_surface_);
+  if (texture_ == nullptr) {
+    texture_failed_ = true;
+    Logger::Error("GlyphAtlas: texture upload failed: " + std::string(SDL_GetError()));
+    return nullptr;
+  }
+  SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
+  return texture_;
 }
@@ -4,23 +4,20 @@
 
 #include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include "AssetManager/GlyphMetrics.h"
+
 class AssetManager;
 
-// Runtime side of the glyph atlas: holds a CPU pixel buffer of the packed glyph PNG + a codepoint
-// → metrics map. CPU-side (vs. an SDL_Texture) so RenderTextSystem can compose strings by blitting
-// from this surface into a destination SDL_Surface, then SDL_CreateTextureFromSurface — same
-// lifetime + caching shape RenderTextSystem already uses for the TTF_RenderText path. Loaded once
-// per (font, size) pair when AssetManager::AddFont sees a sidecar .atlas.png next to the .ttf.
+// Runtime side of the glyph atlas: a CPU pixel buffer of the packed glyph PNG plus its
+// GlyphMetrics (codepoint rects, advances, kerning). It seeds the font's GlyphCache as page 0:
+// RenderTextSystem draws each baked glyph as a quad sampling Texture() — one GPU upload per atlas,
+// shared by every label in the font, so changing a label's text never creates a texture. Loaded once per
+// (font, size) pair when AssetManager::AddFont sees a sidecar .atlas.png next to the .ttf.
 class GlyphAtlas {
  public:
-  struct Glyph {
-    float x{0}, y{0}, w{0}, h{0};
-    float advance{0};
-    float minx{0}, miny{0};
-  };
+  using Glyph = GlyphMetrics::Glyph;
 
   GlyphAtlas() = default;
   GlyphAtlas(const GlyphAtlas&) = delete;
@@ -35,21 +32,26 @@ class GlyphAtlas {
   bool Load(const std::string& pngFullPath, const std::string& luaFullPath);
 
   [[nodiscard]] bool IsLoaded() const { return source_surface_ != nullptr; }
-  [[nodiscard]] const Glyph* Find(std::uint32_t codepoint) const;
+  [[nodiscard]] const Glyph* Find(std::uint32_t codepoint) const { return metrics_.Find(codepoint); }
   [[nodiscard]] bool Contains(std::uint32_t codepoint) const { return Find(codepoint) != nullptr; }
-  // Source surface wrapping the loaded RGBA pixel buffer. RenderTextSystem blits glyph rects out
-  // of this into a destination surface during compose. Lifetime is owned by the GlyphAtlas.
+  [[nodiscard]] const GlyphMetrics& Metrics() const { return metrics_; }
+  // Source surface wrapping the loaded RGBA pixel buffer. Lifetime is owned by the GlyphAtlas.
   [[nodiscard]] SDL_Surface* SourceSurface() const { return source_surface_; }
-  [[nodiscard]] int LineSkip() const { return line_skip_; }
+  // The atlas uploaded to `renderer`, created on first call and owned by the GlyphAtlas. White
+  // glyphs; callers tint per vertex. nullptr when not loaded or the upload failed (logged once).
+  [[nodiscard]] SDL_Texture* Texture(SDL_Renderer* renderer) const;
+  [[nodiscard]] int LineSkip() const { return metrics_.LineSkip(); }
   [[nodiscard]] int AtlasWidth() const { return atlas_width_; }
   [[nodiscard]] int AtlasHeight() const { return atlas_height_; }
-  [[nodiscard]] std::size_t Size() const { return glyphs_.size(); }
+  [[nodiscard]] std::size_t Size() const { return metrics_.Size(); }
 
  private:
   std::vector<std::uint8_t> pixels_;
   SDL_Surface* source_surface_{nullptr};
-  std::unordered_map<std::uint32_t, Glyph> glyphs_;
-  int line_skip_{0};
+  // Lazily uploaded from source_surface_ by Texture(); logically a cache of the pixels.
+  mutable SDL_Texture* texture_{nullptr};
+  mutable bool texture_failed_{false};
+  GlyphMetrics metrics_;
   int atlas_width_{0};
   int atlas_height_{0};
 };
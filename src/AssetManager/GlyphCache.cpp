@@ -0,0 +1,211 @@
+#include "AssetManager/GlyphCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "AssetManager/GlyphAtlas.h"
+#include "General/Logger.h"
+#include "General/Utils.h"
+
+bool GlyphCache::Bind(SDL_Renderer* renderer, TTF_Font* font, const GlyphAtlas* seed) {
+  if (renderer == renderer_ && font == font_ && seed == seed_ && !pages_.empty()) return false;
+  Clear();
+  renderer_ = renderer;
+  font_ = font;
+  seed_ = seed;
+  Page& base = pages_.emplace_back();
+  SDL_Texture* seedTexture = seed != nullptr && seed->IsLoaded() ? seed->Texture(renderer) : nullptr;
+  if (seedTexture != nullptr) {
+    metrics_ = seed->Metrics();
+    base.texture = seedTexture;
+  } else {
+    seed_ = nullptr;
+  }
+  if (metrics_.LineSkip() <= 0 && font != nullptr) metrics_.SetLineSkip(TTF_GetFontLineSkip(font));
+  return true;
+}
+
+bool GlyphCache::Ensure(const std::string_view text, const std::uint64_t frame) {
+  if (font_ == nullptr || pages_.empty()) return false;
+  bool complete = true;
+  for (size_t i = 0; i < text.size();) {
+    const std::uint32_t cp = NextUtf8Codepoint(text, i);
+    if (cp == '\n') continue;
+    if (const GlyphMetrics::Glyph* glyph = metrics_.Find(cp)) {
+      pages_[glyph->page].lastUsedFrame = frame;
+    } else if (!Rasterize(cp, frame)) {
+      complete = false;
+    }
+  }
+  if (!complete) return false;
+
+  std::uint32_t previous = 0;
+  for (size_t i = 0; i < text.size();) {
+    const std::uint32_t cp = NextUtf8Codepoint(text, i);
+    if (cp == '\n') {
+      previous = 0;
+      continue;
+    }
+    if (previous != 0) QueryKerning(previous, cp);
+    previous = cp;
+  }
+  return true;
+}
+
+void GlyphCache::Touch(const std::uint32_t pageMask, const std::uint64_t frame) {
+  for (size_t page = 0; page < pages_.size() && page < 32; ++page) {
+    if ((pageMask >> page & 1u) != 0) pages_[page].lastUsedFrame = frame;
+  }
+}
+
+bool GlyphCache::Rasterize(const std::uint32_t codepoint, const std::uint64_t frame) {
+  int minx = 0, maxx = 0, miny = 0, maxy = 0, advance = 0;
+  if (!TTF_GetGlyphMetrics(font_, codepoint, &minx, &maxx, &miny, &maxy, &advance)) {
+    Logger::Warn("GlyphCache: no metrics for U+" + std::to_string(codepoint) + ": " + std::string(SDL_GetError()));
+    return false;
+  }
+  GlyphMetrics::Glyph glyph;
+  glyph.advance = static_cast<float>(advance);
+  glyph.minx = static_cast<float>(minx);
+  glyph.miny = static_cast<float>(miny);
+
+  // Same call AtlasBaker uses, so a rasterized glyph sits in its cell exactly like a baked one.
+  // Blank glyphs (space, zero-width marks) come back empty and only need their advance.
+  SDL_Surface* surface = TTF_RenderGlyph_Blended(font_, codepoint, SDL_Color{255, 255, 255, 255});
+  SDL_Surface* rgba = surface != nullptr && surface->w > 0 && surface->h > 0
+                          ? SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32)
+                          : nullptr;
+  if (surface != nullptr) SDL_DestroySurface(surface);
+  if (rgba == nullptr) {
+    metrics_.Add(codepoint, glyph);
+    ++stats_.rasterized;
+    return true;
+  }
+
+  const int w = rgba->w;
+  const int h = rgba->h;
+  const int paddedW = w + 2 * kPaddingPx;
+  const int paddedH = h + 2 * kPaddingPx;
+  const std::size_t pagesBefore = pages_.size();
+  SkylinePacker::Spot spot;
+  Page* page = FindRoom(paddedW, paddedH, frame, spot);
+  if (page == nullptr) {
+    SDL_DestroySurface(rgba);
+    return false;
+  }
+
+  // Glyph edges are already transparent, so the border is left clear rather than extruded.
+  std::vector<Uint32> pixels(static_cast<size_t>(paddedW) * static_cast<size_t>(paddedH), 0);
+  const auto* source = static_cast<const unsigned char*>(rgba->pixels);
+  for (int y = 0; y < h; ++y) {
+    std::memcpy(&pixels[static_cast<size_t>(y + kPaddingPx) * static_cast<size_t>(paddedW) + kPaddingPx],
+                source + static_cast<std::ptrdiff_t>(y) * rgba->pitch, static_cast<size_t>(w) * sizeof(Uint32));
+  }
+  SDL_DestroySurface(rgba);
+  // Placed only once the copy lands (as in DynamicTextureAtlas): a failed upload leaves the packer
+  // as it was, and a page created for this glyph alone is destroyed instead of counting against
+  // kMaxPages empty.
+  const SDL_Rect region{spot.at.x, spot.at.y, paddedW, paddedH};
+  if (!SDL_UpdateTexture(page->texture, &region, pixels.data(), paddedW * static_cast<int>(sizeof(Uint32)))) {
+    Logger::Error("GlyphCache: SDL_UpdateTexture failed: " + std::string(SDL_GetError()));
+    if (pages_.size() > pagesBefore) {
+      SDL_DestroyTexture(pages_.back().texture);
+      pages_.pop_back();
+    }
+    return false;
+  }
+  const SkylinePacker::Point at = page->packer.Place(spot);
+
+  glyph.x = static_cast<float>(at.x + kPaddingPx);
+  glyph.y = static_cast<float>(at.y + kPaddingPx);
+  glyph.w = static_cast<float>(w);
+  glyph.h = static_cast<float>(h);
+  glyph.page = static_cast<std::uint16_t>(page - pages_.data());
+  metrics_.Add(codepoint, glyph);
+  page->lastUsedFrame = frame;
+  ++stats_.rasterized;
+  return true;
+}
+
+GlyphCache::Page* GlyphCache::FindRoom(const int w, const int h, const std::uint64_t frame,
+                                       SkylinePacker::Spot& spot) {
+  // Too big for even an empty page: neither a new page nor a recycled one would hold it.
+  if (w > kPageSize || h > kPageSize) return nullptr;
+  for (size_t i = 1; i < pages_.size(); ++i) {
+    if (const auto found = pages_[i].packer.Find(w, h)) {
+      spot = *found;
+      return &pages_[i];
+    }
+  }
+
+  if (pages_.size() <= kMaxPages) {
+    SDL_Texture* texture =
+        SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, kPageSize, kPageSize);
+    if (texture == nullptr) {
+      Logger::Error("GlyphCache: cannot create a glyph page: " + std::string(SDL_GetError()));
+      return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    Page& page = pages_.emplace_back();
+    page.texture = texture;
+    page.packer = SkylinePacker(kPageSize, kPageSize);
+    page.owned = true;
+    spot = *page.packer.Find(w, h);  // fits: the page is empty and the size was checked above
+    return &page;
+  }
+
+  size_t victim = 0;
+  std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+  for (size_t i = 1; i < pages_.size(); ++i) {
+    if (pages_[i].lastUsedFrame < frame && pages_[i].lastUsedFrame < oldest) {
+      victim = i;
+      oldest = pages_[i].lastUsedFrame;
+    }
+  }
+  if (victim == 0) return nullptr;
+  metrics_.RemoveIf([victim](std::uint32_t, const GlyphMetrics::Glyph& glyph) { return glyph.page == victim; });
+  Page& page = pages_[victim];
+  page.packer.Reset();
+  ++generation_;
+  ++stats_.evictions;
+  spot = *page.packer.Find(w, h);
+  return &page;
+}
+
+void GlyphCache::QueryKerning(const std::uint32_t previous, const std::uint32_t codepoint) {
+  // Pairs between two baked glyphs already came with the atlas (non-zero ones only).
+  if (Seeded(previous) && Seeded(codepoint)) return;
+  const std::uint64_t key = static_cast<std::uint64_t>(previous) << 32 | codepoint;
+  if (!kerning_queried_.insert(key).second) return;
+  int kerning = 0;
+  if (TTF_GetGlyphKerning(font_, previous, codepoint, &kerning) && kerning != 0) {
+    metrics_.AddKerning(previous, codepoint, static_cast<float>(kerning));
+  }
+}
+
+bool GlyphCache::Seeded(const std::uint32_t codepoint) const {
+  return seed_ != nullptr && seed_->Find(codepoint) != nullptr;
+}
+
+void GlyphCache::Clear() {
+  if (pages_.empty() && metrics_.Size() == 0) return;
+  for (const Page& page : pages_) {
+    if (page.owned && page.texture != nullptr) SDL_DestroyTexture(page.texture);
+  }
+  pages_.clear();
+  metrics_.Clear();
+  kerning_queried_.clear();
+  renderer_ = nullptr;
+  font_ = nullptr;
+  seed_ = nullptr;
+  ++generation_;
+}
+
+GlyphCache::Stats GlyphCache::GetStats() const {
+  Stats stats = stats_;
+  stats.pages = pages_.empty() ? 0 : pages_.size() - 1;
+  stats.glyphs = metrics_.Size();
+  return stats;
+}
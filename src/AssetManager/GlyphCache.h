@@ -0,0 +1,97 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "AssetManager/GlyphMetrics.h"
+#include "AssetManager/SkylinePacker.h"
+
+class GlyphAtlas;
+
+// On-demand glyph atlas for one (font, size): every codepoint a label needs is rasterized through
+// SDL_ttf once, packed into a page texture, and from then on drawn as a quad like a baked glyph —
+// so text in any script the face covers goes down the glyph-quad path without a per-label texture.
+//
+// Page 0 is the font's baked GlyphAtlas when it has one (its metrics seed the cache; the texture
+// stays owned by the atlas and is never evicted). Missing glyphs go to up to kMaxPages dynamic
+// pages, packed online with SkylinePacker with kPaddingPx of transparent border. When every page
+// is full, the least recently drawn page is recycled whole: its glyphs are forgotten and
+// Generation() bumps so layouts made against them are redone. A page drawn from in the current
+// frame is never recycled — its quads may already be queued — so a frame that needs more glyphs
+// than the pages hold fails Ensure instead of corrupting queued text.
+//
+// Kerning for pairs involving a rasterized glyph is queried from the face the first time the pair
+// is laid out. Owns its page textures. Not thread-safe; RenderTextSystem calls it serially.
+class GlyphCache {
+ public:
+  static constexpr int kPageSize = 1024;
+  static constexpr std::size_t kMaxPages = 4;  // dynamic pages, on top of the baked atlas
+  static constexpr int kPaddingPx = 1;
+
+  struct Stats {
+    std::size_t pages = 0;         // dynamic pages resident
+    std::size_t glyphs = 0;        // resident glyphs, seeded ones included
+    std::uint64_t rasterized = 0;  // glyphs rendered through SDL_ttf
+    std::uint64_t evictions = 0;   // pages recycled to make room
+  };
+
+  GlyphCache() = default;
+  GlyphCache(const GlyphCache&) = delete;
+  GlyphCache& operator=(const GlyphCache&) = delete;
+  GlyphCache(GlyphCache&&) noexcept = default;
+  GlyphCache& operator=(GlyphCache&&) noexcept = default;
+  ~GlyphCache() { Clear(); }
+
+  // Serve `font` on `renderer`, seeded from `seed` (nullable). A no-op while all three are
+  // unchanged; otherwise drops every glyph and returns true (hot reload, renderer swap).
+  bool Bind(SDL_Renderer* renderer, TTF_Font* font, const GlyphAtlas* seed);
+
+  // Make every codepoint of UTF-8 `text` resident and its kerning known. `frame` is the render
+  // clock (RenderQueue::Frame); pages used in it are kept. False when a glyph could not be
+  // rasterized or placed — the text can't be laid out against Metrics().
+  bool Ensure(std::string_view text, std::uint64_t frame);
+
+  // Mark the pages in `pageMask` (GlyphLayout::pages) as drawn in `frame`.
+  void Touch(std::uint32_t pageMask, std::uint64_t frame);
+  void Clear();
+
+  [[nodiscard]] const GlyphMetrics& Metrics() const { return metrics_; }
+  // Texture behind Glyph::page; nullptr for an unknown page.
+  [[nodiscard]] SDL_Texture* PageTexture(const std::uint16_t page) const {
+    return page < pages_.size() ? pages_[page].texture : nullptr;
+  }
+  // Bumped whenever glyphs are dropped (page recycled, rebind); layouts made before are stale.
+  [[nodiscard]] std::uint64_t Generation() const { return generation_; }
+  [[nodiscard]] Stats GetStats() const;
+
+ private:
+  struct Page {
+    SDL_Texture* texture = nullptr;
+    SkylinePacker packer;
+    std::uint64_t lastUsedFrame = 0;
+    bool owned = false;
+  };
+
+  bool Rasterize(std::uint32_t codepoint, std::uint64_t frame);
+  // A dynamic page with room for w x h: an existing one, a new one, or the least recently drawn
+  // page not used in `frame`, recycled. Writes the unplaced spot to `spot` for Rasterize to place
+  // once the glyph is uploaded; nullptr when none qualifies.
+  Page* FindRoom(int w, int h, std::uint64_t frame, SkylinePacker::Spot& spot);
+  void QueryKerning(std::uint32_t previous, std::uint32_t codepoint);
+  [[nodiscard]] bool Seeded(std::uint32_t codepoint) const;
+
+  SDL_Renderer* renderer_ = nullptr;
+  TTF_Font* font_ = nullptr;
+  const GlyphAtlas* seed_ = nullptr;
+  GlyphMetrics metrics_;
+  std::vector<Page> pages_;  // [0] = the seed atlas (texture may be null)
+  std::unordered_set<std::uint64_t> kerning_queried_;
+  std::uint64_t generation_ = 0;
+  Stats stats_;
+};
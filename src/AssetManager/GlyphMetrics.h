@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+// The metrics half of a glyph atlas: codepoint → packed rect + advance, pair kerning and the
+// font's line skip. Plain data with no SDL so text layout (Renderer/GlyphLayoutCache.h) can be
+// unit-tested and benchmarked without loading an atlas; GlyphAtlas owns one next to its pixels,
+// and GlyphCache keeps one spanning its pages (Glyph::page says which texture a rect is on).
+class GlyphMetrics {
+ public:
+  struct Glyph {
+    float x{0}, y{0}, w{0}, h{0};
+    float advance{0};
+    float minx{0}, miny{0};
+    std::uint16_t page{0};
+  };
+
+  void Add(const std::uint32_t codepoint, const Glyph& glyph) { glyphs_[codepoint] = glyph; }
+  // Horizontal adjustment applied between `previous` and `codepoint` (pixels, usually negative).
+  void AddKerning(const std::uint32_t previous, const std::uint32_t codepoint, const float adjust) {
+    kerning_[PairKey(previous, codepoint)] = adjust;
+  }
+  void SetLineSkip(const int lineSkip) { line_skip_ = lineSkip; }
+  // Drop every glyph `pred(codepoint, glyph)` selects. Kerning is a property of the face, not of
+  // where a glyph is packed, so it stays.
+  template <typename Pred>
+  std::size_t RemoveIf(Pred pred) {
+    return std::erase_if(glyphs_, [&pred](const auto& item) { return pred(item.first, item.second); });
+  }
+  void Clear() {
+    glyphs_.clear();
+    kerning_.clear();
+    line_skip_ = 0;
+  }
+
+  [[nodiscard]] const Glyph* Find(const std::uint32_t codepoint) const {
+    const auto it = glyphs_.find(codepoint);
+    return it == glyphs_.end() ? nullptr : &it->second;
+  }
+  [[nodiscard]] float Kerning(const std::uint32_t previous, const std::uint32_t codepoint) const {
+    if (kerning_.empty()) return 0.0F;
+    const auto it = kerning_.find(PairKey(previous, codepoint));
+    return it == kerning_.end() ? 0.0F : it->second;
+  }
+  [[nodiscard]] int LineSkip() const { return line_skip_; }
+  [[nodiscard]] std::size_t Size() const { return glyphs_.size(); }
+  [[nodiscard]] std::size_t KerningPairs() const { return kerning_.size(); }
+
+ private:
+  static std::uint64_t PairKey(const std::uint32_t previous, const std::uint32_t codepoint) {
+    return static_cast<std::uint64_t>(previous) << 32 | codepoint;
+  }
+
+  std::unordered_map<std::uint32_t, Glyph> glyphs_;
+  std::unordered_map<std::uint64_t, float> kerning_;
+  int line_skip_{0};
+};
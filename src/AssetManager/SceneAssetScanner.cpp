@@ -17,7 +17,7 @@ void AddIfString(const sol::table& table, const char* key, const std::string& co
 void SceneAssetScanner::CollectFromComponents(const sol::table& components, const std::string& entityContext,
                                               std::vector<AssetReference>& out) {
   // Field names match the component Lua bindings: sprite.texture_asset_id,
-  // text_label.font_id, audio_source.clip_id.
+  // text_label.font_id, audio_source.clip_id, animation.clip, particle_emitter.texture_asset_id.
   if (const sol::optional<sol::table> sprite = components["sprite"]; sprite) {
     AddIfString(*sprite, "texture_asset_id", entityContext + " sprite.", out);
   }
@@ -27,15 +27,27 @@ void SceneAssetScanner::CollectFromComponents(const sol::table& components, cons
   if (const sol::optional<sol::table> audio = components["audio_source"]; audio) {
     AddIfString(*audio, "clip_id", entityContext + " audio_source.", out);
   }
+  if (const sol::optional<sol::table> animation = components["animation"]; animation) {
+    AddIfString(*animation, "clip", entityContext + " animation.", out);
+  }
+  if (const sol::optional<sol::table> emitter = components["particle_emitter"]; emitter) {
+    AddIfString(*emitter, "texture_asset_id", entityContext + " particle_emitter.", out);
+  }
 }
 
 std::vector<AssetReference> SceneAssetScanner::CollectRefs(const sol::table& scene) {
   std::vector<AssetReference> refs;
   if (!scene.valid()) return refs;
 
-  // Scene-level tilemap texture (referenced by the loader, not by a component).
+  // Tilemap tileset textures (referenced by the tilemap loader, not by a component): the block's
+  // default plus any per-layer override.
   if (const sol::optional<sol::table> tilemap = scene["tilemap"]; tilemap) {
     AddIfString(*tilemap, "texture_asset_id", "tilemap.", refs);
+    if (const sol::optional<sol::table> layers = (*tilemap)["layers"]; layers) {
+      for (const auto& [_, layer] : *layers) {
+        if (layer.is<sol::table>()) AddIfString(layer.as<sol::table>(), "texture_asset_id", "tilemap.layers.", refs);
+      }
+    }
   }
 
   // Explicit preload list: anything not in the static entity tree (runtime spawns + load-time
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+// Online rectangle packer for one fixed-size page: the "skyline bottom-left" heuristic. The page's
+// used area is tracked as its top silhouette — a list of horizontal segments — and each insert
+// rests the rect on the segment run that leaves its top edge lowest (ties go to the narrower
+// start segment, which fills pits first). Rects are placed as they arrive and never move, so
+// DynamicTextureAtlas can hand out a slice the moment a texture loads. No SDL; unit-tested on
+// its own. Space is only reclaimed by Reset.
+class SkylinePacker {
+ public:
+  struct Point {
+    int x = 0;
+    int y = 0;
+  };
+
+  SkylinePacker() = default;
+  SkylinePacker(const int width, const int height) : width_(width), height_(height) { Reset(); }
+
+  // Where a w x h rect would go, found but not yet placed: Place commits it. Valid until the
+  // next Place, Insert or Reset.
+  struct Spot {
+    Point at;
+    size_t segment = 0;
+    int w = 0;
+    int h = 0;
+  };
+
+  // The spot Insert would use for a w x h rect, or nullopt when it fits nowhere on the page.
+  // Leaves the page untouched, so a caller whose copy into the spot fails has nothing to undo.
+  [[nodiscard]] std::optional<Spot> Find(const int w, const int h) const {
+    if (w <= 0 || h <= 0 || w > width_ || h > height_) return std::nullopt;
+    size_t best = kNone;
+    int bestTop = std::numeric_limits<int>::max();
+    int bestWidth = std::numeric_limits<int>::max();
+    int bestY = 0;
+    for (size_t i = 0; i < skyline_.size(); ++i) {
+      const std::optional<int> y = RestingY(i, w);
+      if (!y || *y + h > height_) continue;
+      if (*y + h < bestTop || (*y + h == bestTop && skyline_[i].width < bestWidth)) {
+        best = i;
+        bestTop = *y + h;
+        bestWidth = skyline_[i].width;
+        bestY = *y;
+      }
+    }
+    if (best == kNone) return std::nullopt;
+    return Spot{{skyline_[best].x, bestY}, best, w, h};
+  }
+
+  // Mark a spot from Find as used and return its top-left corner.
+  Point Place(const Spot& spot) {
+    Raise(spot.segment, spot.at.x, spot.w, spot.at.y + spot.h);
+    usedArea_ += static_cast<size_t>(spot.w) * static_cast<size_t>(spot.h);
+    return spot.at;
+  }
+
+  // Top-left corner for a w x h rect, or nullopt when it fits nowhere on the page.
+  std::optional<Point> Insert(const int w, const int h) {
+    const std::optional<Spot> spot = Find(w, h);
+    if (!spot) return std::nullopt;
+    return Place(*spot);
+  }
+
+  void Reset() {
+    skyline_.assign(1, Segment{0, 0, width_});
+    usedArea_ = 0;
+  }
+
+  [[nodiscard]] int Width() const { return width_; }
+  [[nodiscard]] int Height() const { return height_; }
+  // Sum of the inserted rects' areas (not counting space wasted under the skyline).
+  [[nodiscard]] size_t UsedArea() const { return usedArea_; }
+
+ private:
+  static constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+  struct Segment {
+    int x = 0;
+    int y = 0;  // top of the used area under [x, x + width)
+    int width = 0;
+  };
+
+  // Height a rect of width w starting at segment i would rest at: the tallest segment it spans.
+  [[nodiscard]] std::optional<int> RestingY(size_t i, const int w) const {
+    if (skyline_[i].x + w > width_) return std::nullopt;
+    int y = 0;
+    for (int remaining = w; remaining > 0; ++i) {
+      y = std::max(y, skyline_[i].y);
+      remaining -= skyline_[i].width;
+    }
+    return y;
+  }
+
+  // Replace the silhouette under [x, x + w) with one segment at height `top`, trimming the
+  // segments it covers and merging equal-height neighbours.
+  void Raise(const size_t at, const int x, const int w, const int top) {
+    skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(at), Segment{x, top, w});
+    const int right = x + w;
+    size_t next = at + 1;
+    while (next < skyline_.size() && skyline_[next].x < right) {
+      Segment& s = skyline_[next];
+      const int end = s.x + s.width;
+      if (end <= right) {
+        skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(next));
+        continue;
+      }
+      s.width = end - right;
+      s.x = right;
+      break;
+    }
+    for (size_t i = 0; i + 1 < skyline_.size();) {
+      if (skyline_[i].y == skyline_[i + 1].y) {
+        skyline_[i].width += skyline_[i + 1].width;
+        skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+      } else {
+        ++i;
+      }
+    }
+  }
+
+  int width_ = 0;
+  int height_ = 0;
+  std::vector<Segment> skyline_;
+  size_t usedArea_ = 0;
+};
@@ -11,7 +11,20 @@ SDL_Texture* TextureStore::Add(SDL_Renderer* renderer, const std::string& id, SD
     Logger::Error("Failed to create texture: " + std::string(SDL_GetError()));
     return nullptr;
   }
+  return Insert(id, texture, logPath);
+}
+
+SDL_Texture* TextureStore::AddSurface(SDL_Renderer* renderer, const std::string& id, SDL_Surface* surface,
+                                      const std::string& logPath) {
+  SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+  if (!texture) {
+    Logger::Error("Failed to create texture: " + std::string(SDL_GetError()));
+    return nullptr;
+  }
+  return Insert(id, texture, logPath);
+}
 
+SDL_Texture* TextureStore::Insert(const std::string& id, SDL_Texture* texture, const std::string& logPath) {
   if (default_scale_mode_.has_value()) {
     SDL_SetTextureScaleMode(texture, default_scale_mode_.value());
   }
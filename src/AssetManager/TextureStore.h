@@ -23,11 +23,16 @@ class TextureStore {
   ~TextureStore() { Clear(); }
 
   void SetDefaultScaleMode(std::optional<SDL_ScaleMode> mode) { default_scale_mode_ = mode; }
+  [[nodiscard]] std::optional<SDL_ScaleMode> DefaultScaleMode() const { return default_scale_mode_; }
 
   // Create a texture from an already-opened, owned IO stream (consumed and closed by the loader).
   // Applies the default scale mode, replaces any prior handle under `id`, and bumps the generation.
   // Returns the resident texture, or nullptr on load failure. `logPath` feeds the log line only.
   SDL_Texture* Add(SDL_Renderer* renderer, const std::string& id, SDL_IOStream* io, const std::string& logPath);
+  // Same, from an already-decoded surface (left owned by the caller) — the path AssetManager takes
+  // when it decoded the image to offer it to the DynamicTextureAtlas first and the atlas declined.
+  SDL_Texture* AddSurface(SDL_Renderer* renderer, const std::string& id, SDL_Surface* surface,
+                          const std::string& logPath);
 
   // Direct lookup — no atlas-member redirect (that lives in AssetManager, which has the catalog).
   [[nodiscard]] SDL_Texture* Get(const std::string& id) const;
@@ -42,6 +47,8 @@ class TextureStore {
   [[nodiscard]] const std::map<std::string, SDL_Texture*>& All() const { return textures_; }
 
  private:
+  SDL_Texture* Insert(const std::string& id, SDL_Texture* texture, const std::string& logPath);
+
   std::map<std::string, SDL_Texture*> textures_;
   std::optional<SDL_ScaleMode> default_scale_mode_;
   // Bumped whenever a texture is added, replaced, or removed. Sprite renderers compare against their
@@ -9,9 +9,9 @@
 #include "ECS/Entity.h"
 
 // Audio-side cache mapping Entity -> the MIX_Track* AudioSystem assigned that emitter's
-// AudioSinkComponent, plus the track-pool generation issued for the acquisition. Mirrors
-// Renderer/SpriteRenderCache: it keeps AudioSinkComponent POD-no-SDL while SpatialAudioSystem /
-// DopplerSystem / AudioCullingSystem resolve the live track here each frame.
+// AudioSinkComponent, plus the track-pool generation issued for the acquisition. It keeps
+// AudioSinkComponent POD-no-SDL while SpatialAudioSystem / DopplerSystem / AudioCullingSystem
+// resolve the live track here each frame.
 //
 // A Registry singleton, Set on the live-frame path only (bake runs no audio systems) and Clear()ed
 // on scene unload. Single-threaded: every audio system runs serially (RegisterSystem, not the
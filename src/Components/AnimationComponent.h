@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "AssetManager/AnimationClip.h"
+
 struct AnimationComponent {
   int numFrames;
   int currentFrame;
@@ -8,6 +14,16 @@ struct AnimationComponent {
   double frameTimer;
   bool isFinished;
 
+  // Clip playback. With a clip set, AnimationSystem plays the baked `.anim` clip under clipId and
+  // the frame-counter fields above are ignored (isFinished still reports a finished Once clip).
+  std::string clipId;
+  float clipSpeed = 1.0F;  // playback rate multiplier
+  float clipTime = 0.0F;
+  std::uint32_t clipStep = AnimationClip::kUnstarted;
+  // Resolved from clipId by AnimationSystem; stale once the asset manager's clip generation moves.
+  const AnimationClip* clip = nullptr;
+  std::uint64_t clipGeneration = 0;
+
   explicit AnimationComponent(const int t_numFrames = 1, const int t_frameRateSpeed = 1, const bool t_shouldLoop = true)
       : numFrames(t_numFrames),
         currentFrame(1),
@@ -15,4 +31,15 @@ struct AnimationComponent {
         shouldLoop(t_shouldLoop),
         frameTimer(0.0),
         isFinished(false) {}
+
+  // Switch to clip `id` from its first frame. Playing the clip already playing is a no-op unless
+  // `restart`, so calling this every frame with the desired clip is cheap.
+  void Play(std::string id, const bool restart = false) {
+    if (id == clipId && !restart) return;
+    clipId = std::move(id);
+    clipTime = 0.0F;
+    clipStep = AnimationClip::kUnstarted;
+    clip = nullptr;
+    isFinished = false;
+  }
 };
@@ -3,8 +3,11 @@
 #include <cstdint>
 #include <string>
 
+#include "AssetManager/AssetHandle.h"
+
 struct AudioSourceComponent {
   std::string clipId;
+  AssetHandle clip;  // clipId interned by the Lua bind; invalid after a script reassigns clip_id
   float volume = 1.0f;
   float pitch = 1.0f;
   bool loop = false;
@@ -11,9 +11,24 @@ struct BoxColliderComponent {
   glm::vec2 offset{};
   bool isFixed;
   EntityMask collisionMask;
+  // Opt-in continuous collision: CollisionSystem sweeps the box from its previous detection pass to
+  // the current one, so fast movers can't tunnel through thin colliders at low simulation rates.
+  bool continuous;
+
+  // Sweep origin, written by CollisionSystem each pass (runtime state, not serialized). Reset
+  // hasLastCenter when teleporting or reusing a pooled entity so the next pass doesn't sweep from
+  // the old position.
+  glm::vec2 lastCenter{};
+  bool hasLastCenter = false;
 
   explicit BoxColliderComponent(const int t_width = 0, const int t_height = 0,
                                 const glm::vec2 t_offset = glm::vec2(0, 0), const bool t_isFixed = false,
-                                const EntityMask t_collisionMask = Constants::kDefaultEntityMask)
-      : width(t_width), height(t_height), offset(t_offset), isFixed(t_isFixed), collisionMask(t_collisionMask) {}
+                                const EntityMask t_collisionMask = Constants::kDefaultEntityMask,
+                                const bool t_continuous = false)
+      : width(t_width),
+        height(t_height),
+        offset(t_offset),
+        isFixed(t_isFixed),
+        collisionMask(t_collisionMask),
+        continuous(t_continuous) {}
 };
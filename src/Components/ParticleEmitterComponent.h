@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <glm/glm.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "General/BlendMode.h"
+#include "General/Color.h"
+
+// A value over a particle's normalized age (0 = spawned, 1 = expiring): piecewise-linear between
+// keys sorted by t, held flat before the first key and after the last. No keys samples as 1.
+struct ParticleCurve {
+  struct Key {
+    float t = 0.0F;
+    float value = 0.0F;
+  };
+  std::vector<Key> keys;
+
+  ParticleCurve() = default;
+  explicit ParticleCurve(const float constant) : keys{{0.0F, constant}} {}
+  explicit ParticleCurve(std::vector<Key> t_keys) : keys(std::move(t_keys)) {}
+
+  [[nodiscard]] float Sample(const float t) const {
+    if (keys.empty()) return 1.0F;
+    if (t <= keys.front().t) return keys.front().value;
+    for (std::size_t i = 1; i < keys.size(); ++i) {
+      if (t <= keys[i].t) {
+        const Key& a = keys[i - 1];
+        const Key& b = keys[i];
+        const float span = b.t - a.t;
+        return span > 0.0F ? a.value + (b.value - a.value) * (t - a.t) / span : b.value;
+      }
+    }
+    return keys.back().value;
+  }
+};
+
+// Color over normalized age, same shape as ParticleCurve. No keys samples as opaque white.
+struct ParticleGradient {
+  struct Key {
+    float t = 0.0F;
+    octarine::Color color;
+  };
+  std::vector<Key> keys;
+
+  ParticleGradient() = default;
+  explicit ParticleGradient(const octarine::Color constant) : keys{{0.0F, constant}} {}
+  explicit ParticleGradient(std::vector<Key> t_keys) : keys(std::move(t_keys)) {}
+};
+
+// Emits particles from the entity's global position. The particles themselves are not entities:
+// they live in per-emitter arrays in the ParticleStore singleton, simulated and drawn by
+// ParticleSystem, so a spark costs no archetype move, pool slot or render-queue entry. Each
+// emitter is one batched draw.
+//
+// Spawned particles keep to world space (moving the emitter leaves its live particles behind).
+// Direction is in degrees, 0 = +x and 90 = down (screen y grows downward); spread is the full
+// width of the cone around it.
+struct ParticleEmitterComponent {
+  std::string assetId;  // texture drawn on every particle; empty draws solid squares
+  int layer = 0;
+  octarine::BlendMode blendMode = octarine::BlendMode::Blend;
+
+  bool emitting = true;
+  float rate = 10.0F;  // particles per second while emitting
+  int maxParticles = 1000;
+  float lifetime = 1.0F;
+  float lifetimeVariance = 0.0F;  // +/- seconds
+  float speed = 50.0F;
+  float speedVariance = 0.0F;  // +/- pixels per second
+  float direction = -90.0F;
+  float spread = 360.0F;
+  float spawnRadius = 0.0F;  // particles start anywhere within this disc around the emitter
+  glm::vec2 gravity{0.0F, 0.0F};
+
+  ParticleCurve size{4.0F};      // edge length in pixels
+  ParticleCurve velocity{1.0F};  // multiplies the velocity (launch + gravity)
+  ParticleGradient color;        // tint (or, with no texture, fill)
+
+  // Particles to spawn on the next update on top of the rate; ParticleSystem zeroes it.
+  int pendingBurst = 0;
+
+  void Burst(const int count) { pendingBurst += std::max(count, 0); }
+};
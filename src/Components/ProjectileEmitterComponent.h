@@ -22,6 +22,9 @@ struct ProjectileEmitterComponent {
   // Name assigned to each spawned projectile via NameComponent. Empty string
   // leaves the pooled projectile's existing name in place (default-constructed empty).
   std::string projectileName;
+  // Spawned projectiles get a continuous (swept) collider, so fast shots can't skip over thin
+  // targets between collision passes. Off by default: the swept test costs a little per pair.
+  bool continuousCollision = false;
 
   // t_frequency defaults to 0 == auto-fire OFF. The engine ProjectileEmitSystem tick only fires
   // emitters with frequency > 0; a positive value opts an emitter into engine-driven auto-fire
@@ -4,6 +4,22 @@
 
 struct RigidBodyComponent {
   glm::vec2 velocity;
+  // Contact-solver properties, only read when `simulated` is set. mass <= 0 makes the body
+  // immovable (infinite mass) while still colliding. Restitution is bounciness (0 = no bounce, 1 =
+  // elastic); friction is the Coulomb coefficient along the contact tangent.
+  float mass;
+  float restitution;
+  float friction;
+  // Opt-in: PhysicsSolverSystem resolves this body's contacts with impulses. Bodies without it keep
+  // the kinematic velocity-only behaviour and are ignored by the solver.
+  bool simulated;
 
-  explicit RigidBodyComponent(const glm::vec2 t_velocity = glm::vec2(0, 0)) : velocity(t_velocity) {}
-};
\ No newline at end of file
+  explicit RigidBodyComponent(const glm::vec2 t_velocity = glm::vec2(0, 0), const float t_mass = 1.0f,
+                              const float t_restitution = 0.0f, const float t_friction = 0.2f,
+                              const bool t_simulated = false)
+      : velocity(t_velocity),
+        mass(t_mass),
+        restitution(t_restitution),
+        friction(t_friction),
+        simulated(t_simulated) {}
+};
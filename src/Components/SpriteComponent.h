@@ -3,6 +3,7 @@
 #include <string>
 #include <utility>
 
+#include "AssetManager/AssetHandle.h"
 #include "General/BlendMode.h"
 #include "General/Color.h"
 #include "General/Constants.h"
@@ -11,6 +12,9 @@
 
 struct SpriteComponent {
   std::string assetId;
+  // assetId interned by the Lua bind; the sprite emit resolves through it and falls back to
+  // assetId while it is invalid.
+  AssetHandle texture;
   float width;
   float height;
   int layer;
@@ -4,6 +4,7 @@
 #include <string>
 #include <utility>
 
+#include "AssetManager/AssetHandle.h"
 #include "General/Color.h"
 #include "General/Constants.h"
 
@@ -12,6 +13,7 @@ struct TextLabelComponent {
   int layer;
   std::string text;
   std::string fontId;
+  AssetHandle font;  // fontId interned by the Lua bind (see SpriteComponent::texture)
   octarine::Color color;
   bool isFixed;
 
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+// One layer of a tile map: a width x height grid of tile indices into a tileset atlas, stored
+// row-major in a single vector instead of as one sprite entity per tile. SceneLoader creates one
+// entity per layer from the scene's `tilemap` block (see docs/tilemaps.md).
+//
+// For rendering the grid is split into kChunkTiles x kChunkTiles chunks; RenderTilemapSystem bakes
+// each visible chunk into a cached texture and draws it as one quad. Every SetTile bumps its
+// chunk's revision so only that chunk is re-baked. Solid layers also feed TileCollisionGrid.
+struct TilemapLayerComponent {
+  static constexpr int kChunkTiles = 16;
+  static constexpr std::int32_t kEmptyTile = -1;
+
+  std::string name;
+  std::string tilesetAssetId;
+  int tileWidth = 0;
+  int tileHeight = 0;
+  // Tiles per tileset row; 0 derives it from the texture width.
+  int tilesetColumns = 0;
+  // Pixels around the tileset's edge and between its tiles (Tiled's margin / spacing).
+  int margin = 0;
+  int spacing = 0;
+  int width = 0;   // in tiles
+  int height = 0;  // in tiles
+  glm::vec2 origin{0.0f, 0.0f};  // world position of tile (0, 0)'s top-left corner
+  int layer = 0;                 // render layer, as SpriteComponent::layer
+  bool visible = true;
+  bool solid = false;  // every non-empty tile blocks simulated bodies
+  std::vector<std::int32_t> tiles;  // 0-based tileset indices, kEmptyTile for a hole
+  // Per-chunk content revision, row-major over ChunksX() x ChunksY(). Starts at 1 so a cache entry
+  // that was never baked (revision 0) is always stale.
+  std::vector<std::uint32_t> chunkRevisions;
+  // Bumped by every SetTile; TileCollisionGrid rebuilds when a solid layer's revision moves.
+  std::uint64_t revision = 1;
+
+  TilemapLayerComponent() = default;
+
+  TilemapLayerComponent(std::string t_name, const int t_width, const int t_height, std::vector<std::int32_t> t_tiles)
+      : name(std::move(t_name)), width(t_width), height(t_height), tiles(std::move(t_tiles)) {
+    tiles.resize(static_cast<size_t>(std::max(0, width)) * static_cast<size_t>(std::max(0, height)), kEmptyTile);
+    chunkRevisions.assign(static_cast<size_t>(ChunksX()) * static_cast<size_t>(ChunksY()), 1);
+  }
+
+  [[nodiscard]] int ChunksX() const { return (std::max(0, width) + kChunkTiles - 1) / kChunkTiles; }
+  [[nodiscard]] int ChunksY() const { return (std::max(0, height) + kChunkTiles - 1) / kChunkTiles; }
+
+  [[nodiscard]] bool InBounds(const int x, const int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+
+  [[nodiscard]] std::int32_t TileAt(const int x, const int y) const {
+    return InBounds(x, y) ? tiles[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)]
+                          : kEmptyTile;
+  }
+
+  // Returns false (and changes nothing) outside the grid. Writing the tile already there is a no-op,
+  // so a script re-stamping the same value doesn't force a re-bake.
+  bool SetTile(const int x, const int y, const std::int32_t tile) {
+    if (!InBounds(x, y)) return false;
+    std::int32_t& slot = tiles[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)];
+    const std::int32_t value = tile < 0 ? kEmptyTile : tile;
+    if (slot == value) return true;
+    slot = value;
+    ++chunkRevisions[ChunkIndex(x / kChunkTiles, y / kChunkTiles)];
+    ++revision;
+    return true;
+  }
+
+  [[nodiscard]] size_t ChunkIndex(const int chunkX, const int chunkY) const {
+    return static_cast<size_t>(chunkY) * static_cast<size_t>(ChunksX()) + static_cast<size_t>(chunkX);
+  }
+
+  [[nodiscard]] std::uint32_t ChunkRevision(const int chunkX, const int chunkY) const {
+    return chunkRevisions[ChunkIndex(chunkX, chunkY)];
+  }
+
+  [[nodiscard]] float ChunkWorldWidth() const { return static_cast<float>(kChunkTiles * tileWidth); }
+  [[nodiscard]] float ChunkWorldHeight() const { return static_cast<float>(kChunkTiles * tileHeight); }
+};
+
+// Inclusive chunk range of a layer overlapping a world-space rect; empty (x0 > x1) when the rect
+// misses the layer. Used to pick the chunks to draw for the camera.
+struct TileChunkRange {
+  int x0 = 0, y0 = 0, x1 = -1, y1 = -1;
+  [[nodiscard]] bool Empty() const { return x0 > x1 || y0 > y1; }
+};
+
+inline TileChunkRange VisibleChunkRange(const TilemapLayerComponent& layer, const float minX, const float minY,
+                                        const float maxX, const float maxY) {
+  TileChunkRange range;
+  if (layer.tileWidth <= 0 || layer.tileHeight <= 0 || layer.width <= 0 || layer.height <= 0) return range;
+  const float chunkW = layer.ChunkWorldWidth();
+  const float chunkH = layer.ChunkWorldHeight();
+  const float localMinX = (minX - layer.origin.x) / chunkW;
+  const float localMinY = (minY - layer.origin.y) / chunkH;
+  const float localMaxX = (maxX - layer.origin.x) / chunkW;
+  const float localMaxY = (maxY - layer.origin.y) / chunkH;
+  if (localMaxX < 0.0f || localMaxY < 0.0f) return range;
+  const float chunksX = static_cast<float>(layer.ChunksX());
+  const float chunksY = static_cast<float>(layer.ChunksY());
+  if (localMinX >= chunksX || localMinY >= chunksY) return range;
+  range.x0 = static_cast<int>(std::floor(std::max(0.0f, localMinX)));
+  range.y0 = static_cast<int>(std::floor(std::max(0.0f, localMinY)));
+  range.x1 = std::min(layer.ChunksX() - 1, static_cast<int>(std::floor(localMaxX)));
+  range.y1 = std::min(layer.ChunksY() - 1, static_cast<int>(std::floor(localMaxY)));
+  return range;
+}
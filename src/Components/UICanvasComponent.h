@@ -5,6 +5,9 @@ struct UICanvasComponent {
   float width = 0.f;   // 0 = use viewport width at layout time
   float height = 0.f;  // 0 = use viewport height at layout time
   int baseLayer = 0;   // base render layer for all entities in this canvas
+  // Draw the canvas's subtree into a retained texture, redrawn only when something under it
+  // changes, and composite it as one quad on baseLayer (see Renderer/UICanvasCache.h).
+  bool cached = false;
 
   explicit UICanvasComponent(const bool t_isFixed = true, const float t_width = 0.f, const float t_height = 0.f,
                              const int t_baseLayer = 0)
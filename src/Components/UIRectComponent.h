@@ -8,6 +8,8 @@ struct UIRectComponent {
   float right = 0.f;
   float bottom = 0.f;
   int layer = 0;  // computed by UILayoutSystem from canvas.baseLayer + accumulated UIZIndexComponent.z
+  // UICanvasCache slot of the cached canvas this rect lies under this frame, or -1; set by UILayoutSystem.
+  int cacheSlot = -1;
 
   explicit UIRectComponent(const float t_left = 0.f, const float t_top = 0.f, const float t_right = 0.f,
                            const float t_bottom = 0.f, const int t_layer = 0)
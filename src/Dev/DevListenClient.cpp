@@ -251,6 +251,10 @@ ClientResult DevListenClient::EvalLua(const std::string& host_port, const std::s
                      static_cast<std::uint32_t>(src.size()));
 }
 
+ClientResult DevListenClient::RenderStats(const std::string& host_port, const std::uint32_t frames) {
+  return SendAndRecv(host_port, static_cast<std::uint32_t>(OpCode::RenderStats), &frames, sizeof(frames));
+}
+
 }  // namespace octarine::dev
 
 #endif  // !OCTARINE_SHIPPED
@@ -22,6 +22,9 @@ class DevListenClient {
                                 const std::vector<char>& content);
   static ClientResult ReloadScene(const std::string& host_port);
   static ClientResult EvalLua(const std::string& host_port, const std::string& src);
+  // The last `frames` frames of RenderStats as text lines (see OpCode::RenderStats). The first call
+  // switches collection on in the target.
+  static ClientResult RenderStats(const std::string& host_port, std::uint32_t frames);
 };
 
 }  // namespace octarine::dev
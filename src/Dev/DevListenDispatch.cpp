@@ -2,7 +2,9 @@
 
 #ifndef OCTARINE_SHIPPED
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -16,6 +18,7 @@
 #include "Engine/SceneLoader.h"
 #include "General/Logger.h"
 #include "Lua/HotReload/ScriptHotReload.h"
+#include "Renderer/RenderStats.h"
 
 namespace octarine::dev {
 namespace {
@@ -129,6 +132,32 @@ void HandlePushAsset(Registry& registry, const std::vector<char>& body, std::str
   reply_body = OkReply(path);
 }
 
+// The first query turns collection on, so it usually answers with few (or no) frames; poll again.
+void HandleRenderStats(Registry& registry, const std::vector<char>& body, std::string& reply_body) {
+  auto& history = registry.Get<RenderStatsHistory>();
+  history.Request();
+  std::uint32_t frames = RenderStatsHistory::kCapacity;
+  if (body.size() >= sizeof(frames)) std::memcpy(&frames, body.data(), sizeof(frames));
+  const std::size_t count = std::min<std::size_t>(frames, history.Size());
+  std::string lines;
+  char buf[96];
+  for (std::size_t age = count; age-- > 0;) {
+    const RenderStats& stats = history.Recent(age);
+    std::snprintf(buf, sizeof(buf), "frame=%llu sort_ms=%.3f draw_ms=%.3f",
+                  static_cast<unsigned long long>(stats.frame), static_cast<double>(stats.sortMs),
+                  static_cast<double>(stats.drawMs));
+    lines += buf;
+    stats.ForEachCount([&lines](const char* name, const std::uint32_t value) {
+      lines += ' ';
+      lines += name;
+      lines += '=';
+      lines += std::to_string(value);
+    });
+    lines += '\n';
+  }
+  reply_body = OkReply(lines);
+}
+
 }  // namespace
 
 CommandHandler MakeEngineCommandHandler(Registry& registry, sol::state& lua) {
@@ -149,6 +178,9 @@ CommandHandler MakeEngineCommandHandler(Registry& registry, sol::state& lua) {
       case OpCode::PushAsset:
         HandlePushAsset(*reg, body, reply_body);
         return;
+      case OpCode::RenderStats:
+        HandleRenderStats(*reg, body, reply_body);
+        return;
       default:
         reply_op = kErrorReplyOp;
         reply_body.clear();
@@ -174,6 +174,7 @@ bool IsMainThreadOp(OpCode op) {
     case OpCode::ReloadScene:
     case OpCode::PushScript:
     case OpCode::PushAsset:
+    case OpCode::RenderStats:
       return true;
     default:
       return false;
@@ -11,8 +11,8 @@
 //     hello reply:   op=Hello, body = "OCTARINE_DEV_LISTEN/v1\n"
 //     ping reply:    op=Pong,  body = client nonce echoed back
 //
-// Pure-I/O ops (Hello/Ping) reply directly on the listener thread. The engine-mutating ops
-// (EvalLua / ReloadScene / PushScript / PushAsset) cannot touch the Registry / sol::state /
+// Pure-I/O ops (Hello/Ping) reply directly on the listener thread. The engine ops (EvalLua /
+// ReloadScene / PushScript / PushAsset / RenderStats) cannot touch the Registry / sol::state /
 // AssetManager off the main thread, so the listener parks each one on a queue and blocks until
 // the main thread drains it in Pump(); Pump runs the command and hands the reply back so the
 // listener can write it and close. See `kPush*` body layout on each opcode below.
@@ -32,6 +32,9 @@ enum class OpCode : std::uint32_t {
   ReloadScene = 11,  // body: empty             -> re-runs the active scene; reply { u8 ok }
   PushScript = 12,   // body: u32 path_len | path | bytes -> writes script + forces reload; reply { u8 ok }
   PushAsset = 13,    // body: u32 path_len | path | bytes -> writes asset + reloads it; reply { u8 ok }
+  // body: optional u32 LE frame count (default: the whole history) -> enables RenderStats collection;
+  // reply { u8 ok, utf8 lines oldest first: `frame=N sort_ms=X draw_ms=X <count>=N ...` }
+  RenderStats = 14,
 };
 
 // Handler the engine installs to apply an engine-mutating op on the main thread. Invoked from
@@ -181,6 +181,11 @@ class ArchetypeQuery {
   }
   Iterator end() { return Iterator(type_, matching_archetypes_.end(), matching_archetypes_.end(), include_inactive_); }
 
+  // Default chunk filter for ParallelForEach: no coarse culling.
+  struct AcceptAllChunks {
+    constexpr bool operator()(const ChunkBounds& /*bounds*/) const noexcept { return true; }
+  };
+
   // Process all matching entities in parallel across chunks. Each chunk is an independent
   // memory region, so concurrent processing is safe for per-entity writes.
   // Func signature: void (Entity, TComponents&...) or void (TComponents&...).
@@ -190,9 +195,37 @@ class ArchetypeQuery {
   // instead of dispatching to the pool. Dispatch costs ~13.5 us regardless of N; for a trivial
   // per-entity body serial wins below ~16k entities, while heavy bodies cross over at a few
   // hundred — so the cutoff is per call site. Default 0 keeps the current always-parallel path.
+  //
+  // acceptChunk: bool(const ChunkBounds&), asked once per chunk before any of its entities are
+  // visited; a rejected chunk is skipped whole (coarse culling). Default accepts every chunk.
+  template <typename Func, typename ChunkFilter = AcceptAllChunks>
+  void ParallelForEach(Func&& func, const size_t serialBelowEntities = 0, ChunkFilter acceptChunk = {}) {
+    const auto work = CollectChunkWork(acceptChunk);
+    auto body = [&](const ChunkWork& w) { ProcessChunk(w, func); };
+    RunChunkWork(work, serialBelowEntities, body);
+  }
+
+  // Chunk-at-a-time variant for passes that need per-chunk results (e.g. chunk bounds):
+  // func(Archetype&, chunkIndex, entityCount, arrays...) with one pointer per component (nullptr
+  // for an absent Opt<T>). Same dispatch and serial gate as ParallelForEach.
   template <typename Func>
-  void ParallelForEach(Func&& func, const size_t serialBelowEntities = 0) {
-    const auto work = CollectChunkWork();
+  void ParallelForEachChunk(Func&& func, const size_t serialBelowEntities = 0) {
+    const auto work = CollectChunkWork(AcceptAllChunks{});
+    auto body = [&](const ChunkWork& w) {
+      std::apply([&](auto*... arrays) { func(*w.archetype, w.chunkIdx, w.entityCount, arrays...); }, ChunkArrays(w));
+    };
+    RunChunkWork(work, serialBelowEntities, body);
+  }
+
+ private:
+  struct ChunkWork {
+    Archetype* archetype;
+    size_t chunkIdx;
+    size_t entityCount;
+  };
+
+  template <typename Body>
+  void RunChunkWork(const std::vector<ChunkWork>& work, const size_t serialBelowEntities, Body& body) {
     if (work.empty()) return;
 
     if (serialBelowEntities > 0) {
@@ -202,7 +235,7 @@ class ArchetypeQuery {
       }
       if (totalEntities < serialBelowEntities) {
         PROFILE_COUNTER_ADD("ParallelForEach: SerialGated", 1);
-        ProcessChunks(work, 0, work.size(), func);
+        ProcessChunks(work, 0, work.size(), body);
         return;
       }
     }
@@ -211,7 +244,7 @@ class ArchetypeQuery {
     PROFILE_COUNTER_ADD("ParallelForEach: Batches", static_cast<long long>(num_batches));
     PROFILE_COUNTER_ADD("ParallelForEach: Chunks", static_cast<long long>(work.size()));
     if (num_batches <= 1) {
-      ProcessChunks(work, 0, work.size(), func);
+      ProcessChunks(work, 0, work.size(), body);
       return;
     }
 
@@ -222,25 +255,18 @@ class ArchetypeQuery {
     for (size_t t = 0; t < num_batches - 1; ++t) {
       const size_t begin = t * items_per_batch;
       const size_t end = std::min(begin + items_per_batch, work.size());
-      DispatchBatch(work, begin, end, barrier, func);
+      DispatchBatch(work, begin, end, barrier, body);
     }
 
     const size_t inline_begin = (num_batches - 1) * items_per_batch;
     const size_t inline_end = std::min(inline_begin + items_per_batch, work.size());
     if (inline_begin < inline_end) {
-      ProcessChunks(work, inline_begin, inline_end, func);
+      ProcessChunks(work, inline_begin, inline_end, body);
     }
 
     barrier.Wait();
   }
 
- private:
-  struct ChunkWork {
-    Archetype* archetype;
-    size_t chunkIdx;
-    size_t entityCount;
-  };
-
   // Counts down N expected completions and lets one waiter block on Wait().
   // Decrement and notify happen under the mutex so Wait() cannot return — and
   // therefore the BatchBarrier cannot be destroyed — until the last Signal()
@@ -266,12 +292,13 @@ class ArchetypeQuery {
     }
   };
 
-  std::vector<ChunkWork> CollectChunkWork() const {
+  template <typename ChunkFilter>
+  std::vector<ChunkWork> CollectChunkWork(ChunkFilter acceptChunk) const {
     std::vector<ChunkWork> work;
     for (auto* arch : matching_archetypes_) {
       for (size_t c = 0; c < arch->chunks_.size(); ++c) {
         const size_t count = include_inactive_ ? arch->chunks_[c].GetEntityCount() : arch->chunks_[c].GetActiveCount();
-        if (count > 0) {
+        if (count > 0 && acceptChunk(arch->chunks_[c].GetBounds())) {
           work.push_back({arch, c, count});
         }
       }
@@ -279,59 +306,64 @@ class ArchetypeQuery {
     return work;
   }
 
-  template <typename Func>
-  void DispatchBatch(const std::vector<ChunkWork>& work, size_t begin, size_t end, BatchBarrier& barrier, Func& func) {
+  template <typename Body>
+  void DispatchBatch(const std::vector<ChunkWork>& work, size_t begin, size_t end, BatchBarrier& barrier, Body& body) {
     if (begin >= end) {
       barrier.Signal();
       return;
     }
-    ThreadPool::Instance().Submit([&work, &func, this, begin, end, &barrier] {
-      ProcessChunks(work, begin, end, func);
+    ThreadPool::Instance().Submit([&work, &body, begin, end, &barrier] {
+      ProcessChunks(work, begin, end, body);
       barrier.Signal();
     });
   }
 
-  template <typename Func>
-  void ProcessChunks(const std::vector<ChunkWork>& work, size_t begin, size_t end, Func& func) {
-    for (size_t i = begin; i < end; ++i) {
-      const auto& w = work[i];
+  template <typename Body>
+  static void ProcessChunks(const std::vector<ChunkWork>& work, size_t begin, size_t end, Body& body) {
+    for (size_t i = begin; i < end; ++i) body(work[i]);
+  }
 
-      // Get typed component arrays directly from the chunk — same as Iterator::UpdateChunkPointers.
-      auto arrays = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
-        return std::make_tuple([&]() -> Internal::resolve_pointer_t<TComponents> {
-          using RawT = Internal::unwrap_opt_t<std::tuple_element_t<Is, std::tuple<TComponents...>>>;
-          if constexpr (Internal::is_optional_v<std::tuple_element_t<Is, std::tuple<TComponents...>>>) {
-            if (!w.archetype->HasComponent(type_[Is])) return nullptr;
-          }
-          return w.archetype->template GetComponentArray<RawT>(w.chunkIdx, type_[Is]);
-        }()...);
-      }(std::index_sequence_for<TComponents...>{});
+  // Typed component arrays for one chunk — same as Iterator::UpdateChunkPointers.
+  std::tuple<Internal::resolve_pointer_t<TComponents>...> ChunkArrays(const ChunkWork& w) const {
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return std::make_tuple([&]() -> Internal::resolve_pointer_t<TComponents> {
+        using RawT = Internal::unwrap_opt_t<std::tuple_element_t<Is, std::tuple<TComponents...>>>;
+        if constexpr (Internal::is_optional_v<std::tuple_element_t<Is, std::tuple<TComponents...>>>) {
+          if (!w.archetype->HasComponent(type_[Is])) return nullptr;
+        }
+        return w.archetype->template GetComponentArray<RawT>(w.chunkIdx, type_[Is]);
+      }()...);
+    }(std::index_sequence_for<TComponents...>{});
+  }
 
-      const Entity* entities = w.archetype->chunks_[w.chunkIdx].GetEntityArray();
-
-      for (size_t e = 0; e < w.entityCount; ++e) {
-        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
-          if constexpr (std::is_invocable_v<Func, Entity, Internal::resolve_yield_t<TComponents>...>) {
-            func(entities[e], [&]() -> Internal::resolve_yield_t<TComponents> {
-              auto* array = std::get<Is>(arrays);
-              if constexpr (Internal::is_optional_v<std::tuple_element_t<Is, std::tuple<TComponents...>>>) {
-                return array ? &array[e] : nullptr;
-              } else {
-                return array[e];
-              }
-            }()...);
-          } else {
-            func([&]() -> Internal::resolve_yield_t<TComponents> {
-              auto* array = std::get<Is>(arrays);
-              if constexpr (Internal::is_optional_v<std::tuple_element_t<Is, std::tuple<TComponents...>>>) {
-                return array ? &array[e] : nullptr;
-              } else {
-                return array[e];
-              }
-            }()...);
-          }
-        }(std::index_sequence_for<TComponents...>{});
-      }
+  template <typename Func>
+  void ProcessChunk(const ChunkWork& w, Func& func) const {
+    const auto arrays = ChunkArrays(w);
+
+    const Entity* entities = w.archetype->chunks_[w.chunkIdx].GetEntityArray();
+
+    for (size_t e = 0; e < w.entityCount; ++e) {
+      [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        if constexpr (std::is_invocable_v<Func, Entity, Internal::resolve_yield_t<TComponents>...>) {
+          func(entities[e], [&]() -> Internal::resolve_yield_t<TComponents> {
+            auto* array = std::get<Is>(arrays);
+            if constexpr (Internal::is_optional_v<std::tuple_element_t<Is, std::tuple<TComponents...>>>) {
+              return array ? &array[e] : nullptr;
+            } else {
+              return array[e];
+            }
+          }()...);
+        } else {
+          func([&]() -> Internal::resolve_yield_t<TComponents> {
+            auto* array = std::get<Is>(arrays);
+            if constexpr (Internal::is_optional_v<std::tuple_element_t<Is, std::tuple<TComponents...>>>) {
+              return array ? &array[e] : nullptr;
+            } else {
+              return array[e];
+            }
+          }()...);
+        }
+      }(std::index_sequence_for<TComponents...>{});
     }
   }
 
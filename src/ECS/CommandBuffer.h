@@ -82,6 +82,10 @@ class CommandBuffer {
     state_->deferred.Emplace([entity](Registry* r) { r->RemoveTag<T>(entity); });
   }
 
+  // Arbitrary main-thread work, e.g. a script callback a worker can't make itself. Runs in
+  // emplacement order after the entity commands.
+  void Defer(DeferredFn fn) const { state_->deferred.Emplace(std::move(fn)); }
+
   void Playback(Registry* registry) const;
 
  private:
@@ -22,6 +22,19 @@ struct ChunkHeader {
   uint32_t active_count;
 };
 
+// World-space AABB over a chunk's active renderables, written by TransformSystem when chunk
+// culling is enabled (EngineOptions::chunkCulling) so render producers can skip whole chunks
+// outside the view. Reset to invalid whenever an entity becomes active in the chunk or something
+// the bounds were computed from changes (see TransformSystem::UpdateChunkBounds); a consumer must
+// treat an invalid chunk as visible. Removals leave it valid (still a superset).
+struct ChunkBounds {
+  float minX = 0.0f;
+  float minY = 0.0f;
+  float maxX = 0.0f;
+  float maxY = 0.0f;
+  bool valid = false;
+};
+
 // Outcome of Chunk::RemoveEntity: up to two entities may have been moved into different slots
 // (one when crossing the active/inactive boundary, one for the standard swap-with-end). The
 // caller patches entity_locations_ for each.
@@ -80,7 +93,7 @@ class Chunk {
 
   ~Chunk() { ::operator delete[](buffer_, std::align_val_t{kChunkAlignment}); }
 
-  Chunk(Chunk&& other) noexcept : header_(other.header_), buffer_(other.buffer_) {
+  Chunk(Chunk&& other) noexcept : header_(other.header_), bounds_(other.bounds_), buffer_(other.buffer_) {
     other.buffer_ = nullptr;
     other.header_.entity_count = 0;
     other.header_.active_count = 0;
@@ -90,6 +103,7 @@ class Chunk {
     if (this != &other) {
       ::operator delete[](buffer_, std::align_val_t{kChunkAlignment});
       header_ = other.header_;
+      bounds_ = other.bounds_;
       buffer_ = other.buffer_;
       other.buffer_ = nullptr;
       other.header_.entity_count = 0;
@@ -131,8 +145,13 @@ class Chunk {
   void IncrementActive() {
     assert(header_.active_count < header_.entity_count);
     ++header_.active_count;
+    bounds_.valid = false;
   }
 
+  [[nodiscard]] const ChunkBounds& GetBounds() const { return bounds_; }
+  void SetBounds(const ChunkBounds& bounds) { bounds_ = bounds; }
+  void InvalidateBounds() { bounds_.valid = false; }
+
   void DecrementActive() {
     assert(header_.active_count > 0);
     --header_.active_count;
@@ -218,6 +237,7 @@ class Chunk {
 
  private:
   ChunkHeader header_;
+  ChunkBounds bounds_;
   unsigned char* buffer_;
 };
 
@@ -257,6 +277,7 @@ class Archetype {
   }
 
   EntityLocation AddEntity(const Entity entity) {
+    ++membership_version_;
     // Cached first-non-full chunk index advances monotonically as earlier chunks fill.
     while (first_non_full_chunk_ < chunks_.size() &&
            chunks_[first_non_full_chunk_].GetEntityCount() >= chunk_capacity_) {
@@ -278,6 +299,7 @@ class Archetype {
   // entity_locations_ for each returned entity using the recorded slot.
   std::vector<ChunkRemoveSwap> RemoveEntity(const EntityLocation& location) {
     AssertLocation(location);
+    ++membership_version_;
     auto swaps = chunks_[location.chunkIndex].RemoveEntity(location.indexInChunk, component_offsets_, component_infos_);
     if (location.chunkIndex < first_non_full_chunk_) {
       first_non_full_chunk_ = location.chunkIndex;
@@ -300,6 +322,7 @@ class Archetype {
     AssertLocation(location);
     auto& chunk = chunks_[location.chunkIndex];
     assert(location.indexInChunk >= chunk.GetActiveCount());
+    ++membership_version_;
     const size_t boundary = chunk.GetActiveCount();
     PartitionResult result{boundary, std::nullopt};
     if (location.indexInChunk != boundary) {
@@ -317,6 +340,7 @@ class Archetype {
     AssertLocation(location);
     auto& chunk = chunks_[location.chunkIndex];
     assert(location.indexInChunk < chunk.GetActiveCount());
+    ++membership_version_;
     chunk.DecrementActive();
     const size_t boundary = chunk.GetActiveCount();  // post-decrement: new first inactive slot
     PartitionResult result{boundary, std::nullopt};
@@ -329,6 +353,28 @@ class Archetype {
 
   [[nodiscard]] bool HasComponent(const ComponentID id) const { return component_type_to_index_.contains(id); }
 
+  // Bumped whenever the archetype's entity set (or its active partition) changes: add, remove,
+  // activate, deactivate. Component writes don't touch it. Lets a cache over a query's entities
+  // detect membership changes without rescanning.
+  [[nodiscard]] uint64_t MembershipVersion() const noexcept { return membership_version_; }
+
+  [[nodiscard]] const ChunkBounds& GetChunkBounds(const size_t chunkIndex) const {
+    assert(chunkIndex < chunks_.size());
+    return chunks_[chunkIndex].GetBounds();
+  }
+
+  // Called per chunk from parallel passes; distinct chunks never share state.
+  void SetChunkBounds(const size_t chunkIndex, const ChunkBounds& bounds) {
+    assert(chunkIndex < chunks_.size());
+    chunks_[chunkIndex].SetBounds(bounds);
+  }
+
+  // For writers that move an entity after the bounds pass (e.g. the contact solver's correction).
+  void InvalidateChunkBounds(const size_t chunkIndex) {
+    assert(chunkIndex < chunks_.size());
+    chunks_[chunkIndex].InvalidateBounds();
+  }
+
   template <typename T>
   void AddComponent(const EntityLocation& location, const Entity& componentEntity, const T& component) {
     AssertLocation(location);
@@ -443,4 +489,5 @@ class Archetype {
   std::vector<Chunk> chunks_;
   size_t chunk_capacity_;
   size_t first_non_full_chunk_ = 0;
+  uint64_t membership_version_ = 0;
 };
\ No newline at end of file
@@ -136,9 +136,16 @@ class ComponentQuery final : public Query {
   // Func signature: void (Entity, TComponents&...) or void(TComponents&...).
   // serialBelowEntities: run serially on the calling thread when fewer entities match —
   // see ArchetypeQuery::ParallelForEach for the cost model.
+  // acceptChunk: optional bool(const ChunkBounds&) chunk filter — see ArchetypeQuery::ParallelForEach.
+  template <typename Func, typename ChunkFilter = typename ArchetypeQuery<TComponents...>::AcceptAllChunks>
+  void ParallelForEach(Func&& func, const size_t serialBelowEntities = 0, ChunkFilter acceptChunk = {}) {
+    archetype_query_.ParallelForEach(std::forward<Func>(func), serialBelowEntities, acceptChunk);
+  }
+
+  // Per-chunk parallel pass: func(Archetype&, chunkIndex, entityCount, arrays...).
   template <typename Func>
-  void ParallelForEach(Func&& func, const size_t serialBelowEntities = 0) {
-    archetype_query_.ParallelForEach(std::forward<Func>(func), serialBelowEntities);
+  void ParallelForEachChunk(Func&& func, const size_t serialBelowEntities = 0) {
+    archetype_query_.ParallelForEachChunk(std::forward<Func>(func), serialBelowEntities);
   }
 
   template <typename Func>
@@ -148,6 +155,15 @@ class ComponentQuery final : public Query {
 
   [[nodiscard]] size_t GetCount() const { return archetype_query_.GetTotalEntityCount(); }
 
+  // Changes whenever an entity enters or leaves the matched set (as of the last Update): the sum
+  // of the matched archetypes' membership versions, plus the match count so a newly matched
+  // archetype registers even before its first entity lands. Only ever grows.
+  [[nodiscard]] uint64_t MembershipVersion() const {
+    uint64_t version = matched_.size();
+    for (const Archetype* arch : matched_) version += arch->MembershipVersion();
+    return version;
+  }
+
  private:
   // ContextFacade-based iteration doesn't easily support optional components yet (requires
   // updating ContextFacade and IteratorImpl). For now, systems using Opt<T> must use the
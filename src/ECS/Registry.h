@@ -227,6 +227,8 @@ class Registry {
     if (id < entity_locations_.size() && entity_locations_[id].archetype != nullptr &&
         entity_manager_->IsValid(entity) && entity_locations_[id].archetype->HasComponent(componentEntity.GetId())) {
       GetComponent<T>(entity) = std::move(component);
+      // A replaced component may change what the chunk's bounds were computed from.
+      entity_locations_[id].archetype->InvalidateChunkBounds(entity_locations_[id].chunkIndex);
       return;
     }
     const EntityLocation newLocation = TransitionAddComponent(entity, componentEntity.GetId());
@@ -348,7 +350,12 @@ class Registry {
           : ISystem(PrettifyTypeName(typeid(StoredFunc).name())),
             registry_(registry),
             func_(std::forward<Func>(f)),
-            query_(registry->CreateQuery<TArgs...>()) {}
+            query_(registry->CreateQuery<TArgs...>()) {
+        // Optional hook to add tag filters (WithTag/WithoutTag) to the wrapper's query.
+        if constexpr (requires { func_.ConfigureQuery(*query_); }) {
+          func_.ConfigureQuery(*query_);
+        }
+      }
 
       void Update(const Registry& registry) override {
         query_->Update();
@@ -358,6 +365,15 @@ class Registry {
           func_.Prepare(registry_);
         }
 
+        // Optional coarse-cull hook: func_.AcceptChunk(const ChunkBounds&) skips whole chunks.
+        const auto acceptChunk = [this](const ChunkBounds& bounds) {
+          if constexpr (requires { func_.AcceptChunk(bounds); }) {
+            return func_.AcceptChunk(bounds);
+          } else {
+            return true;
+          }
+        };
+
         if constexpr (std::is_invocable_v<StoredFunc, Entity, float, TArgs&...> ||
                       std::is_invocable_v<StoredFunc, Entity, TArgs&...>) {
           query_->ParallelForEach([this, dt](Entity entity, TArgs&... args) {
@@ -371,7 +387,7 @@ class Registry {
                             "The function passed to ForEach does not match the required signatures. "
                             "Expected one of: void(Entity, T&...), void(Entity, float, T&...).");
             }
-          });
+          }, 0, acceptChunk);
         } else if constexpr (std::is_invocable_v<StoredFunc, float, TArgs&...> ||
                              std::is_invocable_v<StoredFunc, TArgs&...>) {
           query_->ParallelForEach([this, dt](TArgs&... args) {
@@ -385,7 +401,7 @@ class Registry {
                             "The function passed to ForEach does not match the required signatures. "
                             "Expected one of: void(float, T&...), void(T&...).");
             }
-          });
+          }, 0, acceptChunk);
         } else {
           static_assert(
               !std::is_same_v<Func, Func>,
@@ -13,6 +13,13 @@ template <>
 struct EditorInspector<AnimationComponent> {
   static constexpr const char* kDisplayName = "Animation";
   static void draw(Registry* /*registry*/, Entity /*entity*/, AnimationComponent& anim) {
+    if (!anim.clipId.empty()) {
+      ImGui::Text("Clip: %s", anim.clipId.c_str());
+      ImGui::Text("Step: %u  Time: %.2fs", anim.clipStep, static_cast<double>(anim.clipTime));
+      ImGui::DragFloat("Clip Speed", &anim.clipSpeed, 0.05f, 0.0f, 10.0f);
+      if (ImGui::Button("Restart")) anim.Play(anim.clipId, true);
+      return;
+    }
     ImGui::Text("Num Frames: %d", anim.numFrames);
     ImGui::SliderInt("Current Frame", &anim.currentFrame, 1, anim.numFrames);
     ImGui::DragInt("Frame Speed (ms)", &anim.frameRateSpeed);
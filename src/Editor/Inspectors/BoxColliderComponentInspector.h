@@ -17,6 +17,7 @@ struct EditorInspector<BoxColliderComponent> {
     ImGui::DragInt("Height", &bc.height);
     ImGui::DragFloat2("Offset", &bc.offset.x, 1.0F);
     ImGui::Checkbox("Fixed", &bc.isFixed);
+    ImGui::Checkbox("Continuous (CCD)", &bc.continuous);
   }
   static std::optional<BoxColliderComponent> makeDefault() { return BoxColliderComponent{}; }
 };
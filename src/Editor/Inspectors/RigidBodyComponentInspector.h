@@ -14,6 +14,10 @@ struct EditorInspector<RigidBodyComponent> {
   static constexpr const char* kDisplayName = "RigidBody";
   static void draw(Registry* /*registry*/, Entity /*entity*/, RigidBodyComponent& rb) {
     ImGui::DragFloat2("Velocity", &rb.velocity.x, 1.0F);
+    ImGui::Checkbox("Simulated", &rb.simulated);
+    ImGui::DragFloat("Mass", &rb.mass, 0.1F, 0.0F, 10000.0F);
+    ImGui::DragFloat("Restitution", &rb.restitution, 0.01F, 0.0F, 1.0F);
+    ImGui::DragFloat("Friction", &rb.friction, 0.01F, 0.0F, 2.0F);
   }
   static std::optional<RigidBodyComponent> makeDefault() { return RigidBodyComponent{}; }
 };
@@ -15,6 +15,12 @@ void DrawAssetBrowserWindow(Registry* registry) {
     const auto& textures = assetManager.GetTextures();
     ImGui::Text("Loaded: %zu", textures.size());
     for (const auto& [id, texture] : textures) ImGui::BulletText("%s", id.c_str());
+    const DynamicTextureAtlas& atlas = assetManager.GetDynamicAtlas();
+    if (const DynamicTextureAtlas::Stats stats = atlas.GetStats(); stats.pages > 0) {
+      ImGui::Text("Dynamic atlas: %zu on %zu page(s), %.1f MB", stats.liveEntries, stats.pages,
+                  static_cast<double>(stats.residentBytes) / (1024.0 * 1024.0));
+      for (const std::string& id : atlas.LiveIds()) ImGui::BulletText("%s (atlas)", id.c_str());
+    }
   }
   if (ImGui::CollapsingHeader("Fonts", ImGuiTreeNodeFlags_DefaultOpen)) {
     const auto& fonts = assetManager.GetFonts();
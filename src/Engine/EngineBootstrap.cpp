@@ -19,11 +19,17 @@
 #include "General/Rect.h"
 #include "Lua/Bindings/RegisterAllBindings.h"
 #include "Lua/Modules/RegisterAllModules.h"
+#include "Renderer/DebugDraw.h"
 #include "Renderer/RenderQueue.h"
-#include "Renderer/SpriteRenderCache.h"
+#include "Renderer/RenderStats.h"
+#include "Renderer/StaticSpriteLayer.h"
+#include "Renderer/TextTextureCache.h"
+#include "Renderer/UICanvasCache.h"
 #include "Systems/EntityPoolSystem.h"
 #include "Systems/InputSystem.h"
+#include "Systems/ParticlePool.h"
 #include "Systems/ProjectileEmitSystem.h"
+#include "Systems/TileCollisionGrid.h"
 
 #ifdef OCTARINE_WITH_EDITOR
 #include "Editor/Inspectors/RegisterAllInspectors.h"
@@ -90,16 +96,23 @@ void InstallCoreSingletons(Registry& registry, EngineContext& context, const int
   const octarine::Rect camera{0, 0, static_cast<float>(windowWidth), static_cast<float>(windowHeight)};
 
   registry.Set<RenderQueue>(RenderQueue());
+  registry.Set<RenderStatsHistory>(RenderStatsHistory());
+  registry.Set<DebugDraw>(DebugDraw());
+  registry.Set<ParticleStore>(ParticleStore());
+  registry.Set<StaticSpriteLayer>(StaticSpriteLayer());
+  registry.Set<TileCollisionGrid>(TileCollisionGrid());
   registry.Set<CameraComponent>(CameraComponent{camera});
   registry.Set<AssetManager>(AssetManager());
   registry.Set<ViewportInfo>(ViewportInfo{0, 0, static_cast<float>(windowWidth), static_cast<float>(windowHeight)});
   if (withFramePathCaches) {
-    // Entity-keyed backend-handle caches, each replacing a handle that used to live on a POD
-    // component: SpriteRenderCache ← SpriteComponent.cachedTexture (SDL_Texture*), AudioTrackCache
-    // ← AudioSinkComponent.track (MIX_Track*). Bake runs no frames and no audio systems, so it
-    // skips both slots.
-    registry.Set<SpriteRenderCache>(SpriteRenderCache());
+    // Backend-handle caches: AudioTrackCache is entity-keyed and replaces the MIX_Track* that used
+    // to live on AudioSinkComponent. TextTextureCache is the content-keyed store of
+    // RenderTextSystem's rasterized labels, UICanvasCache the retained textures of cached UI
+    // canvases. Bake runs no frames and no audio systems, so it skips all three slots. (Sprite
+    // textures need no cache: SpriteComponent carries an interned AssetHandle.)
     registry.Set<AudioTrackCache>(AudioTrackCache());
+    registry.Set<TextTextureCache>(TextTextureCache(SDL_DestroyTexture));
+    registry.Set<UICanvasCache>(UICanvasCache(SDL_DestroyTexture));
   }
 
   // Publish the now-live AssetManager onto the context so consumers reach it without a
@@ -115,9 +128,10 @@ ProjectileEmitSystem& InstallPoolAndProjectile(Registry& registry) {
 
   // ProjectileEmitSystem Set + Init so GameModule's fire_projectile binding can capture it
   // from the Registry during the modules-install phase below. Init only does
-  // RegisterPool<...> calls — safe before scene/system registration.
+  // RegisterPool<...> calls — safe before scene/system registration. The AssetManager is Set by
+  // InstallCoreSingletons, so the pooled bullets' sprite id is interned once here.
   auto& projectileEmitSystem = registry.Set<ProjectileEmitSystem>(ProjectileEmitSystem());
-  projectileEmitSystem.Init(registry);
+  projectileEmitSystem.Init(registry, registry.Get<AssetManager>().Intern("bullet-texture"));
   return projectileEmitSystem;
 }
 
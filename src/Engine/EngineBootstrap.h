@@ -33,16 +33,18 @@ namespace engine_bootstrap {
 void InstallLuaLibraries(sol::state& lua);
 
 // Set the engine-level Registry singletons that the startup script + Lua modules read at
-// install time: RenderQueue, CameraComponent (sized to the window), AssetManager,
-// ViewportInfo, and — on the live-frame path only (withFramePathCaches; bake skips them since
-// no frames render and no audio systems run) — the entity-keyed backend-handle caches
-// SpriteRenderCache and AudioTrackCache. Also plumbs the freshly-Set AssetManager pointer onto
-// the EngineContext; other context fields must already be populated by the caller.
+// install time: RenderQueue, DebugDraw, ParticleStore, StaticSpriteLayer, TileCollisionGrid,
+// CameraComponent (sized to the window), AssetManager, ViewportInfo, and — on the live-frame path only
+// (withFramePathCaches; bake skips them since no frames render and no audio systems run) — the
+// backend-handle caches AudioTrackCache, TextTextureCache and UICanvasCache. Also plumbs the
+// freshly-Set AssetManager pointer onto the EngineContext; other context fields must already be
+// populated by the caller.
 void InstallCoreSingletons(Registry& registry, EngineContext& context, int windowWidth, int windowHeight,
                            bool withFramePathCaches);
 
 // EntityPoolManager + ProjectileEmitSystem. ProjectileEmitSystem::Init calls RegisterPool
-// against the EntityPoolManager, so EntityPoolManager must be Set first. Both bind Lua
+// against the EntityPoolManager, so EntityPoolManager must be Set first; it also interns the
+// bullet sprite through the AssetManager InstallCoreSingletons Set. Both bind Lua
 // surfaces (fire_projectile), so registration must happen before InstallLuaModules.
 // Returns the system reference so callers can stash it for later use.
 ProjectileEmitSystem& InstallPoolAndProjectile(Registry& registry);
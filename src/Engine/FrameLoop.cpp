@@ -4,10 +4,14 @@
 #include <SDL3_mixer/SDL_mixer.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
+#include <string>
 
 #include "AssetManager/AssetHotReload.h"
 #include "AssetManager/AssetManager.h"
+#include "Components/CameraComponents.h"
 #include "Components/ViewportInfo.h"
 #include "ECS/Registry.h"
 #include "Engine/EngineContext.h"
@@ -18,11 +22,16 @@
 #include "Events/MouseWheelEvent.h"
 #include "Game/Game.h"
 #include "Game/GameConfig.h"
+#include "General/Constants.h"
 #include "General/Logger.h"
 #include "General/PerfUtils.h"
+#include "General/Utils.h"
 #include "Lua/HotReload/ScriptHotReload.h"
+#include "Renderer/DebugDraw.h"
 #include "Renderer/RenderQueue.h"
+#include "Renderer/RenderStats.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/UICanvasCache.h"
 #include "Systems/DrawColliderSystem.h"
 #include "Systems/InputSystem.h"
 #include "Systems/PerfOverlaySystem.h"
@@ -37,6 +46,18 @@
 #include "imgui_impl_sdl3.h"
 #endif
 
+namespace {
+// Below this many colliders the wireframe pass isn't worth fanning out to the thread pool.
+constexpr size_t kDrawColliderSerialBelow = 2048;
+
+// Frame-time target for dynamic resolution: the explicit budget, else the frame cap's period.
+float ResolutionBudgetMs(const EngineOptions& options) {
+  if (options.dynamicResolutionBudgetMs > 0.0F) return options.dynamicResolutionBudgetMs;
+  const int fps = options.fpsTarget > 0 ? options.fpsTarget : Constants::kFps;
+  return 1000.0F / static_cast<float>(fps);
+}
+}  // namespace
+
 #ifndef OCTARINE_SHIPPED
 namespace {
 // Portable env read. MSVC deprecates std::getenv (C4996) and the build treats warnings as errors,
@@ -179,6 +200,10 @@ void FrameLoop::Update(const float deltaTime) {
   }
 #endif
 
+  // Bring interned asset handles up to date with last frame's loads, unloads and hot reloads, so
+  // the systems resolve sprites, labels and audio sources by index rather than by id.
+  registry_->Get<AssetManager>().RefreshHandles();
+
   if (!options.isPaused || options.stepFrame) {
     registry_->Update(deltaTime * options.timeScale);
     options.stepFrame = false;
@@ -199,29 +224,86 @@ void FrameLoop::Render(const float deltaTime) {
   auto& gameConfig = registry_->Get<GameConfig>();
 
   PROFILE_COUNTER_SET("RenderQueue: Size", static_cast<long long>(renderQueue.Size()));
+  PROFILE_COUNTER_SET("RenderQueue: High water", static_cast<long long>(renderQueue.HighWaterMark()));
+  PROFILE_COUNTER_SET("RenderQueue: Capacity", static_cast<long long>(renderQueue.Capacity()));
+  PROFILE_COUNTER_SET("RenderQueue: Growth events", static_cast<long long>(renderQueue.GrowthEvents()));
   PROFILE_COUNTER_SET("Entities: User", static_cast<long long>(registry_->GetUserEntityCount()));
 
+  // Pick this frame's scene scale from the last frame's cost; back to full scale when switched off.
+  if (const auto& engineOptions = gameConfig.GetEngineOptions(); engineOptions.dynamicResolution) {
+    dynamic_resolution_.SetMinScale(engineOptions.dynamicResolutionMinScale);
+    dynamic_resolution_.Update(last_frame_work_ms_, ResolutionBudgetMs(engineOptions));
+    renderer_->SetSceneScale(runtime_->SdlRenderer(), dynamic_resolution_.Scale());
+  } else if (dynamic_resolution_.Step() != 0) {
+    dynamic_resolution_.Reset();
+    renderer_->SetSceneScale(runtime_->SdlRenderer(), 1.0F);
+  }
+  PROFILE_COUNTER_SET("Render: Scene scale percent",
+                      static_cast<long long>(std::lround(renderer_->GetSceneScale() * 100.0F)));
+
+  // Redraw this frame's changed cached UI canvas into its texture before the scene samples it. Its
+  // draw calls count toward this frame's RenderStats, so the tally starts before it.
+  renderer_->ResetStats();
+  if (auto* canvasCache = registry_->TryGet<UICanvasCache>()) {
+    canvasCache->Flush([this](const RenderQueue& canvasQueue, SDL_Texture* target) {
+      renderer_->DrawQueueToTexture(canvasQueue, runtime_->SdlRenderer(), target);
+    });
+  }
+
   renderer_->BeginScene(runtime_->SdlRenderer());
 
+  // RenderStats: only read the clock (and fill the record below) while collection is on.
+  using StatsClock = std::chrono::steady_clock;
+  auto& renderStats = registry_->Get<RenderStatsHistory>();
+  const bool collectStats = renderStats.IsEnabled();
+  const StatsClock::time_point sortStart = collectStats ? StatsClock::now() : StatsClock::time_point{};
 #ifdef OCTARINE_PROFILING
   {
     PerfUtils::ScopedTimer sortTimer("Render: Sort");
     renderQueue.Sort();
   }
+#else
+  renderQueue.Sort();
+#endif
+  const StatsClock::time_point drawStart = collectStats ? StatsClock::now() : StatsClock::time_point{};
+#ifdef OCTARINE_PROFILING
   {
     PerfUtils::ScopedTimer drawTimer("Render: Draw");
     renderer_->DrawQueue(renderQueue, runtime_->SdlRenderer());
   }
 #else
-  renderQueue.Sort();
   renderer_->DrawQueue(renderQueue, runtime_->SdlRenderer());
 #endif
+  if (collectStats) {
+    const StatsClock::time_point drawEnd = StatsClock::now();
+    RenderStats stats;
+    renderStats.TakeCulling(stats);
+    renderQueue.FillStats(stats);
+    renderer_->FillStats(stats);
+    stats.sortMs = std::chrono::duration<float, std::milli>(drawStart - sortStart).count();
+    stats.drawMs = std::chrono::duration<float, std::milli>(drawEnd - drawStart).count();
+    renderStats.Push(stats);
+#ifdef OCTARINE_PROFILING
+    // Bench runs get every count as a COUNTER line; sort and draw are TIMER lines already.
+    stats.ForEachCount([](const char* name, const std::uint32_t value) {
+      PROFILE_COUNTER_SET(std::string("RenderStats: ") + name, static_cast<long long>(value));
+    });
+#endif
+  }
+  [[maybe_unused]] const SpriteBatchStats& batchStats = renderer_->GetSpriteBatchStats();
+  PROFILE_COUNTER_SET("Render: Sprite runs", static_cast<long long>(batchStats.runs));
+  PROFILE_COUNTER_SET("Render: Batch breaks",
+                      static_cast<long long>(batchStats.textureBreaks + batchStats.blendBreaks +
+                                             batchStats.commandBreaks));
 
+  auto& debugDraw = registry_->Get<DebugDraw>();
   if (gameConfig.GetEngineOptions().drawColliders && collider_query_) {
     collider_query_->Update();
-    DrawColliderSystem drawColliderSystem;
-    collider_query_->ForEach(drawColliderSystem);
+    collider_query_->ParallelForEach(DrawColliderSystem(debugDraw), kDrawColliderSerialBelow);
   }
+  // Collider wireframes plus whatever systems and scripts drew this frame, in one geometry call.
+  const auto& camera = registry_->Get<CameraComponent>().viewport;
+  debugDraw.Flush(runtime_->SdlRenderer(), camera.x, camera.y);
 
   // Built-in perf overlay (no ImGui). Drawn into the scene texture so it composites for both the
   // player (CompositeSceneToWindow) and the editor Scene panel, and rides along in --capture dumps.
@@ -232,6 +314,13 @@ void FrameLoop::Render(const float deltaTime) {
   renderer_->EndScene(runtime_->SdlRenderer());
 
   auto& options = gameConfig.GetEngineOptions();
+  // Collection for the next frame: profiling (bench) builds always, otherwise only while the perf
+  // overlay shows its render rows (or a dev-listen client has asked, which RenderStatsHistory keeps).
+#ifdef OCTARINE_PROFILING
+  renderStats.SetEnabled(true);
+#else
+  renderStats.SetEnabled(options.showPerfOverlay && HasFlag(options.perfOverlayMetrics, PerfOverlayMetrics::Render));
+#endif
   const bool editorSession = gameConfig.IsEditorMode() || !gameConfig.HasLoadedConfig();
 
   // Update viewport info for non-editor sessions or when ImGui is disabled.
@@ -276,6 +365,8 @@ void FrameLoop::Render(const float deltaTime) {
   // alongside TIMER lines. All systems for this frame have already written their values.
   PROFILE_COUNTERS_REPORT();
   renderQueue.Clear();
+  last_frame_work_ms_ = static_cast<float>(static_cast<double>(SDL_GetTicksNS() - nanoseconds_previous_frame_) /
+                                           static_cast<double>(SDL_NS_PER_MS));
 
 #ifndef OCTARINE_SHIPPED
   // Headless capture: once the target frame is reached, write the rendered scene to disk and quit.
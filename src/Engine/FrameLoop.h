@@ -10,6 +10,7 @@
 #include "Components/GlobalTransformComponent.h"
 #include "ECS/Query.h"
 #include "EventBus/EventBus.h"
+#include "Renderer/DynamicResolution.h"
 #include "Systems/PerfOverlaySystem.h"
 
 class Game;
@@ -74,6 +75,10 @@ class FrameLoop {
   // Built-in (no-ImGui) FPS + frame-time overlay. Holds a small per-line text-texture cache, so it
   // is a long-lived member rather than reconstructed each frame.
   PerfOverlaySystem perf_overlay_;
+  // Scene-scale controller for EngineOptions::dynamicResolution, fed the previous frame's work time
+  // (Update + Render, excluding the WaitTime sleep) at the start of each Render.
+  DynamicResolution dynamic_resolution_;
+  float last_frame_work_ms_ = 0.0F;
 
 #ifndef OCTARINE_SHIPPED
   // Headless frame-capture (env-driven, dev/bench only). When OCTARINE_CAPTURE_PATH is set, the
@@ -15,10 +15,10 @@
 #include "Engine/EngineContext.h"
 #include "Engine/LuaProtect.h"
 #include "Engine/SdlFileReader.h"
+#include "Engine/TilemapLoader.h"
 #include "Game/GameConfig.h"
 #include "General/Logger.h"
 #include "Lua/LuaEntityLoader.h"
-#include "Renderer/SpriteRenderCache.h"
 #include "Systems/InputSystem.h"
 
 #ifdef OCTARINE_WITH_EDITOR
@@ -177,6 +177,12 @@ void SceneLoader::LoadScene(const std::string& scenePath) {
         Logger::Info("Loaded " + std::to_string(entityCount) + " entities from scene table.");
       }
 
+      // 2b. Tile layers (one TilemapLayerComponent entity per layer; cleared with the entities).
+      if (sol::optional<sol::table> tilemap = sceneTable["tilemap"]; tilemap && tilemap->valid()) {
+        const int layerCount = tilemap_loader::LoadSceneTilemap(*registry_, lua_, *tilemap);
+        Logger::Info("Loaded " + std::to_string(layerCount) + " tilemap layer(s) from scene table.");
+      }
+
       // 3. Try to call a 'run' or 'load' or 'setup' function if present
       sol::optional<sol::function> runFunc = sceneTable["run"];
       if (!runFunc) runFunc = sceneTable["load"].get<sol::optional<sol::function>>();
@@ -238,13 +244,9 @@ void SceneLoader::clearSceneEntities() {
   if (auto* inputSystem = registry_->TryGet<InputSystem>()) {
     inputSystem->ResetLuaState();
   }
-  // Drop cached SDL_Texture* lookups for entities that just got blammed; the next sprite-emit
-  // pass repopulates as those entities are recreated by the new scene's load.
-  if (auto* spriteCache = registry_->TryGet<SpriteRenderCache>()) {
-    spriteCache->Clear();
-  }
-  // Same for cached MIX_Track* handles — the just-blammed emitters' sinks are gone; AudioSystem
-  // re-acquires + re-caches tracks for the new scene's emitters as they play.
+  // Drop cached MIX_Track* handles — the just-blammed emitters' sinks are gone; AudioSystem
+  // re-acquires + re-caches tracks for the new scene's emitters as they play. Interned asset
+  // handles stay: they name ids, not entities, and the next scene reuses most of them.
   if (auto* trackCache = registry_->TryGet<AudioTrackCache>()) {
     trackCache->Clear();
   }
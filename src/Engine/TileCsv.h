@@ -0,0 +1,71 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Parse one tile layer from CSV text: one row of the map per line, comma-separated 0-based tileset
+// indices, -1 (or any negative value) for an empty cell — the layout Tiled's CSV export writes.
+// Blank lines and a trailing comma at the end of a row are ignored. On success fills `tiles`
+// row-major and sets width/height; on failure returns false with `error` naming the bad line.
+// Header-only so the headless tests can exercise it without SDL or Lua.
+inline bool ParseTileCsv(const std::string_view text, std::vector<std::int32_t>& tiles, int& width, int& height,
+                         std::string& error) {
+  tiles.clear();
+  width = 0;
+  height = 0;
+  int lineNumber = 0;
+  size_t lineStart = 0;
+  while (lineStart <= text.size()) {
+    size_t lineEnd = text.find('\n', lineStart);
+    if (lineEnd == std::string_view::npos) lineEnd = text.size();
+    const std::string_view line = text.substr(lineStart, lineEnd - lineStart);
+    lineStart = lineEnd + 1;
+    ++lineNumber;
+
+    int rowWidth = 0;
+    bool sawValue = false;
+    size_t pos = 0;
+    while (pos <= line.size()) {
+      size_t comma = line.find(',', pos);
+      if (comma == std::string_view::npos) comma = line.size();
+      std::string_view cell = line.substr(pos, comma - pos);
+      pos = comma + 1;
+      while (!cell.empty() && (cell.front() == ' ' || cell.front() == '\t')) cell.remove_prefix(1);
+      while (!cell.empty() && (cell.back() == ' ' || cell.back() == '\t' || cell.back() == '\r')) {
+        cell.remove_suffix(1);
+      }
+      if (cell.empty()) {
+        // A trailing comma (or a blank line) leaves one empty cell at the end; anything else is a hole.
+        if (comma == line.size()) break;
+        error = "empty cell on line " + std::to_string(lineNumber);
+        return false;
+      }
+      std::int32_t value = 0;
+      const auto [end, ec] = std::from_chars(cell.data(), cell.data() + cell.size(), value);
+      if (ec != std::errc() || end != cell.data() + cell.size()) {
+        error = "bad tile index '" + std::string(cell) + "' on line " + std::to_string(lineNumber);
+        return false;
+      }
+      tiles.push_back(value < 0 ? -1 : value);
+      ++rowWidth;
+      sawValue = true;
+    }
+    if (!sawValue) continue;
+    if (height == 0) {
+      width = rowWidth;
+    } else if (rowWidth != width) {
+      error = "line " + std::to_string(lineNumber) + " has " + std::to_string(rowWidth) + " tiles, expected " +
+              std::to_string(width);
+      return false;
+    }
+    ++height;
+  }
+  if (height == 0) {
+    error = "no tile rows";
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,299 @@
+#include "Engine/TilemapLoader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AssetManager/AssetManager.h"
+#include "Components/TilemapLayerComponent.h"
+#include "ECS/Registry.h"
+#include "Engine/LuaProtect.h"
+#include "Engine/SdlFileReader.h"
+#include "Engine/TileCsv.h"
+#include "General/Logger.h"
+
+namespace {
+
+// Tiled packs flip/rotation flags into a gid's top four bits; chunks are baked unflipped.
+constexpr std::uint32_t kTiledGidMask = 0x0FFFFFFFu;
+
+// Tileset geometry and placement shared by every layer of the block; each layer may override.
+struct LayerDefaults {
+  std::string tilesetAssetId;
+  int tileWidth = 0;
+  int tileHeight = 0;
+  int columns = 0;
+  int margin = 0;
+  int spacing = 0;
+  glm::vec2 origin{0.0f, 0.0f};
+  int layer = 0;
+};
+
+LayerDefaults ReadDefaults(const sol::table& table, const LayerDefaults& base) {
+  LayerDefaults out = base;
+  out.tilesetAssetId = table["texture_asset_id"].get_or(base.tilesetAssetId);
+  out.tileWidth = table["tile_width"].get_or(base.tileWidth);
+  out.tileHeight = table["tile_height"].get_or(base.tileHeight);
+  out.columns = table["columns"].get_or(base.columns);
+  out.margin = table["margin"].get_or(base.margin);
+  out.spacing = table["spacing"].get_or(base.spacing);
+  out.origin.x = table["x"].get_or(base.origin.x);
+  out.origin.y = table["y"].get_or(base.origin.y);
+  out.layer = table["layer"].get_or(base.layer);
+  return out;
+}
+
+bool EndsWith(const std::string& value, const std::string& suffix) {
+  if (value.size() < suffix.size()) return false;
+  return std::equal(suffix.rbegin(), suffix.rend(), value.rbegin(),
+                    [](const unsigned char a, const unsigned char b) { return std::tolower(a) == std::tolower(b); });
+}
+
+bool AddLayer(Registry& registry, TilemapLayerComponent layer, const LayerDefaults& defaults) {
+  layer.tilesetAssetId = defaults.tilesetAssetId;
+  layer.tileWidth = defaults.tileWidth;
+  layer.tileHeight = defaults.tileHeight;
+  layer.tilesetColumns = defaults.columns;
+  layer.margin = defaults.margin;
+  layer.spacing = defaults.spacing;
+  layer.origin = defaults.origin;
+  layer.layer = defaults.layer;
+  if (layer.tileWidth <= 0 || layer.tileHeight <= 0) {
+    Logger::Error("Tilemap layer '" + layer.name + "' has no tile_width/tile_height; skipped.");
+    return false;
+  }
+  if (layer.width <= 0 || layer.height <= 0) {
+    Logger::Error("Tilemap layer '" + layer.name + "' is empty; skipped.");
+    return false;
+  }
+  const Entity entity = registry.CreateEntity();
+  registry.AddComponent(entity, std::move(layer));
+  return true;
+}
+
+bool ReadCsvFile(const AssetManager& assetManager, const std::string& path, std::vector<std::int32_t>& tiles,
+                 int& width, int& height) {
+  const std::string fullPath = assetManager.GetFullPath(path);
+  const auto bytes = ReadFileViaSDL(fullPath);
+  if (!bytes) return false;
+  std::string error;
+  if (!ParseTileCsv(*bytes, tiles, width, height, error)) {
+    Logger::Error("Tilemap CSV '" + fullPath + "': " + error);
+    return false;
+  }
+  return true;
+}
+
+// Inline layer: { name, width, height, tiles = {...} } or { name, csv = "path.csv" }, plus any of
+// the block-level defaults and `solid` / `visible`.
+bool LoadInlineLayer(Registry& registry, const AssetManager& assetManager, const sol::table& table,
+                     const LayerDefaults& blockDefaults) {
+  std::vector<std::int32_t> tiles;
+  int width = table["width"].get_or(0);
+  int height = table["height"].get_or(0);
+  const std::string name = table["name"].get_or(std::string("layer"));
+  if (const sol::optional<std::string> csv = table["csv"]; csv) {
+    if (!ReadCsvFile(assetManager, *csv, tiles, width, height)) return false;
+  } else if (const sol::optional<sol::table> data = table["tiles"]; data) {
+    const size_t count = data->size();
+    if (count != static_cast<size_t>(std::max(0, width)) * static_cast<size_t>(std::max(0, height))) {
+      Logger::Error("Tilemap layer '" + name + "': tiles has " + std::to_string(count) + " entries, expected width " +
+                    "x height = " + std::to_string(width * height) + "; skipped.");
+      return false;
+    }
+    tiles.reserve(count);
+    for (size_t i = 1; i <= count; ++i) tiles.push_back(data->get_or<std::int32_t>(i, -1));
+  } else {
+    Logger::Error("Tilemap layer '" + name + "' has neither `tiles` nor `csv`; skipped.");
+    return false;
+  }
+  TilemapLayerComponent layer(name, width, height, std::move(tiles));
+  layer.solid = table["solid"].get_or(false);
+  layer.visible = table["visible"].get_or(true);
+  return AddLayer(registry, std::move(layer), ReadDefaults(table, blockDefaults));
+}
+
+bool IsCollisionLayer(const sol::table& tiledLayer, const std::string& name) {
+  if (const sol::optional<sol::table> properties = tiledLayer["properties"]; properties) {
+    if (const sol::optional<bool> solid = (*properties)["solid"]; solid) return *solid;
+  }
+  std::string lower = name;
+  std::ranges::transform(lower, lower.begin(), [](const unsigned char c) { return std::tolower(c); });
+  return lower == "collision";
+}
+
+// Tiled "tilelayer" from the Lua export (uncompressed data comes out as encoding "lua"). Gids are
+// 1-based against the first tileset's firstgid; 0 is empty. Later tilesets' gids are dropped.
+bool LoadTiledLayer(Registry& registry, const sol::table& tiledLayer, const LayerDefaults& defaults,
+                    const std::uint32_t firstGid, const std::uint32_t lastGid) {
+  const std::string name = tiledLayer["name"].get_or(std::string("layer"));
+  if (tiledLayer["chunks"].valid()) {
+    Logger::Error("Tilemap layer '" + name + "': infinite Tiled maps are not supported; skipped.");
+    return false;
+  }
+  const std::string encoding = tiledLayer["encoding"].get_or(std::string("lua"));
+  if (encoding != "lua") {
+    Logger::Error("Tilemap layer '" + name + "': '" + encoding +
+                  "' layer data is not supported — set the map's tile layer format to CSV; skipped.");
+    return false;
+  }
+  const int width = tiledLayer["width"].get_or(0);
+  const int height = tiledLayer["height"].get_or(0);
+  const sol::optional<sol::table> data = tiledLayer["data"];
+  if (!data || data->size() != static_cast<size_t>(std::max(0, width)) * static_cast<size_t>(std::max(0, height))) {
+    Logger::Error("Tilemap layer '" + name + "': data does not match width x height; skipped.");
+    return false;
+  }
+
+  std::vector<std::int32_t> tiles;
+  tiles.reserve(data->size());
+  int flipped = 0;
+  int foreign = 0;
+  for (size_t i = 1; i <= data->size(); ++i) {
+    const auto raw = static_cast<std::uint32_t>(data->get_or<double>(i, 0.0));
+    const std::uint32_t gid = raw & kTiledGidMask;
+    if (gid != raw) ++flipped;
+    if (gid == 0) {
+      tiles.push_back(TilemapLayerComponent::kEmptyTile);
+    } else if (gid < firstGid || gid >= lastGid) {
+      tiles.push_back(TilemapLayerComponent::kEmptyTile);
+      ++foreign;
+    } else {
+      tiles.push_back(static_cast<std::int32_t>(gid - firstGid));
+    }
+  }
+  if (flipped > 0) {
+    Logger::Warn("Tilemap layer '" + name + "': " + std::to_string(flipped) +
+                 " flipped/rotated tile(s) drawn unflipped.");
+  }
+  if (foreign > 0) {
+    Logger::Warn("Tilemap layer '" + name + "': " + std::to_string(foreign) +
+                 " tile(s) from a second tileset dropped (one tileset per map).");
+  }
+
+  LayerDefaults layerDefaults = defaults;
+  layerDefaults.origin.x += tiledLayer["offsetx"].get_or(0.0f);
+  layerDefaults.origin.y += tiledLayer["offsety"].get_or(0.0f);
+  if (const sol::optional<sol::table> properties = tiledLayer["properties"]; properties) {
+    layerDefaults.layer = (*properties)["layer"].get_or(layerDefaults.layer);
+  }
+  TilemapLayerComponent layer(name, width, height, std::move(tiles));
+  layer.solid = IsCollisionLayer(tiledLayer, name);
+  layer.visible = tiledLayer["visible"].get_or(true);
+  return AddLayer(registry, std::move(layer), layerDefaults);
+}
+
+int LoadTiledLayers(Registry& registry, const sol::table& layers, LayerDefaults& defaults,
+                    const std::uint32_t firstGid, const std::uint32_t lastGid) {
+  int created = 0;
+  for (size_t i = 1; i <= layers.size(); ++i) {
+    const sol::optional<sol::table> tiledLayer = layers[i];
+    if (!tiledLayer) continue;
+    const std::string type = (*tiledLayer)["type"].get_or(std::string());
+    if (type == "tilelayer") {
+      if (LoadTiledLayer(registry, *tiledLayer, defaults, firstGid, lastGid)) ++created;
+      ++defaults.layer;  // Tiled draws layers in list order; give each its own render layer
+    } else if (type == "group") {
+      if (const sol::optional<sol::table> children = (*tiledLayer)["layers"]; children) {
+        created += LoadTiledLayers(registry, *children, defaults, firstGid, lastGid);
+      }
+    }
+  }
+  return created;
+}
+
+// A map exported from Tiled with File > Export As > Lua (or the same table built by hand).
+int LoadTiledMap(Registry& registry, const sol::table& map, const LayerDefaults& blockDefaults) {
+  const std::string orientation = map["orientation"].get_or(std::string("orthogonal"));
+  if (orientation != "orthogonal") {
+    Logger::Error("Tilemap: '" + orientation + "' Tiled maps are not supported (orthogonal only).");
+    return 0;
+  }
+  LayerDefaults defaults = blockDefaults;
+  if (defaults.tileWidth <= 0) defaults.tileWidth = map["tilewidth"].get_or(0);
+  if (defaults.tileHeight <= 0) defaults.tileHeight = map["tileheight"].get_or(0);
+
+  std::uint32_t firstGid = 1;
+  std::uint32_t lastGid = UINT32_MAX;
+  if (const sol::optional<sol::table> tilesets = map["tilesets"]; tilesets && tilesets->size() > 0) {
+    const sol::table first = (*tilesets)[1];
+    firstGid = first["firstgid"].get_or(1u);
+    if (defaults.columns <= 0) defaults.columns = first["columns"].get_or(0);
+    defaults.margin = first["margin"].get_or(defaults.margin);
+    defaults.spacing = first["spacing"].get_or(defaults.spacing);
+    if (tilesets->size() > 1) {
+      const sol::table second = (*tilesets)[2];
+      lastGid = second["firstgid"].get_or(UINT32_MAX);
+    }
+  }
+
+  const sol::optional<sol::table> layers = map["layers"];
+  if (!layers) return 0;
+  return LoadTiledLayers(registry, *layers, defaults, firstGid, lastGid);
+}
+
+int LoadMapFile(Registry& registry, sol::state& lua, const AssetManager& assetManager, const std::string& path,
+                const sol::table& tilemap, const LayerDefaults& defaults) {
+  if (EndsWith(path, ".csv")) {
+    std::vector<std::int32_t> tiles;
+    int width = 0;
+    int height = 0;
+    if (!ReadCsvFile(assetManager, path, tiles, width, height)) return 0;
+    TilemapLayerComponent layer(tilemap["name"].get_or(path), width, height, std::move(tiles));
+    layer.solid = tilemap["solid"].get_or(false);
+    return AddLayer(registry, std::move(layer), defaults) ? 1 : 0;
+  }
+  if (EndsWith(path, ".lua")) {
+    const std::string fullPath = assetManager.GetFullPath(path);
+    auto bytes = ReadFileViaSDL(fullPath);
+    if (!bytes) return 0;
+    DecryptLuaBytes(*bytes);
+    sol::protected_function_result result = lua.safe_script(*bytes, sol::script_pass_on_error, "@" + fullPath);
+    if (!result.valid()) {
+      const sol::error err = result;
+      Logger::Error("Tilemap: failed to load '" + fullPath + "': " + std::string(err.what()));
+      return 0;
+    }
+    if (result.return_count() == 0 || !result[0].is<sol::table>()) {
+      Logger::Error("Tilemap: '" + fullPath + "' did not return a map table.");
+      return 0;
+    }
+    return LoadTiledMap(registry, result[0].get<sol::table>(), defaults);
+  }
+  Logger::Warn("Tilemap: unsupported map file '" + path + "' (expected a Tiled Lua export or .csv).");
+  return 0;
+}
+
+}  // namespace
+
+namespace tilemap_loader {
+
+int LoadSceneTilemap(Registry& registry, sol::state& lua, const sol::table& tilemap) {
+  const auto& assetManager = registry.Get<AssetManager>();
+  const LayerDefaults defaults = ReadDefaults(tilemap, LayerDefaults{});
+  int created = 0;
+
+  const sol::object map = tilemap["map"];
+  if (map.is<sol::table>()) {
+    created += LoadTiledMap(registry, map.as<sol::table>(), defaults);
+  } else if (map.is<std::string>()) {
+    created += LoadMapFile(registry, lua, assetManager, map.as<std::string>(), tilemap, defaults);
+  }
+
+  if (const sol::optional<sol::table> layers = tilemap["layers"]; layers) {
+    LayerDefaults layerDefaults = defaults;
+    layerDefaults.layer += created;  // stack inline layers above the map file's
+    for (size_t i = 1; i <= layers->size(); ++i) {
+      const sol::optional<sol::table> layer = (*layers)[i];
+      if (!layer) continue;
+      if (LoadInlineLayer(registry, assetManager, *layer, layerDefaults)) ++created;
+      ++layerDefaults.layer;
+    }
+  }
+  return created;
+}
+
+}  // namespace tilemap_loader
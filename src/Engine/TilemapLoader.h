@@ -0,0 +1,17 @@
+#pragma once
+
+#include <sol/sol.hpp>
+
+class Registry;
+
+// Turns a scene's `tilemap` block into TilemapLayerComponent entities, one per layer — see
+// docs/tilemaps.md for the accepted shapes. Layers come from, in order:
+//   - `map`: a Tiled map exported as Lua (".lua": orthogonal, finite, uncompressed tile layers, first
+//     tileset only) or a single-layer CSV file (".csv", see ParseTileCsv);
+//   - `layers`: inline layer tables, each with a flat `tiles` array or its own `csv` file.
+// Tileset geometry (texture_asset_id, tile_width/height, columns, margin, spacing) and placement
+// (x, y, layer) set on the block are defaults each layer may override. Malformed input is logged
+// and the offending layer skipped; the rest of the scene still loads. Returns the layers created.
+namespace tilemap_loader {
+int LoadSceneTilemap(Registry& registry, sol::state& lua, const sol::table& tilemap);
+}  // namespace tilemap_loader
@@ -1,23 +1,53 @@
 #pragma once
 
+#include <span>
 #include <utility>
-#include <vector>
 
 #include "ECS/Entity.h"
 #include "EventBus/Event.h"
 
-// One event carrying the frame's *entering* collision pairs — first-contact overlaps that were not
-// present in the previous frame. Persistent overlaps (entities that remain in contact across frames)
-// are excluded; subscribers only see each contact once, on entry.
+struct CollisionRoutes;
+
+// One event carrying the frame's collision pairs, split three ways by the previous-frame diff:
+//   - entering: first-contact overlaps that were not present in the previous frame.
+//   - staying:  overlaps present in both frames (sustained contact).
+//   - exiting:  overlaps present last frame that are gone this frame (also emitted on their own as
+//               CollisionExitBatchEvent for exit-only subscribers).
+// Reactive subscribers (damage, bounce, script on_collision) read `entering` so each contact fires
+// once; `staying` is there for continuous responses that need every frame of contact.
 //
 // Emitted by CollisionSystem once per frame as a single batch rather than one event per pair
-// (W2.3); the enter/exit filter (W2.2) further reduces the set to new contacts only.
+// (W2.3). Each span is a contiguous range sorted by the pair's (lower, higher) entity index, with
+// `first` always the lower-index entity.
+//
+// `enteringToi` is index-aligned with `entering`: the fraction of the detection pass (0..1) at which
+// each pair first touched. Pairs involving a continuous (CCD) collider get a real time of impact
+// from the swept test; discrete pairs only know end-of-pass positions and report 1. May be empty
+// when the emitter has no TOI to offer.
+//
+// `routes`, when set, is `entering` already bucketed by response role (see CollisionRouter), so
+// response systems skip per-pair classification. Null on hand-built events; consumers then route
+// the span themselves.
 //
-// `pairs` is borrowed from a CollisionSystem-local vector and is only valid for the duration of
-// the EmitEvent dispatch; subscribers must consume it synchronously and must not store the reference.
+// The spans view CollisionSystem-owned buffers that are reused next frame, so they are only valid
+// for the duration of the EmitEvent dispatch; subscribers must consume them synchronously and must
+// not store them.
 class CollisionBatchEvent : public Event {
  public:
-  const std::vector<std::pair<Entity, Entity>>& pairs;
+  std::span<const std::pair<Entity, Entity>> entering;
+  std::span<const std::pair<Entity, Entity>> staying;
+  std::span<const std::pair<Entity, Entity>> exiting;
+  std::span<const float> enteringToi;
+  const CollisionRoutes* routes;
 
-  explicit CollisionBatchEvent(const std::vector<std::pair<Entity, Entity>>& collisionPairs) : pairs(collisionPairs) {}
+  explicit CollisionBatchEvent(std::span<const std::pair<Entity, Entity>> enteringPairs,
+                               std::span<const std::pair<Entity, Entity>> stayingPairs = {},
+                               std::span<const std::pair<Entity, Entity>> exitingPairs = {},
+                               std::span<const float> enteringTimesOfImpact = {},
+                               const CollisionRoutes* routedPairs = nullptr)
+      : entering(enteringPairs),
+        staying(stayingPairs),
+        exiting(exitingPairs),
+        enteringToi(enteringTimesOfImpact),
+        routes(routedPairs) {}
 };
@@ -9,13 +9,15 @@
 enum class PerfOverlayCorner : std::uint8_t { TopLeft, TopRight, BottomLeft, BottomRight };
 
 // Which metrics the perf overlay draws. config.ini: PerfOverlayMetrics takes a comma-separated
-// list of fps|frametime|entities|memory, or all ("both" accepted as a legacy alias).
+// list of fps|frametime|entities|memory|text|render, or all ("both" accepted as a legacy alias).
 enum class PerfOverlayMetrics : std::uint8_t {
   Fps = 1 << 0,
   FrameTime = 1 << 1,
   Entities = 1 << 2,
   Memory = 1 << 3,
-  All = Fps | FrameTime | Entities | Memory
+  Text = 1 << 4,
+  Render = 1 << 5,  // RenderStats: draw calls, switches, culling, queue fill, sort/draw time
+  All = Fps | FrameTime | Entities | Memory | Text | Render
 };
 
 inline PerfOverlayMetrics operator|(PerfOverlayMetrics lhs, PerfOverlayMetrics rhs) {
@@ -57,4 +59,27 @@ struct EngineOptions {
   // runtime toggle. Poll cadence is mtime-based, single-threaded, on the main loop.
   bool hotReloadEnabled = true;
   float hotReloadPollSeconds = 0.25F;
+  // Coarse render culling, both off by default (config.ini only; read when systems register).
+  // ChunkCulling=: TransformSystem records per-chunk world bounds of sprite chunks and
+  // RenderSpriteSystem skips chunks entirely outside the camera before testing entities.
+  bool chunkCulling = false;
+  // StaticCullGridCell=: world units per cell of the static sprite layer's cull grid; 0 keeps
+  // the linear pass over the baked list.
+  float staticCullGridCell = 0.0F;
+  // DynamicAtlas=: pack small loose textures into shared runtime atlas pages as they load
+  // (DynamicTextureAtlas) so sprites using different images still batch. DynamicAtlasBudgetMB=
+  // caps the pages' texture memory. Read when AssetManager loads the config.
+  bool dynamicAtlas = false;
+  int dynamicAtlasBudgetMB = 64;
+  // TextCacheBudgetMB=: texture memory RenderTextSystem may keep for rasterized labels no entity
+  // currently shows (TextTextureCache); labels on screen are never evicted. Read when systems
+  // register.
+  int textCacheBudgetMB = 16;
+  // DynamicResolution=: render the scene below full resolution while frames run over budget and
+  // upscale it on present (DynamicResolution controller, Renderer target pool). Off by default.
+  // DynamicResolutionMinScale= is the floor (0.25–1, default 0.5); DynamicResolutionBudgetMs= the
+  // frame-time target (0 = derive from FpsTarget, 60 fps when uncapped). Read every frame.
+  bool dynamicResolution = false;
+  float dynamicResolutionMinScale = 0.5F;
+  float dynamicResolutionBudgetMs = 0.0F;
 };
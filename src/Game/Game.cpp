@@ -53,7 +53,7 @@
 #include "Project/ProjectIni.h"
 #include "Renderer/RenderQueue.h"
 #include "Renderer/Renderer.h"
-#include "Renderer/SpriteRenderCache.h"
+#include "Renderer/TextTextureCache.h"
 // InputSystemLuaBinding specializes LuaSystemBinding<InputSystem> — needed below where
 // LuaSystemRegistry::registerSystem(inputSystem) instantiates the lookup. Don't drop.
 #include "Components/AudioActiveTag.h"
@@ -74,11 +74,16 @@
 #include "Systems/InputSystem.h"
 #include "Systems/ObstacleBounceSystem.h"
 #include "Systems/OffScreenDespawnSystem.h"
+#include "Systems/ParticleSystem.h"
+#include "Systems/PhysicsSolverSystem.h"
 #include "Systems/ProjectileEmitSystem.h"
 #include "Systems/ProjectileLifecycleSystem.h"
 #include "Systems/RenderPrimitiveSystem.h"
 #include "Systems/RenderSpriteSystem.h"
+#include "Systems/RenderStaticSpriteSystem.h"
 #include "Systems/RenderTextSystem.h"
+#include "Systems/RenderTilemapSystem.h"
+#include "Systems/RenderUICanvasSystem.h"
 #include "Systems/RenderUISpriteSystem.h"
 #include "Systems/ScriptCollisionSystem.h"
 #include "Systems/ScriptSystem.h"
@@ -386,7 +391,7 @@ bool Game::RunBakeValidation(const std::string& assetPath) {
   registry_->Set<EngineContext>(bakeCtx);
 
   // Shared bootstrap spine. withFramePathCaches=false — bake runs no frames and no audio systems,
-  // so the SpriteRenderCache / AudioTrackCache slots are unused.
+  // so the AudioTrackCache / text / canvas cache slots are unused.
   engine_bootstrap::InstallCoreSingletons(*registry_, registry_->Get<EngineContext>(), gameConfig.windowWidth,
                                           gameConfig.windowHeight, /*withFramePathCaches=*/false);
   engine_bootstrap::InstallPoolAndProjectile(*registry_);
@@ -524,8 +529,8 @@ void Game::Setup() {
   auto& gameConfig = registry_->Get<GameConfig>();
 
   // Shared bootstrap spine (see engine_bootstrap/EngineBootstrap.h). withFramePathCaches=true —
-  // the live game loop reads SpriteRenderCache from the sprite-render pass and AudioTrackCache
-  // from the spatial/Doppler/culling audio systems.
+  // the live game loop reads AudioTrackCache from the spatial/Doppler/culling audio systems and
+  // the text / canvas caches from the UI render passes.
   engine_bootstrap::InstallCoreSingletons(*registry_, registry_->Get<EngineContext>(), gameConfig.windowWidth,
                                           gameConfig.windowHeight, /*withFramePathCaches=*/true);
 
@@ -646,8 +651,11 @@ void Game::Setup() {
   // Despawn entities (except the player) once they leave the playable area.
   registry_->RegisterParallelSystem<PositionComponent, SpriteComponent>(OffScreenDespawnSystem());
 
-  // Resolve the transform hierarchy into global positions/scales.
-  auto transform = registry_->RegisterBulkSystem<GlobalTransformComponent>(TransformSystem());
+  // Resolve the transform hierarchy into global positions/scales (plus sprite chunk bounds when
+  // chunk culling is on).
+  const auto& engineOptions = gameConfig.GetEngineOptions();
+  auto transform =
+      registry_->RegisterBulkSystem<GlobalTransformComponent>(TransformSystem(engineOptions.chunkCulling));
 
   auto collision = registry_->RegisterBulkSystem(CollisionSystem());
   // Store a pointer so the Lua are_colliding() query can reach IsOverlapping() without coupling
@@ -655,6 +663,9 @@ void Game::Setup() {
   // registry's lifetime (the wrapper is owned by registry_->systems_).
   registry_->Set<CollisionSystem*>(&collision.Func());
 
+  // Contact resolution for RigidBodyComponent::simulated bodies, fed by the collision pass's pairs.
+  auto physicsSolver = registry_->RegisterBulkSystem(PhysicsSolverSystem());
+
   // Spatial audio: snapshot the listener entity (UpdateListenerTransformSystem) then mutate
   // gain + stereo pan on live spatial tracks (SpatialAudioSystem). AudioSystem (above) is the
   // one that adds the AudioSinkComponent and caches its MIX_Track in AudioTrackCache, which
@@ -684,9 +695,18 @@ void Game::Setup() {
 
   // Render queue producers
   registry_->RegisterParallelSystem<GlobalTransformComponent, SpriteComponent>(RenderSpriteSystem());
-  registry_->RegisterSystem<UIRectComponent, SpriteComponent>(RenderUISpriteSystem());
-  registry_->RegisterSystem<TextLabelComponent>(RenderTextSystem());
+  // Static-tagged sprites: baked once into a retained, pre-sorted layer, culled and appended per frame.
+  registry_->RegisterBulkSystem(RenderStaticSpriteSystem(engineOptions.staticCullGridCell));
+  // Tile layers: visible chunks baked into cached textures, one queue entry per chunk.
+  registry_->RegisterBulkSystem(RenderTilemapSystem());
+  // Cached UI canvases: one quad each while current; their entities are routed by the cache below.
+  auto uiCanvas = registry_->RegisterBulkSystem(RenderUICanvasSystem());
+  auto uiSprites = registry_->RegisterSystem<UIRectComponent, SpriteComponent>(RenderUISpriteSystem());
+  registry_->Get<TextTextureCache>().SetBudget(static_cast<std::size_t>(engineOptions.textCacheBudgetMB) << 20);
+  auto texts = registry_->RegisterSystem<TextLabelComponent>(RenderTextSystem());
   registry_->RegisterParallelSystem<SquarePrimitiveComponent, GlobalTransformComponent>(RenderPrimitiveSystem());
+  // Particle emitters: particles live in ParticleStore, not the registry; one geometry batch per emitter.
+  auto particles = registry_->RegisterBulkSystem(ParticleSystem());
 
   // Execution-order edges (topo-sorted in Registry::Update; registration order breaks ties).
   // Emit before integration so freshly-spawned projectiles integrate/transform/collide the same
@@ -696,6 +716,8 @@ void Game::Setup() {
   // transform.globalPosition / globalScale, so it runs after both.
   registry_->Order(transform).After(velocityIntegration);
   registry_->Order(collision).After(transform).After(velocityIntegration);
+  // The solver corrects positions and velocities the collision pass just paired up.
+  registry_->Order(physicsSolver).After(collision);
   // Listener snapshot + spatial gain/pan need this-frame globals; spatial reads the listener
   // snapshot and is gated by culling (culled emitters lose their sink); both resolve tracks the
   // AudioSystem update cached.
@@ -707,6 +729,12 @@ void Game::Setup() {
   registry_->Order(doppler).After(transform).After(listenerTransform).After(audioCulling).After(audioSystem);
   // Camera follows after gameplay-driven transform updates.
   registry_->Order(cameraFollow).After(transform);
+  // Canvas modes are settled by the layout pass, and must be before the UI producers route by them.
+  registry_->Order(uiCanvas).After(uiLayout);
+  registry_->Order(uiSprites).After(uiCanvas);
+  registry_->Order(texts).After(uiCanvas);
+  // Emitters spawn at this-frame globals, and draw against the followed camera.
+  registry_->Order(particles).After(transform).After(cameraFollow);
 
   // Event subscriptions (one-time). FrameLoop holds its own RAII subscription handle.
   frame_loop_->SubscribeToEvents();
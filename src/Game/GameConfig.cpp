@@ -187,6 +187,14 @@ bool GameConfig::LoadConfig(const std::unordered_map<std::string, std::string>&
   success &= SetValue(settings, "PerfOverlay", &GameConfig::SetPerfOverlay, false);
   success &= SetValue(settings, "PerfOverlayCorner", &GameConfig::SetPerfOverlayCorner, false);
   success &= SetValue(settings, "PerfOverlayMetrics", &GameConfig::SetPerfOverlayMetrics, false);
+  success &= SetValue(settings, "ChunkCulling", &GameConfig::SetChunkCulling, false);
+  success &= SetValue(settings, "StaticCullGridCell", &GameConfig::SetStaticCullGridCell, false);
+  success &= SetValue(settings, "DynamicAtlas", &GameConfig::SetDynamicAtlas, false);
+  success &= SetValue(settings, "DynamicAtlasBudgetMB", &GameConfig::SetDynamicAtlasBudgetMB, false);
+  success &= SetValue(settings, "TextCacheBudgetMB", &GameConfig::SetTextCacheBudgetMB, false);
+  success &= SetValue(settings, "DynamicResolution", &GameConfig::SetDynamicResolution, false);
+  success &= SetValue(settings, "DynamicResolutionMinScale", &GameConfig::SetDynamicResolutionMinScale, false);
+  success &= SetValue(settings, "DynamicResolutionBudgetMs", &GameConfig::SetDynamicResolutionBudgetMs, false);
 
   return success;
 }
@@ -314,11 +322,15 @@ void GameConfig::SetPerfOverlayMetrics(const std::string& metrics) {
       perfOverlayMetrics = perfOverlayMetrics | PerfOverlayMetrics::Entities;
     } else if (metric == "memory" || metric == "mem") {
       perfOverlayMetrics = perfOverlayMetrics | PerfOverlayMetrics::Memory;
+    } else if (metric == "text") {
+      perfOverlayMetrics = perfOverlayMetrics | PerfOverlayMetrics::Text;
+    } else if (metric == "render") {
+      perfOverlayMetrics = perfOverlayMetrics | PerfOverlayMetrics::Render;
     } else if (metric == "all" || metric == "both") {
       perfOverlayMetrics = PerfOverlayMetrics::All;
     } else {
       Logger::Warn("Unknown PerfOverlayMetrics '" + metric +
-                   "' (expected fps|frametime|entities|memory|all); keeping current.");
+                   "' (expected fps|frametime|entities|memory|text|render|all); keeping current.");
       return;
     }
   }
@@ -335,6 +347,52 @@ void GameConfig::SetHotReloadPollSeconds(const float seconds) {
   engine_options_.hotReloadPollSeconds = seconds;
 }
 
+void GameConfig::SetChunkCulling(const bool enabled) { engine_options_.chunkCulling = enabled; }
+
+void GameConfig::SetStaticCullGridCell(const float cellSize) {
+  if (cellSize < 0.0F) {
+    Logger::Warn("StaticCullGridCell must be >= 0; keeping current value.");
+    return;
+  }
+  engine_options_.staticCullGridCell = cellSize;
+}
+
+void GameConfig::SetDynamicAtlas(const bool enabled) { engine_options_.dynamicAtlas = enabled; }
+
+void GameConfig::SetDynamicAtlasBudgetMB(const int megabytes) {
+  if (megabytes < 0) {
+    Logger::Warn("DynamicAtlasBudgetMB must be >= 0; keeping current value.");
+    return;
+  }
+  engine_options_.dynamicAtlasBudgetMB = megabytes;
+}
+
+void GameConfig::SetTextCacheBudgetMB(const int megabytes) {
+  if (megabytes < 0) {
+    Logger::Warn("TextCacheBudgetMB must be >= 0; keeping current value.");
+    return;
+  }
+  engine_options_.textCacheBudgetMB = megabytes;
+}
+
+void GameConfig::SetDynamicResolution(const bool enabled) { engine_options_.dynamicResolution = enabled; }
+
+void GameConfig::SetDynamicResolutionMinScale(const float scale) {
+  if (scale <= 0.0F || scale > 1.0F) {
+    Logger::Warn("DynamicResolutionMinScale must be in (0, 1]; keeping current value.");
+    return;
+  }
+  engine_options_.dynamicResolutionMinScale = scale;
+}
+
+void GameConfig::SetDynamicResolutionBudgetMs(const float milliseconds) {
+  if (milliseconds < 0.0F) {
+    Logger::Warn("DynamicResolutionBudgetMs must be >= 0; keeping current value.");
+    return;
+  }
+  engine_options_.dynamicResolutionBudgetMs = milliseconds;
+}
+
 void GameConfig::SetLogLevel(const std::string& logLevel) {
   if (logLevel.empty()) return;
   Logger::SetLevel(logLevel);
@@ -115,6 +115,14 @@ class GameConfig {
   void SetPerfOverlay(bool enabled);
   void SetPerfOverlayCorner(const std::string& corner);
   void SetPerfOverlayMetrics(const std::string& metrics);
+  void SetChunkCulling(bool enabled);
+  void SetStaticCullGridCell(float cellSize);
+  void SetDynamicAtlas(bool enabled);
+  void SetDynamicAtlasBudgetMB(int megabytes);
+  void SetTextCacheBudgetMB(int megabytes);
+  void SetDynamicResolution(bool enabled);
+  void SetDynamicResolutionMinScale(float scale);
+  void SetDynamicResolutionBudgetMs(float milliseconds);
   // Runtime override of the compile-time default log level. Invoked from LoadConfig; pushes the
   // value straight into spdlog via Logger::SetLevel, so subsequent Logger calls honor it.
   void SetLogLevel(const std::string& logLevel);
@@ -23,11 +23,21 @@ static constexpr size_t kCollisionResponseParallelThreshold = 2048;
 // hitting Channel<RenderKey>::overflow_buffer (which serializes on a mutex).
 static constexpr size_t kRenderCommandBufferSize = 256 * 1024;
 
-// Pre-sized capacity for RenderQueue. Multi-producer parallel systems write directly
-// into pre-allocated slots via atomic fetch_add — overflowing is undefined. Size for
-// peak frame load (stress tests can hit ~120K+).
+// Slots RenderQueue allocates up front. Not a limit: the queue grows (between frames from its
+// high-water mark, mid-frame if it must), so this only saves the first heavy frames a growth
+// step. Stress tests can hit ~120K+.
 constexpr static size_t kInitialRenderQueueCapacity = 256 * 1024;
 
+// Below this many sprites per frame, SpriteBatcher expands vertices on the main thread. A sprite
+// costs tens of nanoseconds to expand, so the ThreadPool fork/join only pays off in the tens of
+// thousands. Tunable; SpriteBatcher::SetParallelThreshold overrides it per batcher.
+static constexpr size_t kSpriteExpandParallelThreshold = 16 * 1024;
+
+// Below this many keys, RenderQueue::Sort runs on the main thread. Each parallel radix pass is two
+// fork/joins (count, scatter), so splitting only wins once a pass moves more than a few hundred
+// KB. Tunable; RenderQueue::SetParallelSortThreshold overrides it per queue.
+static constexpr size_t kRenderQueueParallelSortThreshold = 64 * 1024;
+
 static constexpr int kDebugUIBaseLayer = 1000;
 
 // Y-band size (world pixels) for grouping render keys before secondary sort by texture.
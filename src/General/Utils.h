@@ -1,7 +1,9 @@
 #pragma once
+#include <cstdint>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -30,3 +32,38 @@ inline float GetAverage(const std::vector<float>& vec) {
   const float sum = std::accumulate(vec.begin(), vec.end(), 0.0f);
   return sum / static_cast<float>(vec.size());
 }
+
+// Decode the UTF-8 sequence starting at text[i] and advance i past it. Malformed, truncated or
+// overlong sequences yield U+FFFD and consume one byte, so a bad string still makes progress.
+inline std::uint32_t NextUtf8Codepoint(const std::string_view text, size_t& i) {
+  constexpr std::uint32_t kReplacement = 0xFFFD;
+  const auto lead = static_cast<unsigned char>(text[i++]);
+  if (lead < 0x80) return lead;
+  int extra = 0;
+  std::uint32_t cp = 0;
+  std::uint32_t minimum = 0;
+  if ((lead & 0xE0) == 0xC0) {
+    extra = 1;
+    cp = lead & 0x1Fu;
+    minimum = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    extra = 2;
+    cp = lead & 0x0Fu;
+    minimum = 0x800;
+  } else if ((lead & 0xF8) == 0xF0) {
+    extra = 3;
+    cp = lead & 0x07u;
+    minimum = 0x10000;
+  } else {
+    return kReplacement;
+  }
+  if (i + static_cast<size_t>(extra) > text.size()) return kReplacement;
+  for (int k = 0; k < extra; ++k) {
+    const auto next = static_cast<unsigned char>(text[i + static_cast<size_t>(k)]);
+    if ((next & 0xC0) != 0x80) return kReplacement;
+    cp = cp << 6 | (next & 0x3Fu);
+  }
+  if (cp < minimum || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return kReplacement;
+  i += static_cast<size_t>(extra);
+  return cp;
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <sol/sol.hpp>
+#include <string>
+#include <utility>
 
 #include "Components/AnimationComponent.h"
 #include "Lua/Bindings/LuaBinding.h"
@@ -15,13 +17,22 @@ struct LuaBinding<AnimationComponent> {
     using namespace LuaComponentHelpers;
     const int numberFrames = SafeGetOptionalValue<int>(t, "num_frames", 1);
     const int speedRate = SafeGetOptionalValue<int>(t, "speed_rate", 1);
-    return AnimationComponent(numberFrames, speedRate);
+    AnimationComponent animation(numberFrames, speedRate);
+    animation.clipSpeed = SafeGetOptionalValue<float>(t, "clip_speed", 1.0f);
+    if (auto clip = SafeGetOptionalValue<std::string>(t, "clip", std::string{}); !clip.empty()) {
+      animation.Play(std::move(clip));
+    }
+    return animation;
   }
 
   static void bindUsertype(sol::state& lua) {
     lua.new_usertype<AnimationComponent>(
         kUsertypeName, "num_frames", &AnimationComponent::numFrames, "current_frame", &AnimationComponent::currentFrame,
         "frame_rate_speed", &AnimationComponent::frameRateSpeed, "should_loop", &AnimationComponent::shouldLoop,
-        "is_finished", &AnimationComponent::isFinished);
+        "is_finished", &AnimationComponent::isFinished, "clip_speed", &AnimationComponent::clipSpeed, "clip",
+        sol::property([](const AnimationComponent& a) { return a.clipId; }), "play",
+        [](AnimationComponent& a, std::string clipId, const sol::optional<bool> restart) {
+          a.Play(std::move(clipId), restart.value_or(false));
+        });
   }
 };
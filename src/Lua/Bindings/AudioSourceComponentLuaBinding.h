@@ -1,7 +1,10 @@
 #pragma once
 
 #include <sol/sol.hpp>
+#include <string>
+#include <utility>
 
+#include "AssetManager/AssetManager.h"
 #include "Components/AudioSourceComponent.h"
 #include "Lua/Bindings/LuaBinding.h"
 
@@ -27,12 +30,24 @@ struct LuaBinding<AudioSourceComponent> {
                                 maxDistance, doppler);
   }
 
+  static void internAssets(AudioSourceComponent& source, AssetManager& assets) {
+    source.clip = assets.Intern(source.clipId);
+  }
+
   static void bindUsertype(sol::state& lua) {
+    // Reassigning clip_id drops the interned handle (a component method can't reach the
+    // AssetManager), so the next play resolves the new id by name.
     lua.new_usertype<AudioSourceComponent>(
-        kUsertypeName, "clip_id", &AudioSourceComponent::clipId, "volume", &AudioSourceComponent::volume, "pitch",
-        &AudioSourceComponent::pitch, "loop", &AudioSourceComponent::loop, "play_on_spawn",
-        &AudioSourceComponent::playOnSpawn, "despawn_on_finish", &AudioSourceComponent::despawnOnFinish, "spatial",
-        &AudioSourceComponent::spatial, "min_distance", &AudioSourceComponent::minDistance, "max_distance",
-        &AudioSourceComponent::maxDistance, "doppler", &AudioSourceComponent::doppler);
+        kUsertypeName, "clip_id",
+        sol::property([](const AudioSourceComponent& a) { return a.clipId; },
+                      [](AudioSourceComponent& a, std::string clipId) {
+                        a.clipId = std::move(clipId);
+                        a.clip = AssetHandle{};
+                      }),
+        "volume", &AudioSourceComponent::volume, "pitch", &AudioSourceComponent::pitch, "loop",
+        &AudioSourceComponent::loop, "play_on_spawn", &AudioSourceComponent::playOnSpawn, "despawn_on_finish",
+        &AudioSourceComponent::despawnOnFinish, "spatial", &AudioSourceComponent::spatial, "min_distance",
+        &AudioSourceComponent::minDistance, "max_distance", &AudioSourceComponent::maxDistance, "doppler",
+        &AudioSourceComponent::doppler);
   }
 };
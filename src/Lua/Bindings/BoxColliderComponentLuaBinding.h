@@ -20,12 +20,14 @@ struct LuaBinding<BoxColliderComponent> {
     const bool isFixed = SafeGetOptionalValue<bool>(t, "is_fixed", false);
     const auto collisionMask = SafeGetOptionalValue<int>(t, "collision_mask", Constants::kDefaultEntityMask);
     const auto collisionMaskBits = EntityMask(static_cast<unsigned long long>(collisionMask));
-    return BoxColliderComponent(width, height, offset, isFixed, collisionMaskBits);
+    const bool continuous = SafeGetOptionalValue<bool>(t, "continuous", false);
+    return BoxColliderComponent(width, height, offset, isFixed, collisionMaskBits, continuous);
   }
 
   static void bindUsertype(sol::state& lua) {
     lua.new_usertype<BoxColliderComponent>(kUsertypeName, "width", &BoxColliderComponent::width, "height",
                                            &BoxColliderComponent::height, "is_fixed", &BoxColliderComponent::isFixed,
-                                           "offset", &BoxColliderComponent::offset);
+                                           "offset", &BoxColliderComponent::offset, "continuous",
+                                           &BoxColliderComponent::continuous);
   }
 };
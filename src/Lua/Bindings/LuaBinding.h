@@ -55,6 +55,11 @@ inline sol::optional<sol::table> SafeGetOptionalTable(const sol::table& dataTabl
 //   static T fromLua(const sol::object& data);     // sol::object (not table) so bare-string/int edge cases fit
 //   static void bindUsertype(sol::state& lua);     // call lua.new_usertype<T>(kUsertypeName, ...);
 //
+// and MAY provide
+//   static void internAssets(T& component, AssetManager& assets);
+// to intern the component's asset ids into its AssetHandle fields. LuaComponentRegistry calls it
+// between fromLua and AddComponent, so every scene / spawn bind resolves ids once, up front.
+//
 // bindUsertype may include both fields and member functions in the new_usertype call,
 // e.g.  "damage", &HealthComponent::Damage  alongside  "max_health", &T::maxHealth.
 //
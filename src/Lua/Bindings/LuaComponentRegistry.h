@@ -3,8 +3,10 @@
 #include <functional>
 #include <sol/sol.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "AssetManager/AssetManager.h"
 #include "ECS/Entity.h"
 #include "ECS/Registry.h"
 #include "Lua/Bindings/LuaBinding.h"
@@ -25,7 +27,13 @@ class LuaComponentRegistry {
     Entry entry;
     entry.luaKey = B::kLuaKey;
     entry.usertypeName = B::kUsertypeName;
-    entry.attach = [](Registry* r, Entity e, const sol::object& d) { r->AddComponent(e, B::fromLua(d)); };
+    entry.attach = [](Registry* r, Entity e, const sol::object& d) {
+      T component = B::fromLua(d);
+      if constexpr (requires(T& c, AssetManager& assets) { B::internAssets(c, assets); }) {
+        if (auto* assets = r->TryGet<AssetManager>()) B::internAssets(component, *assets);
+      }
+      r->AddComponent(e, std::move(component));
+    };
     entry.bindUsertype = [](sol::state& lua) { B::bindUsertype(lua); };
     entry.bindRegistryAccessors = [key = std::string(B::kLuaKey)](sol::table& reg, Registry* r) {
       reg.set_function("has_" + key, [r](Entity e) { return r->HasComponent<T>(e); });
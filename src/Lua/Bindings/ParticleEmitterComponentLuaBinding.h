@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <sol/sol.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Components/ParticleEmitterComponent.h"
+#include "General/BlendMode.h"
+#include "General/Constants.h"
+#include "Lua/Bindings/LuaBinding.h"
+
+template <>
+struct LuaBinding<ParticleEmitterComponent> {
+  static constexpr const char* kLuaKey = "particle_emitter";
+  static constexpr const char* kUsertypeName = "particle_emitter_component";
+
+  static ParticleEmitterComponent fromLua(const sol::object& data) {
+    const auto t = data.as<sol::table>();
+    using namespace LuaComponentHelpers;
+    ParticleEmitterComponent emitter;
+    emitter.assetId = SafeGetOptionalValue<std::string>(t, "texture_asset_id", std::string{});
+    emitter.layer = SafeGetOptionalValue<int>(t, "layer", 1);
+    emitter.blendMode = octarine::BlendModeFromString(SafeGetOptionalValue<std::string>(t, "blend_mode", "blend"));
+    emitter.emitting = SafeGetOptionalValue<bool>(t, "emitting", true);
+    emitter.rate = SafeGetOptionalValue<float>(t, "rate", emitter.rate);
+    emitter.maxParticles = SafeGetOptionalValue<int>(t, "max_particles", emitter.maxParticles);
+    emitter.lifetime = SafeGetOptionalValue<float>(t, "lifetime", emitter.lifetime);
+    emitter.lifetimeVariance = SafeGetOptionalValue<float>(t, "lifetime_variance", 0.0f);
+    emitter.speed = SafeGetOptionalValue<float>(t, "speed", emitter.speed);
+    emitter.speedVariance = SafeGetOptionalValue<float>(t, "speed_variance", 0.0f);
+    emitter.direction = SafeGetOptionalValue<float>(t, "direction", emitter.direction);
+    emitter.spread = SafeGetOptionalValue<float>(t, "spread", emitter.spread);
+    emitter.spawnRadius = SafeGetOptionalValue<float>(t, "spawn_radius", 0.0f);
+    emitter.gravity = SafeGetVec2(t, "gravity");
+    emitter.size = CurveFromLua(t.get<sol::object>("size"), emitter.size);
+    emitter.velocity = CurveFromLua(t.get<sol::object>("velocity"), emitter.velocity);
+    emitter.color = GradientFromLua(t.get<sol::object>("color"));
+    // Optional one-off burst on the first update, for effects that are only a burst (explosions).
+    emitter.Burst(SafeGetOptionalValue<int>(t, "burst", 0));
+    return emitter;
+  }
+
+  static void bindUsertype(sol::state& lua) {
+    lua.new_usertype<ParticleEmitterComponent>(
+        kUsertypeName, "texture_asset_id", &ParticleEmitterComponent::assetId, "layer",
+        &ParticleEmitterComponent::layer, "emitting", &ParticleEmitterComponent::emitting, "rate",
+        &ParticleEmitterComponent::rate, "max_particles", &ParticleEmitterComponent::maxParticles, "lifetime",
+        &ParticleEmitterComponent::lifetime, "lifetime_variance", &ParticleEmitterComponent::lifetimeVariance,
+        "speed", &ParticleEmitterComponent::speed, "speed_variance", &ParticleEmitterComponent::speedVariance,
+        "direction", &ParticleEmitterComponent::direction, "spread", &ParticleEmitterComponent::spread,
+        "spawn_radius", &ParticleEmitterComponent::spawnRadius, "gravity", &ParticleEmitterComponent::gravity,
+        "burst", &ParticleEmitterComponent::Burst, "blend_mode",
+        sol::property([](const ParticleEmitterComponent& e) { return octarine::ToString(e.blendMode); },
+                      [](ParticleEmitterComponent& e, const std::string_view mode) {
+                        e.blendMode = octarine::BlendModeFromString(mode, e.blendMode);
+                      }));
+  }
+
+ private:
+  // A number is a constant; a list of {t, value} pairs is a curve over normalized age. Anything
+  // else keeps `fallback`.
+  static ParticleCurve CurveFromLua(const sol::object& value, const ParticleCurve& fallback) {
+    if (value.is<float>()) return ParticleCurve(value.as<float>());
+    if (!value.is<sol::table>()) return fallback;
+    const auto list = value.as<sol::table>();
+    std::vector<ParticleCurve::Key> keys;
+    for (std::size_t i = 1; i <= list.size(); ++i) {
+      const sol::optional<sol::table> pair = list[i];
+      if (!pair) continue;
+      keys.push_back({pair.value()[1].get_or(0.0f), pair.value()[2].get_or(0.0f)});
+    }
+    return keys.empty() ? fallback : ParticleCurve(std::move(keys));
+  }
+
+  // A color table ({r, g, b, a}, channels defaulting to 255) is a constant; a list of
+  // {t, color} pairs is a gradient over normalized age. Absent means white.
+  static ParticleGradient GradientFromLua(const sol::object& value) {
+    if (!value.is<sol::table>()) return {};
+    const auto table = value.as<sol::table>();
+    if (!table[1].valid()) return ParticleGradient(ColorFromLua(table));
+    std::vector<ParticleGradient::Key> keys;
+    for (std::size_t i = 1; i <= table.size(); ++i) {
+      const sol::optional<sol::table> pair = table[i];
+      if (!pair) continue;
+      keys.push_back({pair.value()[1].get_or(0.0f), ColorFromLua(pair.value()[2])});
+    }
+    return ParticleGradient(std::move(keys));
+  }
+
+  static octarine::Color ColorFromLua(const sol::optional<sol::table>& color) {
+    constexpr int kMax = Constants::kUint8Max;
+    if (!color) return {kMax, kMax, kMax, kMax};
+    const sol::table& t = color.value();
+    return {static_cast<std::uint8_t>(t.get_or("r", kMax)), static_cast<std::uint8_t>(t.get_or("g", kMax)),
+            static_cast<std::uint8_t>(t.get_or("b", kMax)), static_cast<std::uint8_t>(t.get_or("a", kMax))};
+  }
+};
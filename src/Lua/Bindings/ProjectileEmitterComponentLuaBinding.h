@@ -35,6 +35,7 @@ struct LuaBinding<ProjectileEmitterComponent> {
     // (the C++ constructor default). Stress tests use this to stagger emitter fire times
     // so they don't all spawn projectiles on the same frame (thundering-herd).
     component.countDownTimer = SafeGetOptionalValue<float>(t, "countdown_timer", repeatFrequency);
+    component.continuousCollision = SafeGetOptionalValue<bool>(t, "continuous_collision", false);
     return component;
   }
 
@@ -43,6 +44,7 @@ struct LuaBinding<ProjectileEmitterComponent> {
         kUsertypeName, "velocity", &ProjectileEmitterComponent::velocity, "duration",
         &ProjectileEmitterComponent::duration, "frequency", &ProjectileEmitterComponent::frequency, "damage",
         &ProjectileEmitterComponent::damage, "countdown_timer", &ProjectileEmitterComponent::countDownTimer,
-        "projectile_name", &ProjectileEmitterComponent::projectileName);
+        "projectile_name", &ProjectileEmitterComponent::projectileName, "continuous_collision",
+        &ProjectileEmitterComponent::continuousCollision);
   }
 };
@@ -8,6 +8,7 @@
 #include "Lua/Bindings/HealthComponentLuaBinding.h"
 #include "Lua/Bindings/LuaComponentRegistry.h"
 #include "Lua/Bindings/NameComponentLuaBinding.h"
+#include "Lua/Bindings/ParticleEmitterComponentLuaBinding.h"
 #include "Lua/Bindings/PositionComponentLuaBinding.h"
 #include "Lua/Bindings/ProjectileEmitterComponentLuaBinding.h"
 #include "Lua/Bindings/RigidBodyComponentLuaBinding.h"
@@ -46,4 +47,5 @@ void RegisterAllLuaBindings() {
   LuaComponentRegistry::registerComponent<UIAnchorComponent>();
   LuaComponentRegistry::registerComponent<UIRectComponent>();
   LuaComponentRegistry::registerComponent<UIZIndexComponent>();
+  LuaComponentRegistry::registerComponent<ParticleEmitterComponent>();
 }
@@ -12,10 +12,17 @@ struct LuaBinding<RigidBodyComponent> {
 
   static RigidBodyComponent fromLua(const sol::object& data) {
     const auto t = data.as<sol::table>();
-    return RigidBodyComponent(LuaComponentHelpers::SafeGetVec2(t, "velocity"));
+    using namespace LuaComponentHelpers;
+    return RigidBodyComponent(SafeGetVec2(t, "velocity"), SafeGetOptionalValue<float>(t, "mass", 1.0f),
+                              SafeGetOptionalValue<float>(t, "restitution", 0.0f),
+                              SafeGetOptionalValue<float>(t, "friction", 0.2f),
+                              SafeGetOptionalValue<bool>(t, "simulated", false));
   }
 
   static void bindUsertype(sol::state& lua) {
-    lua.new_usertype<RigidBodyComponent>(kUsertypeName, "velocity", &RigidBodyComponent::velocity);
+    lua.new_usertype<RigidBodyComponent>(kUsertypeName, "velocity", &RigidBodyComponent::velocity, "mass",
+                                         &RigidBodyComponent::mass, "restitution", &RigidBodyComponent::restitution,
+                                         "friction", &RigidBodyComponent::friction, "simulated",
+                                         &RigidBodyComponent::simulated);
   }
 };
@@ -5,6 +5,7 @@
 #include <string>
 #include <string_view>
 
+#include "AssetManager/AssetManager.h"
 #include "Components/SpriteComponent.h"
 #include "General/BlendMode.h"
 #include "General/Constants.h"
@@ -35,6 +36,10 @@ struct LuaBinding<SpriteComponent> {
     return sprite;
   }
 
+  static void internAssets(SpriteComponent& sprite, AssetManager& assets) {
+    sprite.texture = assets.Intern(sprite.assetId);
+  }
+
   static void bindUsertype(sol::state& lua) {
     lua.new_usertype<SpriteComponent>(
         kUsertypeName, "width", sol::readonly(&SpriteComponent::width), "height",
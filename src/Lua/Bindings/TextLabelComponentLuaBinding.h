@@ -2,6 +2,7 @@
 
 #include <sol/sol.hpp>
 
+#include "AssetManager/AssetManager.h"
 #include "Components/TextLabelComponent.h"
 #include "Lua/Bindings/LuaBinding.h"
 
@@ -22,6 +23,10 @@ struct LuaBinding<TextLabelComponent> {
     return TextLabelComponent(offsetPosition, layer, text, fontId, color, isFixed);
   }
 
+  static void internAssets(TextLabelComponent& label, AssetManager& assets) {
+    label.font = assets.Intern(label.fontId);
+  }
+
   static void bindUsertype(sol::state& lua) {
     lua.new_usertype<TextLabelComponent>(kUsertypeName, "text", &TextLabelComponent::text, "color",
                                          &TextLabelComponent::color, "layer", &TextLabelComponent::layer, "position",
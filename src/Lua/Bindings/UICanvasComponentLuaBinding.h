@@ -13,14 +13,16 @@ struct LuaBinding<UICanvasComponent> {
   static UICanvasComponent fromLua(const sol::object& data) {
     const auto t = data.as<sol::table>();
     using namespace LuaComponentHelpers;
-    return UICanvasComponent(
+    UICanvasComponent canvas(
         SafeGetOptionalValue<bool>(t, "is_fixed", true), SafeGetOptionalValue<float>(t, "width", 0.f),
         SafeGetOptionalValue<float>(t, "height", 0.f), SafeGetOptionalValue<int>(t, "base_layer", 0));
+    canvas.cached = SafeGetOptionalValue<bool>(t, "cached", false);
+    return canvas;
   }
 
   static void bindUsertype(sol::state& lua) {
     lua.new_usertype<UICanvasComponent>(kUsertypeName, "is_fixed", &UICanvasComponent::isFixed, "width",
                                         &UICanvasComponent::width, "height", &UICanvasComponent::height, "base_layer",
-                                        &UICanvasComponent::baseLayer);
+                                        &UICanvasComponent::baseLayer, "cached", &UICanvasComponent::cached);
   }
 };
@@ -6,6 +6,7 @@
 #include "Components/EntityMaskComponent.h"
 #include "Components/GlobalTransformComponent.h"
 #include "Components/NameComponent.h"
+#include "Components/ParticleEmitterComponent.h"
 #include "Components/PositionComponent.h"
 #include "Components/RotationComponent.h"
 #include "Components/ScaleComponent.h"
@@ -175,8 +176,8 @@ class LuaEntityLoader {
 
  private:
   // Add a GlobalTransformComponent iff (a) any local transform component is present and
-  // (b) at least one world-space consumer system (sprite/primitive/collider/UI button/text label)
-  // is attached. Keeps script-only or camera-anchor entities lean.
+  // (b) at least one world-space consumer system (sprite/primitive/collider/UI button/text label/
+  // particle emitter) is attached. Keeps script-only or camera-anchor entities lean.
   static void MaybeAttachGlobalTransform(Registry* registry, const Entity& entity) {
     const bool hasAnyLocal = registry->HasComponent<PositionComponent>(entity) ||
                              registry->HasComponent<ScaleComponent>(entity) ||
@@ -186,7 +187,7 @@ class LuaEntityLoader {
     const bool needsGlobal =
         registry->HasComponent<SpriteComponent>(entity) || registry->HasComponent<SquarePrimitiveComponent>(entity) ||
         registry->HasComponent<BoxColliderComponent>(entity) || registry->HasComponent<UIButtonComponent>(entity) ||
-        registry->HasComponent<TextLabelComponent>(entity);
+        registry->HasComponent<TextLabelComponent>(entity) || registry->HasComponent<ParticleEmitterComponent>(entity);
     if (!needsGlobal) return;
 
     if (registry->HasComponent<GlobalTransformComponent>(entity)) return;
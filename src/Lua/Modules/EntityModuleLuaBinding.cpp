@@ -1,7 +1,10 @@
 #include "Lua/Modules/EntityModuleLuaBinding.h"
 
+#include <cstdint>
 #include <glm/glm.hpp>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "Components/NameComponent.h"
 #include "Components/PositionComponent.h"
@@ -12,6 +15,7 @@
 #include "Lua/Bindings/LuaComponentRegistry.h"
 #include "Lua/LuaBindingContext.h"
 #include "Systems/CollisionSystem.h"
+#include "Systems/SpatialIndex.h"
 
 namespace {
 glm::vec2 GetEntityPosition(Registry* registry, const Entity entity) {
@@ -83,6 +87,127 @@ void BlamEntities(Registry* registry, const sol::table& entities) {
     registry->QueueBlamEntity(value.as<Entity>());
   }
 }
+
+// Result buffers for the spatial.* queries, reused across calls so a query allocates nothing on
+// the C++ side. Lua bindings only run on the main thread.
+struct SpatialScratch {
+  std::vector<Entity> entities;
+  std::vector<RayHit> rays;
+  std::vector<NearestHit> nearest;
+};
+
+SpatialScratch& GetSpatialScratch() {
+  static SpatialScratch scratch;
+  return scratch;
+}
+
+// nullptr until the collision system is registered (e.g. in headless tooling).
+const SpatialIndex* GetSpatialIndex(Registry* registry) {
+  CollisionSystem* cs = registry->Get<CollisionSystem*>();
+  return cs != nullptr ? &cs->GetSpatialIndex() : nullptr;
+}
+
+// Scripts pass masks as plain ints, like `collision_mask`; omitted means "every layer".
+EntityMask ToQueryMask(const sol::optional<int> mask) {
+  return mask ? EntityMask(static_cast<std::uint32_t>(*mask)) : SpatialIndex::kAllMasks;
+}
+
+// Write the live entities of `hits` into `out` as a 1-based array. A caller-supplied table is
+// refilled in place (stale tail entries cleared) so per-frame queries can reuse one table;
+// otherwise a table presized to the hit count is created. Entities despawned since the last
+// collision pass are skipped.
+template <typename Hits, typename ToEntity>
+sol::table WriteEntityArray(sol::this_state state, Registry* registry, const Hits& hits,
+                            const sol::optional<sol::table>& out, ToEntity toEntity) {
+  sol::state_view lua(state);
+  sol::table result = out ? *out : lua.create_table(static_cast<int>(hits.size()), 0);
+  int count = 0;
+  for (const auto& hit : hits) {
+    const Entity entity = toEntity(hit);
+    if (!registry->IsAlive(entity)) continue;
+    result.raw_set(++count, entity);
+  }
+  for (int i = count + 1; result.raw_get<sol::object>(i).get_type() != sol::type::lua_nil; ++i) {
+    result.raw_set(i, sol::lua_nil);
+  }
+  return result;
+}
+
+sol::table InstallSpatialTable(sol::state& lua, LuaBindingContext& ctx) {
+  sol::table spatial = lua.create_table();
+  const auto self = [](const Entity entity) { return entity; };
+
+  spatial.set_function("query_aabb", [&ctx, self](sol::this_state state, const float x, const float y,
+                                                   const float w, const float h, const sol::optional<int> mask,
+                                                   const sol::optional<sol::table> out) {
+    Registry* registry = ctx.GetRegistry();
+    auto& hits = GetSpatialScratch().entities;
+    hits.clear();
+    if (const SpatialIndex* index = GetSpatialIndex(registry)) {
+      index->QueryAabb(x, y, x + w, y + h, ToQueryMask(mask), hits);
+    }
+    return WriteEntityArray(state, registry, hits, out, self);
+  });
+
+  spatial.set_function("query_circle", [&ctx, self](sol::this_state state, const float x, const float y,
+                                                     const float radius, const sol::optional<int> mask,
+                                                     const sol::optional<sol::table> out) {
+    Registry* registry = ctx.GetRegistry();
+    auto& hits = GetSpatialScratch().entities;
+    hits.clear();
+    if (const SpatialIndex* index = GetSpatialIndex(registry)) {
+      index->QueryCircle(x, y, radius, ToQueryMask(mask), hits);
+    }
+    return WriteEntityArray(state, registry, hits, out, self);
+  });
+
+  // First hit only: returns entity, distance, hit_x, hit_y — or nil on a miss.
+  spatial.set_function("raycast", [&ctx](sol::this_state state, const float ox, const float oy, const float dx,
+                                         const float dy, const float maxDistance, const sol::optional<int> mask) {
+    Registry* registry = ctx.GetRegistry();
+    sol::variadic_results results;
+    const SpatialIndex* index = GetSpatialIndex(registry);
+    // Despawned colliders are skipped inside the search, so one in front can't hide a live hit.
+    const auto alive = [registry](const Entity entity) { return registry->IsAlive(entity); };
+    const auto hit =
+        index != nullptr ? index->Raycast(ox, oy, dx, dy, maxDistance, ToQueryMask(mask), alive) : std::nullopt;
+    if (!hit) {
+      results.push_back(sol::make_object(state, sol::lua_nil));
+      return results;
+    }
+    results.push_back(sol::make_object(state, hit->entity));
+    results.push_back(sol::make_object(state, hit->distance));
+    results.push_back(sol::make_object(state, hit->x));
+    results.push_back(sol::make_object(state, hit->y));
+    return results;
+  });
+
+  spatial.set_function("raycast_all", [&ctx](sol::this_state state, const float ox, const float oy, const float dx,
+                                             const float dy, const float maxDistance, const sol::optional<int> mask,
+                                             const sol::optional<sol::table> out) {
+    Registry* registry = ctx.GetRegistry();
+    auto& hits = GetSpatialScratch().rays;
+    hits.clear();
+    if (const SpatialIndex* index = GetSpatialIndex(registry)) {
+      index->RaycastAll(ox, oy, dx, dy, maxDistance, ToQueryMask(mask), hits);
+    }
+    return WriteEntityArray(state, registry, hits, out, [](const RayHit& hit) { return hit.entity; });
+  });
+
+  spatial.set_function("nearest", [&ctx](sol::this_state state, const float x, const float y, const int k,
+                                         const sol::optional<int> mask, const sol::optional<sol::table> out) {
+    Registry* registry = ctx.GetRegistry();
+    auto& hits = GetSpatialScratch().nearest;
+    hits.clear();
+    const SpatialIndex* index = GetSpatialIndex(registry);
+    if (index != nullptr && k > 0) {
+      index->Nearest(x, y, static_cast<size_t>(k), ToQueryMask(mask), hits);
+    }
+    return WriteEntityArray(state, registry, hits, out, [](const NearestHit& hit) { return hit.entity; });
+  });
+
+  return spatial;
+}
 }  // namespace
 
 void LuaModuleBinding<EntityModule>::install(sol::state& lua, LuaBindingContext& ctx) {
@@ -113,6 +238,10 @@ void LuaModuleBinding<EntityModule>::install(sol::state& lua, LuaBindingContext&
     return cs != nullptr && cs->IsOverlapping(a, b);
   });
 
+  // Spatial queries over the colliders of the last completed collision pass (see SpatialIndex).
+  // Each array-returning query accepts an optional trailing table to refill instead of allocating.
+  lua["spatial"] = InstallSpatialTable(lua, ctx);
+
   lua["registry"] = lua.create_table();
   sol::table reg = lua["registry"];
 
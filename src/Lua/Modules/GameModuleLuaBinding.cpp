@@ -1,12 +1,166 @@
 #include "Lua/Modules/GameModuleLuaBinding.h"
 
+#include <cmath>
+#include <cstdint>
 #include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <tuple>
 
 #include "Components/CameraComponents.h"
+#include "Components/TilemapLayerComponent.h"
+#include "ECS/Query.h"
 #include "ECS/Registry.h"
 #include "Game/GameConfig.h"
+#include "General/Color.h"
 #include "Lua/LuaBindingContext.h"
+#include "Renderer/DebugDraw.h"
+#include "Renderer/StaticSpriteLayer.h"
+#include "Systems/ParticlePool.h"
 #include "Systems/ProjectileEmitSystem.h"
+#include "Systems/TileCollisionGrid.h"
+
+namespace {
+using TilemapLayerQuery = std::unique_ptr<ComponentQuery<TilemapLayerComponent>>;
+
+// Scenes hold a handful of layers, so a linear scan of the layer query is all a name lookup needs.
+TilemapLayerComponent* FindTilemapLayer(Registry* registry, TilemapLayerQuery& query, const std::string& name) {
+  if (!query) query = registry->CreateQuery<TilemapLayerComponent>();
+  query->Update();
+  TilemapLayerComponent* found = nullptr;
+  query->ForEach([&](TilemapLayerComponent& layer) {
+    if (found == nullptr && layer.name == name) found = &layer;
+  });
+  return found;
+}
+
+sol::table InstallTilemapTable(sol::state& lua, LuaBindingContext& ctx) {
+  sol::table tilemap = lua.create_table();
+  auto query = std::make_shared<TilemapLayerQuery>();
+
+  // Tile index at tile coordinates (-1 for an empty or out-of-range cell); nil if no such layer.
+  tilemap.set_function("get_tile", [&ctx, query](const std::string& layerName, const int x,
+                                                 const int y) -> sol::optional<int> {
+    const TilemapLayerComponent* layer = FindTilemapLayer(ctx.GetRegistry(), *query, layerName);
+    if (layer == nullptr) return sol::nullopt;
+    return static_cast<int>(layer->TileAt(x, y));
+  });
+
+  // Write a tile (-1 clears it). Only the chunk holding it is re-baked; on a solid layer the
+  // collision grid rebuilds before the next physics step. False if the layer or cell doesn't exist.
+  tilemap.set_function("set_tile", [&ctx, query](const std::string& layerName, const int x, const int y,
+                                                 const int tile) {
+    TilemapLayerComponent* layer = FindTilemapLayer(ctx.GetRegistry(), *query, layerName);
+    return layer != nullptr && layer->SetTile(x, y, tile);
+  });
+
+  // World position -> tile coordinates on a layer (may be out of range); nil, nil if no such layer.
+  tilemap.set_function("world_to_tile", [&ctx, query](const std::string& layerName, const float x, const float y) {
+    using Coord = sol::optional<int>;
+    const TilemapLayerComponent* layer = FindTilemapLayer(ctx.GetRegistry(), *query, layerName);
+    if (layer == nullptr || layer->tileWidth <= 0 || layer->tileHeight <= 0) {
+      return std::make_tuple(Coord(sol::nullopt), Coord(sol::nullopt));
+    }
+    const float tileX = std::floor((x - layer->origin.x) / static_cast<float>(layer->tileWidth));
+    const float tileY = std::floor((y - layer->origin.y) / static_cast<float>(layer->tileHeight));
+    return std::make_tuple(Coord(static_cast<int>(tileX)), Coord(static_cast<int>(tileY)));
+  });
+
+  // True if the world position falls in a solid tile of any solid layer.
+  tilemap.set_function("is_solid", [&ctx](const float x, const float y) {
+    Registry* registry = ctx.GetRegistry();
+    auto* grid = registry->TryGet<TileCollisionGrid>();
+    if (grid == nullptr) return false;
+    grid->Sync(*registry);
+    return grid->IsSolidAt(x, y);
+  });
+  return tilemap;
+}
+
+// {r, g, b, a} with each channel defaulting to 255, so `{r = 255, g = 0, b = 0}` is opaque red and
+// no table at all is white.
+octarine::Color DebugColor(const sol::optional<sol::table>& color) {
+  constexpr int kMax = 255;
+  if (!color) return {kMax, kMax, kMax, kMax};
+  const sol::table& t = color.value();
+  return {static_cast<std::uint8_t>(t.get_or("r", kMax)), static_cast<std::uint8_t>(t.get_or("g", kMax)),
+          static_cast<std::uint8_t>(t.get_or("b", kMax)), static_cast<std::uint8_t>(t.get_or("a", kMax))};
+}
+
+DebugDraw::Space DebugSpace(const sol::optional<bool> fixed) {
+  return fixed.value_or(false) ? DebugDraw::Space::Screen : DebugDraw::Space::World;
+}
+
+sol::table InstallDebugDrawTable(sol::state& lua, LuaBindingContext& ctx) {
+  sol::table debugDraw = lua.create_table();
+  using OptColor = sol::optional<sol::table>;
+  using OptBool = sol::optional<bool>;
+
+  // Shapes last one frame: draw them every frame they should stay up. World coordinates unless
+  // `fixed` is true (screen space, like a fixed component).
+  debugDraw.set_function("line", [&ctx](const float x0, const float y0, const float x1, const float y1,
+                                        const OptColor& color, const OptBool fixed) {
+    if (auto* draw = ctx.GetRegistry()->TryGet<DebugDraw>()) {
+      draw->Line(x0, y0, x1, y1, DebugColor(color), DebugSpace(fixed));
+    }
+  });
+
+  debugDraw.set_function("rect", [&ctx](const float x, const float y, const float w, const float h,
+                                        const OptColor& color, const OptBool filled, const OptBool fixed) {
+    auto* draw = ctx.GetRegistry()->TryGet<DebugDraw>();
+    if (draw == nullptr) return;
+    if (filled.value_or(false)) {
+      draw->FillRect(x, y, w, h, DebugColor(color), DebugSpace(fixed));
+    } else {
+      draw->Rect(x, y, w, h, DebugColor(color), DebugSpace(fixed));
+    }
+  });
+
+  debugDraw.set_function("circle", [&ctx](const float x, const float y, const float radius, const OptColor& color,
+                                          const OptBool filled, const OptBool fixed) {
+    auto* draw = ctx.GetRegistry()->TryGet<DebugDraw>();
+    if (draw == nullptr) return;
+    if (filled.value_or(false)) {
+      draw->FillCircle(x, y, radius, DebugColor(color), DebugSpace(fixed));
+    } else {
+      draw->Circle(x, y, radius, DebugColor(color), DebugSpace(fixed));
+    }
+  });
+
+  // SDL's 8x8 debug font; top-left at (x, y).
+  debugDraw.set_function("text", [&ctx](const float x, const float y, const std::string& text, const OptColor& color,
+                                        const OptBool fixed) {
+    if (auto* draw = ctx.GetRegistry()->TryGet<DebugDraw>()) {
+      draw->Text(x, y, text, DebugColor(color), DebugSpace(fixed));
+    }
+  });
+  return debugDraw;
+}
+
+sol::table InstallParticlesTable(sol::state& lua, LuaBindingContext& ctx) {
+  sol::table particles = lua.create_table();
+
+  // Live particles of an emitter entity (0 if it has none or isn't an emitter).
+  particles.set_function("count", [&ctx](const Entity emitter) {
+    const auto* store = ctx.GetRegistry()->TryGet<ParticleStore>();
+    return store == nullptr ? 0 : static_cast<int>(store->Count(emitter));
+  });
+
+  // Drop an emitter's live particles at once; emission carries on per its `emitting` flag.
+  particles.set_function("clear", [&ctx](const Entity emitter) {
+    auto* store = ctx.GetRegistry()->TryGet<ParticleStore>();
+    if (store == nullptr) return;
+    if (auto* state = store->Find(emitter)) state->pool.Clear();
+  });
+
+  // Live particles across every emitter.
+  particles.set_function("total", [&ctx]() {
+    const auto* store = ctx.GetRegistry()->TryGet<ParticleStore>();
+    return store == nullptr ? 0 : static_cast<int>(store->TotalParticles());
+  });
+  return particles;
+}
+}  // namespace
 
 void LuaModuleBinding<GameModule>::install(sol::state& lua, LuaBindingContext& ctx) {
   lua.set_function("quit_game", [&ctx]() { ctx.RequestQuit(); });
@@ -26,6 +180,23 @@ void LuaModuleBinding<GameModule>::install(sol::state& lua, LuaBindingContext& c
     return options.showPerfOverlay;
   });
 
+  // Rebake the retained static sprite layer next frame. The engine notices static entities being
+  // added or removed on its own, but not component edits — call this after moving, resizing or
+  // re-texturing an entity tagged "static".
+  lua.set_function("invalidate_static_sprites", [&ctx]() {
+    if (auto* layer = ctx.GetRegistry()->TryGet<StaticSpriteLayer>()) layer->Invalidate();
+  });
+
+  // Tile layers loaded from the scene's `tilemap` block (see docs/tilemaps.md), addressed by layer name.
+  lua["tilemap"] = InstallTilemapTable(lua, ctx);
+
+  // Immediate-mode debug shapes drawn over the scene this frame (see docs/lua-scripting.md).
+  lua["debug_draw"] = InstallDebugDrawTable(lua, ctx);
+
+  // Particle emitter queries; emitters themselves are `particle_emitter` components (see
+  // docs/lua-scripting.md).
+  lua["particles"] = InstallParticlesTable(lua, ctx);
+
   lua.set_function("set_game_map_dimensions", [&ctx](const double width, const double height) {
     auto& gameConfig = ctx.GetRegistry()->Get<GameConfig>();
     gameConfig.playableAreaHeight = static_cast<float>(height);
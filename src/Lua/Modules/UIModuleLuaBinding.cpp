@@ -55,6 +55,7 @@ void LuaModuleBinding<UIModule>::install(sol::state& lua, LuaBindingContext& ctx
       canvas.width = static_cast<float>((*opts)["width"].get_or(0.0));
       canvas.height = static_cast<float>((*opts)["height"].get_or(0.0));
       canvas.baseLayer = (*opts)["base_layer"].get_or(0);
+      canvas.cached = (*opts)["cached"].get_or(false);
     }
     r->AddComponent(entity, canvas);
     if (!r->HasComponent<UIRectComponent>(entity)) {
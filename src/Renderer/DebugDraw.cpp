@@ -0,0 +1,24 @@
+#include "./DebugDraw.h"
+
+#include <SDL3/SDL.h>
+
+void DebugDraw::Flush(SDL_Renderer* sdlRenderer, const float cameraX, const float cameraY) {
+  const Batch& batch = Gather(cameraX, cameraY);
+  if (sdlRenderer == nullptr) return;
+
+  if (!batch.indices.empty()) {
+    static_assert(sizeof(Vertex) == 6 * sizeof(float), "Vertex must stay position + SDL_FColor");
+    const Vertex* vertices = batch.vertices.data();
+    // Untextured geometry takes the draw blend mode.
+    SDL_SetRenderDrawBlendMode(sdlRenderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometryRaw(sdlRenderer, nullptr, &vertices->x, sizeof(Vertex),
+                          reinterpret_cast<const SDL_FColor*>(&vertices->r), sizeof(Vertex), nullptr, 0,
+                          static_cast<int>(batch.vertices.size()), batch.indices.data(),
+                          static_cast<int>(batch.indices.size()), sizeof(std::uint32_t));
+  }
+
+  for (const Label& label : batch.labels) {
+    SDL_SetRenderDrawColor(sdlRenderer, label.color.r, label.color.g, label.color.b, label.color.a);
+    SDL_RenderDebugText(sdlRenderer, label.x, label.y, label.text.c_str());
+  }
+}
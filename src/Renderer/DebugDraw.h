@@ -0,0 +1,307 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "General/Color.h"
+
+struct SDL_Renderer;
+
+// Immediate-mode debug drawing: lines, rects, circles and text pushed from anywhere during the
+// frame and drawn over the scene by FrameLoop::Render. Collider wireframes (DrawColliderSystem) and
+// the Lua `debug_draw` table go through it.
+//
+// Every shape is tessellated on the spot into triangles — a line is a thin quad — so the frame's
+// shapes go out as one SDL_RenderGeometryRaw call however many there are, plus one
+// SDL_RenderDebugText per string. Producers write to a per-thread buffer found through a
+// thread_local cursor (the RenderPayloadPool scheme), so ParallelForEach bodies can draw without
+// locking. The cursor remembers one DebugDraw, so a thread switching instances looks its buffer up
+// again under a mutex — registering one only on its first draw on that instance. Buffers keep
+// their capacity across frames.
+//
+// World-space shapes are offset by the camera when gathered; Space::Screen shapes (fixed UI,
+// isFixed colliders) are not. Gather / Flush / Clear run between phases, never alongside
+// producers. Everything but Flush is SDL-free.
+class DebugDraw {
+ public:
+  enum class Space : std::uint8_t { World, Screen };
+
+  struct Point {
+    float x = 0.0F;
+    float y = 0.0F;
+  };
+
+  // Position + color, laid out so the color can be handed to SDL as an SDL_FColor array.
+  struct Vertex {
+    float x = 0.0F;
+    float y = 0.0F;
+    float r = 0.0F;
+    float g = 0.0F;
+    float b = 0.0F;
+    float a = 0.0F;
+  };
+
+  struct Label {
+    float x = 0.0F;
+    float y = 0.0F;
+    octarine::Color color;
+    std::string text;
+  };
+
+  // The frame's shapes merged across threads, in screen coordinates.
+  struct Batch {
+    std::vector<Vertex> vertices;
+    std::vector<std::uint32_t> indices;
+    std::vector<Label> labels;
+  };
+
+  static constexpr float kDefaultThickness = 1.0F;
+  // Circle tessellation: roughly one segment per 4 px of circumference, within these bounds.
+  static constexpr int kMinCircleSegments = 12;
+  static constexpr int kMaxCircleSegments = 64;
+
+  DebugDraw() : epoch_(NextEpoch()) {}
+  ~DebugDraw() = default;
+  DebugDraw(const DebugDraw&) = delete;
+  DebugDraw& operator=(const DebugDraw&) = delete;
+  // Registry::Set takes singletons by value. Only valid before any producer is drawing; a fresh
+  // epoch makes every thread register a new buffer with the moved-to instance.
+  DebugDraw(DebugDraw&& other) noexcept : buffers_(std::move(other.buffers_)), epoch_(NextEpoch()) {}
+  DebugDraw& operator=(DebugDraw&& other) noexcept {
+    buffers_ = std::move(other.buffers_);
+    epoch_ = NextEpoch();
+    return *this;
+  }
+
+  void Line(const float x0, const float y0, const float x1, const float y1, const octarine::Color color,
+            const Space space = Space::World, const float thickness = kDefaultThickness) {
+    AddSegment(ShapesFor(space), {x0, y0}, {x1, y1}, color, thickness);
+  }
+
+  // Connected segments through `points`; `closed` joins the last point back to the first.
+  void Polyline(const std::span<const Point> points, const bool closed, const octarine::Color color,
+                const Space space = Space::World, const float thickness = kDefaultThickness) {
+    if (points.size() < 2) return;
+    Shapes& shapes = ShapesFor(space);
+    for (std::size_t i = 1; i < points.size(); ++i) AddSegment(shapes, points[i - 1], points[i], color, thickness);
+    if (closed && points.size() > 2) AddSegment(shapes, points.back(), points.front(), color, thickness);
+  }
+
+  // Outline drawn inside the rect's edges, like SDL_RenderRect.
+  void Rect(const float x, const float y, const float w, const float h, const octarine::Color color,
+            const Space space = Space::World, const float thickness = kDefaultThickness) {
+    Shapes& shapes = ShapesFor(space);
+    const float t = std::min({thickness, w * 0.5F, h * 0.5F});
+    AddRect(shapes, x, y, w, t, color);
+    AddRect(shapes, x, y + h - t, w, t, color);
+    AddRect(shapes, x, y + t, t, h - 2.0F * t, color);
+    AddRect(shapes, x + w - t, y + t, t, h - 2.0F * t, color);
+  }
+
+  void FillRect(const float x, const float y, const float w, const float h, const octarine::Color color,
+                const Space space = Space::World) {
+    AddRect(ShapesFor(space), x, y, w, h, color);
+  }
+
+  void Circle(const float cx, const float cy, const float radius, const octarine::Color color,
+              const Space space = Space::World, const float thickness = kDefaultThickness) {
+    Shapes& shapes = ShapesFor(space);
+    const int segments = CircleSegments(radius);
+    Point previous{cx + radius, cy};
+    ForEachCirclePoint(cx, cy, radius, segments, [&](const Point point) {
+      AddSegment(shapes, previous, point, color, thickness);
+      previous = point;
+    });
+  }
+
+  void FillCircle(const float cx, const float cy, const float radius, const octarine::Color color,
+                  const Space space = Space::World) {
+    Shapes& shapes = ShapesFor(space);
+    const int segments = CircleSegments(radius);
+    const auto center = static_cast<std::uint32_t>(shapes.vertices.size());
+    shapes.vertices.push_back(MakeVertex({cx, cy}, color));
+    shapes.vertices.push_back(MakeVertex({cx + radius, cy}, color));
+    ForEachCirclePoint(cx, cy, radius, segments, [&](const Point point) {
+      const auto last = static_cast<std::uint32_t>(shapes.vertices.size() - 1);
+      shapes.vertices.push_back(MakeVertex(point, color));
+      shapes.indices.insert(shapes.indices.end(), {center, last, last + 1});
+    });
+  }
+
+  // SDL's built-in 8x8 debug font, top-left at (x, y).
+  void Text(const float x, const float y, const std::string_view text, const octarine::Color color,
+            const Space space = Space::World) {
+    Buffer& buffer = Local();
+    (space == Space::World ? buffer.worldLabels : buffer.screenLabels).push_back({x, y, color, std::string(text)});
+  }
+
+  // Merge every thread's shapes into one batch, world-space ones shifted by -camera, and empty the
+  // buffers. The batch stays valid until the next Gather.
+  const Batch& Gather(const float cameraX, const float cameraY) {
+    batch_.vertices.clear();
+    batch_.indices.clear();
+    batch_.labels.clear();
+    for (const auto& buffer : buffers_) {
+      Append(buffer->world, -cameraX, -cameraY);
+      Append(buffer->screen, 0.0F, 0.0F);
+      for (Label& label : buffer->worldLabels) {
+        label.x -= cameraX;
+        label.y -= cameraY;
+        batch_.labels.push_back(std::move(label));
+      }
+      for (Label& label : buffer->screenLabels) batch_.labels.push_back(std::move(label));
+      Reset(*buffer);
+    }
+    return batch_;
+  }
+
+  // Gather and draw onto the current render target: one geometry call plus one per string.
+  void Flush(SDL_Renderer* sdlRenderer, float cameraX, float cameraY);
+
+  // Drop everything drawn since the last flush (scene change, bench reset).
+  void Clear() {
+    for (const auto& buffer : buffers_) Reset(*buffer);
+  }
+
+  // Per-thread buffers registered so far: one per thread that has drawn on this instance.
+  [[nodiscard]] std::size_t BufferCount() const { return buffers_.size(); }
+
+ private:
+  struct Shapes {
+    std::vector<Vertex> vertices;
+    std::vector<std::uint32_t> indices;
+  };
+  struct Buffer {
+    std::thread::id thread;
+    Shapes world;
+    Shapes screen;
+    std::vector<Label> worldLabels;
+    std::vector<Label> screenLabels;
+  };
+  struct Cursor {
+    const DebugDraw* owner = nullptr;
+    std::uint64_t epoch = 0;
+    Buffer* buffer = nullptr;
+  };
+
+  static std::uint64_t NextEpoch() {
+    static std::atomic<std::uint64_t> epochs{0};
+    return epochs.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // This thread's buffer. The cursor is the fast path; when it points at another instance (or this
+  // one before a move) the buffer is found by thread id, and only created on a thread's first draw.
+  Buffer& Local() {
+    thread_local Cursor cursor;
+    if (cursor.owner != this || cursor.epoch != epoch_) {
+      const std::thread::id self = std::this_thread::get_id();
+      const std::lock_guard lock(mutex_);
+      auto it = std::find_if(buffers_.begin(), buffers_.end(), [self](const auto& b) { return b->thread == self; });
+      if (it == buffers_.end()) {
+        buffers_.push_back(std::make_unique<Buffer>());
+        buffers_.back()->thread = self;
+        it = buffers_.end() - 1;
+      }
+      cursor = {this, epoch_, it->get()};
+    }
+    return *cursor.buffer;
+  }
+
+  Shapes& ShapesFor(const Space space) {
+    Buffer& buffer = Local();
+    return space == Space::World ? buffer.world : buffer.screen;
+  }
+
+  static Vertex MakeVertex(const Point point, const octarine::Color color) {
+    constexpr float kInv255 = 1.0F / 255.0F;
+    return {point.x, point.y, color.r * kInv255, color.g * kInv255, color.b * kInv255, color.a * kInv255};
+  }
+
+  // Two triangles over the quad a-b-c-d, given in winding order.
+  static void AddQuad(Shapes& shapes, const Point a, const Point b, const Point c, const Point d,
+                      const octarine::Color color) {
+    const auto base = static_cast<std::uint32_t>(shapes.vertices.size());
+    shapes.vertices.insert(shapes.vertices.end(),
+                           {MakeVertex(a, color), MakeVertex(b, color), MakeVertex(c, color), MakeVertex(d, color)});
+    shapes.indices.insert(shapes.indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+  }
+
+  static void AddRect(Shapes& shapes, const float x, const float y, const float w, const float h,
+                      const octarine::Color color) {
+    if (w <= 0.0F || h <= 0.0F) return;
+    AddQuad(shapes, {x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}, color);
+  }
+
+  // A segment as a quad `thickness` wide, centred on the line. A zero-length segment is a dot.
+  static void AddSegment(Shapes& shapes, const Point a, const Point b, const octarine::Color color,
+                         const float thickness) {
+    const float dx = b.x - a.x;
+    const float dy = b.y - a.y;
+    const float length = std::sqrt(dx * dx + dy * dy);
+    const float half = thickness * 0.5F;
+    if (length <= 0.0F) {
+      AddRect(shapes, a.x - half, a.y - half, thickness, thickness, color);
+      return;
+    }
+    const float nx = -dy / length * half;
+    const float ny = dx / length * half;
+    AddQuad(shapes, {a.x + nx, a.y + ny}, {b.x + nx, b.y + ny}, {b.x - nx, b.y - ny}, {a.x - nx, a.y - ny}, color);
+  }
+
+  static int CircleSegments(const float radius) {
+    const auto perimeterSteps = static_cast<int>(radius * 1.5F);  // ~2*pi*r / 4
+    return std::clamp(perimeterSteps, kMinCircleSegments, kMaxCircleSegments);
+  }
+
+  // Calls f(point) for the `segments` points after (cx + radius, cy) going round, ending back on it.
+  // Rotates incrementally, so there is one sin/cos pair per circle rather than per point.
+  template <typename F>
+  static void ForEachCirclePoint(const float cx, const float cy, const float radius, const int segments, F&& f) {
+    const float step = 6.28318530718F / static_cast<float>(segments);
+    const float c = std::cos(step);
+    const float s = std::sin(step);
+    float ox = radius;
+    float oy = 0.0F;
+    for (int i = 1; i < segments; ++i) {
+      const float rx = ox * c - oy * s;
+      oy = ox * s + oy * c;
+      ox = rx;
+      f(Point{cx + ox, cy + oy});
+    }
+    f(Point{cx + radius, cy});
+  }
+
+  void Append(const Shapes& shapes, const float offsetX, const float offsetY) {
+    const auto base = static_cast<std::uint32_t>(batch_.vertices.size());
+    for (Vertex vertex : shapes.vertices) {
+      vertex.x += offsetX;
+      vertex.y += offsetY;
+      batch_.vertices.push_back(vertex);
+    }
+    for (const std::uint32_t index : shapes.indices) batch_.indices.push_back(base + index);
+  }
+
+  static void Reset(Buffer& buffer) {
+    buffer.world.vertices.clear();
+    buffer.world.indices.clear();
+    buffer.screen.vertices.clear();
+    buffer.screen.indices.clear();
+    buffer.worldLabels.clear();
+    buffer.screenLabels.clear();
+  }
+
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+  std::mutex mutex_;
+  std::uint64_t epoch_;
+  Batch batch_;
+};
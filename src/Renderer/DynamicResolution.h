@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// Picks the scene render target's scale each frame from how long frames take. The scene is drawn
+// at Scale() of the game's logical size (Renderer::SetSceneScale) and upscaled on present, so a
+// fill-rate-bound frame — SDL's software renderer, a low-end GPU — trades sharpness for time
+// instead of dropping frames.
+//
+// Scales are quantized to kStepSize steps from 1.0 down to the configured minimum, so Renderer's
+// target pool holds a handful of sizes and a wobbling frame time can't reallocate every frame.
+// Smoothed frame time over budget steps down after a short cooldown; stepping up needs a sustained
+// stretch of headroom *and* a predicted cost (area-proportional, i.e. fill-bound) that still fits
+// the budget, which is what keeps it from oscillating between two steps. SDL-free; FrameLoop owns
+// one and feeds it.
+class DynamicResolution {
+ public:
+  static constexpr float kStepSize = 0.125F;
+  static constexpr float kLowestMinScale = 0.25F;
+  static constexpr float kDefaultMinScale = 0.5F;
+  static constexpr std::size_t kMaxSteps = 7;  // 1.0 .. kLowestMinScale
+
+  // Smoothed frame time above this share of the budget steps down...
+  static constexpr float kOverBudget = 0.95F;
+  // ...and stepping up needs the next step's predicted cost under this share.
+  static constexpr float kUpHeadroom = 0.85F;
+  static constexpr float kSmoothing = 0.1F;    // EMA weight of the newest frame
+  static constexpr int kCooldownFrames = 30;   // after any change, let the average settle
+  static constexpr int kUpSustainFrames = 60;  // consecutive frames of headroom before stepping up
+
+  DynamicResolution() = default;
+  explicit DynamicResolution(const float minScale) { SetMinScale(minScale); }
+
+  // Lowest scale the controller may pick, clamped to [kLowestMinScale, 1] and rounded up to a step.
+  // Raising it above the current scale snaps the scale up at once.
+  void SetMinScale(const float minScale) {
+    const float clamped = std::clamp(minScale, kLowestMinScale, 1.0F);
+    step_count_ = 1 + static_cast<std::size_t>(std::floor((1.0F - clamped) / kStepSize + 1e-4F));
+    step_ = std::min(step_, step_count_ - 1);
+  }
+
+  // Feed the last frame's cost against its budget (both ms). Returns true when Scale() changed.
+  bool Update(const float frameMs, const float budgetMs) {
+    if (budgetMs <= 0.0F || frameMs < 0.0F) return false;
+    average_ms_ = has_average_ ? average_ms_ + (frameMs - average_ms_) * kSmoothing : frameMs;
+    has_average_ = true;
+    if (cooldown_ > 0) {
+      --cooldown_;
+      return false;
+    }
+
+    if (average_ms_ > budgetMs * kOverBudget) {
+      headroom_frames_ = 0;
+      if (step_ + 1 >= step_count_) return false;
+      ++step_;
+      cooldown_ = kCooldownFrames;
+      return true;
+    }
+
+    if (step_ == 0) return false;
+    const float ratio = ScaleAt(step_ - 1) / ScaleAt(step_);
+    if (average_ms_ * ratio * ratio >= budgetMs * kUpHeadroom) {
+      headroom_frames_ = 0;
+      return false;
+    }
+    if (++headroom_frames_ < kUpSustainFrames) return false;
+    --step_;
+    headroom_frames_ = 0;
+    cooldown_ = kCooldownFrames;
+    return true;
+  }
+
+  // Back to full scale with a fresh average (option switched off, scene change, resize).
+  void Reset() {
+    step_ = 0;
+    cooldown_ = 0;
+    headroom_frames_ = 0;
+    has_average_ = false;
+    average_ms_ = 0.0F;
+  }
+
+  [[nodiscard]] float Scale() const { return ScaleAt(step_); }
+  [[nodiscard]] std::size_t Step() const { return step_; }
+  [[nodiscard]] std::size_t StepCount() const { return step_count_; }
+  [[nodiscard]] float AverageMs() const { return average_ms_; }
+
+  [[nodiscard]] static float ScaleAt(const std::size_t step) { return 1.0F - static_cast<float>(step) * kStepSize; }
+
+  // Pixel size of a target at `scale` of a `base` logical dimension; never below 1.
+  [[nodiscard]] static int ScaledSize(const int base, const float scale) {
+    return std::max(1, static_cast<int>(std::lround(static_cast<float>(base) * scale)));
+  }
+
+ private:
+  std::size_t step_ = 0;
+  std::size_t step_count_ = 1 + static_cast<std::size_t>((1.0F - kDefaultMinScale) / kStepSize);
+  float average_ms_ = 0.0F;
+  bool has_average_ = false;
+  int cooldown_ = 0;
+  int headroom_frames_ = 0;
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "AssetManager/GlyphMetrics.h"
+#include "General/Utils.h"
+
+// One glyph of a laid-out string: where it sits relative to the label's top-left corner and which
+// rect of which atlas page it samples. Same size on both sides — glyphs draw unscaled.
+struct GlyphQuad {
+  float x = 0.0F;
+  float y = 0.0F;
+  float srcX = 0.0F;
+  float srcY = 0.0F;
+  float w = 0.0F;
+  float h = 0.0F;
+  std::uint16_t page = 0;
+};
+
+// A string laid out against one font's GlyphMetrics: advances, pair kerning and '\n' line breaks
+// applied, blank glyphs dropped. width/height bound the whole label (height is lines × line skip);
+// `pages` has bit p set when a quad samples page p (pages past 31 share bit 31).
+struct GlyphLayout {
+  std::vector<GlyphQuad> quads;
+  float width = 0.0F;
+  float height = 0.0F;
+  std::uint32_t pages = 0;
+};
+
+// Lay UTF-8 `text` out against `metrics`. Top-aligned per line, matching how AtlasBaker and
+// GlyphCache rasterize each glyph at full line height. Pen positions snap to whole pixels so
+// glyphs sample the atlas 1:1. nullopt when a codepoint has no glyph.
+inline std::optional<GlyphLayout> LayoutGlyphs(const GlyphMetrics& metrics, const std::string_view text) {
+  GlyphLayout layout;
+  layout.quads.reserve(text.size());
+  const auto lineSkip = static_cast<float>(std::max(1, metrics.LineSkip()));
+  float pen = 0.0F;
+  float top = 0.0F;
+  std::uint32_t previous = 0;
+  for (size_t i = 0; i < text.size();) {
+    const std::uint32_t cp = NextUtf8Codepoint(text, i);
+    if (cp == '\n') {
+      layout.width = std::max(layout.width, pen);
+      pen = 0.0F;
+      top += lineSkip;
+      previous = 0;
+      continue;
+    }
+    const GlyphMetrics::Glyph* glyph = metrics.Find(cp);
+    if (glyph == nullptr) return std::nullopt;
+    if (previous != 0) pen += metrics.Kerning(previous, cp);
+    if (glyph->w > 0.0F && glyph->h > 0.0F && cp != ' ') {
+      layout.quads.push_back({std::floor(pen), top, glyph->x, glyph->y, glyph->w, glyph->h, glyph->page});
+      layout.pages |= 1u << std::min<std::uint16_t>(glyph->page, 31);
+    }
+    pen += glyph->advance;
+    previous = cp;
+  }
+  layout.width = std::ceil(std::max(layout.width, pen));
+  layout.height = top + lineSkip;
+  return layout;
+}
+
+// Content-keyed store of GlyphLayouts: (metrics, string) → layout, shared by every label showing
+// that string in that font. A label holds the shared_ptr it got back, so eviction never pulls a
+// layout out from under a live label; it only forgets the cache's own reference. Past `capacity`
+// entries the least recently used half is dropped in one pass (amortised O(1) per insert).
+// Lookups are heterogeneous, so a hit builds no key string. Not thread-safe.
+class GlyphLayoutCache {
+ public:
+  static constexpr std::size_t kDefaultCapacity = 1024;
+
+  struct Stats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+  };
+
+  explicit GlyphLayoutCache(const std::size_t capacity = kDefaultCapacity)
+      : capacity_(std::max<std::size_t>(capacity, 2)) {}
+
+  // Cached layout for `text`, laying it out on a miss; nullptr when the metrics lack a glyph.
+  std::shared_ptr<const GlyphLayout> Get(const GlyphMetrics& metrics, const std::string_view text) {
+    const KeyView view{&metrics, text};
+    if (const auto it = entries_.find(view); it != entries_.end()) {
+      ++stats_.hits;
+      it->second.lastUsed = ++tick_;
+      return it->second.layout;
+    }
+    ++stats_.misses;
+    std::optional<GlyphLayout> layout = LayoutGlyphs(metrics, text);
+    if (!layout) return nullptr;
+    if (entries_.size() >= capacity_) EvictOldestHalf();
+    auto shared = std::make_shared<const GlyphLayout>(std::move(*layout));
+    entries_.emplace(Key{&metrics, std::string(text)}, Entry{shared, ++tick_});
+    return shared;
+  }
+
+  // Drop every layout made against `metrics` — its glyphs moved or were evicted.
+  void Forget(const GlyphMetrics& metrics) {
+    std::erase_if(entries_, [&metrics](const auto& item) { return item.first.metrics == &metrics; });
+  }
+  void Clear() { entries_.clear(); }
+  [[nodiscard]] std::size_t Size() const { return entries_.size(); }
+  [[nodiscard]] const Stats& GetStats() const { return stats_; }
+
+ private:
+  struct Key {
+    const GlyphMetrics* metrics;
+    std::string text;
+  };
+  struct KeyView {
+    const GlyphMetrics* metrics;
+    std::string_view text;
+  };
+  struct KeyHash {
+    using is_transparent = void;
+    std::size_t operator()(const KeyView& key) const {
+      return std::hash<std::string_view>{}(key.text) ^ (std::hash<const void*>{}(key.metrics) * 31);
+    }
+    std::size_t operator()(const Key& key) const { return (*this)(KeyView{key.metrics, key.text}); }
+  };
+  struct KeyEqual {
+    using is_transparent = void;
+    static KeyView View(const Key& key) { return {key.metrics, key.text}; }
+    static KeyView View(const KeyView& key) { return key; }
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+      const KeyView l = View(a);
+      const KeyView r = View(b);
+      return l.metrics == r.metrics && l.text == r.text;
+    }
+  };
+  struct Entry {
+    std::shared_ptr<const GlyphLayout> layout;
+    std::uint64_t lastUsed = 0;
+  };
+
+  void EvictOldestHalf() {
+    std::vector<std::uint64_t> ticks;
+    ticks.reserve(entries_.size());
+    for (const auto& [key, entry] : entries_) ticks.push_back(entry.lastUsed);
+    const auto median = ticks.begin() + static_cast<std::ptrdiff_t>(ticks.size() / 2);
+    std::nth_element(ticks.begin(), median, ticks.end());
+    const std::uint64_t cutoff = *median;
+    stats_.evictions += std::erase_if(entries_, [cutoff](const auto& item) { return item.second.lastUsed < cutoff; });
+  }
+
+  std::unordered_map<Key, Entry, KeyHash, KeyEqual> entries_;
+  std::size_t capacity_;
+  std::uint64_t tick_ = 0;
+  Stats stats_;
+};
@@ -2,6 +2,8 @@
 
 #include <SDL3/SDL.h>
 
+#include <cstdint>
+
 #include "General/BlendMode.h"
 #include "General/Constants.h"
 
@@ -49,3 +51,18 @@ struct TextCommand {
   SDL_FRect destRect{};
   SDL_Texture* texture{};
 };
+
+// A producer-built triangle list drawn with one SDL_RenderGeometryRaw call (a particle emitter's
+// quads). The arrays are the producer's and must stay put until the frame is drawn; positions,
+// colors and uvs are read `stride` bytes apart. A null texture draws flat-colored triangles.
+struct GeometryCommand {
+  const float* positions{};
+  const SDL_FColor* colors{};
+  const float* uvs{};
+  int stride{};
+  int vertexCount{};
+  const std::uint32_t* indices{};
+  int indexCount{};
+  SDL_Texture* texture{};
+  SDL_BlendMode blendMode{SDL_BLENDMODE_BLEND};
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+
 #include "General/Rect.h"
 
 // Renderable viewport-cull test shared by all Render*System producers. World-space items
@@ -14,3 +17,29 @@ inline bool IsRenderableOutsideViewport(const float originX, const float originY
   return originX + width < camera.x || originX > camera.x + camera.w || originY + height < camera.y ||
          originY > camera.y + camera.h;
 }
+
+// Coarse test for a world-space AABB given as min/max corners (a chunk's bounds, a grid cell).
+// Same comparisons as the per-renderable test above, so anything that rejects a box would also
+// reject every renderable inside it.
+inline bool IsWorldBoundsOutsideCamera(const float minX, const float minY, const float maxX, const float maxY,
+                                       const octarine::Rect& camera) {
+  return maxX < camera.x || minX > camera.x + camera.w || maxY < camera.y || minY > camera.y + camera.h;
+}
+
+// Frame tally of viewport-cull decisions, read into RenderStats. Producers hold a pointer taken
+// from RenderStatsHistory::CullTally() — null while collection is off, so a disabled build pays one
+// predictable branch per test. Relaxed atomics: the sprite producer runs in parallel.
+struct RenderCullTally {
+  std::atomic<std::uint32_t> tested{0};
+  std::atomic<std::uint32_t> culled{0};
+
+  void Record(const bool wasCulled) {
+    tested.fetch_add(1, std::memory_order_relaxed);
+    if (wasCulled) culled.fetch_add(1, std::memory_order_relaxed);
+  }
+  // A producer that counted a whole pass locally (e.g. the static layer's grid walk).
+  void Add(const std::uint32_t testedCount, const std::uint32_t culledCount) {
+    tested.fetch_add(testedCount, std::memory_order_relaxed);
+    culled.fetch_add(culledCount, std::memory_order_relaxed);
+  }
+};
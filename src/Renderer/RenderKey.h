@@ -4,46 +4,34 @@
 #include <compare>
 #include <cstdint>
 
-#include "./RenderCommands.h"
 #include "./RenderableType.h"
 #include "General/Constants.h"
 
-// Render entry — slim header (precomputed sortKey + type) plus one of three POD payloads
-// in a union, selected by `type`. Inlining the payload here means a sorted iteration is
-// fully sequential reads through one vector instead of a random gather into per-type
-// command arrays.
+// Render queue record — the 16 bytes RenderQueue::Sort permutes: a precomputed sortKey, the
+// command's type, and the index of its payload in the queue's per-type pool. The payload itself
+// (SpriteCommand / SquareCommand / TextCommand / GeometryCommand) stays where the producer wrote
+// it; read it back with RenderQueue::Sprite / Square / Text / Geometry.
 //
 // `sortKey` packs all of (layer, depthBand, type, batchKey-hash) into a 64-bit integer
 // so RenderQueue::Sort can use a comparison-free radix sort. Layout, MSB → LSB:
 //   bits 63-48 : layer (16 bits, unsigned — 64K layers covers kDebugUIBaseLayer headroom)
 //   bits 47-28 : depthBand + bias (20 bits — ±16M world pixels at 32px bands)
 //   bits 27-24 : type (4 bits)
-//   bits 23-21 : blend mode (3 bits) — clusters same-blend runs within a band so SDL3
-//                doesn't break batches on blend-state changes.
+//   bits 23-21 : blend mode (3 bits) — clusters same-blend runs within a band so sprite
+//                batches don't break on blend-state changes.
 //   bits 20- 0 : batchKey hash (21 bits) — clusters same-texture runs within a
-//                band+blend so SDL3's internal renderer can coalesce them. 2M slots makes
+//                band+blend so SpriteBatcher submits each as one draw. 2M slots makes
 //                collisions vanishingly rare for any realistic texture count; collisions
 //                only degrade batching, never produce wrong pixels.
 //
-// type is also stored separately because Renderer::Render dispatches on it to choose the
-// payload union member.
+// type is also stored separately because Renderer::DrawQueue dispatches on it to choose the
+// payload pool. The two usually agree; glyph quads (RenderQueue::EmplaceGlyph) sort as TEXT but
+// are SPRITE records.
 struct RenderKey {
   std::uint64_t sortKey{};
+  std::uint32_t payloadIndex{};
   RenderableType type{};
 
-  union Payload {
-    SpriteCommand sprite;
-    SquareCommand square;
-    TextCommand text;
-
-    // Leaves union storage uninitialized — the producing system always overwrites the
-    // active member chosen by `type`. Skipping zero-init saves ~56 bytes of writes per
-    // emplace, which is meaningful at 100K+ keys per frame.
-    Payload() {}
-  } payload;
-
-  RenderKey() = default;
-
   static std::uint64_t ComputeSortKey(unsigned int layer, float depth, RenderableType type, const void* batchKey,
                                       std::uint8_t blendBits = 0) {
     std::int32_t band = 0;
@@ -78,3 +66,5 @@ struct RenderKey {
   auto operator<=>(const RenderKey& other) const { return sortKey <=> other.sortKey; }
   bool operator==(const RenderKey& other) const { return sortKey == other.sortKey && type == other.type; }
 };
+
+static_assert(sizeof(RenderKey) == 16, "RenderKey is the radix-sorted record; keep it at 16 bytes");
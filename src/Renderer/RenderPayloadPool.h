@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "General/Logger.h"
+#include "General/ThreadPool.h"
+
+// Growable multi-producer store for one render command type. RenderQueue keeps one pool per
+// payload type and sorts only 16-byte RenderKey records that point back into them.
+//
+// Storage is a list of fixed-size segments addressed through a fixed pointer table, so it can grow
+// without moving payloads that are already written. Each segment is split by field: the sort keys
+// sit in their own array, so the record gather in RenderQueue::Sort streams 8 bytes per slot
+// instead of striding over the payloads. Each producer thread reserves a block of kBlockSlots slots
+// at a time with one fetch_add on the shared block counter and then fills it with no further
+// synchronisation. A block that lands past the allocated segments allocates the next segment under
+// a mutex (rare: Clear pre-grows the store from the observed high-water mark, so steady-state
+// frames never take it). Nothing is dropped short of the segment table's hard cap, where further
+// commands go to a per-thread scratch block and are logged once instead of writing past it.
+template <typename Command>
+class RenderPayloadPool {
+ public:
+  // Slots reserved per producer per claim.
+  static constexpr size_t kBlockSlots = 256;
+  static constexpr size_t kBlocksPerSegment = 64;
+  static constexpr size_t kSegmentSlots = kBlocksPerSegment * kBlockSlots;
+
+  explicit RenderPayloadPool(const size_t capacity)
+      : segments_(std::make_unique<std::atomic<Segment*>[]>(kMaxSegments)), epoch_(NextEpoch()) {
+    Reserve(capacity);
+  }
+
+  ~RenderPayloadPool() = default;
+  RenderPayloadPool(const RenderPayloadPool&) = delete;
+  RenderPayloadPool& operator=(const RenderPayloadPool&) = delete;
+
+  // Atomics and the growth mutex aren't movable, but Registry::Set takes the RenderQueue singleton
+  // by value. The hand-rolled move snapshots the counters; only valid before any concurrent
+  // producer attaches (i.e. registration time). A fresh epoch invalidates any block a thread still
+  // holds.
+  RenderPayloadPool(RenderPayloadPool&& other) noexcept
+      : segments_(std::move(other.segments_)),
+        owned_(std::move(other.owned_)),
+        next_block_(other.next_block_.load(std::memory_order_relaxed)),
+        epoch_(NextEpoch()),
+        high_water_(other.high_water_),
+        growth_events_(other.growth_events_.load(std::memory_order_relaxed)) {}
+  RenderPayloadPool& operator=(RenderPayloadPool&& other) noexcept {
+    segments_ = std::move(other.segments_);
+    owned_ = std::move(other.owned_);
+    next_block_.store(other.next_block_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    epoch_ = NextEpoch();
+    high_water_ = other.high_water_;
+    growth_events_.store(other.growth_events_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+  }
+
+  // Claim a slot, stamp its sort key and hand back the payload for the producer to fill.
+  Command& Emplace(const std::uint64_t sortKey) {
+    thread_local BlockCursor cursor;
+    if (cursor.owner != this || cursor.epoch != epoch_ || *cursor.fill == kBlockSlots) ClaimBlock(cursor);
+    const std::uint32_t i = (*cursor.fill)++;
+    cursor.sortKeys[i] = sortKey;
+    return cursor.payloads[i];
+  }
+
+  // End-of-frame reset. Records the frame's usage in the high-water mark and grows the store so
+  // the next frame at that load (plus a partly-filled block per thread) needs no mid-frame growth.
+  void Clear() {
+    high_water_ = std::max(high_water_, Size());
+    if (high_water_ > 0) Reserve(high_water_ + high_water_ / 4 + kBlockSlots * ThreadPool::Instance().Size());
+    next_block_.store(0, std::memory_order_relaxed);
+    epoch_ = NextEpoch();
+  }
+
+  // Blocks reserved since the last Clear. Between phases only, like everything below.
+  [[nodiscard]] size_t Blocks() const noexcept {
+    return std::min(next_block_.load(std::memory_order_relaxed), kMaxBlocks);
+  }
+
+  [[nodiscard]] std::uint32_t FillOf(const size_t block) const noexcept {
+    return SegmentAt(block / kBlocksPerSegment).fill[block % kBlocksPerSegment];
+  }
+
+  // The block's sort keys, FillOf(block) of them; key i belongs to payload block * kBlockSlots + i.
+  [[nodiscard]] const std::uint64_t* SortKeys(const size_t block) const noexcept {
+    return SegmentAt(block / kBlocksPerSegment).sortKeys.data() + (block % kBlocksPerSegment) * kBlockSlots;
+  }
+
+  [[nodiscard]] const Command& At(const std::uint32_t slot) const noexcept {
+    return SegmentAt(slot / kSegmentSlots).payloads[slot % kSegmentSlots];
+  }
+
+  [[nodiscard]] size_t Size() const noexcept {
+    const size_t blocks = Blocks();
+    size_t count = 0;
+    for (size_t block = 0; block < blocks; ++block) count += FillOf(block);
+    return count;
+  }
+
+  [[nodiscard]] size_t Capacity() const noexcept { return owned_.size() * kSegmentSlots; }
+  [[nodiscard]] size_t HighWaterMark() const noexcept { return high_water_; }
+  [[nodiscard]] size_t GrowthEvents() const noexcept { return growth_events_.load(std::memory_order_relaxed); }
+  [[nodiscard]] size_t ResidentBytes() const noexcept { return owned_.size() * sizeof(Segment); }
+
+ private:
+  // Upper bound on the pointer table, so it never reallocates under concurrent readers. 4096
+  // segments is 64M slots — far past anything a frame can draw.
+  static constexpr size_t kMaxSegments = 4096;
+  static constexpr size_t kMaxBlocks = kMaxSegments * kBlocksPerSegment;
+
+  struct Segment {
+    std::array<std::uint64_t, kSegmentSlots> sortKeys;
+    std::array<Command, kSegmentSlots> payloads;
+    // Slots used per block; written only by the thread holding the block.
+    std::array<std::uint32_t, kBlocksPerSegment> fill;
+  };
+
+  // A producer thread's current block. One per thread per payload type, shared by every pool of
+  // that type: the owner/epoch check makes a block from another pool (or a previous frame) count
+  // as exhausted.
+  struct BlockCursor {
+    const RenderPayloadPool* owner = nullptr;
+    std::uint64_t epoch = 0;
+    std::uint64_t* sortKeys = nullptr;
+    Command* payloads = nullptr;
+    std::uint32_t* fill = nullptr;
+  };
+
+  static std::uint64_t NextEpoch() {
+    static std::atomic<std::uint64_t> epochs{0};
+    return epochs.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // Where a producer's writes land once the table is exhausted: one block per thread, never read.
+  struct OverflowBlock {
+    std::array<std::uint64_t, kBlockSlots> sortKeys;
+    std::array<Command, kBlockSlots> payloads;
+    std::uint32_t fill = 0;
+  };
+
+  void ClaimBlock(BlockCursor& cursor) {
+    const size_t block = next_block_.fetch_add(1, std::memory_order_relaxed);
+    if (block >= kMaxBlocks) {
+      ClaimOverflow(cursor);
+      return;
+    }
+    Segment& segment = SegmentFor(block / kBlocksPerSegment);
+    const size_t first = (block % kBlocksPerSegment) * kBlockSlots;
+    cursor.owner = this;
+    cursor.epoch = epoch_;
+    cursor.sortKeys = segment.sortKeys.data() + first;
+    cursor.payloads = segment.payloads.data() + first;
+    cursor.fill = &segment.fill[block % kBlocksPerSegment];
+    *cursor.fill = 0;
+  }
+
+  // Past kMaxSegments there is no table entry to grow into. Refuse the block: the cursor fills a
+  // thread-local scratch block that Blocks() never reaches, so the commands are dropped rather
+  // than indexing past the table.
+  void ClaimOverflow(BlockCursor& cursor) {
+    static std::atomic<bool> warned{false};
+    if (!warned.exchange(true, std::memory_order_relaxed)) {
+      Logger::Error("RenderPayloadPool: segment table exhausted (" + std::to_string(kMaxBlocks * kBlockSlots) +
+                    " slots); commands past it are dropped.");
+    }
+    thread_local std::unique_ptr<OverflowBlock> overflow;
+    if (!overflow) overflow = std::make_unique<OverflowBlock>();
+    cursor.owner = this;
+    cursor.epoch = epoch_;
+    cursor.sortKeys = overflow->sortKeys.data();
+    cursor.payloads = overflow->payloads.data();
+    cursor.fill = &overflow->fill;
+    *cursor.fill = 0;
+  }
+
+  // ClaimBlock keeps `index` inside the table; the assert guards new callers.
+  Segment& SegmentFor(const size_t index) {
+    assert(index < kMaxSegments && "RenderPayloadPool: segment index past the table");
+    if (Segment* segment = segments_[index].load(std::memory_order_acquire)) return *segment;
+    const std::lock_guard<std::mutex> lock(growth_mutex_);
+    if (Segment* segment = segments_[index].load(std::memory_order_relaxed)) return *segment;
+    growth_events_.fetch_add(1, std::memory_order_relaxed);
+    return *AllocateSegment(index);
+  }
+
+  [[nodiscard]] const Segment& SegmentAt(const size_t index) const noexcept {
+    return *segments_[index].load(std::memory_order_acquire);
+  }
+
+  // Segments are allocated in index order, so owned_[i] backs table entry i.
+  Segment* AllocateSegment(const size_t index) {
+    while (owned_.size() <= index) {
+      owned_.push_back(std::make_unique<Segment>());
+      segments_[owned_.size() - 1].store(owned_.back().get(), std::memory_order_release);
+    }
+    return owned_[index].get();
+  }
+
+  // Between frames only (no producers running).
+  void Reserve(const size_t slots) {
+    const size_t segments = std::min((slots + kSegmentSlots - 1) / kSegmentSlots, kMaxSegments);
+    if (segments > owned_.size()) AllocateSegment(segments - 1);
+  }
+
+  std::unique_ptr<std::atomic<Segment*>[]> segments_;
+  std::vector<std::unique_ptr<Segment>> owned_;
+  std::mutex growth_mutex_;
+  std::atomic<size_t> next_block_{0};
+  std::uint64_t epoch_;
+  size_t high_water_ = 0;
+  std::atomic<size_t> growth_events_{0};
+};
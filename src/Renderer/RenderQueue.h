@@ -2,134 +2,282 @@
 
 #include <algorithm>
 #include <array>
-#include <atomic>
+#include <cassert>
 #include <cstdint>
 #include <vector>
 
 #include "./RenderCommands.h"
 #include "./RenderKey.h"
+#include "./RenderPayloadPool.h"
+#include "./RenderStats.h"
 #include "General/Constants.h"
+#include "General/ThreadPool.h"
 
-// Lock-free, multi-producer render queue. Pre-sized to a fixed capacity; parallel
-// systems atomically claim a slot via fetch_add and write directly. No per-system
-// channel + playback merge — that intermediate copy was the bulk of the overhead in
-// the previous CommandBuffer-driven design.
+// Multi-producer render queue. Producers (serial and parallel render systems) write commands
+// straight into the queue's storage — there is no per-system channel + playback merge.
 //
-// Sort() uses an LSB radix sort on the precomputed RenderKey::sortKey. With ~32K+ keys
-// this is dramatically faster than std::sort on the full 80-byte RenderKey because the
-// radix passes only touch 16-byte (key, srcIdx) entries. The full 80-byte permutation is
-// applied via a gather into a scratch buffer at the end — sequential writes are
-// prefetch-friendly and the source data fits in L3 cache at typical entry counts.
+// Payloads live in one RenderPayloadPool per command type (per-thread slot blocks, growth between
+// frames from the high-water mark; see RenderPayloadPool.h) and never move once written. Sort()
+// gathers a 16-byte RenderKey record — sort key, type, payload index — for every filled slot,
+// radix-sorts the records on the precomputed sortKey, and begin()/end() iterate the sorted
+// records. Consumers read each command through Sprite() / Square() / Text(). Only the records are
+// permuted: the sort's memory traffic and its extra buffers scale with 16 bytes per key, not with
+// the payload size.
 //
-// Capacity must comfortably exceed the max keys-per-frame for the scene; an overflow
-// asserts in debug. Bump Constants::kInitialRenderQueueCapacity if you hit it.
+// Retained sprites (StaticSpriteLayer) arrive already sorted through EmplaceRetainedSprite and skip
+// the radix sort: Sort() merges them into the sorted dynamic records in one linear pass. Their
+// records carry kRetainedBit in payloadIndex.
+//
+// Geometry commands (one per particle emitter, each a whole triangle list) are few and come from
+// serial producers, so they sit in a plain vector rather than a payload pool and join the records
+// after the block gather.
 class RenderQueue {
  public:
   using value_type = RenderKey;
   using const_iterator = std::vector<RenderKey>::const_iterator;
 
-  explicit RenderQueue(const size_t capacity = Constants::kInitialRenderQueueCapacity) {
-    render_keys_.resize(capacity);
-  }
+  // Slots reserved per producer per claim.
+  static constexpr size_t kBlockSlots = RenderPayloadPool<SpriteCommand>::kBlockSlots;
 
-  ~RenderQueue() = default;
-  RenderQueue(const RenderQueue&) = delete;
-  RenderQueue& operator=(const RenderQueue&) = delete;
+  // Marks a record's payloadIndex as indexing the retained sprites rather than the sprite pool.
+  // Pool indices stay far below it (the pool tops out at 64M slots).
+  static constexpr std::uint32_t kRetainedBit = 1u << 31;
 
-  // Atomic isn't move-constructible, but Registry::Set takes the singleton by value.
-  // Hand-rolled move just snapshots the counter; only valid before any concurrent producer
-  // attaches (i.e. registration time).
-  RenderQueue(RenderQueue&& other) noexcept
-      : render_keys_(std::move(other.render_keys_)), count_(other.count_.load(std::memory_order_relaxed)) {}
-  RenderQueue& operator=(RenderQueue&& other) noexcept {
-    render_keys_ = std::move(other.render_keys_);
-    count_.store(other.count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    return *this;
-  }
+  // `capacity` pre-sizes the sprite pool; squares and text start with at most one segment each
+  // and grow from their own high-water marks.
+  explicit RenderQueue(const size_t capacity = Constants::kInitialRenderQueueCapacity)
+      : sprites_(capacity),
+        squares_(std::min(capacity, RenderPayloadPool<SquareCommand>::kSegmentSlots)),
+        texts_(std::min(capacity, RenderPayloadPool<TextCommand>::kSegmentSlots)) {}
 
   SpriteCommand& EmplaceSprite(unsigned int layer, float depth, const void* batchKey = nullptr,
                                octarine::BlendMode blendMode = octarine::BlendMode::Blend) {
-    auto& key = ClaimSlot();
-    key.sortKey = RenderKey::ComputeSortKey(layer, depth, SPRITE, batchKey, static_cast<std::uint8_t>(blendMode));
-    key.type = SPRITE;
-    return key.payload.sprite;
+    return sprites_.Emplace(
+        RenderKey::ComputeSortKey(layer, depth, SPRITE, batchKey, static_cast<std::uint8_t>(blendMode)));
   }
 
   SquareCommand& EmplaceSquare(unsigned int layer, float depth, const void* batchKey = nullptr,
                                octarine::BlendMode blendMode = octarine::BlendMode::Blend) {
-    auto& key = ClaimSlot();
-    key.sortKey =
-        RenderKey::ComputeSortKey(layer, depth, SQUARE_PRIMITIVE, batchKey, static_cast<std::uint8_t>(blendMode));
-    key.type = SQUARE_PRIMITIVE;
-    return key.payload.square;
+    return squares_.Emplace(
+        RenderKey::ComputeSortKey(layer, depth, SQUARE_PRIMITIVE, batchKey, static_cast<std::uint8_t>(blendMode)));
   }
 
   TextCommand& EmplaceText(unsigned int layer, float depth, const void* batchKey = nullptr) {
-    auto& key = ClaimSlot();
-    key.sortKey = RenderKey::ComputeSortKey(layer, depth, TEXT, batchKey);
-    key.type = TEXT;
-    return key.payload.text;
+    return texts_.Emplace(RenderKey::ComputeSortKey(layer, depth, TEXT, batchKey));
   }
 
-  void Clear() { count_.store(0, std::memory_order_relaxed); }
+  // A text glyph drawn as a sprite quad from a glyph-atlas texture. It sorts where a TextCommand at
+  // the same layer/depth would (after that band's sprites and squares), but lands in the sprite
+  // pool, so SpriteBatcher merges a label's glyphs — and neighbouring labels in the same font —
+  // into one geometry run.
+  SpriteCommand& EmplaceGlyph(unsigned int layer, float depth, const void* batchKey) {
+    return sprites_.Emplace(RenderKey::ComputeSortKey(layer, depth, TEXT, batchKey));
+  }
 
-  void Sort() {
-    const size_t n = count_.load(std::memory_order_relaxed);
-    if (n <= 1) return;
+  // A prebuilt triangle list drawn as one call. Single producer: call from a serial system.
+  GeometryCommand& EmplaceGeometry(unsigned int layer, float depth, const void* batchKey = nullptr,
+                                   octarine::BlendMode blendMode = octarine::BlendMode::Blend) {
+    geometry_keys_.push_back(
+        RenderKey::ComputeSortKey(layer, depth, GEOMETRY, batchKey, static_cast<std::uint8_t>(blendMode)));
+    return geometry_.emplace_back();
+  }
+
+  // Append a sprite whose sort key was computed ahead of time. Single producer (call from a serial
+  // system), and keys must arrive in non-decreasing order — the retained span is never sorted.
+  SpriteCommand& EmplaceRetainedSprite(const std::uint64_t sortKey) {
+    assert((retained_keys_.empty() || retained_keys_.back() <= sortKey) && "retained sprites must arrive sorted");
+    retained_keys_.push_back(sortKey);
+    return retained_sprites_.emplace_back();
+  }
+
+  // Payload behind a record from this queue's iteration; `key.type` says which one to call.
+  [[nodiscard]] const SpriteCommand& Sprite(const RenderKey& key) const {
+    if ((key.payloadIndex & kRetainedBit) != 0) return retained_sprites_[key.payloadIndex & ~kRetainedBit];
+    return sprites_.At(key.payloadIndex);
+  }
+  [[nodiscard]] const SquareCommand& Square(const RenderKey& key) const { return squares_.At(key.payloadIndex); }
+  [[nodiscard]] const TextCommand& Text(const RenderKey& key) const { return texts_.At(key.payloadIndex); }
+  [[nodiscard]] const GeometryCommand& Geometry(const RenderKey& key) const { return geometry_[key.payloadIndex]; }
+
+  // End-of-frame reset. Folds the frame into the high-water marks (the queue's and each pool's)
+  // and pre-grows the pools so the next frame at that load needs no mid-frame growth.
+  void Clear() {
+    high_water_ = std::max(high_water_, Size());
+    sprites_.Clear();
+    squares_.Clear();
+    texts_.Clear();
+    geometry_keys_.clear();
+    geometry_.clear();
+    records_.clear();
+    retained_keys_.clear();
+    retained_sprites_.clear();
+    ++frame_;
+  }
 
-    // Build (sortKey, srcIdx) entries — 16 bytes each. Sorting these instead of the
-    // 80-byte RenderKeys is the main speedup; we only gather the heavy keys once at
-    // the end via a sequential-write scatter into a scratch buffer.
-    sort_entries_.resize(n);
-    for (size_t i = 0; i < n; ++i) {
-      sort_entries_[i].key = render_keys_[i].sortKey;
-      sort_entries_[i].srcIdx = static_cast<std::uint32_t>(i);
+  // Orders the frame's keys for drawing. Above the parallel threshold the record gather and the
+  // radix passes are split across the ThreadPool; the result is identical to the serial path (the
+  // parallel scatter is stable across batches).
+  void Sort() {
+    // Prefix the block fills of all three pools so each block knows where its records go; that
+    // lets the gather run per block in parallel. Blocks are numbered sprites, squares, then text.
+    sprite_blocks_ = sprites_.Blocks();
+    square_blocks_ = squares_.Blocks();
+    const size_t blocks = sprite_blocks_ + square_blocks_ + texts_.Blocks();
+    block_offsets_.resize(blocks);
+    size_t n = 0;
+    for (size_t block = 0; block < blocks; ++block) {
+      block_offsets_[block] = n;
+      n += FillOf(block);
     }
+    const size_t pooled = n;
+    n += geometry_keys_.size();
+    const bool parallel = n > parallel_sort_threshold_;
+
+    // Gather the records, streaming each block's sort keys. records_ only grows in capacity, so
+    // steady-state frames don't allocate.
+    records_.resize(n);
+    const auto gatherRecords = [this](const size_t /*batch*/, const size_t begin, const size_t end) {
+      for (size_t block = begin; block < end; ++block) {
+        if (block < sprite_blocks_) {
+          GatherBlock(sprites_, block, SPRITE, records_.data() + block_offsets_[block]);
+        } else if (block < sprite_blocks_ + square_blocks_) {
+          GatherBlock(squares_, block - sprite_blocks_, SQUARE_PRIMITIVE, records_.data() + block_offsets_[block]);
+        } else {
+          GatherBlock(texts_, block - sprite_blocks_ - square_blocks_, TEXT, records_.data() + block_offsets_[block]);
+        }
+      }
+    };
+
+    const auto gatherGeometry = [this, pooled] {
+      for (size_t i = 0; i < geometry_keys_.size(); ++i) {
+        records_[pooled + i] = {geometry_keys_[i], static_cast<std::uint32_t>(i), GEOMETRY};
+      }
+    };
 
-    RadixSort();
-
-    // Gather: write the sorted RenderKeys sequentially into permute_scratch_ by
-    // reading from random source positions. Sequential writes are prefetch-friendly;
-    // the random reads hit ~2.5 MB of source data which fits comfortably in L3 cache.
-    // The scratch vector is kept alive across frames so this doesn't allocate after
-    // the first frame.
-    // Resize to full capacity — after the swap this becomes render_keys_, and ClaimSlot()
-    // indexes into it up to the pre-sized capacity.
-    permute_scratch_.resize(render_keys_.size());
-    const auto* perm = sort_entries_.data();
-    const auto* src = render_keys_.data();
-    auto* dst = permute_scratch_.data();
-    for (size_t i = 0; i < n; ++i) {
-      dst[i] = src[perm[i].srcIdx];
+    if (parallel) {
+      ThreadPool::ParallelChunks(blocks, gatherRecords);
+      gatherGeometry();
+      ParallelRadixSort();
+    } else {
+      gatherRecords(0, 0, blocks);
+      gatherGeometry();
+      RadixSort();
     }
-    std::swap(render_keys_, permute_scratch_);
+    MergeRetained();
   }
 
-  [[nodiscard]] const_iterator begin() const noexcept { return render_keys_.cbegin(); }
-  [[nodiscard]] const_iterator end() const noexcept {
-    return render_keys_.cbegin() + static_cast<std::ptrdiff_t>(count_.load(std::memory_order_relaxed));
-  }
+  // Key count above which Sort() goes parallel (default Constants::kRenderQueueParallelSortThreshold).
+  void SetParallelSortThreshold(const size_t keys) { parallel_sort_threshold_ = keys; }
+
+  // Iteration covers the records ordered by the last Sort().
+  [[nodiscard]] const_iterator begin() const noexcept { return records_.cbegin(); }
+  [[nodiscard]] const_iterator end() const noexcept { return records_.cend(); }
   [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
   [[nodiscard]] const_iterator cend() const noexcept { return end(); }
-  [[nodiscard]] bool IsEmpty() const noexcept { return count_.load(std::memory_order_relaxed) == 0; }
-  [[nodiscard]] size_t Size() const noexcept { return count_.load(std::memory_order_relaxed); }
+  [[nodiscard]] bool IsEmpty() const noexcept {
+    return sprites_.Blocks() == 0 && squares_.Blocks() == 0 && texts_.Blocks() == 0 && retained_keys_.empty() &&
+           geometry_keys_.empty();
+  }
+
+  // Keys emplaced since the last Clear. Walks the reserved blocks, so call it between phases, not
+  // while producers are running.
+  [[nodiscard]] size_t Size() const noexcept {
+    return sprites_.Size() + squares_.Size() + texts_.Size() + retained_keys_.size() + geometry_keys_.size();
+  }
+
+  // Telemetry. Capacity: payload slots currently allocated across the pools. HighWaterMark: most
+  // keys seen in any frame (folded in at Clear). GrowthEvents: segments that had to be allocated
+  // mid-frame. ResidentBytes: pool segments, the retained span and the sort buffers.
+  [[nodiscard]] size_t Capacity() const noexcept {
+    return sprites_.Capacity() + squares_.Capacity() + texts_.Capacity();
+  }
+  [[nodiscard]] size_t HighWaterMark() const noexcept { return high_water_; }
+  // Frames cleared so far. Render-side caches fed from per-entity systems use it as their clock
+  // (e.g. GlyphCache won't recycle a page already sampled by this frame's commands).
+  [[nodiscard]] std::uint64_t Frame() const noexcept { return frame_; }
+  [[nodiscard]] size_t GrowthEvents() const noexcept {
+    return sprites_.GrowthEvents() + squares_.GrowthEvents() + texts_.GrowthEvents();
+  }
+  // This frame's fill by payload type into `stats` (RenderStats collection), and the pool growth
+  // since the previous call. Same caveat as Size().
+  void FillStats(RenderStats& stats) noexcept {
+    stats.frame = frame_;
+    stats.sprites = static_cast<std::uint32_t>(sprites_.Size());
+    stats.squares = static_cast<std::uint32_t>(squares_.Size());
+    stats.texts = static_cast<std::uint32_t>(texts_.Size());
+    stats.retained = static_cast<std::uint32_t>(retained_keys_.size());
+    stats.geometry = static_cast<std::uint32_t>(geometry_keys_.size());
+    stats.commands = stats.sprites + stats.squares + stats.texts + stats.retained + stats.geometry;
+    stats.queueGrowth = static_cast<std::uint32_t>(GrowthEvents() - growth_at_stats_);
+    growth_at_stats_ = GrowthEvents();
+  }
+  [[nodiscard]] size_t ResidentBytes() const noexcept {
+    return sprites_.ResidentBytes() + squares_.ResidentBytes() + texts_.ResidentBytes() +
+           (records_.capacity() + radix_scratch_.capacity() + retained_records_.capacity()) * sizeof(RenderKey) +
+           batch_histograms_.capacity() * sizeof(ByteHistograms) + block_offsets_.capacity() * sizeof(size_t) +
+           retained_keys_.capacity() * sizeof(std::uint64_t) + retained_sprites_.capacity() * sizeof(SpriteCommand) +
+           geometry_keys_.capacity() * sizeof(std::uint64_t) + geometry_.capacity() * sizeof(GeometryCommand);
+  }
 
  private:
-  RenderKey& ClaimSlot() {
-    const size_t i = count_.fetch_add(1, std::memory_order_relaxed);
-    // Pre-sized vector — caller must size capacity to peak frame load.
-    return render_keys_[i];
+  [[nodiscard]] std::uint32_t FillOf(const size_t block) const noexcept {
+    if (block < sprite_blocks_) return sprites_.FillOf(block);
+    if (block < sprite_blocks_ + square_blocks_) return squares_.FillOf(block - sprite_blocks_);
+    return texts_.FillOf(block - sprite_blocks_ - square_blocks_);
+  }
+
+  template <typename Command>
+  static void GatherBlock(const RenderPayloadPool<Command>& pool, const size_t block, const RenderableType type,
+                          RenderKey* out) {
+    const std::uint64_t* sortKeys = pool.SortKeys(block);
+    const std::uint32_t fill = pool.FillOf(block);
+    const auto first = static_cast<std::uint32_t>(block * kBlockSlots);
+    for (std::uint32_t i = 0; i < fill; ++i) out[i] = {sortKeys[i], first + i, type};
+  }
+
+  // Merges the pre-sorted retained span into the radix-sorted records. Retained records go first
+  // on equal keys (std::merge takes ties from its first range), so the result doesn't depend on
+  // which path sorted the dynamic keys.
+  void MergeRetained() {
+    if (retained_keys_.empty()) return;
+    const size_t retained = retained_keys_.size();
+    retained_records_.resize(retained);
+    for (size_t i = 0; i < retained; ++i) {
+      retained_records_[i] = {retained_keys_[i], static_cast<std::uint32_t>(i) | kRetainedBit, SPRITE};
+    }
+    radix_scratch_.resize(records_.size() + retained);
+    std::merge(retained_records_.begin(), retained_records_.end(), records_.begin(), records_.end(),
+               radix_scratch_.begin(),
+               [](const RenderKey& a, const RenderKey& b) { return a.sortKey < b.sortKey; });
+    std::swap(records_, radix_scratch_);
   }
 
-  struct SortEntry {
-    std::uint64_t key;
-    std::uint32_t srcIdx;
-  };
+  // One 256-bucket count per key byte.
+  using ByteHistograms = std::array<std::array<size_t, 256>, 8>;
+
+  static void CountBytes(ByteHistograms& histograms, const RenderKey* entries, const size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      const std::uint64_t k = entries[i].sortKey;
+      histograms[0][k & 0xFFu]++;
+      histograms[1][(k >> 8) & 0xFFu]++;
+      histograms[2][(k >> 16) & 0xFFu]++;
+      histograms[3][(k >> 24) & 0xFFu]++;
+      histograms[4][(k >> 32) & 0xFFu]++;
+      histograms[5][(k >> 40) & 0xFFu]++;
+      histograms[6][(k >> 48) & 0xFFu]++;
+      histograms[7][(k >> 56) & 0xFFu]++;
+    }
+  }
+
+  // A pass is skippable when exactly one bucket holds all n entries (all bytes identical).
+  static bool IsUniform(const std::array<size_t, 256>& counts, const size_t n) {
+    return std::find(counts.begin(), counts.end(), n) != counts.end();
+  }
 
   // LSB radix sort on the 64-bit key with two optimizations over the naive 8-pass version:
   //
   // 1. Single-pass histogram: build all 8 byte-histograms in one scan of the data instead
-  //    of re-reading the array for each pass. At 32k entries × 16 bytes this avoids ~3.5 MB
+  //    of re-reading the array for each pass. At 32k records × 16 bytes this avoids ~3.5 MB
   //    of redundant reads and the associated cache-miss overhead.
   //
   // 2. Skip-uniform-byte: if every entry has the same value for a given byte (common — e.g.
@@ -137,45 +285,23 @@ class RenderQueue {
   //    Skipping it saves both the scatter pass AND its prefix-sum. On a typical stress scene
   //    this cuts 8 passes to ~4.
   //
-  // Pass-parity bookkeeping ensures the final sorted result lives in sort_entries_ regardless
+  // Pass-parity bookkeeping ensures the final sorted result lives in records_ regardless
   // of how many passes actually executed.
   void RadixSort() {
-    const size_t n = sort_entries_.size();
+    const size_t n = records_.size();
     if (n <= 1) return;
     radix_scratch_.resize(n);
 
     // --- Phase 1: build all 8 histograms in one scan ---
-    std::array<std::array<size_t, 256>, 8> histograms{};
-    for (size_t i = 0; i < n; ++i) {
-      const std::uint64_t k = sort_entries_[i].key;
-      histograms[0][k & 0xFFu]++;
-      histograms[1][(k >> 8) & 0xFFu]++;
-      histograms[2][(k >> 16) & 0xFFu]++;
-      histograms[3][(k >> 24) & 0xFFu]++;
-      histograms[4][(k >> 32) & 0xFFu]++;
-      histograms[5][(k >> 40) & 0xFFu]++;
-      histograms[6][(k >> 48) & 0xFFu]++;
-      histograms[7][(k >> 56) & 0xFFu]++;
-    }
+    ByteHistograms histograms{};
+    CountBytes(histograms, records_.data(), n);
 
-    // --- Phase 2: determine which passes are needed ---
-    // A pass is skippable when exactly one bucket holds all n entries (all bytes identical).
-    std::array<bool, 8> skip{};
-    for (size_t pass = 0; pass < 8; ++pass) {
-      for (size_t bucket = 0; bucket < 256; ++bucket) {
-        if (histograms[pass][bucket] == n) {
-          skip[pass] = true;
-          break;
-        }
-      }
-    }
-
-    // --- Phase 3: scatter passes (LSB → MSB), skipping uniform bytes ---
-    std::vector<SortEntry>* in = &sort_entries_;
-    std::vector<SortEntry>* out = &radix_scratch_;
+    // --- Phase 2: scatter passes (LSB → MSB), skipping uniform bytes ---
+    std::vector<RenderKey>* in = &records_;
+    std::vector<RenderKey>* out = &radix_scratch_;
 
     for (size_t pass = 0; pass < 8; ++pass) {
-      if (skip[pass]) continue;
+      if (IsUniform(histograms[pass], n)) continue;
 
       const size_t shift = pass * 8;
 
@@ -190,22 +316,111 @@ class RenderQueue {
 
       // Scatter
       for (size_t i = 0; i < n; ++i) {
-        const auto bucket = static_cast<std::uint8_t>(((*in)[i].key >> shift) & 0xFFu);
+        const auto bucket = static_cast<std::uint8_t>(((*in)[i].sortKey >> shift) & 0xFFu);
         (*out)[counts[bucket]++] = (*in)[i];
       }
       std::swap(in, out);
     }
 
-    // Ensure the sorted result lives in sort_entries_.
-    if (in != &sort_entries_) {
-      std::swap(sort_entries_, radix_scratch_);
+    // Ensure the sorted result lives in records_.
+    if (in != &records_) {
+      std::swap(records_, radix_scratch_);
+    }
+  }
+
+  // The same sort split across the ThreadPool. Each batch owns a fixed contiguous range of the
+  // input (ParallelChunks splits a given count identically every call) and keeps its own
+  // histograms. Per pass, the global prefix is taken bucket-major, batch-minor, so batch b's
+  // entries for a bucket land after batch b-1's — each batch scatters into disjoint slots with no
+  // atomics, and the result is stable, i.e. identical to RadixSort().
+  //
+  // The up-front all-bytes count gives both the uniform-byte skip (from the summed totals) and
+  // the first executed pass's per-batch counts. Later passes recount their byte per batch, since
+  // a scatter reshuffles which entries each batch's range holds.
+  void ParallelRadixSort() {
+    const size_t n = records_.size();
+    if (n <= 1) return;
+    radix_scratch_.resize(n);
+    const size_t batches = std::min(n, ThreadPool::Instance().Size());
+    // Zeroed up front: a ragged split can leave trailing batches that are never called.
+    batch_histograms_.assign(batches, ByteHistograms{});
+
+    // --- Phase 1: per-batch histograms of every byte, then totals for the skip test ---
+    ThreadPool::ParallelChunks(n, [this](const size_t batch, const size_t begin, const size_t end) {
+      if (begin < end) CountBytes(batch_histograms_[batch], records_.data() + begin, end - begin);
+    });
+    std::array<bool, 8> skip{};
+    for (size_t pass = 0; pass < 8; ++pass) {
+      std::array<size_t, 256> totals{};
+      for (const ByteHistograms& histograms : batch_histograms_) {
+        for (size_t bucket = 0; bucket < 256; ++bucket) totals[bucket] += histograms[pass][bucket];
+      }
+      skip[pass] = IsUniform(totals, n);
+    }
+
+    // --- Phase 2: count (after the first pass), prefix, scatter — per byte, LSB → MSB ---
+    std::vector<RenderKey>* in = &records_;
+    std::vector<RenderKey>* out = &radix_scratch_;
+    bool first = true;
+
+    for (size_t pass = 0; pass < 8; ++pass) {
+      if (skip[pass]) continue;
+      const size_t shift = pass * 8;
+
+      if (!first) {
+        for (ByteHistograms& histograms : batch_histograms_) histograms[pass].fill(0);
+        ThreadPool::ParallelChunks(n, [&](const size_t batch, const size_t begin, const size_t end) {
+          auto& counts = batch_histograms_[batch][pass];
+          for (size_t i = begin; i < end; ++i) counts[((*in)[i].sortKey >> shift) & 0xFFu]++;
+        });
+      }
+      first = false;
+
+      size_t sum = 0;
+      for (size_t bucket = 0; bucket < 256; ++bucket) {
+        for (ByteHistograms& histograms : batch_histograms_) {
+          const size_t saved = histograms[pass][bucket];
+          histograms[pass][bucket] = sum;
+          sum += saved;
+        }
+      }
+
+      ThreadPool::ParallelChunks(n, [&](const size_t batch, const size_t begin, const size_t end) {
+        auto& offsets = batch_histograms_[batch][pass];
+        const RenderKey* src = in->data();
+        RenderKey* dst = out->data();
+        for (size_t i = begin; i < end; ++i) dst[offsets[(src[i].sortKey >> shift) & 0xFFu]++] = src[i];
+      });
+      std::swap(in, out);
+    }
+
+    if (in != &records_) {
+      std::swap(records_, radix_scratch_);
     }
   }
 
-  std::vector<RenderKey> render_keys_;
-  std::atomic<size_t> count_{0};
+  RenderPayloadPool<SpriteCommand> sprites_;
+  RenderPayloadPool<SquareCommand> squares_;
+  RenderPayloadPool<TextCommand> texts_;
+  size_t high_water_ = 0;
+  std::uint64_t frame_ = 0;
+  size_t growth_at_stats_ = 0;
+
+  // Retained sprites for this frame, in sort-key order.
+  std::vector<std::uint64_t> retained_keys_;
+  std::vector<SpriteCommand> retained_sprites_;
+
+  // This frame's geometry commands, in emplace order; their records index geometry_.
+  std::vector<std::uint64_t> geometry_keys_;
+  std::vector<GeometryCommand> geometry_;
 
-  std::vector<SortEntry> sort_entries_;
-  std::vector<SortEntry> radix_scratch_;
-  std::vector<RenderKey> permute_scratch_;  // Gather output buffer, kept alive to avoid re-alloc.
+  // Sort state. records_ holds the sorted records that begin()/end() iterate.
+  std::vector<RenderKey> records_;
+  std::vector<RenderKey> radix_scratch_;
+  std::vector<RenderKey> retained_records_;
+  std::vector<ByteHistograms> batch_histograms_;
+  std::vector<size_t> block_offsets_;
+  size_t sprite_blocks_ = 0;
+  size_t square_blocks_ = 0;
+  size_t parallel_sort_threshold_ = Constants::kRenderQueueParallelSortThreshold;
 };
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "Renderer/RenderCulling.h"
+
+// One frame of render instrumentation, for telling why a frame is render-bound. Filled in three
+// stages by FrameLoop::Render while collection is on: RenderCullTally (the Render*System viewport
+// tests, during Update), RenderQueue::FillStats (queue fill per command type) and
+// Renderer::FillStats (what DrawQueue submitted), plus the sort/draw wall times FrameLoop measures
+// around them.
+struct RenderStats {
+  std::uint64_t frame = 0;  // RenderQueue::Frame() the stats describe
+
+  // Viewport culling across the producers: renderables tested, and how many of those were rejected.
+  // Sprite chunks skipped whole by the coarse bounds test aren't counted; their sprites never reach
+  // the per-renderable test.
+  std::uint32_t cullTested = 0;
+  std::uint32_t culled = 0;
+
+  // Queue fill by payload type. Glyph quads land in the sprite pool; retained sprites are the
+  // StaticSpriteLayer span merged in at sort time; geometry is one batch per particle emitter.
+  std::uint32_t commands = 0;
+  std::uint32_t sprites = 0;
+  std::uint32_t squares = 0;
+  std::uint32_t texts = 0;
+  std::uint32_t retained = 0;
+  std::uint32_t geometry = 0;
+  std::uint32_t queueGrowth = 0;  // pool segments allocated mid-frame
+
+  // Submission. drawCalls counts SDL_RenderGeometry / FillRect / RenderTexture calls; a switch is
+  // a draw whose texture or blend mode differs from the draw before it.
+  std::uint32_t drawCalls = 0;
+  std::uint32_t spriteRuns = 0;
+  std::uint32_t textureSwitches = 0;
+  std::uint32_t blendChanges = 0;
+  std::uint32_t commandBreaks = 0;  // sprite runs cut short by another command type between them
+
+  float sortMs = 0.0F;
+  float drawMs = 0.0F;
+
+  // Call f(name, value) for every counter (everything but `frame` and the two times), in
+  // declaration order — the one place that names them for the dev-listen export and the bench
+  // COUNTER lines.
+  template <typename F>
+  void ForEachCount(F&& f) const {
+    f("cull_tested", cullTested);
+    f("culled", culled);
+    f("commands", commands);
+    f("sprites", sprites);
+    f("squares", squares);
+    f("texts", texts);
+    f("retained", retained);
+    f("geometry", geometry);
+    f("queue_growth", queueGrowth);
+    f("draw_calls", drawCalls);
+    f("sprite_runs", spriteRuns);
+    f("texture_switches", textureSwitches);
+    f("blend_changes", blendChanges);
+    f("command_breaks", commandBreaks);
+  }
+};
+
+// Registry singleton: collection switch, the live cull tally and a ring of the last kCapacity
+// frames of RenderStats. Off until someone asks for it — the perf overlay's `render` metric, a
+// dev-listen RenderStats query, or a profiling build — so shipping builds collect nothing.
+class RenderStatsHistory {
+ public:
+  static constexpr std::size_t kCapacity = 240;  // ~4 s at 60 fps
+
+  RenderStatsHistory() = default;
+  RenderStatsHistory(const RenderStatsHistory&) = delete;
+  RenderStatsHistory& operator=(const RenderStatsHistory&) = delete;
+  // The tally's atomics aren't movable; a moved-to history starts with a zero tally.
+  RenderStatsHistory(RenderStatsHistory&& other) noexcept
+      : frames_(other.frames_),
+        next_(other.next_),
+        size_(other.size_),
+        enabled_(other.enabled_),
+        requested_(other.requested_) {}
+  RenderStatsHistory& operator=(RenderStatsHistory&& other) noexcept {
+    frames_ = other.frames_;
+    next_ = other.next_;
+    size_ = other.size_;
+    enabled_ = other.enabled_;
+    requested_ = other.requested_;
+    return *this;
+  }
+  ~RenderStatsHistory() = default;
+
+  // Collect from the next frame on when `enabled` (FrameLoop re-evaluates it every frame) or once
+  // Request() has been called (a dev-listen client asked; sticky for the session).
+  void SetEnabled(const bool enabled) { enabled_ = enabled || requested_; }
+  void Request() { requested_ = enabled_ = true; }
+  [[nodiscard]] bool IsEnabled() const { return enabled_; }
+
+  // Where producers count cull decisions this frame; nullptr while collection is off.
+  [[nodiscard]] RenderCullTally* CullTally() { return enabled_ ? &cull_ : nullptr; }
+
+  // Move the cull tally into `stats` and zero it for the next frame.
+  void TakeCulling(RenderStats& stats) {
+    stats.cullTested = cull_.tested.exchange(0, std::memory_order_relaxed);
+    stats.culled = cull_.culled.exchange(0, std::memory_order_relaxed);
+  }
+
+  void Push(const RenderStats& stats) {
+    frames_[next_] = stats;
+    next_ = (next_ + 1) % kCapacity;
+    if (size_ < kCapacity) ++size_;
+  }
+
+  [[nodiscard]] std::size_t Size() const { return size_; }
+  // `age` frames back from the newest (0 = latest). Requires age < Size().
+  [[nodiscard]] const RenderStats& Recent(const std::size_t age) const {
+    return frames_[(next_ + kCapacity - 1 - age) % kCapacity];
+  }
+  void Clear() {
+    next_ = 0;
+    size_ = 0;
+  }
+
+ private:
+  std::array<RenderStats, kCapacity> frames_{};
+  std::size_t next_ = 0;
+  std::size_t size_ = 0;
+  bool enabled_ = false;
+  bool requested_ = false;
+  RenderCullTally cull_;
+};
@@ -2,4 +2,4 @@
 
 #include <cstdint>
 
-enum RenderableType : std::uint8_t { SPRITE, SQUARE_PRIMITIVE, TEXT };
\ No newline at end of file
+enum RenderableType : std::uint8_t { SPRITE, SQUARE_PRIMITIVE, TEXT, GEOMETRY };
\ No newline at end of file
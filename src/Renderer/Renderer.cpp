@@ -1,8 +1,12 @@
 #include "./Renderer.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <span>
 #include <string>
 
+#include "./DynamicResolution.h"
 #include "General/Constants.h"
 #include "General/Logger.h"
 
@@ -13,23 +17,47 @@ constexpr Uint8 kWindowClearBlack = 0;
 
 bool Renderer::CreateScene(SDL_Renderer* sdlRenderer, const int width, const int height) {
   if (sdlRenderer == nullptr) return false;
-  scene_texture_ = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
-  if (scene_texture_ == nullptr) {
-    Logger::Error("Renderer::CreateScene SDL_CreateTexture failed: " + std::string(SDL_GetError()));
-    return false;
-  }
-  return true;
+  DestroyScene();
+  scene_width_ = width;
+  scene_height_ = height;
+  return SetSceneScale(sdlRenderer, 1.0F);
 }
 
 void Renderer::DestroyScene() {
-  if (scene_texture_ != nullptr) {
-    SDL_DestroyTexture(scene_texture_);
-    scene_texture_ = nullptr;
+  for (const SceneTarget& target : scene_targets_) SDL_DestroyTexture(target.texture);
+  scene_targets_.clear();
+  scene_texture_ = nullptr;
+  scene_scale_x_ = 1.0F;
+  scene_scale_y_ = 1.0F;
+}
+
+bool Renderer::SetSceneScale(SDL_Renderer* sdlRenderer, const float scale) {
+  if (sdlRenderer == nullptr || scene_width_ <= 0 || scene_height_ <= 0) return false;
+  const int width = DynamicResolution::ScaledSize(scene_width_, std::min(scale, 1.0F));
+  const int height = DynamicResolution::ScaledSize(scene_height_, std::min(scale, 1.0F));
+  const auto pooled = std::find_if(scene_targets_.begin(), scene_targets_.end(), [&](const SceneTarget& target) {
+    return target.width == width && target.height == height;
+  });
+  SDL_Texture* texture = pooled != scene_targets_.end() ? pooled->texture : nullptr;
+  if (texture == nullptr) {
+    texture = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (texture == nullptr) {
+      Logger::Error("Renderer::SetSceneScale SDL_CreateTexture failed: " + std::string(SDL_GetError()));
+      return false;
+    }
+    scene_targets_.push_back({texture, width, height});
   }
+  scene_texture_ = texture;
+  scene_scale_x_ = static_cast<float>(width) / static_cast<float>(scene_width_);
+  scene_scale_y_ = static_cast<float>(height) / static_cast<float>(scene_height_);
+  return true;
 }
 
 void Renderer::BeginScene(SDL_Renderer* sdlRenderer) const {
   SDL_SetRenderTarget(sdlRenderer, scene_texture_);
+  // Render scale is per target in SDL3; re-applied every frame so a freshly pooled target (or
+  // the full-scale one after a step up) maps logical coordinates onto its own pixel size.
+  SDL_SetRenderScale(sdlRenderer, scene_scale_x_, scene_scale_y_);
   SDL_SetRenderDrawColor(sdlRenderer, kSceneClearGrey, kSceneClearGrey, kSceneClearGrey, Constants::kUint8Max);
   SDL_RenderClear(sdlRenderer);
 }
@@ -73,24 +101,68 @@ bool Renderer::CaptureScene(SDL_Renderer* sdlRenderer, const std::string& path)
 }
 #endif
 
-void Renderer::DrawQueue(const RenderQueue& renderQueue, SDL_Renderer* renderer) const {
-  for (const RenderKey& key : renderQueue) {
+void Renderer::DrawQueueToTexture(const RenderQueue& renderQueue, SDL_Renderer* sdlRenderer, SDL_Texture* target) {
+  if (sdlRenderer == nullptr || target == nullptr) return;
+  SDL_Texture* previousTarget = SDL_GetRenderTarget(sdlRenderer);
+  Uint8 r = 0, g = 0, b = 0, a = 0;
+  SDL_GetRenderDrawColor(sdlRenderer, &r, &g, &b, &a);
+  SDL_SetRenderTarget(sdlRenderer, target);
+  SDL_SetRenderDrawColor(sdlRenderer, 0, 0, 0, 0);
+  SDL_RenderClear(sdlRenderer);
+  DrawQueue(renderQueue, sdlRenderer);
+  SDL_SetRenderTarget(sdlRenderer, previousTarget);
+  SDL_SetRenderDrawColor(sdlRenderer, r, g, b, a);
+}
+
+void Renderer::ResetStats() {
+  draw_calls_ = 0;
+  texture_switches_ = 0;
+  blend_changes_ = 0;
+  sprite_runs_ = 0;
+  command_breaks_ = 0;
+}
+
+void Renderer::FillStats(RenderStats& stats) const {
+  stats.drawCalls = draw_calls_;
+  stats.spriteRuns = sprite_runs_;
+  stats.textureSwitches = texture_switches_;
+  stats.blendChanges = blend_changes_;
+  stats.commandBreaks = command_breaks_;
+}
+
+void Renderer::NoteDraw(const SDL_Texture* texture, const SDL_BlendMode blendMode) {
+  ++draw_calls_;
+  if (draw_calls_ > 1 && texture != last_texture_) ++texture_switches_;
+  if (draw_calls_ > 1 && blendMode != last_blend_) ++blend_changes_;
+  last_texture_ = texture;
+  last_blend_ = blendMode;
+}
+
+void Renderer::DrawQueue(const RenderQueue& renderQueue, SDL_Renderer* renderer) {
+  sprite_batcher_.Build(renderQueue);
+  sprite_runs_ += static_cast<std::uint32_t>(sprite_batcher_.Stats().runs);
+  command_breaks_ += static_cast<std::uint32_t>(sprite_batcher_.Stats().commandBreaks);
+  const std::span<const SpriteRun> runs = sprite_batcher_.Runs();
+  const auto keys = renderQueue.begin();
+  const size_t count = renderQueue.Size();
+  size_t nextRun = 0;
+  for (size_t i = 0; i < count;) {
+    // Sprite runs were expanded up front; each goes out as one geometry call in queue order.
+    if (nextRun < runs.size() && runs[nextRun].keyBegin == i) {
+      NoteDraw(runs[nextRun].texture, runs[nextRun].blendMode);
+      sprite_batcher_.Submit(renderer, nextRun);
+      i = runs[nextRun].keyEnd;
+      ++nextRun;
+      continue;
+    }
+    const RenderKey& key = keys[static_cast<std::ptrdiff_t>(i++)];
     switch (key.type) {
-      case SPRITE: {
-        const auto& cmd = key.payload.sprite;
-        const SDL_FRect destRect = {cmd.destX, cmd.destY, cmd.destW, cmd.destH};
-        const auto deg = static_cast<float>(cmd.rotation * (180.0 / 3.14159265358979323846));
-        // Modulation state lives on the shared SDL_Texture, so set it on every draw — the
-        // previous sprite using this texture may have left different values behind. Same-state
-        // sets are cheap (SDL just stores them; they apply at draw time).
-        SDL_SetTextureColorMod(cmd.texture, cmd.colorMod.r, cmd.colorMod.g, cmd.colorMod.b);
-        SDL_SetTextureAlphaMod(cmd.texture, cmd.colorMod.a);
-        SDL_SetTextureBlendMode(cmd.texture, cmd.blendMode);
-        SDL_RenderTextureRotated(renderer, cmd.texture, &cmd.srcRect, &destRect, deg, &cmd.pivot, cmd.flip);
+      case SPRITE:
+        // Only textureless sprites fall outside a run; like SDL_RenderTextureRotated, draw nothing.
         break;
-      }
       case SQUARE_PRIMITIVE: {
-        const auto& cmd = key.payload.square;
+        const auto& cmd = renderQueue.Square(key);
+        NoteDraw(nullptr, cmd.blendMode);
         // Applies to both the fill-rect and the SDL_RenderGeometry (untextured) path.
         SDL_SetRenderDrawBlendMode(renderer, cmd.blendMode);
         if (cmd.rotation == 0.0) {
@@ -123,10 +195,25 @@ void Renderer::DrawQueue(const RenderQueue& renderQueue, SDL_Renderer* renderer)
         break;
       }
       case TEXT: {
-        const auto& cmd = key.payload.text;
+        const auto& cmd = renderQueue.Text(key);
+        // Label textures keep SDL's default blend mode.
+        NoteDraw(cmd.texture, SDL_BLENDMODE_BLEND);
         SDL_RenderTexture(renderer, cmd.texture, nullptr, &cmd.destRect);
         break;
       }
+      case GEOMETRY: {
+        const auto& cmd = renderQueue.Geometry(key);
+        NoteDraw(cmd.texture, cmd.blendMode);
+        // Textured geometry takes the texture's blend mode, untextured the draw blend mode.
+        if (cmd.texture != nullptr) {
+          SDL_SetTextureBlendMode(cmd.texture, cmd.blendMode);
+        } else {
+          SDL_SetRenderDrawBlendMode(renderer, cmd.blendMode);
+        }
+        SDL_RenderGeometryRaw(renderer, cmd.texture, cmd.positions, cmd.stride, cmd.colors, cmd.stride, cmd.uvs,
+                              cmd.stride, cmd.vertexCount, cmd.indices, cmd.indexCount, sizeof(std::uint32_t));
+        break;
+      }
       default:
         Logger::Error("Unknown renderable type");
         break;
@@ -2,9 +2,13 @@
 
 #include <SDL3/SDL.h>
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "./RenderQueue.h"
+#include "./RenderStats.h"
+#include "./SpriteBatcher.h"
 #include "AssetManager/AssetManager.h"
 
 class Registry;
@@ -12,12 +16,18 @@ class Registry;
 // Owns the off-screen scene target the game renders into each frame, plus the SDL_RenderTarget
 // switches + present. Game::Render orchestrates the phases (BeginScene / DrawQueue / EndScene /
 // CompositeSceneToWindow / Present) instead of calling SDL_Set*RenderTarget itself; the engine
-// keeps `SDL_SetRenderTarget` contained to this TU.
+// keeps `SDL_SetRenderTarget` contained to this TU (which also bakes cached UI canvases through
+// DrawQueueToTexture) and TilemapChunkCache's chunk bake, both restoring whatever target was bound.
 //
-// The scene texture is sized to the window at creation time. Lifetime tracks the SDL renderer:
-// Game::Initialize calls CreateScene after the renderer exists; Game::Destroy calls DestroyScene
-// before SDL_DestroyRenderer. Re-creation on window resize is a follow-up — the existing
-// behavior keeps the original window-size target and lets SDL letterbox it.
+// The scene is always drawn in the game's logical coordinates (GameConfig window size), whatever
+// the window's size: the composite stretches it to the window, and ViewportInfo maps the cursor
+// back. With dynamic resolution (SetSceneScale) the target is a smaller texture and BeginScene sets
+// a matching SDL render scale, so producers, culling and input keep using logical coordinates.
+// Targets come from a small pool keyed by size — one per DynamicResolution step at most — so
+// moving between scales never reallocates after the first visit.
+//
+// Lifetime tracks the SDL renderer: Game::Initialize calls CreateScene after the renderer exists;
+// Game::Destroy calls DestroyScene before SDL_DestroyRenderer.
 class Renderer {
  public:
   Renderer() = default;
@@ -28,28 +38,51 @@ class Renderer {
   Renderer(Renderer&&) = delete;
   Renderer& operator=(Renderer&&) = delete;
 
-  // Allocate the scene render target. Must run after SDL_CreateRenderer. Returns false (and
-  // leaves the renderer in a no-scene state) when SDL_CreateTexture fails — caller logs.
+  // Allocate the full-scale scene render target for a width x height logical scene. Must run after
+  // SDL_CreateRenderer. Returns false (and leaves the renderer in a no-scene state) when
+  // SDL_CreateTexture fails — caller logs.
   bool CreateScene(SDL_Renderer* sdlRenderer, int width, int height);
 
-  // Destroy the scene texture. Idempotent; safe to call when CreateScene never ran or failed.
-  // Must run before SDL_DestroyRenderer.
+  // Destroy every pooled scene texture. Idempotent; safe to call when CreateScene never ran or
+  // failed. Must run before SDL_DestroyRenderer.
   void DestroyScene();
 
-  // Phase 1: bind the scene texture as the render target and clear to the engine's scene-bg
-  // grey. Subsequent DrawQueue / per-frame draw calls land in the scene texture.
+  // Render the scene at `scale` (0, 1] of its logical size from the next BeginScene on, taking the
+  // target from the pool or allocating it on first use. Returns false and keeps the current target
+  // when there is no scene or the allocation fails.
+  bool SetSceneScale(SDL_Renderer* sdlRenderer, float scale);
+  [[nodiscard]] float GetSceneScale() const { return scene_scale_x_; }
+
+  // Phase 1: bind the scene texture as the render target, set its render scale and clear to the
+  // engine's scene-bg grey. Subsequent DrawQueue / per-frame draw calls land in the scene texture.
   void BeginScene(SDL_Renderer* sdlRenderer) const;
 
   // Phase 2: walk a sorted RenderQueue and dispatch each command to SDL_Render*. Texture/font
-  // resolution happens in the producer systems (cmd.texture is already a live handle).
-  void DrawQueue(const RenderQueue& renderQueue, SDL_Renderer* sdlRenderer) const;
+  // resolution happens in the producer systems (cmd.texture is already a live handle). Sprites go
+  // through the SpriteBatcher: one SDL_RenderGeometry per same-texture, same-blend run.
+  void DrawQueue(const RenderQueue& renderQueue, SDL_Renderer* sdlRenderer);
+
+  // Draw a sorted `renderQueue` into the render-target texture `target` over a transparent clear,
+  // then restore the bound target. For retained offscreen layers (UICanvasCache); its draws count
+  // toward the frame's submission tally alongside the scene's.
+  void DrawQueueToTexture(const RenderQueue& renderQueue, SDL_Renderer* sdlRenderer, SDL_Texture* target);
+
+  // Batching counters from the most recent DrawQueue.
+  [[nodiscard]] const SpriteBatchStats& GetSpriteBatchStats() const { return sprite_batcher_.Stats(); }
+
+  // Start the frame's submission tally: every DrawQueue / DrawQueueToTexture until the next call
+  // adds to it. FrameLoop calls it once per frame, before any canvas bake.
+  void ResetStats();
+
+  // Submission counters tallied since ResetStats into `stats` (RenderStats collection).
+  void FillStats(RenderStats& stats) const;
 
   // Phase 3: unbind the scene texture (RT becomes the window backbuffer) and clear that
   // backbuffer to black. The editor/debug UI + final composite draw on top of the cleared
   // backbuffer.
   void EndScene(SDL_Renderer* sdlRenderer) const;
 
-  // Player-build composite: blit the full scene texture into the window backbuffer. Editor
+  // Player-build composite: stretch the full scene texture over the window backbuffer. Editor
   // builds skip this — the Scene window inside ImGui draws the scene texture itself, so
   // composing it to the window again would double-draw.
   void CompositeSceneToWindow(SDL_Renderer* sdlRenderer) const;
@@ -71,5 +104,30 @@ class Renderer {
 #endif
 
  private:
-  SDL_Texture* scene_texture_ = nullptr;
+  // Count one draw call and whether it changed the bound texture / blend mode.
+  void NoteDraw(const SDL_Texture* texture, SDL_BlendMode blendMode);
+
+  struct SceneTarget {
+    SDL_Texture* texture = nullptr;
+    int width = 0;
+    int height = 0;
+  };
+
+  SDL_Texture* scene_texture_ = nullptr;  // the pooled target BeginScene binds
+  std::vector<SceneTarget> scene_targets_;
+  int scene_width_ = 0;  // logical scene size
+  int scene_height_ = 0;
+  float scene_scale_x_ = 1.0F;  // target pixels per logical unit
+  float scene_scale_y_ = 1.0F;
+  SpriteBatcher sprite_batcher_;
+
+  // The frame's submission tally across every DrawQueue since ResetStats. A handful of compares
+  // per draw call (not per sprite), so it is kept whether or not RenderStats are being collected.
+  std::uint32_t draw_calls_ = 0;
+  std::uint32_t texture_switches_ = 0;
+  std::uint32_t blend_changes_ = 0;
+  std::uint32_t sprite_runs_ = 0;
+  std::uint32_t command_breaks_ = 0;
+  const SDL_Texture* last_texture_ = nullptr;
+  SDL_BlendMode last_blend_ = SDL_BLENDMODE_NONE;
 };
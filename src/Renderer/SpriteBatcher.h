@@ -0,0 +1,220 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./RenderCommands.h"
+#include "./RenderQueue.h"
+#include "General/Constants.h"
+#include "General/PerfUtils.h"
+#include "General/ThreadPool.h"
+
+// Per-frame counters for the sprite batching stage. A "run" is one SDL_RenderGeometry call; each
+// break records why the previous run had to end early.
+struct SpriteBatchStats {
+  size_t sprites = 0;
+  size_t runs = 0;
+  size_t textureBreaks = 0;  // next sprite used a different texture
+  size_t blendBreaks = 0;    // same texture, different blend mode
+  size_t commandBreaks = 0;  // a non-sprite command (square, text) sat between two sprites
+};
+
+// One SDL_RenderGeometry call: queue entries [keyBegin, keyEnd) are consecutive sprites sharing
+// `texture` and `blendMode`, expanded into quads [firstQuad, firstQuad + keyEnd - keyBegin) of the
+// vertex arena.
+struct SpriteRun {
+  size_t keyBegin;
+  size_t keyEnd;
+  size_t firstQuad;
+  SDL_Texture* texture;
+  SDL_BlendMode blendMode;
+  float invTexW, invTexH;
+};
+
+// Collapses consecutive SpriteCommands that share a texture and blend mode into one
+// SDL_RenderGeometry call. The sorted RenderQueue already clusters sprites by (layer, band, type,
+// blend, texture hash), so on a typical frame the runs are long and the per-sprite
+// SDL_SetTexture*Mod + SDL_RenderTextureRotated sequence collapses to one geometry submit per run.
+//
+// Each sprite expands to four vertices with rotation (about the command's pivot), flip, source
+// rect and colour modulation baked in — SDL_RenderGeometry modulates per vertex and ignores the
+// texture's own colour/alpha mod, so no per-sprite texture state is touched. Only adjacent sprites
+// merge, so draw order is exactly the queue's order.
+//
+// Per frame: Build walks the sorted queue once on the calling thread to cut it into runs (and
+// reads each run's texture size — SDL calls stay on the main thread), then expands every run's
+// vertices into one shared arena. Each sprite's slot in the arena is known from the run table, so
+// above the parallel threshold the expansion splits the arena into contiguous ranges across the
+// ThreadPool with no further coordination. Submit then issues the finished runs; the index buffer
+// is the fixed two-triangle pattern shared by every run and only ever grows.
+class SpriteBatcher {
+ public:
+  // Cut `queue` into runs and expand their vertices. The runs stay valid until the next Build.
+  void Build(const RenderQueue& queue) {
+    PlanRuns(queue);
+    ExpandRuns(queue);
+    EnsureIndices(largest_run_);
+  }
+
+  // Draw run `run` (an index into Runs()).
+  void Submit(SDL_Renderer* renderer, const size_t run) const {
+    const SpriteRun& r = runs_[run];
+    const size_t quads = r.keyEnd - r.keyBegin;
+    SDL_SetTextureBlendMode(r.texture, r.blendMode);
+    SDL_RenderGeometry(renderer, r.texture, vertices_.data() + r.firstQuad * kVerticesPerQuad,
+                       static_cast<int>(quads * kVerticesPerQuad), indices_.data(),
+                       static_cast<int>(quads * kIndicesPerQuad));
+  }
+
+  // Build + Submit every run — for callers whose queue holds nothing but sprites.
+  void Draw(SDL_Renderer* renderer, const RenderQueue& queue) {
+    Build(queue);
+    for (size_t run = 0; run < runs_.size(); ++run) Submit(renderer, run);
+  }
+
+  [[nodiscard]] std::span<const SpriteRun> Runs() const { return runs_; }
+  [[nodiscard]] std::span<const SDL_Vertex> Vertices() const { return vertices_; }
+  [[nodiscard]] const SpriteBatchStats& Stats() const { return stats_; }
+
+  // Sprite count at or below which expansion stays on the calling thread.
+  void SetParallelThreshold(const size_t sprites) { parallel_threshold_ = sprites; }
+
+  // Write the four corners (top-left, top-right, bottom-right, bottom-left of the unrotated dest
+  // rect) of `cmd` into `out`. invTexW / invTexH are 1 / texture size, for normalised UVs. Matches
+  // SDL_RenderTextureRotated: rotation is clockwise about dest + pivot, flips mirror the source.
+  static void ExpandQuad(const SpriteCommand& cmd, const float invTexW, const float invTexH, SDL_Vertex* out) {
+    const float c = std::cos(static_cast<float>(cmd.rotation));
+    const float s = std::sin(static_cast<float>(cmd.rotation));
+    const float originX = cmd.destX + cmd.pivot.x;
+    const float originY = cmd.destY + cmd.pivot.y;
+    const float left = -cmd.pivot.x;
+    const float top = -cmd.pivot.y;
+    const float right = cmd.destW - cmd.pivot.x;
+    const float bottom = cmd.destH - cmd.pivot.y;
+
+    float u0 = cmd.srcRect.x * invTexW;
+    float u1 = (cmd.srcRect.x + cmd.srcRect.w) * invTexW;
+    float v0 = cmd.srcRect.y * invTexH;
+    float v1 = (cmd.srcRect.y + cmd.srcRect.h) * invTexH;
+    if ((cmd.flip & SDL_FLIP_HORIZONTAL) != 0) std::swap(u0, u1);
+    if ((cmd.flip & SDL_FLIP_VERTICAL) != 0) std::swap(v0, v1);
+
+    constexpr float kInv255 = 1.0f / static_cast<float>(Constants::kUint8Max);
+    const SDL_FColor color = {cmd.colorMod.r * kInv255, cmd.colorMod.g * kInv255, cmd.colorMod.b * kInv255,
+                              cmd.colorMod.a * kInv255};
+    const float xs[kVerticesPerQuad] = {left, right, right, left};
+    const float ys[kVerticesPerQuad] = {top, top, bottom, bottom};
+    const float us[kVerticesPerQuad] = {u0, u1, u1, u0};
+    const float vs[kVerticesPerQuad] = {v0, v0, v1, v1};
+    for (size_t i = 0; i < kVerticesPerQuad; ++i) {
+      out[i].position = {originX + xs[i] * c - ys[i] * s, originY + xs[i] * s + ys[i] * c};
+      out[i].color = color;
+      out[i].tex_coord = {us[i], vs[i]};
+    }
+  }
+
+  static constexpr size_t kVerticesPerQuad = 4;
+  static constexpr size_t kIndicesPerQuad = 6;
+
+ private:
+  // Serial pass: one comparison per key, one SDL_GetTextureSize per run. A sprite without a
+  // texture draws nothing (as with SDL_RenderTextureRotated) and ends the run like any other
+  // texture change.
+  void PlanRuns(const RenderQueue& queue) {
+    PROFILE_NAMED_SCOPE("Plan Sprite Runs");
+    runs_.clear();
+    stats_ = {};
+    largest_run_ = 0;
+    size_t quads = 0;
+    bool open = false;
+    const auto close = [&](const size_t keyEnd) {
+      SpriteRun& run = runs_.back();
+      run.keyEnd = keyEnd;
+      const size_t runQuads = keyEnd - run.keyBegin;
+      quads += runQuads;
+      largest_run_ = std::max(largest_run_, runQuads);
+      open = false;
+    };
+
+    size_t index = 0;
+    for (const RenderKey& key : queue) {
+      if (key.type != SPRITE) {
+        if (open) {
+          ++stats_.commandBreaks;
+          close(index);
+        }
+        ++index;
+        continue;
+      }
+      const SpriteCommand& cmd = queue.Sprite(key);
+      if (open && (cmd.texture != runs_.back().texture || cmd.blendMode != runs_.back().blendMode)) {
+        if (cmd.texture != runs_.back().texture) {
+          ++stats_.textureBreaks;
+        } else {
+          ++stats_.blendBreaks;
+        }
+        close(index);
+      }
+      if (!open && cmd.texture != nullptr) {
+        float w = 0.0f;
+        float h = 0.0f;
+        SDL_GetTextureSize(cmd.texture, &w, &h);
+        runs_.push_back({index, index, quads, cmd.texture, cmd.blendMode, w > 0.0f ? 1.0f / w : 0.0f,
+                         h > 0.0f ? 1.0f / h : 0.0f});
+        open = true;
+      }
+      ++index;
+    }
+    if (open) close(index);
+    stats_.sprites = quads;
+    stats_.runs = runs_.size();
+    vertices_.resize(quads * kVerticesPerQuad);
+  }
+
+  // Fill the arena. Work is split by quad, not by run, so one long run still spreads across every
+  // worker; each range finds its starting run by binary search and walks forward.
+  void ExpandRuns(const RenderQueue& queue) {
+    PROFILE_NAMED_SCOPE("Expand Sprite Vertices");
+    const size_t quads = stats_.sprites;
+    if (quads == 0) return;
+    const auto keys = queue.begin();
+    const auto expandRange = [&](const size_t /*batch*/, const size_t begin, const size_t end) {
+      auto run = std::upper_bound(runs_.begin(), runs_.end(), begin,
+                                  [](const size_t quad, const SpriteRun& r) { return quad < r.firstQuad; }) -
+                 1;
+      for (size_t quad = begin; quad < end; ++quad) {
+        while (quad >= run->firstQuad + (run->keyEnd - run->keyBegin)) ++run;
+        const auto key = static_cast<std::ptrdiff_t>(run->keyBegin + (quad - run->firstQuad));
+        ExpandQuad(queue.Sprite(keys[key]), run->invTexW, run->invTexH, vertices_.data() + quad * kVerticesPerQuad);
+      }
+    };
+    if (quads <= parallel_threshold_) {
+      expandRange(0, 0, quads);
+    } else {
+      ThreadPool::ParallelChunks(quads, expandRange);
+    }
+  }
+
+  void EnsureIndices(const size_t quads) {
+    const size_t have = indices_.size() / kIndicesPerQuad;
+    if (have >= quads) return;
+    indices_.reserve(quads * kIndicesPerQuad);
+    for (size_t q = have; q < quads; ++q) {
+      const int base = static_cast<int>(q * kVerticesPerQuad);
+      indices_.insert(indices_.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+  }
+
+  std::vector<SpriteRun> runs_;
+  std::vector<SDL_Vertex> vertices_;
+  std::vector<int> indices_;
+  size_t largest_run_ = 0;
+  size_t parallel_threshold_ = Constants::kSpriteExpandParallelThreshold;
+  SpriteBatchStats stats_;
+};
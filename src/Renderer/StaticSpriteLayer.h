@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "General/Rect.h"
+#include "Renderer/RenderCommands.h"
+#include "Renderer/RenderCulling.h"
+
+// Retained render layer for sprites that never move (backgrounds, decor). Entities tagged
+// StaticSpriteLayer::kTag are skipped by RenderSpriteSystem; RenderStaticSpriteSystem bakes them
+// once into world-space sprite commands, sorted by sort key, and each frame only culls the baked
+// list and appends the visible commands (camera offset applied) to the RenderQueue's retained
+// span, which RenderQueue::Sort merges with the dynamic keys.
+//
+// The bake is rebuilt only when it goes stale: a static entity added, removed, activated or
+// deactivated (seen through the query's membership version), a texture reload (AssetManager's
+// texture generation), or an explicit Invalidate(). Component writes are not tracked by the ECS,
+// so code that moves or restyles a static entity must call Invalidate() — from Lua,
+// invalidate_static_sprites().
+//
+// Culling is a linear pass over the baked list by default. With a grid cell size set
+// (EngineOptions::staticCullGridCell) the rebuild also bins world-space entries into a uniform
+// grid, and ForEachVisible only tests entries in the cells the camera overlaps — worthwhile
+// when the static world is much larger than the view.
+class StaticSpriteLayer {
+ public:
+  // Scene/Lua tag that opts an entity into the layer.
+  static constexpr const char* kTag = "static";
+
+  struct Entry {
+    std::uint64_t sortKey;
+    // World-space dest (screen-space if isFixed); the per-frame emit subtracts the camera.
+    SpriteCommand command;
+    bool isFixed;
+  };
+
+  // Forces a rebuild on the next frame.
+  void Invalidate() noexcept { dirty_ = true; }
+
+  // World units per grid cell; 0 disables the grid. Takes effect at the next rebuild.
+  void SetGridCellSize(const float cellSize) noexcept {
+    if (cellSize == grid_cell_request_) return;
+    grid_cell_request_ = cellSize;
+    dirty_ = true;
+  }
+
+  [[nodiscard]] bool IsStale(const std::uint64_t membershipVersion,
+                             const std::uint64_t textureGeneration) const noexcept {
+    return dirty_ || membershipVersion != membership_version_ || textureGeneration != texture_generation_;
+  }
+
+  // Rebuild protocol: BeginRebuild, Add each static sprite, EndRebuild (sorts and stamps).
+  void BeginRebuild() { entries_.clear(); }
+
+  Entry& Add(const std::uint64_t sortKey, const bool isFixed) {
+    Entry& entry = entries_.emplace_back();
+    entry.sortKey = sortKey;
+    entry.isFixed = isFixed;
+    return entry;
+  }
+
+  void EndRebuild(const std::uint64_t membershipVersion, const std::uint64_t textureGeneration) {
+    // Stable, so equal keys keep query order — the order RenderSpriteSystem would have emitted.
+    std::ranges::stable_sort(entries_, {}, &Entry::sortKey);
+    BuildGrid();
+    membership_version_ = membershipVersion;
+    texture_generation_ = textureGeneration;
+    dirty_ = false;
+    ++rebuilds_;
+  }
+
+  // Baked entries in draw order.
+  [[nodiscard]] const std::vector<Entry>& Entries() const noexcept { return entries_; }
+  [[nodiscard]] size_t Size() const noexcept { return entries_.size(); }
+  [[nodiscard]] size_t Rebuilds() const noexcept { return rebuilds_; }
+  [[nodiscard]] bool HasGrid() const noexcept { return !cell_start_.empty(); }
+
+  // Calls func(const Entry&) for each entry that passes the per-entry viewport test, in draw
+  // order. The grid only narrows the candidates, so the visible set is identical either way.
+  template <typename Func>
+  void ForEachVisible(const octarine::Rect& camera, const float windowWidth, const float windowHeight, Func&& func) {
+    const auto visit = [&](const Entry& entry) {
+      const SpriteCommand& cmd = entry.command;
+      if (!IsRenderableOutsideViewport(cmd.destX, cmd.destY, cmd.destW, cmd.destH, entry.isFixed, camera, windowWidth,
+                                       windowHeight)) {
+        func(entry);
+      }
+    };
+    const int cx0 = HasGrid() ? CellX(camera.x) : 0;
+    const int cx1 = HasGrid() ? CellX(camera.x + camera.w) : 0;
+    const int cy0 = HasGrid() ? CellY(camera.y) : 0;
+    const int cy1 = HasGrid() ? CellY(camera.y + camera.h) : 0;
+    // A camera over most of the grid gains nothing from the cell walk; scan linearly instead.
+    const auto cellsInView = static_cast<std::int64_t>(cx1 - cx0 + 1) * (cy1 - cy0 + 1);
+    if (!HasGrid() || cellsInView * 2 > static_cast<std::int64_t>(grid_cols_) * grid_rows_) {
+      for (const Entry& entry : entries_) visit(entry);
+      return;
+    }
+
+    // Mark candidates in a bitset over entry indices: dedupes entries spanning several visible
+    // cells, and the word scan below yields them in index (= sort-key) order without a sort.
+    std::ranges::fill(candidate_bits_, std::uint64_t{0});
+    const auto mark = [&](const std::uint32_t index) {
+      candidate_bits_[index >> 6] |= std::uint64_t{1} << (index & 63);
+    };
+    for (const std::uint32_t index : unbinned_) mark(index);
+    for (int cy = cy0; cy <= cy1; ++cy) {
+      for (int cx = cx0; cx <= cx1; ++cx) {
+        const auto cell = static_cast<size_t>(cy) * static_cast<size_t>(grid_cols_) + static_cast<size_t>(cx);
+        for (std::uint32_t i = cell_start_[cell]; i < cell_start_[cell + 1]; ++i) mark(cell_entries_[i]);
+      }
+    }
+    for (size_t word = 0; word < candidate_bits_.size(); ++word) {
+      for (std::uint64_t bits = candidate_bits_[word]; bits != 0; bits &= bits - 1) {
+        visit(entries_[word * 64 + static_cast<size_t>(std::countr_zero(bits))]);
+      }
+    }
+  }
+
+ private:
+  // Caps bound grid memory: a sparse, sprawling static world gets coarser cells instead of
+  // millions of empty ones, and an entry covering many cells (a full-level backdrop) is kept on
+  // the always-tested list rather than copied into each of them.
+  static constexpr std::int64_t kMaxGridCells = std::int64_t{1} << 20;
+  static constexpr std::int64_t kMaxCellsPerEntry = 64;
+
+  struct EntryBounds {
+    float minX, minY, maxX, maxY;
+  };
+
+  static EntryBounds BoundsOf(const SpriteCommand& cmd) {
+    return {std::min(cmd.destX, cmd.destX + cmd.destW), std::min(cmd.destY, cmd.destY + cmd.destH),
+            std::max(cmd.destX, cmd.destX + cmd.destW), std::max(cmd.destY, cmd.destY + cmd.destH)};
+  }
+
+  [[nodiscard]] int CellX(const float x) const {
+    return std::clamp(static_cast<int>(std::floor((x - grid_origin_x_) / grid_cell_)), 0, grid_cols_ - 1);
+  }
+  [[nodiscard]] int CellY(const float y) const {
+    return std::clamp(static_cast<int>(std::floor((y - grid_origin_y_) / grid_cell_)), 0, grid_rows_ - 1);
+  }
+
+  // Counting-sort binning into CSR arrays (cell_start_ / cell_entries_); fixed (screen-space) and
+  // oversized entries go to unbinned_.
+  void BuildGrid() {
+    cell_start_.clear();
+    cell_entries_.clear();
+    unbinned_.clear();
+    if (grid_cell_request_ <= 0.0f || entries_.empty()) return;
+
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    for (const Entry& entry : entries_) {
+      if (entry.isFixed) continue;
+      const EntryBounds b = BoundsOf(entry.command);
+      minX = std::min(minX, b.minX);
+      minY = std::min(minY, b.minY);
+      maxX = std::max(maxX, b.maxX);
+      maxY = std::max(maxY, b.maxY);
+    }
+    if (minX > maxX) return;  // all screen-space: the linear pass is already exact
+
+    grid_cell_ = grid_cell_request_;
+    const auto span = [&](const float extent) { return static_cast<std::int64_t>(extent / grid_cell_) + 1; };
+    while (span(maxX - minX) * span(maxY - minY) > kMaxGridCells) grid_cell_ *= 2.0f;
+    grid_origin_x_ = minX;
+    grid_origin_y_ = minY;
+    grid_cols_ = static_cast<int>(span(maxX - minX));
+    grid_rows_ = static_cast<int>(span(maxY - minY));
+
+    const auto cellCount = static_cast<size_t>(grid_cols_) * static_cast<size_t>(grid_rows_);
+    cell_start_.assign(cellCount + 1, 0);
+    const auto forEachCell = [&](const Entry& entry, auto&& onCell) {
+      const EntryBounds b = BoundsOf(entry.command);
+      for (int cy = CellY(b.minY); cy <= CellY(b.maxY); ++cy) {
+        for (int cx = CellX(b.minX); cx <= CellX(b.maxX); ++cx) {
+          onCell(static_cast<size_t>(cy) * static_cast<size_t>(grid_cols_) + static_cast<size_t>(cx));
+        }
+      }
+    };
+    const auto binned = [&](const Entry& entry) {
+      if (entry.isFixed) return false;
+      const EntryBounds b = BoundsOf(entry.command);
+      const std::int64_t cells = std::int64_t{CellX(b.maxX) - CellX(b.minX) + 1} * (CellY(b.maxY) - CellY(b.minY) + 1);
+      return cells <= kMaxCellsPerEntry;
+    };
+
+    for (std::uint32_t i = 0; i < entries_.size(); ++i) {
+      if (!binned(entries_[i])) {
+        unbinned_.push_back(i);
+        continue;
+      }
+      forEachCell(entries_[i], [&](const size_t cell) { ++cell_start_[cell + 1]; });
+    }
+    for (size_t c = 0; c < cellCount; ++c) cell_start_[c + 1] += cell_start_[c];
+    cell_entries_.resize(cell_start_[cellCount]);
+    std::vector<std::uint32_t> cursor(cell_start_.begin(), cell_start_.end() - 1);
+    for (std::uint32_t i = 0; i < entries_.size(); ++i) {
+      if (!binned(entries_[i])) continue;
+      forEachCell(entries_[i], [&](const size_t cell) { cell_entries_[cursor[cell]++] = i; });
+    }
+    candidate_bits_.assign((entries_.size() + 63) / 64, 0);
+  }
+
+  std::vector<Entry> entries_;
+  std::uint64_t membership_version_ = 0;
+  std::uint64_t texture_generation_ = 0;
+  bool dirty_ = true;
+  size_t rebuilds_ = 0;
+
+  float grid_cell_request_ = 0.0f;
+  float grid_cell_ = 0.0f;
+  float grid_origin_x_ = 0.0f;
+  float grid_origin_y_ = 0.0f;
+  int grid_cols_ = 0;
+  int grid_rows_ = 0;
+  std::vector<std::uint32_t> cell_start_;    // cellCount + 1 offsets into cell_entries_
+  std::vector<std::uint32_t> cell_entries_;  // entry indices, ascending within each cell
+  std::vector<std::uint32_t> unbinned_;      // fixed and oversized entries, tested every frame
+  std::vector<std::uint64_t> candidate_bits_;  // one bit per entry, rebuilt each ForEachVisible
+};
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+struct SDL_Texture;
+
+// Content-keyed store of rasterized text textures: (font id, color, string) → one SDL_Texture,
+// shared by every label showing that string. Labels Acquire an entry and Release it when their
+// text changes or their entity goes away; an entry nobody holds stays resident as a cache until
+// the unreferenced entries exceed the byte budget, then the least recently released go first.
+// Referenced entries are never evicted, so the budget bounds idle memory, not live text.
+//
+// Only whole-label rasterizations live here — RenderTextSystem's last-resort path when a font's
+// GlyphCache can't serve a label. SDL-free: the cache never creates textures, and destroys them
+// through the callback it was given, so the policy is unit-tested without a renderer. Not
+// thread-safe; RenderTextSystem runs serially.
+class TextTextureCache {
+ public:
+  static constexpr std::size_t kDefaultBudgetBytes = std::size_t{16} << 20;
+
+  using Destroyer = std::function<void(SDL_Texture*)>;
+
+  struct Entry {
+    SDL_Texture* texture = nullptr;
+    float width = 0.0F;
+    float height = 0.0F;
+    std::size_t bytes = 0;  // width x height x 4
+  };
+
+  struct Stats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+    std::size_t entries = 0;
+    std::size_t bytes = 0;      // every resident texture, referenced or not
+    std::size_t idleBytes = 0;  // the evictable share
+  };
+
+  TextTextureCache() = default;
+  explicit TextTextureCache(Destroyer destroy, const std::size_t budgetBytes = kDefaultBudgetBytes)
+      : destroy_(std::move(destroy)), budget_bytes_(budgetBytes) {}
+  TextTextureCache(const TextTextureCache&) = delete;
+  TextTextureCache& operator=(const TextTextureCache&) = delete;
+  TextTextureCache(TextTextureCache&&) = default;
+  TextTextureCache& operator=(TextTextureCache&&) = default;
+  ~TextTextureCache() { Clear(); }
+
+  // A reference to the resident texture for this content, or nullptr on a miss — the caller
+  // rasterizes and Inserts. Every non-null return must be paired with a Release.
+  const Entry* Acquire(const std::string_view fontId, const std::uint32_t color, const std::string_view text) {
+    const auto it = entries_.find(KeyView{fontId, color, text});
+    if (it == entries_.end()) {
+      ++stats_.misses;
+      return nullptr;
+    }
+    ++stats_.hits;
+    Slot& slot = it->second;
+    if (slot.refs++ == 0) {
+      idle_.erase(slot.idlePos);
+      idle_bytes_ -= slot.entry.bytes;
+    }
+    return &slot.entry;
+  }
+
+  // Take ownership of a freshly rasterized `texture` for this content and return it acquired
+  // once. Replaces (and destroys) an unreferenced entry with the same key.
+  const Entry* Insert(const std::string_view fontId, const std::uint32_t color, const std::string_view text,
+                      SDL_Texture* texture, const float width, const float height) {
+    if (const auto it = entries_.find(KeyView{fontId, color, text}); it != entries_.end()) {
+      if (it->second.refs > 0) {
+        // Already resident and held (the caller skipped Acquire): keep that one.
+        Destroy(texture);
+        ++it->second.refs;
+        return &it->second.entry;
+      }
+      Drop(it);
+    }
+    Slot slot;
+    slot.entry = {texture, width, height, static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4};
+    slot.refs = 1;
+    bytes_ += slot.entry.bytes;
+    const auto it = entries_.emplace(Key{std::string(fontId), color, std::string(text)}, slot).first;
+    Trim();
+    return &it->second.entry;
+  }
+
+  // Drop one reference. An entry whose last reference goes becomes the most recently used idle
+  // entry and may be evicted from then on.
+  void Release(const std::string_view fontId, const std::uint32_t color, const std::string_view text) {
+    const auto it = entries_.find(KeyView{fontId, color, text});
+    if (it == entries_.end() || it->second.refs == 0) return;
+    if (--it->second.refs == 0) {
+      it->second.idlePos = idle_.insert(idle_.end(), &it->first);
+      idle_bytes_ += it->second.entry.bytes;
+      Trim();
+    }
+  }
+
+  void SetBudget(const std::size_t budgetBytes) {
+    budget_bytes_ = budgetBytes;
+    Trim();
+  }
+  // Destroy every texture, referenced or not (renderer teardown, device reset).
+  void Clear() {
+    for (auto& [key, slot] : entries_) Destroy(slot.entry.texture);
+    entries_.clear();
+    idle_.clear();
+    bytes_ = 0;
+    idle_bytes_ = 0;
+  }
+
+  [[nodiscard]] std::size_t Budget() const { return budget_bytes_; }
+  [[nodiscard]] Stats GetStats() const {
+    Stats stats = stats_;
+    stats.entries = entries_.size();
+    stats.bytes = bytes_;
+    stats.idleBytes = idle_bytes_;
+    return stats;
+  }
+
+ private:
+  struct Key {
+    std::string fontId;
+    std::uint32_t color;
+    std::string text;
+  };
+  struct KeyView {
+    std::string_view fontId;
+    std::uint32_t color;
+    std::string_view text;
+  };
+  struct KeyHash {
+    using is_transparent = void;
+    std::size_t operator()(const KeyView& key) const {
+      const std::size_t h = std::hash<std::string_view>{}(key.text) * 31 + std::hash<std::string_view>{}(key.fontId);
+      return h ^ (static_cast<std::size_t>(key.color) * 0x9E3779B97F4A7C15ull);
+    }
+    std::size_t operator()(const Key& key) const { return (*this)(KeyView{key.fontId, key.color, key.text}); }
+  };
+  struct KeyEqual {
+    using is_transparent = void;
+    static KeyView View(const Key& key) { return {key.fontId, key.color, key.text}; }
+    static KeyView View(const KeyView& key) { return key; }
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+      const KeyView l = View(a);
+      const KeyView r = View(b);
+      return l.color == r.color && l.text == r.text && l.fontId == r.fontId;
+    }
+  };
+  // Unreferenced entries' keys (owned by entries_), least recently released first.
+  using IdleList = std::list<const Key*>;
+  struct Slot {
+    Entry entry;
+    std::uint32_t refs = 0;
+    IdleList::iterator idlePos;  // valid while refs == 0
+  };
+  using Map = std::unordered_map<Key, Slot, KeyHash, KeyEqual>;
+
+  // Evict idle entries, least recently released first, until the idle share fits the budget.
+  void Trim() {
+    while (idle_bytes_ > budget_bytes_ && !idle_.empty()) {
+      Drop(entries_.find(*idle_.front()));
+      ++stats_.evictions;
+    }
+  }
+
+  // Destroy an unreferenced entry.
+  void Drop(const Map::iterator it) {
+    idle_.erase(it->second.idlePos);
+    idle_bytes_ -= it->second.entry.bytes;
+    bytes_ -= it->second.entry.bytes;
+    Destroy(it->second.entry.texture);
+    entries_.erase(it);
+  }
+
+  void Destroy(SDL_Texture* texture) const {
+    if (texture != nullptr && destroy_) destroy_(texture);
+  }
+
+  Destroyer destroy_;
+  std::size_t budget_bytes_ = kDefaultBudgetBytes;
+  Map entries_;
+  IdleList idle_;
+  std::size_t bytes_ = 0;
+  std::size_t idle_bytes_ = 0;
+  Stats stats_;
+};
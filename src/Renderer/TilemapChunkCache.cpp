@@ -0,0 +1,162 @@
+#include "Renderer/TilemapChunkCache.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "General/Logger.h"
+
+TilemapChunkCache::TilemapChunkCache(TilemapChunkCache&& other) noexcept
+    : layers_(std::exchange(other.layers_, {})), frame_(other.frame_), stats_(other.stats_) {}
+
+TilemapChunkCache& TilemapChunkCache::operator=(TilemapChunkCache&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    layers_ = std::exchange(other.layers_, {});
+    frame_ = other.frame_;
+    stats_ = other.stats_;
+  }
+  return *this;
+}
+
+SDL_Texture* TilemapChunkCache::Acquire(SDL_Renderer* renderer, const Entity layerEntity,
+                                        const TilemapLayerComponent& layer, const int chunkX, const int chunkY,
+                                        SDL_Texture* tileset, const SDL_FRect atlasOffset,
+                                        const std::uint64_t textureGeneration) {
+  LayerChunks& entry = layers_[layerEntity.id];
+  entry.lastUsedFrame = frame_;
+  if (entry.chunks.size() != layer.chunkRevisions.size()) {
+    for (const Chunk& chunk : entry.chunks) {
+      if (chunk.texture != nullptr) SDL_DestroyTexture(chunk.texture);
+    }
+    entry.chunks.assign(layer.chunkRevisions.size(), Chunk{});
+  }
+
+  Chunk& chunk = entry.chunks[layer.ChunkIndex(chunkX, chunkY)];
+  chunk.lastUsedFrame = frame_;
+  const std::uint32_t revision = layer.ChunkRevision(chunkX, chunkY);
+  if (chunk.revision != revision || chunk.tileset != tileset || chunk.textureGeneration != textureGeneration) {
+    if (!Bake(renderer, chunk, layer, chunkX, chunkY, tileset, atlasOffset)) return nullptr;
+    chunk.revision = revision;
+    chunk.tileset = tileset;
+    chunk.textureGeneration = textureGeneration;
+    ++stats_.bakes;
+  }
+  return chunk.empty ? nullptr : chunk.texture;
+}
+
+bool TilemapChunkCache::Bake(SDL_Renderer* renderer, Chunk& chunk, const TilemapLayerComponent& layer,
+                             const int chunkX, const int chunkY, SDL_Texture* tileset,
+                             const SDL_FRect atlasOffset) const {
+  constexpr int kChunk = TilemapLayerComponent::kChunkTiles;
+  const int firstX = chunkX * kChunk;
+  const int firstY = chunkY * kChunk;
+  const int tilesX = std::min(kChunk, layer.width - firstX);
+  const int tilesY = std::min(kChunk, layer.height - firstY);
+
+  chunk.empty = true;
+  for (int y = firstY; y < firstY + tilesY && chunk.empty; ++y) {
+    for (int x = firstX; x < firstX + tilesX; ++x) {
+      if (layer.TileAt(x, y) != TilemapLayerComponent::kEmptyTile) {
+        chunk.empty = false;
+        break;
+      }
+    }
+  }
+  if (chunk.empty) {
+    if (chunk.texture != nullptr) SDL_DestroyTexture(chunk.texture);
+    chunk.texture = nullptr;
+    return true;
+  }
+
+  // Tiles per tileset row: explicit, or whatever fits the texture (the atlas slice when packed).
+  int columns = layer.tilesetColumns;
+  if (columns <= 0) {
+    float textureW = atlasOffset.w;
+    if (textureW <= 0.0f) {
+      float textureH = 0.0f;
+      SDL_GetTextureSize(tileset, &textureW, &textureH);
+    }
+    columns = std::max(1, (static_cast<int>(textureW) - 2 * layer.margin + layer.spacing) /
+                              std::max(1, layer.tileWidth + layer.spacing));
+  }
+
+  if (chunk.texture == nullptr) {
+    chunk.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                      tilesX * layer.tileWidth, tilesY * layer.tileHeight);
+    if (chunk.texture == nullptr) {
+      Logger::Error("TilemapChunkCache: SDL_CreateTexture failed for layer '" + layer.name +
+                    "': " + std::string(SDL_GetError()));
+      return false;
+    }
+    SDL_SetTextureBlendMode(chunk.texture, SDL_BLENDMODE_BLEND);
+    // Sample the chunk the way the tileset itself would be sampled, so pixel art stays crisp.
+    SDL_ScaleMode scaleMode = SDL_SCALEMODE_LINEAR;
+    SDL_GetTextureScaleMode(tileset, &scaleMode);
+    SDL_SetTextureScaleMode(chunk.texture, scaleMode);
+  }
+
+  // Tiles never overlap inside a chunk, so copy them unblended: blending onto the transparent clear
+  // would premultiply edge pixels and darken them when the chunk itself is blended onto the scene.
+  SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+  Uint8 r = 0, g = 0, b = 0, a = 0;
+  SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+  SDL_BlendMode tilesetBlend = SDL_BLENDMODE_BLEND;
+  SDL_GetTextureBlendMode(tileset, &tilesetBlend);
+
+  SDL_SetRenderTarget(renderer, chunk.texture);
+  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+  SDL_RenderClear(renderer);
+  SDL_SetTextureBlendMode(tileset, SDL_BLENDMODE_NONE);
+  const auto tileW = static_cast<float>(layer.tileWidth);
+  const auto tileH = static_cast<float>(layer.tileHeight);
+  for (int y = 0; y < tilesY; ++y) {
+    for (int x = 0; x < tilesX; ++x) {
+      const std::int32_t tile = layer.TileAt(firstX + x, firstY + y);
+      if (tile == TilemapLayerComponent::kEmptyTile) continue;
+      const int column = tile % columns;
+      const int row = tile / columns;
+      const SDL_FRect src{atlasOffset.x + static_cast<float>(layer.margin + column * (layer.tileWidth + layer.spacing)),
+                          atlasOffset.y + static_cast<float>(layer.margin + row * (layer.tileHeight + layer.spacing)),
+                          tileW, tileH};
+      const SDL_FRect dst{static_cast<float>(x) * tileW, static_cast<float>(y) * tileH, tileW, tileH};
+      SDL_RenderTexture(renderer, tileset, &src, &dst);
+    }
+  }
+  SDL_SetTextureBlendMode(tileset, tilesetBlend);
+  SDL_SetRenderTarget(renderer, previousTarget);
+  SDL_SetRenderDrawColor(renderer, r, g, b, a);
+  return true;
+}
+
+void TilemapChunkCache::EndFrame() {
+  size_t resident = 0;
+  for (auto it = layers_.begin(); it != layers_.end();) {
+    LayerChunks& entry = it->second;
+    for (Chunk& chunk : entry.chunks) {
+      if (chunk.texture != nullptr && frame_ - chunk.lastUsedFrame > kEvictAfterFrames) {
+        SDL_DestroyTexture(chunk.texture);
+        chunk = Chunk{};
+      }
+      if (chunk.texture != nullptr) ++resident;
+    }
+    if (frame_ - entry.lastUsedFrame > kEvictAfterFrames) {
+      it = layers_.erase(it);  // every chunk is past the horizon too, so all textures are freed
+    } else {
+      ++it;
+    }
+  }
+  stats_.chunks = resident;
+  stats_.bakes = 0;
+  ++frame_;
+}
+
+void TilemapChunkCache::Clear() {
+  for (auto& [id, entry] : layers_) {
+    for (const Chunk& chunk : entry.chunks) {
+      if (chunk.texture != nullptr) SDL_DestroyTexture(chunk.texture);
+    }
+  }
+  layers_.clear();
+  stats_ = {};
+}
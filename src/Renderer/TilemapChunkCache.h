@@ -0,0 +1,72 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Components/TilemapLayerComponent.h"
+#include "ECS/Entity.h"
+
+// Render-side cache of baked tilemap chunks: each kChunkTiles x kChunkTiles block of a layer is
+// drawn once into its own render-target texture, then the whole chunk goes out as a single quad
+// per frame instead of one per tile. A chunk is re-baked when its TilemapLayerComponent revision,
+// the tileset texture, or the AssetManager texture generation changes; chunks that go unused for
+// kEvictAfterFrames frames (scrolled away, or their layer despawned) are freed.
+//
+// Entries are keyed by the layer's full Entity id (generation included), so a recycled entity slot
+// never picks up a previous layer's textures. Owned by RenderTilemapSystem; single-threaded.
+class TilemapChunkCache {
+ public:
+  static constexpr std::uint64_t kEvictAfterFrames = 120;
+
+  struct Stats {
+    size_t chunks = 0;  // resident baked chunk textures
+    int bakes = 0;      // chunks (re-)baked this frame
+  };
+
+  TilemapChunkCache() = default;
+  ~TilemapChunkCache() { Clear(); }
+
+  TilemapChunkCache(const TilemapChunkCache&) = delete;
+  TilemapChunkCache& operator=(const TilemapChunkCache&) = delete;
+  TilemapChunkCache(TilemapChunkCache&& other) noexcept;
+  TilemapChunkCache& operator=(TilemapChunkCache&& other) noexcept;
+
+  // The baked texture for chunk (chunkX, chunkY) of `layer`, baking it first if it is missing or
+  // stale; nullptr when the chunk holds no tiles or the bake failed (logged). atlasOffset is the
+  // tileset's slice origin inside a packed atlas (zero for a loose texture). Restores the caller's
+  // render target.
+  SDL_Texture* Acquire(SDL_Renderer* renderer, Entity layerEntity, const TilemapLayerComponent& layer, int chunkX,
+                       int chunkY, SDL_Texture* tileset, SDL_FRect atlasOffset, std::uint64_t textureGeneration);
+
+  // Advance the frame clock and free chunks not acquired for kEvictAfterFrames frames.
+  void EndFrame();
+
+  void Clear();
+
+  [[nodiscard]] const Stats& GetStats() const { return stats_; }
+
+ private:
+  struct Chunk {
+    SDL_Texture* texture = nullptr;
+    const SDL_Texture* tileset = nullptr;
+    std::uint32_t revision = 0;  // 0 = never baked; layer revisions start at 1
+    std::uint64_t textureGeneration = 0;
+    std::uint64_t lastUsedFrame = 0;
+    bool empty = false;
+  };
+
+  struct LayerChunks {
+    std::vector<Chunk> chunks;  // row-major, parallel to TilemapLayerComponent::chunkRevisions
+    std::uint64_t lastUsedFrame = 0;
+  };
+
+  bool Bake(SDL_Renderer* renderer, Chunk& chunk, const TilemapLayerComponent& layer, int chunkX, int chunkY,
+            SDL_Texture* tileset, SDL_FRect atlasOffset) const;
+
+  std::unordered_map<EntityID, LayerChunks> layers_;
+  std::uint64_t frame_ = 1;
+  Stats stats_;
+};
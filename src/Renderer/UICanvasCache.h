@@ -0,0 +1,267 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ECS/Entity.h"
+#include "Renderer/RenderQueue.h"
+
+struct SDL_Texture;
+
+// Retained render targets for UI canvases that opt in with UICanvasComponent::cached. A cached
+// canvas draws its subtree into its own texture once, then goes out as a single quad per frame
+// until something under it changes; its sprites and labels skip culling, the main sort and the
+// draw in the meantime.
+//
+// Change detection is a fingerprint: UILayoutSystem, which walks every canvas each frame anyway,
+// folds each descendant's rect, sprite and label fields (plus the texture generation) into one
+// hash per canvas. Each frame a cached canvas is in one of three modes:
+//   Clean   — the fingerprint matches the texture's: the UI producers skip its entities and
+//             RenderUICanvasSystem emits the texture.
+//   Bake    — the fingerprint changed last frame and held since: the producers emit its entities
+//             into the bake queue instead of the frame's, Flush draws that into the texture before
+//             the scene, and the texture is emitted this frame already.
+//   Direct  — still changing (or another canvas holds this frame's bake): drawn like an uncached
+//             canvas. A canvas animating every frame therefore costs what it did before opting in,
+//             never a bake per frame.
+// One canvas bakes per frame, so the bake queue is shared.
+//
+// The composited quad sits on the canvas's base layer, so a cached canvas's z-indexed children no
+// longer interleave with other layers. The texture holds premultiplied color (blending onto a
+// transparent clear premultiplies), so the quad is drawn with SDL_BLENDMODE_BLEND_PREMULTIPLIED.
+//
+// Textures come from the caller (Composite's `create`) and are destroyed through the Destroyer,
+// so the policy is unit-tested without a renderer. Not thread-safe: the layout pass, the producers'
+// Route lookups (serial systems) and Flush all run on the main thread.
+class UICanvasCache {
+ public:
+  using Destroyer = std::function<void(SDL_Texture*)>;
+
+  enum class Mode : std::uint8_t { Direct, Bake, Clean };
+
+  // UIRectComponent::cacheSlot of an entity outside any cached canvas.
+  static constexpr std::int32_t kNoSlot = -1;
+  // Canvases not visited by the layout pass for this many frames (despawned, or caching switched
+  // off) have their textures freed.
+  static constexpr std::uint64_t kEvictAfterFrames = 120;
+
+  struct Stats {
+    std::size_t canvases = 0;  // resident canvas textures
+    std::size_t bytes = 0;     // their pixels, width x height x 4
+    std::uint64_t bakes = 0;   // since startup
+  };
+
+  // Order-dependent 64-bit hash the layout pass accumulates per canvas.
+  class Fingerprint {
+   public:
+    void Mix(const std::uint64_t value) { hash_ = (hash_ ^ value) * kPrime; }
+    void Mix(const float value) { Mix(static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(value))); }
+    void Mix(const std::string_view text) {
+      Mix(static_cast<std::uint64_t>(std::hash<std::string_view>{}(text)));
+      Mix(static_cast<std::uint64_t>(text.size()));
+    }
+    [[nodiscard]] std::uint64_t Value() const { return hash_; }
+
+   private:
+    static constexpr std::uint64_t kPrime = 0x100000001B3ull;  // FNV-1a
+    std::uint64_t hash_ = 0xCBF29CE484222325ull;
+  };
+
+  UICanvasCache() = default;
+  explicit UICanvasCache(Destroyer destroy) : destroy_(std::move(destroy)) {}
+  UICanvasCache(const UICanvasCache&) = delete;
+  UICanvasCache& operator=(const UICanvasCache&) = delete;
+  UICanvasCache(UICanvasCache&&) = default;
+  UICanvasCache& operator=(UICanvasCache&&) = default;
+  ~UICanvasCache() { Clear(); }
+
+  // Layout pass, once per frame before the first Open: forget last frame's slots and free the
+  // canvases that have gone unvisited for kEvictAfterFrames.
+  void BeginFrame() {
+    ++frame_;
+    active_.clear();
+    bake_slot_ = kNoSlot;
+    for (auto it = canvases_.begin(); it != canvases_.end();) {
+      if (frame_ - it->second.lastSeenFrame > kEvictAfterFrames) {
+        Release(it->second);
+        it = canvases_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  // Start a cached canvas for this frame; the returned slot goes on every UIRectComponent under
+  // it. Close it with its fingerprint before the producers run.
+  std::int32_t Open(const Entity canvas) {
+    Canvas& entry = canvases_[canvas.id];
+    entry.lastSeenFrame = frame_;
+    entry.mode = Mode::Direct;
+    active_.push_back(&entry);
+    return static_cast<std::int32_t>(active_.size() - 1);
+  }
+
+  // Settle the slot's mode for this frame from its subtree's fingerprint, its size in pixels and
+  // the layer its quad draws on. See the class comment for the rules.
+  void Close(const std::int32_t slot, const std::uint64_t fingerprint, const int width, const int height,
+             const int layer) {
+    Canvas& canvas = *active_[static_cast<std::size_t>(slot)];
+    canvas.layer = layer;
+    const bool resized = canvas.width != width || canvas.height != height;
+    canvas.width = width;
+    canvas.height = height;
+    if (width <= 0 || height <= 0) {
+      canvas.mode = Mode::Direct;
+    } else if (canvas.texture != nullptr && !resized && canvas.baked && fingerprint == canvas.bakedFingerprint) {
+      canvas.mode = Mode::Clean;
+    } else if (fingerprint == canvas.fingerprint && bake_slot_ == kNoSlot) {
+      canvas.mode = Mode::Bake;
+      bake_slot_ = slot;
+    } else {
+      canvas.mode = Mode::Direct;
+    }
+    canvas.fingerprint = fingerprint;
+  }
+
+  // Where a producer sends a UI entity's commands: `frame` for entities outside a cached canvas
+  // or in a Direct one, the bake queue for this frame's Bake canvas, nullptr (emit nothing) for a
+  // Clean one.
+  [[nodiscard]] RenderQueue* Route(const std::int32_t slot, RenderQueue& frame) {
+    if (slot < 0 || static_cast<std::size_t>(slot) >= active_.size()) return &frame;
+    switch (active_[static_cast<std::size_t>(slot)]->mode) {
+      case Mode::Clean:
+        return nullptr;
+      case Mode::Bake:
+        return &BakeQueue();
+      case Mode::Direct:
+        break;
+    }
+    return &frame;
+  }
+
+  [[nodiscard]] Mode ModeOf(const std::int32_t slot) const {
+    if (slot < 0 || static_cast<std::size_t>(slot) >= active_.size()) return Mode::Direct;
+    return active_[static_cast<std::size_t>(slot)]->mode;
+  }
+
+  // Emit the quad of every Clean and Bake canvas into `frame`, after the layout pass and before
+  // the UI producers. `create(width, height)` makes a render-target texture when a baking canvas
+  // has none of its size; if that fails the canvas falls back to Direct for the frame.
+  template <typename Create>
+  void Composite(RenderQueue& frame, Create&& create) {
+    for (std::size_t slot = 0; slot < active_.size(); ++slot) {
+      Canvas& canvas = *active_[slot];
+      if (canvas.mode == Mode::Bake && !EnsureTexture(canvas, create)) {
+        canvas.mode = Mode::Direct;
+        bake_slot_ = kNoSlot;
+      }
+      if (canvas.mode == Mode::Direct) continue;
+      const auto w = static_cast<float>(canvas.width);
+      const auto h = static_cast<float>(canvas.height);
+      SpriteCommand& cmd = frame.EmplaceSprite(static_cast<unsigned int>(canvas.layer), 0.0F, canvas.texture);
+      cmd = SpriteCommand{};
+      cmd.destW = w;
+      cmd.destH = h;
+      cmd.srcRect = {0.0F, 0.0F, w, h};
+      cmd.pivot = {w * 0.5F, h * 0.5F};
+      cmd.texture = canvas.texture;
+      cmd.blendMode = SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+    }
+  }
+
+  // Before the scene draws: sort this frame's bake queue and hand it to `draw(queue, texture)`,
+  // which renders it into the canvas texture over a transparent clear. No-op when no canvas bakes.
+  template <typename Draw>
+  void Flush(Draw&& draw) {
+    if (bake_slot_ == kNoSlot) return;
+    Canvas& canvas = *active_[static_cast<std::size_t>(bake_slot_)];
+    RenderQueue& queue = BakeQueue();
+    queue.Sort();
+    draw(static_cast<const RenderQueue&>(queue), canvas.texture);
+    queue.Clear();
+    canvas.baked = true;
+    canvas.bakedFingerprint = canvas.fingerprint;
+    ++stats_.bakes;
+    bake_slot_ = kNoSlot;
+  }
+
+  // Destroy every texture (renderer teardown). Canvases re-bake on their next stable frame.
+  void Clear() {
+    for (auto& [id, canvas] : canvases_) Release(canvas);
+    canvases_.clear();
+    active_.clear();
+    bake_slot_ = kNoSlot;
+  }
+
+  [[nodiscard]] Stats GetStats() const {
+    Stats stats = stats_;
+    for (const auto& [id, canvas] : canvases_) {
+      if (canvas.texture == nullptr) continue;
+      ++stats.canvases;
+      stats.bytes += TextureBytes(canvas);
+    }
+    return stats;
+  }
+
+ private:
+  struct Canvas {
+    SDL_Texture* texture = nullptr;
+    int textureWidth = 0;  // size `texture` was created at
+    int textureHeight = 0;
+    int width = 0;  // this frame's size
+    int height = 0;
+    int layer = 0;
+    std::uint64_t fingerprint = 0;  // latest Close
+    std::uint64_t bakedFingerprint = 0;
+    bool baked = false;  // texture holds bakedFingerprint's content
+    std::uint64_t lastSeenFrame = 0;
+    Mode mode = Mode::Direct;
+  };
+
+  static std::size_t TextureBytes(const Canvas& canvas) {
+    return static_cast<std::size_t>(canvas.textureWidth) * static_cast<std::size_t>(canvas.textureHeight) * 4;
+  }
+
+  template <typename Create>
+  bool EnsureTexture(Canvas& canvas, Create& create) {
+    if (canvas.texture != nullptr && canvas.textureWidth == canvas.width && canvas.textureHeight == canvas.height) {
+      return true;
+    }
+    Release(canvas);
+    canvas.texture = create(canvas.width, canvas.height);
+    if (canvas.texture == nullptr) return false;
+    canvas.textureWidth = canvas.width;
+    canvas.textureHeight = canvas.height;
+    return true;
+  }
+
+  void Release(Canvas& canvas) const {
+    if (canvas.texture != nullptr && destroy_) destroy_(canvas.texture);
+    canvas.texture = nullptr;
+    canvas.textureWidth = 0;
+    canvas.textureHeight = 0;
+    canvas.baked = false;
+  }
+
+  // Allocated on the first bake: a RenderQueue pre-sizes a payload segment per command type.
+  RenderQueue& BakeQueue() {
+    if (bake_queue_ == nullptr) bake_queue_ = std::make_unique<RenderQueue>(RenderQueue::kBlockSlots);
+    return *bake_queue_;
+  }
+
+  Destroyer destroy_;
+  // Node-based, so the Canvas pointers in active_ stay put while other canvases come and go.
+  std::unordered_map<EntityID, Canvas> canvases_;
+  std::vector<Canvas*> active_;  // this frame's cached canvases, indexed by slot
+  std::int32_t bake_slot_ = kNoSlot;
+  std::unique_ptr<RenderQueue> bake_queue_;
+  std::uint64_t frame_ = 0;
+  Stats stats_;
+};
@@ -1,13 +1,40 @@
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <string>
 
+#include "AssetManager/AnimationClip.h"
+#include "AssetManager/AssetManager.h"
 #include "Components/AnimationComponent.h"
+#include "Components/ScriptComponent.h"
 #include "Components/SpriteComponent.h"
+#include "ECS/CommandBuffer.h"
+#include "ECS/Entity.h"
+#include "ECS/Registry.h"
+#include "General/Logger.h"
 
+// Steps sprite animations on the worker threads. An AnimationComponent with a clip plays its baked
+// `.anim` clip (AnimationClip) and writes the frame's rect to SpriteComponent::srcRect; one without
+// falls back to the frame counter, stepping srcRect.x one sprite width per frame. Clip events are
+// deferred to the main thread and delivered to the entity's script as
+// on_animation_event(self, entity, name).
 class AnimationSystem {
  public:
-  void operator()(const float deltaTime, SpriteComponent& sprite, AnimationComponent& animation) const {
+  CommandBuffer& GetCommandBuffer() { return cmd_buffer_; }
+
+  void Prepare(Registry* registry) {
+    assetManager_ = registry->TryGet<AssetManager>();
+    clipGeneration_ = assetManager_ != nullptr ? assetManager_->AnimationClipGeneration() : 0;
+  }
+
+  void operator()(const Entity entity, const float deltaTime, SpriteComponent& sprite,
+                  AnimationComponent& animation) const {
+    if (!animation.clipId.empty()) {
+      PlayClip(entity, deltaTime, sprite, animation);
+      return;
+    }
     if (animation.numFrames <= 0 || animation.frameRateSpeed <= 0 || animation.isFinished) {
       return;
     }
@@ -19,6 +46,38 @@ class AnimationSystem {
   }
 
  private:
+  void PlayClip(const Entity entity, const float deltaTime, SpriteComponent& sprite,
+                AnimationComponent& animation) const {
+    // Re-resolve only when the clip set changed: the lookup is a map find, the common path a compare.
+    // Concurrent finds are safe — clips are only loaded and dropped between updates.
+    if (animation.clip == nullptr || animation.clipGeneration != clipGeneration_) {
+      animation.clip = assetManager_ != nullptr ? assetManager_->GetAnimationClip(animation.clipId) : nullptr;
+      animation.clipGeneration = clipGeneration_;
+    }
+    const AnimationClip* clip = animation.clip;
+    if (clip == nullptr || clip->Empty() || animation.isFinished) return;
+
+    animation.isFinished = clip->Advance(animation.clipTime, animation.clipStep, deltaTime * animation.clipSpeed,
+                                         [&](const std::string& name) {
+                                           cmd_buffer_.Defer([entity, name](Registry* registry) {
+                                             FireScriptEvent(registry, entity, name);
+                                           });
+                                         });
+    sprite.srcRect = clip->Rect(animation.clipStep);
+  }
+
+  static void FireScriptEvent(Registry* registry, const Entity entity, const std::string& name) {
+    if (!registry->IsAlive(entity) || !registry->HasComponent<ScriptComponent>(entity)) return;
+    auto& script = registry->GetComponent<ScriptComponent>(entity);
+    if (!script.scriptTable.valid()) return;
+    const sol::optional<sol::protected_function> onEvent = script.scriptTable["on_animation_event"];
+    if (!onEvent) return;
+    if (auto result = (*onEvent)(script.scriptTable, entity, name); !result.valid()) {
+      const sol::error err = result;
+      Logger::ErrorLua(std::string(err.what()));
+    }
+  }
+
   void UpdateAnimationState(AnimationComponent& animation, const float deltaTime) const {
     animation.frameTimer += deltaTime;
     const double timePerFrame = 1.0f / static_cast<double>(animation.frameRateSpeed);
@@ -42,4 +101,8 @@ class AnimationSystem {
       }
     }
   }
-};
\ No newline at end of file
+
+  const AssetManager* assetManager_ = nullptr;
+  std::uint64_t clipGeneration_ = 0;
+  CommandBuffer cmd_buffer_;
+};
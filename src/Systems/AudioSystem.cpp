@@ -184,7 +184,7 @@ void AudioSystem::SpawnSinkForSource(Entity entity, AudioSourceComponent& source
   if (!source.playOnSpawn && !resumingFromCull) return;
 
   auto& assetManager = registry_->Get<AssetManager>();
-  MIX_Audio* clip = assetManager.GetAudioClip(source.clipId);
+  MIX_Audio* clip = assetManager.GetAudioClip(source.clip, source.clipId);
   if (!clip) {
     Logger::Warn("AudioSystem: Clip not found: " + source.clipId);
     // Mark "tried" by attaching a finished sink — prevents per-frame retry without mutating the source.
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "ECS/Entity.h"
+
+// One collider as the collision pipeline sees it: world-space OBB plus its enclosing AABB and the
+// entity/collision masks. Gathered once per detection pass by CollisionSystem; consumed by the
+// broadphase/narrowphase and then by SpatialIndex for gameplay queries.
+struct Box {
+  Entity entity;
+  EntityMask entityMask;
+  EntityMask collisionMask;
+  // AABB enclosing the (possibly rotated) OBB — used by the median-cut broadphase. For a swept box
+  // it encloses the whole sweep (start and end positions).
+  float minX, minY;
+  float maxX, maxY;
+  // OBB narrowphase state, at the end-of-step (current) position.
+  float cx, cy;
+  float hx, hy;
+  float rotCos, rotSin;
+  bool rotated;
+  // Continuous-collision sweep: centre displacement since the previous detection pass. Only set for
+  // colliders that opted into CCD and moved; the box started the step at (cx - sweepX, cy - sweepY).
+  float sweepX = 0.0f;
+  float sweepY = 0.0f;
+  bool swept = false;
+
+  [[nodiscard]] bool intersectsInDimension(const Box& other, const int dim) const {
+    if (dim == 0) return !(maxX < other.minX || minX > other.maxX);
+    if (dim == 1) return !(maxY < other.minY || minY > other.maxY);
+    return false;  // Invalid dimension
+  }
+
+  // SAT on the 4 face normals of two OBBs. Only invoked when at least one box is rotated;
+  // axis-aligned pairs short-circuit on the AABB check above.
+  [[nodiscard]] bool obbIntersects(const Box& other) const {
+    const float ax0 = rotCos, ay0 = rotSin;
+    const float ax1 = -rotSin, ay1 = rotCos;
+    const float bx0 = other.rotCos, by0 = other.rotSin;
+    const float bx1 = -other.rotSin, by1 = other.rotCos;
+    const float dx = other.cx - cx;
+    const float dy = other.cy - cy;
+
+    const float axes[4][2] = {{ax0, ay0}, {ax1, ay1}, {bx0, by0}, {bx1, by1}};
+    for (const auto& axis : axes) {
+      const float ux = axis[0];
+      const float uy = axis[1];
+      const float aProj = hx * std::abs(ax0 * ux + ay0 * uy) + hy * std::abs(ax1 * ux + ay1 * uy);
+      const float bProj = other.hx * std::abs(bx0 * ux + by0 * uy) + other.hy * std::abs(bx1 * ux + by1 * uy);
+      const float distProj = std::abs(dx * ux + dy * uy);
+      if (distProj > aProj + bProj) return false;
+    }
+    return true;
+  }
+
+  // Time-of-impact test for a pair where at least one box is swept. Works in relative motion: hold
+  // `other` at its start position and move this box by the difference of the two sweeps, then slab
+  // test this box's start centre against `other`'s AABB grown by this box's half extents (Minkowski
+  // sum) over t in [0, 1]. Rotated boxes use their enclosing AABB here, so the test is conservative
+  // for them. On a hit `toi` is the first-contact fraction of the step (0 if touching at the start).
+  [[nodiscard]] bool sweptIntersects(const Box& other, float& toi) const {
+    const float halfX = (maxX - minX - std::abs(sweepX) + other.maxX - other.minX - std::abs(other.sweepX)) * 0.5f;
+    const float halfY = (maxY - minY - std::abs(sweepY) + other.maxY - other.minY - std::abs(other.sweepY)) * 0.5f;
+    const float start[2] = {cx - sweepX - (other.cx - other.sweepX), cy - sweepY - (other.cy - other.sweepY)};
+    const float motion[2] = {sweepX - other.sweepX, sweepY - other.sweepY};
+    const float half[2] = {halfX, halfY};
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    for (int axis = 0; axis < kAxisCount; ++axis) {
+      if (motion[axis] == 0.0f) {
+        if (std::abs(start[axis]) > half[axis]) return false;
+        continue;
+      }
+      float t0 = (-half[axis] - start[axis]) / motion[axis];
+      float t1 = (half[axis] - start[axis]) / motion[axis];
+      if (t0 > t1) std::swap(t0, t1);
+      tMin = std::max(tMin, t0);
+      tMax = std::min(tMax, t1);
+      if (tMin > tMax) return false;
+    }
+    toi = tMin;
+    return true;
+  }
+
+  // Full pair test: mask gate, AABB overlap (which already covers any sweep), then the swept TOI
+  // test or the discrete OBB test. On a hit `toi` is the fraction of the step at which contact
+  // began; discrete pairs only know end-of-step positions and report 1.
+  [[nodiscard]] bool intersects(const Box& other, float& toi) const {
+    const bool canInteract = !(collisionMask & other.entityMask).none() || !(other.collisionMask & entityMask).none();
+    if (!canInteract) {
+      return false;
+    }
+    if (!intersectsInDimension(other, 0) || !intersectsInDimension(other, 1)) return false;
+    if (swept || other.swept) return sweptIntersects(other, toi);
+    toi = 1.0f;
+    if (!rotated && !other.rotated) return true;
+    return obbIntersects(other);
+  }
+
+ private:
+  static constexpr int kAxisCount = 2;
+};
+
+// One narrowphase hit: the two entities and the time of impact from Box::intersects.
+struct BoxContact {
+  Entity a;
+  Entity b;
+  float toi;
+};
@@ -1,13 +1,15 @@
 #pragma once
 
+#include <span>
 #include <utility>
 #include <vector>
 
 #include "ECS/Entity.h"
 #include "General/ThreadPool.h"
 
-// Shared scaffold for the collision-response systems (DamageSystem, ObstacleBounceSystem). Both
-// iterate the frame's intersecting-pair vector doing per-pair tag CLASSIFICATION (registry reads
+// Generic classify/apply scaffold for collision responders whose rules don't fit a CollisionRouter
+// role (the engine's own DamageSystem / ObstacleBounceSystem consume routed buckets instead). A
+// responder iterates the frame's entering-pair span doing per-pair CLASSIFICATION (registry reads
 // only) and then a small number of MUTATIONS for the pairs that actually interact. The
 // classification is the cost that scales (a HasTag sweep per pair); the mutations are few.
 //
@@ -28,7 +30,7 @@
 // dedups; each bounce occurrence is replayed exactly once. Below the threshold it is a plain serial
 // loop (avoids ThreadPool dispatch overhead at realistic density).
 template <typename HitT, typename ClassifyFn, typename ApplyFn>
-void RunCollisionResponse(const std::vector<std::pair<Entity, Entity>>& pairs, size_t threshold, ClassifyFn&& classify,
+void RunCollisionResponse(std::span<const std::pair<Entity, Entity>> pairs, size_t threshold, ClassifyFn&& classify,
                           ApplyFn&& apply) {
   const size_t count = pairs.size();
   if (count == 0) return;
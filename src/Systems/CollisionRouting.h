@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ECS/Entity.h"
+#include "ECS/Registry.h"
+#include "General/Constants.h"
+#include "General/ThreadPool.h"
+
+// What an entity does when it collides. A collider can carry several roles (an enemy is both
+// damageable and a bouncer).
+enum CollisionRole : std::uint8_t {
+  kRoleDamageDealer = 1u << 0,
+  kRoleDamageable = 1u << 1,
+  kRoleObstacle = 1u << 2,
+  kRoleBouncer = 1u << 3,
+  kRoleScriptListener = 1u << 4,
+};
+
+// One frame's entering pairs split into per-responder buckets. Each response system consumes only
+// its own bucket, so pairs no responder cares about (the bulk at high density) cost one routing
+// lookup and nothing else. Bucket order follows the entering span.
+struct CollisionRoutes {
+  // (dealer, damageable) — one record per direction that qualifies.
+  std::vector<std::pair<Entity, Entity>> damage;
+  // Bouncer of each bouncer/obstacle contact. Every occurrence is kept (no dedup): the bounce flips
+  // velocity per contact, so two obstacles in one frame must flip twice.
+  std::vector<Entity> bounce;
+  // Indices into the entering span of pairs where either side listens, so the time of impact at
+  // the same index stays reachable.
+  std::vector<std::uint32_t> script;
+
+  void Clear() {
+    damage.clear();
+    bounce.clear();
+    script.clear();
+  }
+};
+
+// Routes collision pairs by per-archetype role masks instead of per-pair HasTag/HasComponent
+// lookups. Response systems declare which components/tags grant which role (DefineRole, at Init);
+// the router folds those into one role byte per archetype as archetypes appear — incrementally,
+// walking only the tail of Registry::ArchetypeLog like ComponentQuery does — so classifying an
+// entity is a generation check plus one table read.
+//
+// Lives as a Registry singleton shared by the response systems (see Instance). CollisionSystem
+// routes the entering span once per batch and hands the buckets over on the event; systems fall
+// back to routing the span themselves when an event arrives without them.
+class CollisionRouter {
+ public:
+  // The registry's shared router, created on first use.
+  static CollisionRouter& Instance(Registry& registry) {
+    if (auto* router = registry.TryGet<CollisionRouter>()) return *router;
+    return registry.Set<CollisionRouter>(CollisionRouter());
+  }
+
+  // Grant `role` to every archetype containing `componentOrTag`. Definitions are any-of: a role
+  // granted by two tags applies to archetypes carrying either. Re-derives every known archetype.
+  void DefineRole(const CollisionRole role, const Entity componentOrTag) {
+    for (const auto& [id, roles] : definitions_) {
+      if (id == componentOrTag.GetId() && roles == role) return;
+    }
+    definitions_.emplace_back(componentOrTag.GetId(), role);
+    rolesByArchetype_.clear();
+    seenArchetypes_ = 0;
+  }
+
+  // Role mask of the entity's current archetype; 0 for dead or stale handles. Read-only, so safe
+  // across worker threads once Refresh has run for this registry state.
+  [[nodiscard]] std::uint8_t RolesOf(const Registry& registry, const Entity entity) const {
+    if (!registry.IsAlive(entity)) return 0;
+    const auto archetypeId = static_cast<size_t>(registry.GetEntityLocation(entity).archetype->GetID());
+    return archetypeId < rolesByArchetype_.size() ? rolesByArchetype_[archetypeId] : 0;
+  }
+
+  // Fold any archetypes created since the last call into the role table.
+  void Refresh(const Registry& registry) {
+    const std::vector<Archetype*>& log = registry.ArchetypeLog();
+    for (; seenArchetypes_ < log.size(); ++seenArchetypes_) {
+      const Archetype* archetype = log[seenArchetypes_];
+      std::uint8_t roles = 0;
+      for (const auto& [id, role] : definitions_) {
+        if (archetype->HasComponent(id)) roles |= role;
+      }
+      const auto archetypeId = static_cast<size_t>(archetype->GetID());
+      if (archetypeId >= rolesByArchetype_.size()) rolesByArchetype_.resize(archetypeId + 1, 0);
+      rolesByArchetype_[archetypeId] = roles;
+    }
+  }
+
+  // Bucket `pairs` by role combination. Above kCollisionResponseParallelThreshold the lookups run
+  // across the ThreadPool into per-batch buckets that are concatenated in batch order, so the
+  // result matches the serial pass exactly. The returned buckets are reused by the next call.
+  const CollisionRoutes& Route(const Registry& registry, std::span<const std::pair<Entity, Entity>> pairs) {
+    Refresh(registry);
+    routes_.Clear();
+    const size_t count = pairs.size();
+    if (count <= Constants::kCollisionResponseParallelThreshold) {
+      RouteSerial(registry, pairs, routes_);
+      return routes_;
+    }
+
+    perBatch_.resize(ThreadPool::Instance().Size());
+    for (CollisionRoutes& batch : perBatch_) batch.Clear();
+    ThreadPool::ParallelChunks(count, [&](const size_t batch, const size_t begin, const size_t end) {
+      RouteRange(registry, pairs, begin, end, perBatch_[batch]);
+    });
+    for (const CollisionRoutes& batch : perBatch_) {
+      routes_.damage.insert(routes_.damage.end(), batch.damage.begin(), batch.damage.end());
+      routes_.bounce.insert(routes_.bounce.end(), batch.bounce.begin(), batch.bounce.end());
+      routes_.script.insert(routes_.script.end(), batch.script.begin(), batch.script.end());
+    }
+    return routes_;
+  }
+
+  // Route's serial body, appending to caller-owned buckets. Refresh must have run for the current
+  // archetype set.
+  void RouteSerial(const Registry& registry, std::span<const std::pair<Entity, Entity>> pairs,
+                   CollisionRoutes& out) const {
+    RouteRange(registry, pairs, 0, pairs.size(), out);
+  }
+
+ private:
+  void RouteRange(const Registry& registry, std::span<const std::pair<Entity, Entity>> pairs, const size_t begin,
+                  const size_t end, CollisionRoutes& out) const {
+    for (size_t i = begin; i < end; ++i) {
+      const auto& [a, b] = pairs[i];
+      const std::uint8_t rolesA = RolesOf(registry, a);
+      const std::uint8_t rolesB = RolesOf(registry, b);
+      if ((rolesA | rolesB) == 0) continue;
+      if ((rolesA & kRoleDamageDealer) && (rolesB & kRoleDamageable)) out.damage.emplace_back(a, b);
+      if ((rolesB & kRoleDamageDealer) && (rolesA & kRoleDamageable)) out.damage.emplace_back(b, a);
+      if ((rolesA & kRoleBouncer) && (rolesB & kRoleObstacle)) out.bounce.push_back(a);
+      if ((rolesB & kRoleBouncer) && (rolesA & kRoleObstacle)) out.bounce.push_back(b);
+      if ((rolesA | rolesB) & kRoleScriptListener) out.script.push_back(static_cast<std::uint32_t>(i));
+    }
+  }
+
+  // (component or tag id, role it grants).
+  std::vector<std::pair<ComponentID, std::uint8_t>> definitions_;
+  // Role mask indexed by ArchetypeID; archetypes never die, so entries never go stale.
+  std::vector<std::uint8_t> rolesByArchetype_;
+  size_t seenArchetypes_ = 0;
+  CollisionRoutes routes_;
+  std::vector<CollisionRoutes> perBatch_;
+};
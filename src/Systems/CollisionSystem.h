@@ -1,12 +1,13 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
-#include <functional>
+#include <cstdint>
 #include <future>
 #include <memory>
-#include <unordered_set>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -23,67 +24,34 @@
 #include "Events/CollisionExitBatchEvent.h"
 #include "General/PerfUtils.h"
 #include "General/ThreadPool.h"
+#include "Systems/CollisionBox.h"
+#include "Systems/CollisionRouting.h"
+#include "Systems/SpatialIndex.h"
 
 constexpr int kMaxDimensions = 2;
 // These values can be tuned for better performance.
 constexpr int kMaxRecursionDepth = 64;
 constexpr int kBruteforceCutoff = 32;
 
-struct Box {
-  Entity entity;
-  EntityMask entityMask;
-  EntityMask collisionMask;
-  // AABB enclosing the (possibly rotated) OBB — used by the median-cut broadphase.
-  float minX, minY;
-  float maxX, maxY;
-  // OBB narrowphase state.
-  float cx, cy;
-  float hx, hy;
-  float rotCos, rotSin;
-  bool rotated;
-
-  [[nodiscard]] bool intersectsInDimension(const Box& other, const int dim) const {
-    if (dim == 0) return !(maxX < other.minX || minX > other.maxX);
-    if (dim == 1) return !(maxY < other.minY || minY > other.maxY);
-    return false;  // Invalid dimension
-  }
-
-  // SAT on the 4 face normals of two OBBs. Only invoked when at least one box is rotated;
-  // axis-aligned pairs short-circuit on the AABB check above.
-  [[nodiscard]] bool obbIntersects(const Box& other) const {
-    const float ax0 = rotCos, ay0 = rotSin;
-    const float ax1 = -rotSin, ay1 = rotCos;
-    const float bx0 = other.rotCos, by0 = other.rotSin;
-    const float bx1 = -other.rotSin, by1 = other.rotCos;
-    const float dx = other.cx - cx;
-    const float dy = other.cy - cy;
-
-    const float axes[4][2] = {{ax0, ay0}, {ax1, ay1}, {bx0, by0}, {bx1, by1}};
-    for (const auto& axis : axes) {
-      const float ux = axis[0];
-      const float uy = axis[1];
-      const float aProj = hx * std::abs(ax0 * ux + ay0 * uy) + hy * std::abs(ax1 * ux + ay1 * uy);
-      const float bProj = other.hx * std::abs(bx0 * ux + by0 * uy) + other.hy * std::abs(bx1 * ux + by1 * uy);
-      const float distProj = std::abs(dx * ux + dy * uy);
-      if (distProj > aProj + bProj) return false;
-    }
-    return true;
-  }
-
-  [[nodiscard]] bool intersects(const Box& other) const {
-    const bool canInteract = !(collisionMask & other.entityMask).none() || !(other.collisionMask & entityMask).none();
-    if (!canInteract) {
-      return false;
-    }
-    if (!intersectsInDimension(other, 0) || !intersectsInDimension(other, 1)) return false;
-    if (!rotated && !other.rotated) return true;
-    return obbIntersects(other);
-  }
+// One overlapping pair in the frame's sorted pair list. `key` packs the two entity *indices*
+// (lower << 32 | higher) so the list can be radix-sorted and diffed against last frame's list with a
+// linear merge. Indices are unique among live entities, so keys are unique within one frame; the
+// full handles ride along so a recycled slot (same index, new generation) diffs as exit + enter.
+struct SortedPair {
+  std::uint64_t key;
+  std::pair<Entity, Entity> entities;  // first is the lower-index entity
+  float toi;                           // time of impact within the pass, see Box::intersects
 };
 
 struct CollisionResult {
-  std::vector<std::pair<Entity, Entity>> intersectingPairs;
-  std::vector<Box> boxes;
+  std::vector<BoxContact> intersectingPairs;
+  // Spatial index built over this pass's boxes once the broadphase is done with them; it owns the
+  // box storage, which is recycled into the next gather when the index is retired.
+  SpatialIndex index;
+  // intersectingPairs normalized, radix-sorted by key and deduplicated on the worker, so the main
+  // thread only runs the merge. sortScratch is the radix ping-pong buffer, handed back for reuse.
+  std::vector<SortedPair> sortedPairs;
+  std::vector<SortedPair> sortScratch;
 };
 
 struct Partitions {
@@ -107,9 +75,16 @@ class CollisionSystem {
     if (collisionResult_.valid()) {
       PROFILE_NAMED_SCOPE("Emit Events");
       CollisionResult result = collisionResult_.get();
-      EmitCollisionEvents(eventBus, result.intersectingPairs);
-      cachedBoxes_ = std::move(result.boxes);
-      cachedBoxes_.clear();
+      currPairs_ = std::move(result.sortedPairs);
+      sortScratch_ = std::move(result.sortScratch);
+      EmitCollisionEvents(*registry, eventBus);
+      cachedPairs_ = std::move(result.intersectingPairs);
+      cachedPairs_.clear();
+      // Publish the fresh index; the retired one gives its box storage back to the next gather
+      // and its node storage to the next build.
+      std::swap(spatialIndex_, result.index);
+      cachedBoxes_ = result.index.TakeBoxes();
+      spareIndex_ = std::move(result.index);
     }
 
     std::vector<Box> boxes = std::move(cachedBoxes_);
@@ -126,7 +101,7 @@ class CollisionSystem {
       std::atomic<size_t> nextIndex{0};
 
       query_->ParallelForEach([&](Entity entity, const GlobalTransformComponent& transform,
-                                  const BoxColliderComponent& collider, const EntityMaskComponent& entityMask) {
+                                  BoxColliderComponent& collider, const EntityMaskComponent& entityMask) {
         const size_t idx = nextIndex.fetch_add(1, std::memory_order_relaxed);
         const float w = static_cast<float>(collider.width) * transform.scale.x;
         const float h = static_cast<float>(collider.height) * transform.scale.y;
@@ -143,26 +118,45 @@ class CollisionSystem {
         const bool rotated = transform.rotation != 0.0;
         const float aabbHx = hx * std::abs(rc) + hy * std::abs(rs);
         const float aabbHy = hx * std::abs(rs) + hy * std::abs(rc);
+
+        // Continuous colliders sweep from where the last pass saw them to here, so a fast mover
+        // can't tunnel through a thin collider between two low-rate passes. The AABB grows to
+        // cover the whole sweep; the broadphase needs no other change.
+        float sweepX = 0.0f;
+        float sweepY = 0.0f;
+        if (collider.continuous && collider.hasLastCenter) {
+          sweepX = cx - collider.lastCenter.x;
+          sweepY = cy - collider.lastCenter.y;
+        }
+        collider.lastCenter = {cx, cy};
+        collider.hasLastCenter = collider.continuous;
+
         boxes[idx] = {entity,
                       entityMask.mask,
                       collider.collisionMask,
-                      cx - aabbHx,
-                      cy - aabbHy,
-                      cx + aabbHx,
-                      cy + aabbHy,
+                      cx - aabbHx + std::min(0.0f, -sweepX),
+                      cy - aabbHy + std::min(0.0f, -sweepY),
+                      cx + aabbHx + std::max(0.0f, -sweepX),
+                      cy + aabbHy + std::max(0.0f, -sweepY),
                       cx,
                       cy,
                       hx,
                       hy,
                       rc,
                       rs,
-                      rotated};
+                      rotated,
+                      sweepX,
+                      sweepY,
+                      sweepX != 0.0f || sweepY != 0.0f};
       });
     }
 
     PROFILE_COUNTER_SET("Collision: Box count", static_cast<long long>(boxes.size()));
 
     if (boxes.empty()) {
+      // Nothing to detect, so no pass will publish an index; drop the stale one rather than keep
+      // answering spatial queries with colliders that no longer exist.
+      cachedBoxes_ = spatialIndex_.Size() > 0 ? spatialIndex_.TakeBoxes() : std::move(boxes);
       return;
     }
 
@@ -172,61 +166,174 @@ class CollisionSystem {
   // Returns true if entity a and entity b are currently overlapping (sustained OR just-entered).
   // Reflects the result of the most recently completed async detection pass (one frame of lag
   // on the very first frame, stable thereafter). Safe to call from on_update or on_collision.
+  // Binary search over the sorted pair list — no hashing, no allocation.
   [[nodiscard]] bool IsOverlapping(const Entity a, const Entity b) const {
-    return prevPairSet_.count({std::min(a.id, b.id), std::max(a.id, b.id)}) > 0;
+    const std::pair<Entity, Entity> pair = NormalizePair(a, b);
+    const std::uint64_t key = PairKey(pair);
+    const auto it = std::lower_bound(prevPairs_.begin(), prevPairs_.end(), key,
+                                     [](const SortedPair& p, const std::uint64_t k) { return p.key < k; });
+    return it != prevPairs_.end() && it->key == key && it->entities == pair;
   }
 
- private:
-  struct PairHash {
-    size_t operator()(const std::pair<EntityID, EntityID>& p) const noexcept {
-      // Boost-style hash_combine: golden-ratio constant spreads entropy, shifts mix bits.
-      static constexpr size_t kGoldenRatio = 0x9e3779b9ULL;
-      static constexpr int kLeftShift = 6;
-      size_t h = std::hash<EntityID>{}(p.first);
-      h ^= std::hash<EntityID>{}(p.second) + kGoldenRatio + (h << kLeftShift) + (h >> 2);
-      return h;
-    }
-  };
-  using PairSet = std::unordered_set<std::pair<EntityID, EntityID>, PairHash>;
+  // Spatial queries (AABB, circle, raycast, k-nearest) over the colliders of the most recently
+  // completed detection pass — same snapshot and lag as IsOverlapping. Main-thread (or
+  // between-collect) use only: the published index is swapped when a pass is collected.
+  [[nodiscard]] const SpatialIndex& GetSpatialIndex() const { return spatialIndex_; }
 
-  PairSet prevPairSet_;
+  // Every pair overlapping in the most recently completed pass (entering + staying), sorted by key.
+  // Same snapshot and lifetime rules as GetSpatialIndex. Feeds PhysicsSolverSystem's contacts.
+  [[nodiscard]] std::span<const SortedPair> GetOverlappingPairs() const { return prevPairs_; }
+
+ private:
+  // Last completed frame's overlaps, sorted by key. Read by IsOverlapping between collects.
+  std::vector<SortedPair> prevPairs_;
+  // This frame's sorted overlaps and the radix ping-pong buffer. Moved into the detection task on
+  // dispatch and handed back in CollisionResult, so neither allocates once warmed up.
+  std::vector<SortedPair> currPairs_;
+  std::vector<SortedPair> sortScratch_;
+  // Backing storage for the event spans; cleared and refilled by each merge.
+  std::vector<std::pair<Entity, Entity>> enteringPairs_;
+  std::vector<std::pair<Entity, Entity>> stayingPairs_;
+  std::vector<std::pair<Entity, Entity>> exitingPairs_;
+  // Time of impact per entering pair, index-aligned with enteringPairs_.
+  std::vector<float> enteringToi_;
+  std::vector<BoxContact> cachedPairs_;
   std::vector<Box> cachedBoxes_;
+  SpatialIndex spatialIndex_;
+  SpatialIndex spareIndex_;
   std::future<CollisionResult> collisionResult_;
   std::unique_ptr<ComponentQuery<GlobalTransformComponent, BoxColliderComponent, EntityMaskComponent>> query_;
 
-  // Diff this frame's overlaps against the previous frame and emit the enter/exit batches.
-  //   - enter (W2.2): pairs overlapping now but not last frame — first-contact only, so persistent
-  //     overlaps (enemy pinned against a wall, stacked entities) don't re-fire every frame.
-  //   - exit: pairs that overlapped last frame but no longer do.
-  void EmitCollisionEvents(EventBus* eventBus, const std::vector<std::pair<Entity, Entity>>& intersectingPairs) {
-    PROFILE_COUNTER_SET("Collision: Intersecting pairs", static_cast<long long>(intersectingPairs.size()));
+  [[nodiscard]] static std::pair<Entity, Entity> NormalizePair(const Entity a, const Entity b) {
+    return a.GetId() <= b.GetId() ? std::pair{a, b} : std::pair{b, a};
+  }
+
+  [[nodiscard]] static std::uint64_t PairKey(const std::pair<Entity, Entity>& pair) {
+    return (static_cast<std::uint64_t>(pair.first.GetId()) << 32) | pair.second.GetId();
+  }
 
-    PairSet currentSet;
-    currentSet.reserve(intersectingPairs.size());
-    for (const auto& [a, b] : intersectingPairs) {
-      currentSet.emplace(std::min(a.id, b.id), std::max(a.id, b.id));
+  // Normalize the detection output into keyed records, radix-sort them and drop duplicates. Runs on
+  // the detection worker so the main thread only pays for the merge.
+  static void BuildSortedPairs(const std::vector<BoxContact>& intersectingPairs, std::vector<SortedPair>& sorted,
+                               std::vector<SortedPair>& scratch) {
+    ACCUMULATE_PROFILE_SCOPE("Sort Collision Pairs");
+    sorted.clear();
+    sorted.reserve(intersectingPairs.size());
+    for (const auto& [a, b, toi] : intersectingPairs) {
+      const std::pair<Entity, Entity> pair = NormalizePair(a, b);
+      sorted.push_back({PairKey(pair), pair, toi});
     }
+    RadixSortPairs(sorted, scratch);
+    // The broadphase shouldn't report a pair twice, but a duplicate would surface as a double
+    // enter, so collapse adjacent equal keys (linear on sorted input).
+    sorted.erase(std::unique(sorted.begin(), sorted.end(),
+                             [](const SortedPair& x, const SortedPair& y) { return x.key == y.key; }),
+                 sorted.end());
+  }
 
-    std::vector<std::pair<Entity, Entity>> enteringPairs;
-    enteringPairs.reserve(intersectingPairs.size());
-    for (const auto& [a, b] : intersectingPairs) {
-      if (!prevPairSet_.count({std::min(a.id, b.id), std::max(a.id, b.id)})) {
-        enteringPairs.emplace_back(a, b);
+  // LSB radix sort on the 64-bit pair key; same shape as RenderQueue::RadixSort (one histogram
+  // scan, uniform-byte passes skipped). Entity indices rarely use their top bytes, so the high byte
+  // of each packed index is usually uniform and a typical frame runs ~6 of the 8 passes.
+  static void RadixSortPairs(std::vector<SortedPair>& entries, std::vector<SortedPair>& scratch) {
+    const size_t n = entries.size();
+    if (n <= 1) return;
+    scratch.resize(n);
+
+    std::array<std::array<size_t, 256>, 8> histograms{};
+    for (const SortedPair& entry : entries) {
+      for (size_t pass = 0; pass < 8; ++pass) {
+        histograms[pass][(entry.key >> (pass * 8)) & 0xFFu]++;
       }
     }
 
-    std::vector<std::pair<Entity, Entity>> exitingPairs;
-    for (const auto& [minId, maxId] : prevPairSet_) {
-      if (!currentSet.count({minId, maxId})) {
-        exitingPairs.emplace_back(Entity{minId}, Entity{maxId});
+    std::vector<SortedPair>* in = &entries;
+    std::vector<SortedPair>* out = &scratch;
+    for (size_t pass = 0; pass < 8; ++pass) {
+      auto& counts = histograms[pass];
+      if (std::any_of(counts.begin(), counts.end(), [n](const size_t c) { return c == n; })) continue;
+
+      size_t sum = 0;
+      for (auto& c : counts) {
+        const size_t saved = c;
+        c = sum;
+        sum += saved;
+      }
+      const size_t shift = pass * 8;
+      for (size_t i = 0; i < n; ++i) {
+        const auto bucket = static_cast<std::uint8_t>(((*in)[i].key >> shift) & 0xFFu);
+        (*out)[counts[bucket]++] = (*in)[i];
       }
+      std::swap(in, out);
     }
 
-    prevPairSet_ = std::move(currentSet);
+    if (in != &entries) {
+      std::swap(entries, scratch);
+    }
+  }
 
-    PROFILE_COUNTER_SET("Collision: Entering pairs", static_cast<long long>(enteringPairs.size()));
-    eventBus->EmitEvent<CollisionBatchEvent>(enteringPairs);
-    eventBus->EmitEvent<CollisionExitBatchEvent>(exitingPairs);
+  // Diff this frame's sorted overlaps against the previous frame's in one linear merge and emit the
+  // batches. Both lists are sorted by key, so each step advances whichever side holds the smaller
+  // key:
+  //   - enter (W2.2): pairs overlapping now but not last frame — first-contact only, so persistent
+  //     overlaps (enemy pinned against a wall, stacked entities) don't re-fire every frame.
+  //   - stay: pairs overlapping in both frames.
+  //   - exit: pairs that overlapped last frame but no longer do.
+  // Equal keys with different handles mean a slot was recycled in between: the old pair exits and
+  // the new one enters. When response systems have registered a CollisionRouter, the entering span
+  // is bucketed by role once here and the buckets ride on the event.
+  void EmitCollisionEvents(Registry& registry, EventBus* eventBus) {
+    PROFILE_COUNTER_SET("Collision: Intersecting pairs", static_cast<long long>(currPairs_.size()));
+
+    enteringPairs_.clear();
+    enteringToi_.clear();
+    stayingPairs_.clear();
+    exitingPairs_.clear();
+    const auto enter = [this](const SortedPair& pair) {
+      enteringPairs_.push_back(pair.entities);
+      enteringToi_.push_back(pair.toi);
+    };
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < prevPairs_.size() && j < currPairs_.size()) {
+      const SortedPair& prev = prevPairs_[i];
+      const SortedPair& curr = currPairs_[j];
+      if (prev.key < curr.key) {
+        exitingPairs_.push_back(prev.entities);
+        ++i;
+      } else if (curr.key < prev.key) {
+        enter(curr);
+        ++j;
+      } else {
+        if (prev.entities == curr.entities) {
+          stayingPairs_.push_back(curr.entities);
+        } else {
+          exitingPairs_.push_back(prev.entities);
+          enter(curr);
+        }
+        ++i;
+        ++j;
+      }
+    }
+    for (; i < prevPairs_.size(); ++i) exitingPairs_.push_back(prevPairs_[i].entities);
+    for (; j < currPairs_.size(); ++j) enter(currPairs_[j]);
+
+    // This frame becomes next frame's baseline; the old baseline's storage is reused for the next
+    // detection pass.
+    std::swap(prevPairs_, currPairs_);
+
+    PROFILE_COUNTER_SET("Collision: Entering pairs", static_cast<long long>(enteringPairs_.size()));
+    PROFILE_COUNTER_SET("Collision: Exiting pairs", static_cast<long long>(exitingPairs_.size()));
+    const CollisionRoutes* routes = nullptr;
+    if (auto* router = registry.TryGet<CollisionRouter>()) {
+      PROFILE_NAMED_SCOPE("Route Collision Pairs");
+      routes = &router->Route(registry, enteringPairs_);
+    }
+    eventBus->EmitEvent<CollisionBatchEvent>(std::span<const std::pair<Entity, Entity>>(enteringPairs_),
+                                             std::span<const std::pair<Entity, Entity>>(stayingPairs_),
+                                             std::span<const std::pair<Entity, Entity>>(exitingPairs_),
+                                             std::span<const float>(enteringToi_), routes);
+    eventBus->EmitEvent<CollisionExitBatchEvent>(std::span<const std::pair<Entity, Entity>>(exitingPairs_));
   }
 
   std::future<CollisionResult> StartAsyncCollisionDetection(std::vector<Box> boxes) {
@@ -235,28 +342,37 @@ class CollisionSystem {
     // copyable std::function; the future hands back to the same valid()/wait_for/get polling below.
     auto promise = std::make_shared<std::promise<CollisionResult>>();
     std::future<CollisionResult> result = promise->get_future();
-    ThreadPool::Instance().Submit([boxes = std::move(boxes), promise, this]() mutable {
+    ThreadPool::Instance().Submit([boxes = std::move(boxes), intersectingPairs = std::move(cachedPairs_),
+                                   sorted = std::move(currPairs_), scratch = std::move(sortScratch_),
+                                   index = std::move(spareIndex_), promise, this]() mutable {
       AGGREGATE_PROFILE_SESSION("Async Box Creation");
-      std::vector<std::pair<Entity, Entity>> intersectingPairs;
+      intersectingPairs.clear();
 
       if (!boxes.empty()) {
         FindIntersectionsRecursive(boxes, 0, static_cast<int>(boxes.size()), 0, 0, intersectingPairs);
       }
-      promise->set_value(CollisionResult{std::move(intersectingPairs), std::move(boxes)});
+      BuildSortedPairs(intersectingPairs, sorted, scratch);
+      {
+        ACCUMULATE_PROFILE_SCOPE("Build Spatial Index");
+        index.Build(std::move(boxes));
+      }
+      promise->set_value(
+          CollisionResult{std::move(intersectingPairs), std::move(index), std::move(sorted), std::move(scratch)});
     });
     return result;
   }
 
   void FindIntersectionsBruteForce(const std::vector<Box>& boxes, const int begin, const int end,
-                                   std::vector<std::pair<Entity, Entity>>& intersectingPairs) const {
+                                   std::vector<BoxContact>& intersectingPairs) const {
     ACCUMULATE_PROFILE_SCOPE("Brute Force Intersection");
 
     for (int i = begin; i < end; ++i) {
       for (int j = i + 1; j < end; ++j) {
         const auto& bi = boxes[static_cast<size_t>(i)];
         const auto& bj = boxes[static_cast<size_t>(j)];
-        if (bi.intersects(bj)) {
-          intersectingPairs.emplace_back(bi.entity, bj.entity);
+        float toi = 1.0f;
+        if (bi.intersects(bj, toi)) {
+          intersectingPairs.push_back({bi.entity, bj.entity, toi});
         }
       }
     }
@@ -294,14 +410,15 @@ class CollisionSystem {
   }
 
   void FindIntersectionsBruteForceBipartite(std::vector<Box>& boxes, const int begin1, const int end1, const int begin2,
-                                            const int end2, std::vector<std::pair<Entity, Entity>>& pairs) const {
+                                            const int end2, std::vector<BoxContact>& pairs) const {
     ACCUMULATE_PROFILE_SCOPE("Brute Force Bipartite");
     for (int i = begin1; i < end1; ++i) {
       for (int j = begin2; j < end2; ++j) {
         const auto& bi = boxes[static_cast<size_t>(i)];
         const auto& bj = boxes[static_cast<size_t>(j)];
-        if (bi.intersects(bj)) {
-          pairs.emplace_back(bi.entity, bj.entity);
+        float toi = 1.0f;
+        if (bi.intersects(bj, toi)) {
+          pairs.push_back({bi.entity, bj.entity, toi});
         }
       }
     }
@@ -312,7 +429,7 @@ class CollisionSystem {
   // NOLINTNEXTLINE(misc-no-recursion,readability-function-cognitive-complexity)
   void FindIntersectionsSweepBipartite(std::vector<Box>& boxes, const int begin1, const int end1, const int begin2,
                                        const int end2, const int dimension,
-                                       std::vector<std::pair<Entity, Entity>>& pairs) {
+                                       std::vector<BoxContact>& pairs) {
     ACCUMULATE_PROFILE_SCOPE("Sweep Bipartite");
 
     if (end1 - begin1 == 0 || end2 - begin2 == 0) return;
@@ -334,7 +451,7 @@ class CollisionSystem {
         for (int j = startJ; j < end2; ++j) {
           const Box& b = boxes[static_cast<size_t>(j)];
           if (b.minX > a.maxX) break;
-          if (a.intersects(b)) pairs.emplace_back(a.entity, b.entity);
+          if (float toi = 1.0f; a.intersects(b, toi)) pairs.push_back({a.entity, b.entity, toi});
         }
       }
     } else {
@@ -349,7 +466,7 @@ class CollisionSystem {
         for (int j = startJ; j < end2; ++j) {
           const Box& b = boxes[static_cast<size_t>(j)];
           if (b.minY > a.maxY) break;
-          if (a.intersects(b)) pairs.emplace_back(a.entity, b.entity);
+          if (float toi = 1.0f; a.intersects(b, toi)) pairs.push_back({a.entity, b.entity, toi});
         }
       }
     }
@@ -357,7 +474,7 @@ class CollisionSystem {
 
   // NOLINTNEXTLINE(misc-no-recursion)
   void FindIntersectionsRecursive(std::vector<Box>& boxes, const int begin, const int end, int dimension,
-                                  const int depth, std::vector<std::pair<Entity, Entity>>& intersectingPairs) {
+                                  const int depth, std::vector<BoxContact>& intersectingPairs) {
     const int count = end - begin;
     if (count <= 1) {
       return;
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "General/PerfUtils.h"
+#include "General/ThreadPool.h"
+
+// One body as the contact solver sees it: an axis-aligned box (rotated colliders use their
+// enclosing AABB), its linear velocity and material. Bodies have no angular state — the engine's
+// RigidBodyComponent is linear-only, so contacts push and slide but never spin.
+struct SolverBody {
+  float cx, cy;  // centre, world space
+  float hx, hy;  // half extents
+  float vx, vy;
+  float invMass;  // 0 = static / infinite mass; never written by the solver
+  float restitution;
+  float friction;
+};
+
+// A candidate pair from the broadphase. `key` must be stable for the pair across steps (it keys
+// the warm-start cache), and pairs must arrive sorted by key — CollisionSystem's sorted pair list
+// already is.
+struct SolverPair {
+  std::uint64_t key;
+  std::uint32_t a;
+  std::uint32_t b;
+};
+
+struct ContactSolverSettings {
+  int velocityIterations = 8;
+  int positionIterations = 3;
+  // Fraction of the penetration beyond the slop removed per position iteration.
+  float positionCorrection = 0.4f;
+  // Penetration (px) left alone so resting contacts stay touching and keep their pair alive.
+  float penetrationSlop = 0.5f;
+  // Closing speeds (px/s) below this don't bounce, so resting stacks don't jitter.
+  float restitutionThreshold = 40.0f;
+};
+
+// Sequential-impulse contact solver over AABB contacts. One Step:
+//   1. contacts: every candidate pair that overlaps and has a dynamic side yields one contact along
+//      the axis of least penetration; impulses from last step's contact with the same key and
+//      normal are carried over (warm start).
+//   2. islands: union-find over dynamic bodies joined by a contact; static bodies never join, so a
+//      floor under two piles leaves two islands.
+//   3. solve: each island runs velocity iterations (normal impulse clamped >= 0, Coulomb friction
+//      clamped to mu * normal impulse) and then a few position-projection passes. Islands share
+//      nothing writable — static bodies are read-only — so they are solved in parallel on the
+//      ThreadPool, and the result is the same as a serial solve.
+class ContactSolver {
+ public:
+  void Step(std::span<SolverBody> bodies, std::span<const SolverPair> pairs,
+            const ContactSolverSettings& settings = {}) {
+    BuildContacts(bodies, pairs, settings);
+    BuildIslands(bodies);
+    {
+      PROFILE_NAMED_SCOPE("Solve Contact Islands");
+      const auto solveRange = [&](const size_t /*batch*/, const size_t begin, const size_t end) {
+        for (size_t island = begin; island < end; ++island) SolveIsland(bodies, island, settings);
+      };
+      if (contacts_.size() < kParallelContactThreshold) {
+        solveRange(0, 0, IslandCount());
+      } else {
+        ThreadPool::ParallelChunks(IslandCount(), solveRange);
+      }
+    }
+    StoreWarmStart();
+  }
+
+  [[nodiscard]] size_t ContactCount() const { return contacts_.size(); }
+  [[nodiscard]] size_t IslandCount() const { return islandOffsets_.empty() ? 0 : islandOffsets_.size() - 1; }
+
+  // Accumulated normal impulse of the contact for `key` after the last Step, or 0 if none.
+  [[nodiscard]] float NormalImpulse(const std::uint64_t key) const {
+    const auto it = std::lower_bound(cache_.begin(), cache_.end(), key,
+                                     [](const CachedImpulse& c, const std::uint64_t k) { return c.key < k; });
+    return it != cache_.end() && it->key == key ? it->normal : 0.0f;
+  }
+
+ private:
+  // Below this many contacts the island pass stays on the calling thread.
+  static constexpr size_t kParallelContactThreshold = 1024;
+
+  struct Contact {
+    std::uint64_t key;
+    std::uint32_t a;
+    std::uint32_t b;
+    float nx, ny;  // unit normal from a to b; always a coordinate axis
+    float normalMass;
+    float tangentMass;
+    float bounceVelocity;  // target separating speed from restitution
+    float friction;
+    float normalImpulse;
+    float tangentImpulse;
+  };
+
+  struct CachedImpulse {
+    std::uint64_t key;
+    float nx, ny;
+    float normal;
+    float tangent;
+  };
+
+  void BuildContacts(std::span<const SolverBody> bodies, std::span<const SolverPair> pairs,
+                     const ContactSolverSettings& settings) {
+    PROFILE_NAMED_SCOPE("Build Contacts");
+    contacts_.clear();
+    size_t cached = 0;
+    for (const SolverPair& pair : pairs) {
+      const SolverBody& a = bodies[pair.a];
+      const SolverBody& b = bodies[pair.b];
+      const float invMassSum = a.invMass + b.invMass;
+      if (invMassSum <= 0.0f) continue;
+      const float dx = b.cx - a.cx;
+      const float dy = b.cy - a.cy;
+      const float overlapX = a.hx + b.hx - std::abs(dx);
+      const float overlapY = a.hy + b.hy - std::abs(dy);
+      if (overlapX <= 0.0f || overlapY <= 0.0f) continue;
+
+      Contact contact{};
+      contact.key = pair.key;
+      contact.a = pair.a;
+      contact.b = pair.b;
+      if (overlapX < overlapY) {
+        contact.nx = dx < 0.0f ? -1.0f : 1.0f;
+      } else {
+        contact.ny = dy < 0.0f ? -1.0f : 1.0f;
+      }
+      contact.normalMass = 1.0f / invMassSum;
+      contact.tangentMass = contact.normalMass;
+      contact.friction = std::sqrt(a.friction * b.friction);
+      const float closing = (b.vx - a.vx) * contact.nx + (b.vy - a.vy) * contact.ny;
+      const float restitution = std::max(a.restitution, b.restitution);
+      contact.bounceVelocity = closing < -settings.restitutionThreshold ? -restitution * closing : 0.0f;
+
+      // Pairs and cache are both sorted by key, so the warm-start lookup is a forward walk.
+      while (cached < cache_.size() && cache_[cached].key < pair.key) ++cached;
+      if (cached < cache_.size() && cache_[cached].key == pair.key && cache_[cached].nx == contact.nx &&
+          cache_[cached].ny == contact.ny) {
+        contact.normalImpulse = cache_[cached].normal;
+        contact.tangentImpulse = cache_[cached].tangent;
+      }
+      contacts_.push_back(contact);
+    }
+  }
+
+  void BuildIslands(std::span<const SolverBody> bodies) {
+    PROFILE_NAMED_SCOPE("Build Islands");
+    parent_.resize(bodies.size());
+    std::iota(parent_.begin(), parent_.end(), 0u);
+    for (const Contact& contact : contacts_) {
+      if (bodies[contact.a].invMass > 0.0f && bodies[contact.b].invMass > 0.0f) Union(contact.a, contact.b);
+    }
+
+    // Number the islands in first-contact order, then counting-sort contacts by island.
+    islandOf_.assign(bodies.size(), kNoIsland);
+    contactIsland_.resize(contacts_.size());
+    std::uint32_t islandCount = 0;
+    for (size_t i = 0; i < contacts_.size(); ++i) {
+      const Contact& contact = contacts_[i];
+      const std::uint32_t root = Find(bodies[contact.a].invMass > 0.0f ? contact.a : contact.b);
+      if (islandOf_[root] == kNoIsland) islandOf_[root] = islandCount++;
+      contactIsland_[i] = islandOf_[root];
+    }
+    islandOffsets_.assign(islandCount + 1, 0);
+    for (const std::uint32_t island : contactIsland_) ++islandOffsets_[island + 1];
+    std::partial_sum(islandOffsets_.begin(), islandOffsets_.end(), islandOffsets_.begin());
+    islandContacts_.resize(contacts_.size());
+    cursor_.assign(islandOffsets_.begin(), islandOffsets_.end() - 1);
+    for (size_t i = 0; i < contacts_.size(); ++i) {
+      islandContacts_[cursor_[contactIsland_[i]]++] = static_cast<std::uint32_t>(i);
+    }
+  }
+
+  [[nodiscard]] std::uint32_t Find(std::uint32_t body) {
+    while (parent_[body] != body) {
+      parent_[body] = parent_[parent_[body]];
+      body = parent_[body];
+    }
+    return body;
+  }
+
+  void Union(const std::uint32_t a, const std::uint32_t b) {
+    const std::uint32_t rootA = Find(a);
+    const std::uint32_t rootB = Find(b);
+    if (rootA != rootB) parent_[std::max(rootA, rootB)] = std::min(rootA, rootB);
+  }
+
+  static void ApplyImpulse(SolverBody& a, SolverBody& b, const float px, const float py) {
+    if (a.invMass > 0.0f) {
+      a.vx -= px * a.invMass;
+      a.vy -= py * a.invMass;
+    }
+    if (b.invMass > 0.0f) {
+      b.vx += px * b.invMass;
+      b.vy += py * b.invMass;
+    }
+  }
+
+  void SolveIsland(std::span<SolverBody> bodies, const size_t island, const ContactSolverSettings& settings) {
+    const std::span<const std::uint32_t> indices(islandContacts_.data() + islandOffsets_[island],
+                                                 islandOffsets_[island + 1] - islandOffsets_[island]);
+
+    // Warm start: re-apply last step's impulses so stacks start near their converged state.
+    for (const std::uint32_t index : indices) {
+      const Contact& c = contacts_[index];
+      const float tx = -c.ny;
+      const float ty = c.nx;
+      ApplyImpulse(bodies[c.a], bodies[c.b], c.nx * c.normalImpulse + tx * c.tangentImpulse,
+                   c.ny * c.normalImpulse + ty * c.tangentImpulse);
+    }
+
+    for (int iteration = 0; iteration < settings.velocityIterations; ++iteration) {
+      for (const std::uint32_t index : indices) {
+        Contact& c = contacts_[index];
+        SolverBody& a = bodies[c.a];
+        SolverBody& b = bodies[c.b];
+        const float tx = -c.ny;
+        const float ty = c.nx;
+
+        // Friction first, bounded by the current normal impulse.
+        const float vt = (b.vx - a.vx) * tx + (b.vy - a.vy) * ty;
+        const float maxFriction = c.friction * c.normalImpulse;
+        const float newTangent = std::clamp(c.tangentImpulse - vt * c.tangentMass, -maxFriction, maxFriction);
+        const float tangentDelta = newTangent - c.tangentImpulse;
+        c.tangentImpulse = newTangent;
+        ApplyImpulse(a, b, tx * tangentDelta, ty * tangentDelta);
+
+        const float vn = (b.vx - a.vx) * c.nx + (b.vy - a.vy) * c.ny;
+        const float newNormal = std::max(c.normalImpulse - (vn - c.bounceVelocity) * c.normalMass, 0.0f);
+        const float normalDelta = newNormal - c.normalImpulse;
+        c.normalImpulse = newNormal;
+        ApplyImpulse(a, b, c.nx * normalDelta, c.ny * normalDelta);
+      }
+    }
+
+    // Position projection: push overlapping bodies apart along the contact normal, re-measuring
+    // the penetration each pass so corrections made earlier in the island are accounted for.
+    for (int iteration = 0; iteration < settings.positionIterations; ++iteration) {
+      for (const std::uint32_t index : indices) {
+        const Contact& c = contacts_[index];
+        SolverBody& a = bodies[c.a];
+        SolverBody& b = bodies[c.b];
+        const float separation = (b.cx - a.cx) * c.nx + (b.cy - a.cy) * c.ny;
+        const float reach = c.nx != 0.0f ? a.hx + b.hx : a.hy + b.hy;
+        const float penetration = reach - separation;
+        if (penetration <= settings.penetrationSlop) continue;
+        const float correction = (penetration - settings.penetrationSlop) * settings.positionCorrection * c.normalMass;
+        if (a.invMass > 0.0f) {
+          a.cx -= c.nx * correction * a.invMass;
+          a.cy -= c.ny * correction * a.invMass;
+        }
+        if (b.invMass > 0.0f) {
+          b.cx += c.nx * correction * b.invMass;
+          b.cy += c.ny * correction * b.invMass;
+        }
+      }
+    }
+  }
+
+  // Keep this step's accumulated impulses, sorted by key like the incoming pairs.
+  void StoreWarmStart() {
+    cache_.clear();
+    cache_.reserve(contacts_.size());
+    for (const Contact& c : contacts_) cache_.push_back({c.key, c.nx, c.ny, c.normalImpulse, c.tangentImpulse});
+  }
+
+  static constexpr std::uint32_t kNoIsland = UINT32_MAX;
+
+  std::vector<Contact> contacts_;
+  std::vector<CachedImpulse> cache_;
+  // Island scratch, reused across steps.
+  std::vector<std::uint32_t> parent_;
+  std::vector<std::uint32_t> islandOf_;
+  std::vector<std::uint32_t> contactIsland_;
+  std::vector<std::uint32_t> islandOffsets_;
+  std::vector<std::uint32_t> islandContacts_;
+  std::vector<std::uint32_t> cursor_;
+};
@@ -1,15 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <utility>
-#include <vector>
 
 #include "Components/HealthComponent.h"
 #include "Components/ProjectileComponent.h"
 #include "ECS/Iterable.h"
 #include "EventBus/EventBus.h"
 #include "Events/CollisionBatchEvent.h"
-#include "General/Constants.h"
-#include "Systems/CollisionResponseParallel.h"
+#include "Systems/CollisionRouting.h"
 
 class DamageSystem {
  public:
@@ -18,26 +17,22 @@ class DamageSystem {
     projectiles_ = registry_->Tag<ProjectileTag>();
     enemies_ = registry_->TagId("enemies");
     player_ = registry_->TagId("player");
+    router_ = &CollisionRouter::Instance(*registry_);
+    router_->DefineRole(kRoleDamageDealer, projectiles_);
+    router_->DefineRole(kRoleDamageable, enemies_);
+    router_->DefineRole(kRoleDamageable, player_);
     subscription_ = eventBus->SubscribeEvent<DamageSystem, CollisionBatchEvent>(this, &DamageSystem::OnCollisionBatch);
   }
 
-  // Process the whole frame's collision pairs (W2.3), parallelising the per-pair tag classification
-  // above a density threshold (parallel collision response). The classify step does registry reads
-  // only (safe to run across worker threads — the registry is structurally stable during the
-  // response); the damage/despawn mutations run serially in apply(). See CollisionResponseParallel.h.
+  // Process the whole frame's collision pairs (W2.3). Classification is done by CollisionRouter
+  // (per-archetype role masks, parallel above a density threshold); only the (projectile, target)
+  // bucket reaches this system, and the damage/despawn mutations run serially here. Damage
+  // subtraction commutes and QueueDespawnEntity dedups, so bucket order doesn't change the outcome.
   void OnCollisionBatch(const CollisionBatchEvent& event) {
-    using Hit = std::pair<Entity, Entity>;  // (projectile, target)
-    RunCollisionResponse<Hit>(
-        event.pairs, Constants::kCollisionResponseParallelThreshold,
-        [this](const Entity a, const Entity b, std::vector<Hit>& sink) {
-          if (registry_->HasTag(a, projectiles_) && (registry_->HasTag(b, player_) || registry_->HasTag(b, enemies_))) {
-            sink.emplace_back(a, b);
-          }
-          if (registry_->HasTag(b, projectiles_) && (registry_->HasTag(a, player_) || registry_->HasTag(a, enemies_))) {
-            sink.emplace_back(b, a);
-          }
-        },
-        [this](const Hit& hit) { OnProjectileHit(hit.first, hit.second); });
+    const CollisionRoutes& routes = event.routes ? *event.routes : router_->Route(*registry_, event.entering);
+    for (const auto& [projectile, target] : routes.damage) {
+      OnProjectileHit(projectile, target);
+    }
   }
 
   void OnProjectileHit(const Entity projectile, const Entity target) const {
@@ -59,6 +54,7 @@ class DamageSystem {
 
  private:
   Registry* registry_ = nullptr;
+  CollisionRouter* router_ = nullptr;
   Entity projectiles_{};
   Entity enemies_{};
   Entity player_{};
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <memory>
-#include <vector>
 
 #include "Components/RigidBodyComponent.h"
 #include "Components/SpriteComponent.h"
@@ -9,9 +8,8 @@
 #include "ECS/Registry.h"
 #include "EventBus/EventBus.h"
 #include "Events/CollisionBatchEvent.h"
-#include "General/Constants.h"
 #include "General/SpriteFlip.h"
-#include "Systems/CollisionResponseParallel.h"
+#include "Systems/CollisionRouting.h"
 
 class ObstacleBounceSystem {
  public:
@@ -19,28 +17,22 @@ class ObstacleBounceSystem {
     registry_ = registry;
     enemies_ = registry_->TagId("enemies");
     obstacles_ = registry_->TagId("obstacles");
+    router_ = &CollisionRouter::Instance(*registry_);
+    router_->DefineRole(kRoleBouncer, enemies_);
+    router_->DefineRole(kRoleObstacle, obstacles_);
     subscription_ = eventBus->SubscribeEvent<ObstacleBounceSystem, CollisionBatchEvent>(
         this, &ObstacleBounceSystem::OnCollisionBatch);
   }
 
-  // Process the whole frame's collision pairs (W2.3), parallelising the per-pair tag classification
-  // above a density threshold. classify does registry reads only; the velocity/sprite flips run
-  // serially in apply(). See CollisionResponseParallel.h.
+  // Process the whole frame's collision pairs (W2.3). CollisionRouter has already picked out the
+  // enemy/obstacle contacts; the velocity/sprite flips run serially here. The bounce bucket keeps
+  // EVERY occurrence: OnObstacleCollision flips velocity each call, so an enemy overlapping two
+  // obstacles must flip twice (net no-op).
   void OnCollisionBatch(const CollisionBatchEvent& event) {
-    RunCollisionResponse<Entity>(
-        event.pairs, Constants::kCollisionResponseParallelThreshold,
-        // Record EVERY bounce occurrence — do NOT dedup. OnObstacleCollision flips velocity each
-        // call, so an enemy overlapping two obstacles must flip twice (net no-op) to match the
-        // serial behaviour; deduping here would silently change the outcome.
-        [this](const Entity a, const Entity b, std::vector<Entity>& sink) {
-          if (registry_->HasTag(a, enemies_) && registry_->HasTag(b, obstacles_)) {
-            sink.push_back(a);
-          }
-          if (registry_->HasTag(b, enemies_) && registry_->HasTag(a, obstacles_)) {
-            sink.push_back(b);
-          }
-        },
-        [this](const Entity enemy) { OnObstacleCollision(enemy); });
+    const CollisionRoutes& routes = event.routes ? *event.routes : router_->Route(*registry_, event.entering);
+    for (const Entity enemy : routes.bounce) {
+      OnObstacleCollision(enemy);
+    }
   }
 
  private:
@@ -56,6 +48,7 @@ class ObstacleBounceSystem {
   }
 
   Registry* registry_ = nullptr;
+  CollisionRouter* router_ = nullptr;
   Entity enemies_{};
   Entity obstacles_{};
   EventBus::SubscriptionHandle subscription_;
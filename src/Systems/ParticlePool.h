@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Components/ParticleEmitterComponent.h"
+#include "ECS/Entity.h"
+#include "General/ThreadPool.h"
+
+// Position + color + texture coordinates, laid out so the three can be handed to
+// SDL_RenderGeometryRaw as strided float / SDL_FColor / float arrays.
+struct ParticleVertex {
+  float x = 0.0F;
+  float y = 0.0F;
+  float r = 0.0F;
+  float g = 0.0F;
+  float b = 0.0F;
+  float a = 0.0F;
+  float u = 0.0F;
+  float v = 0.0F;
+};
+
+// An emitter's curves baked into fixed-size tables once per update, so the per-particle kernels
+// index an array by normalized age instead of searching keys.
+struct ParticleLut {
+  static constexpr std::size_t kSize = 64;
+  static constexpr float kLast = static_cast<float>(kSize - 1);
+
+  std::array<float, kSize> size{};
+  std::array<float, kSize> velocity{};
+  std::array<float, kSize> r{};  // color channels, normalized
+  std::array<float, kSize> g{};
+  std::array<float, kSize> b{};
+  std::array<float, kSize> a{};
+
+  [[nodiscard]] static std::size_t Index(const float t) {
+    return static_cast<std::size_t>(std::clamp(t, 0.0F, 1.0F) * kLast + 0.5F);
+  }
+
+  void Bake(const ParticleEmitterComponent& emitter) {
+    constexpr float kInv255 = 1.0F / 255.0F;
+    const auto& keys = emitter.color.keys;
+    for (std::size_t i = 0; i < kSize; ++i) {
+      const float t = static_cast<float>(i) / kLast;
+      size[i] = emitter.size.Sample(t);
+      velocity[i] = emitter.velocity.Sample(t);
+      if (keys.empty()) {
+        r[i] = g[i] = b[i] = a[i] = 1.0F;
+        continue;
+      }
+      // Same segment walk as ParticleCurve::Sample, on all four channels at once.
+      std::size_t next = 0;
+      while (next < keys.size() && keys[next].t < t) ++next;
+      const auto& from = keys[next == 0 ? 0 : next - 1].color;
+      const auto& to = keys[std::min(next, keys.size() - 1)].color;
+      float w = 0.0F;
+      if (next > 0 && next < keys.size() && keys[next].t > keys[next - 1].t) {
+        w = (t - keys[next - 1].t) / (keys[next].t - keys[next - 1].t);
+      }
+      r[i] = (from.r + (to.r - from.r) * w) * kInv255;
+      g[i] = (from.g + (to.g - from.g) * w) * kInv255;
+      b[i] = (from.b + (to.b - from.b) * w) * kInv255;
+      a[i] = (from.a + (to.a - from.a) * w) * kInv255;
+    }
+  }
+};
+
+// One emitter's live particles as structure-of-arrays: a field per vector, index i across them is
+// particle i. Survivors keep spawn order (Compact is stable), so overlapping particles don't
+// reorder between frames. The kernels (Integrate, BuildQuads) walk plain float arrays with no
+// branches the compiler can't turn into selects, and take a [begin, end) range so the caller can
+// split a big emitter across the ThreadPool; Emit and Compact are serial.
+class ParticlePool {
+ public:
+  static constexpr float kMinLifetime = 0.001F;
+
+  [[nodiscard]] std::size_t Size() const { return x_.size(); }
+
+  void Seed(const std::uint32_t seed) { rng_ = seed == 0 ? 1u : seed; }
+
+  void Clear() {
+    for (auto* field : Fields()) field->clear();
+  }
+
+  // Append `count` particles at (originX, originY) drawn from the emitter's ranges.
+  void Emit(const ParticleEmitterComponent& emitter, const float originX, const float originY, const int count) {
+    if (count <= 0) return;
+    constexpr float kDegToRad = 0.0174532925F;
+    constexpr float kTwoPi = 6.28318530718F;
+    const float direction = emitter.direction * kDegToRad;
+    const float halfSpread = emitter.spread * 0.5F * kDegToRad;
+    for (int n = 0; n < count; ++n) {
+      const float angle = direction + Signed() * halfSpread;
+      const float speed = emitter.speed + Signed() * emitter.speedVariance;
+      const float life = std::max(emitter.lifetime + Signed() * emitter.lifetimeVariance, kMinLifetime);
+      float x = originX;
+      float y = originY;
+      if (emitter.spawnRadius > 0.0F) {
+        const float radius = emitter.spawnRadius * std::sqrt(Unit());
+        const float at = Unit() * kTwoPi;
+        x += radius * std::cos(at);
+        y += radius * std::sin(at);
+      }
+      x_.push_back(x);
+      y_.push_back(y);
+      vx_.push_back(speed * std::cos(angle));
+      vy_.push_back(speed * std::sin(angle));
+      age_.push_back(0.0F);
+      inv_life_.push_back(1.0F / life);
+    }
+  }
+
+  // Age particles [begin, end) by dt and move them: gravity accelerates the velocity, the velocity
+  // curve scales how much of it applies at each age. Disjoint ranges may run concurrently.
+  void Integrate(const std::size_t begin, const std::size_t end, const float dt, const float gravityX,
+                 const float gravityY, const ParticleLut& lut) {
+    float* x = x_.data();
+    float* y = y_.data();
+    float* vx = vx_.data();
+    float* vy = vy_.data();
+    float* age = age_.data();
+    const float* invLife = inv_life_.data();
+    const float* velocityCurve = lut.velocity.data();
+    for (std::size_t i = begin; i < end; ++i) {
+      age[i] += dt;
+      const float scale = velocityCurve[ParticleLut::Index(age[i] * invLife[i])] * dt;
+      vx[i] += gravityX * dt;
+      vy[i] += gravityY * dt;
+      x[i] += vx[i] * scale;
+      y[i] += vy[i] * scale;
+    }
+  }
+
+  // Drop particles that have outlived their lifetime, keeping the rest in order. Returns how many died.
+  std::size_t Compact() {
+    const std::size_t count = Size();
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      if (age_[i] * inv_life_[i] >= 1.0F) continue;
+      if (kept != i) {
+        for (auto* field : Fields()) (*field)[kept] = (*field)[i];
+      }
+      ++kept;
+    }
+    for (auto* field : Fields()) field->resize(kept);
+    return count - kept;
+  }
+
+  // Four vertices per particle for [begin, end) into out[4 * begin ...]: a `size`-curve square
+  // centred on the particle, shifted by (offsetX, offsetY), tinted by the color curve and mapped
+  // to the texture rect (u0, v0)-(u1, v1). Disjoint ranges may run concurrently.
+  void BuildQuads(const std::size_t begin, const std::size_t end, const ParticleLut& lut, const float offsetX,
+                  const float offsetY, const std::array<float, 4>& uv, ParticleVertex* out) const {
+    const auto [u0, v0, u1, v1] = uv;
+    for (std::size_t i = begin; i < end; ++i) {
+      const std::size_t at = ParticleLut::Index(age_[i] * inv_life_[i]);
+      const float half = lut.size[at] * 0.5F;
+      const float cx = x_[i] + offsetX;
+      const float cy = y_[i] + offsetY;
+      const float r = lut.r[at];
+      const float g = lut.g[at];
+      const float b = lut.b[at];
+      const float a = lut.a[at];
+      ParticleVertex* quad = out + i * 4;
+      quad[0] = {cx - half, cy - half, r, g, b, a, u0, v0};
+      quad[1] = {cx + half, cy - half, r, g, b, a, u1, v0};
+      quad[2] = {cx + half, cy + half, r, g, b, a, u1, v1};
+      quad[3] = {cx - half, cy + half, r, g, b, a, u0, v1};
+    }
+  }
+
+  [[nodiscard]] float X(const std::size_t i) const { return x_[i]; }
+  [[nodiscard]] float Y(const std::size_t i) const { return y_[i]; }
+  [[nodiscard]] float Age(const std::size_t i) const { return age_[i]; }
+
+ private:
+  std::array<std::vector<float>*, 6> Fields() { return {&x_, &y_, &vx_, &vy_, &age_, &inv_life_}; }
+
+  // xorshift32: cheap, deterministic per emitter, and good enough for scattering sparks.
+  float Unit() {
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 17;
+    rng_ ^= rng_ << 5;
+    return static_cast<float>(rng_ >> 8) * (1.0F / 16777216.0F);
+  }
+  float Signed() { return Unit() * 2.0F - 1.0F; }
+
+  std::vector<float> x_;
+  std::vector<float> y_;
+  std::vector<float> vx_;
+  std::vector<float> vy_;
+  std::vector<float> age_;
+  std::vector<float> inv_life_;
+  std::uint32_t rng_ = 0x9E3779B9u;
+};
+
+// Registry singleton holding every emitter's particles, keyed by the emitter entity (generation
+// included, so a recycled id starts empty). ParticleSystem steps and draws them; the Lua
+// `particles` table reads counts and clears. An emitter not touched by an update — its entity
+// destroyed or the component removed — is dropped by the Sweep at the end of that update.
+class ParticleStore {
+ public:
+  // Emitters at or above this many particles split their kernels across the ThreadPool.
+  static constexpr std::size_t kParallelThreshold = 8192;
+
+  struct Emitter {
+    ParticlePool pool;
+    ParticleLut lut;
+    std::vector<ParticleVertex> vertices;
+    float spawnCarry = 0.0F;  // fractional particles owed by the rate
+    std::uint64_t frame = 0;
+
+    // One update: age and move the live particles, drop the expired ones, then spawn this frame's
+    // share of the rate plus `burst`, up to maxParticles. New particles are drawn at birth.
+    void Step(const ParticleEmitterComponent& config, const float originX, const float originY, const float dt,
+              const int burst) {
+      lut.Bake(config);
+      ForRange(pool.Size(), [&](const std::size_t begin, const std::size_t end) {
+        pool.Integrate(begin, end, dt, config.gravity.x, config.gravity.y, lut);
+      });
+      pool.Compact();
+
+      int spawn = burst;
+      if (config.emitting && config.rate > 0.0F) {
+        spawnCarry += config.rate * dt;
+        const float whole = std::floor(spawnCarry);
+        spawnCarry -= whole;
+        spawn += static_cast<int>(whole);
+      } else {
+        spawnCarry = 0.0F;
+      }
+      const int room = std::max(config.maxParticles, 0) - static_cast<int>(pool.Size());
+      pool.Emit(config, originX, originY, std::min(spawn, room));
+    }
+
+    // Rebuild `vertices` for the live particles; see ParticlePool::BuildQuads.
+    void Build(const float offsetX, const float offsetY, const std::array<float, 4>& uv) {
+      vertices.resize(pool.Size() * 4);
+      ForRange(pool.Size(), [&](const std::size_t begin, const std::size_t end) {
+        pool.BuildQuads(begin, end, lut, offsetX, offsetY, uv, vertices.data());
+      });
+    }
+  };
+
+  // The entity's emitter state, created empty on first use and stamped as live for this update.
+  Emitter& Acquire(const Entity entity) {
+    auto [it, inserted] = emitters_.try_emplace(static_cast<EntityID>(entity));
+    if (inserted) it->second.pool.Seed(static_cast<std::uint32_t>(entity.id * 2654435761u));
+    it->second.frame = frame_;
+    return it->second;
+  }
+
+  [[nodiscard]] Emitter* Find(const Entity entity) {
+    const auto it = emitters_.find(static_cast<EntityID>(entity));
+    return it == emitters_.end() ? nullptr : &it->second;
+  }
+
+  [[nodiscard]] std::size_t Count(const Entity entity) const {
+    const auto it = emitters_.find(static_cast<EntityID>(entity));
+    return it == emitters_.end() ? 0 : it->second.pool.Size();
+  }
+
+  [[nodiscard]] std::size_t EmitterCount() const { return emitters_.size(); }
+
+  [[nodiscard]] std::size_t TotalParticles() const {
+    std::size_t total = 0;
+    for (const auto& [id, emitter] : emitters_) total += emitter.pool.Size();
+    return total;
+  }
+
+  // Drop the emitters no Acquire touched since the last Sweep, and start the next update.
+  void Sweep() {
+    std::erase_if(emitters_, [this](const auto& entry) { return entry.second.frame != frame_; });
+    ++frame_;
+  }
+
+  // Shared triangle-list indices for `quads` quads (0-1-2, 0-2-3 per quad). Grows, never shrinks;
+  // the returned data is stable until a call asking for more quads than any before.
+  const std::vector<std::uint32_t>& QuadIndices(const std::size_t quads) {
+    const std::size_t have = quad_indices_.size() / 6;
+    for (std::size_t q = have; q < quads; ++q) {
+      const auto base = static_cast<std::uint32_t>(q * 4);
+      quad_indices_.insert(quad_indices_.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+    return quad_indices_;
+  }
+
+  void Clear() { emitters_.clear(); }
+
+ private:
+  template <typename Fn>
+  static void ForRange(const std::size_t count, Fn&& fn) {
+    if (count < kParallelThreshold) {
+      fn(std::size_t{0}, count);
+      return;
+    }
+    ThreadPool::ParallelChunks(count, [&fn](const std::size_t /*batch*/, const std::size_t begin,
+                                            const std::size_t end) { fn(begin, end); });
+  }
+
+  std::unordered_map<EntityID, Emitter> emitters_;
+  std::vector<std::uint32_t> quad_indices_;
+  std::uint64_t frame_ = 1;
+};
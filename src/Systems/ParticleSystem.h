@@ -0,0 +1,99 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "AssetManager/AssetManager.h"
+#include "Components/CameraComponents.h"
+#include "Components/GlobalTransformComponent.h"
+#include "Components/ParticleEmitterComponent.h"
+#include "ECS/Entity.h"
+#include "ECS/Iterable.h"
+#include "ECS/Query.h"
+#include "ECS/Registry.h"
+#include "General/PerfUtils.h"
+#include "General/Rect.h"
+#include "Renderer/RenderCommands.h"
+#include "Renderer/RenderQueue.h"
+#include "Systems/ParticlePool.h"
+
+// Steps every ParticleEmitterComponent's particles (ParticleStore) and queues each emitter as one
+// GeometryCommand: the emitter's live particles as a single triangle list, sorted on the emitter's
+// layer at its global y. Two passes over the emitters — step all, then draw all — so the shared
+// quad index buffer is grown once, before any command points into it. Serial as a system; an
+// emitter big enough to pay for it splits its kernels across the ThreadPool (ParticleStore).
+class ParticleSystem {
+ public:
+  void operator()(const ContextFacade& ctx, const Iterable& /*iter*/) {
+    Registry* registry = ctx.GetRegistry();
+    auto* store = registry->TryGet<ParticleStore>();
+    if (store == nullptr) return;
+    if (!query_) query_ = registry->CreateQuery<ParticleEmitterComponent, GlobalTransformComponent>();
+    query_->Update();
+
+    const float dt = ctx.GetDeltaTime();
+    std::size_t largest = 0;
+    query_->ForEach([&](const Entity entity, ParticleEmitterComponent& emitter,
+                        const GlobalTransformComponent& transform) {
+      ParticleStore::Emitter& state = store->Acquire(entity);
+      state.Step(emitter, transform.position.x, transform.position.y, dt, emitter.pendingBurst);
+      emitter.pendingBurst = 0;
+      largest = std::max(largest, state.pool.Size());
+    });
+    store->Sweep();
+    if (largest == 0) return;
+
+    const auto& assetManager = registry->Get<AssetManager>();
+    const octarine::Rect camera = registry->Get<CameraComponent>().viewport;
+    auto& renderQueue = registry->Get<RenderQueue>();
+    const std::vector<std::uint32_t>& indices = store->QuadIndices(largest);
+
+    [[maybe_unused]] long long drawn = 0;
+    query_->ForEach([&](const Entity entity, const ParticleEmitterComponent& emitter,
+                        const GlobalTransformComponent& transform) {
+      ParticleStore::Emitter* state = store->Find(entity);
+      if (state == nullptr || state->pool.Size() == 0) return;
+      SDL_Texture* texture = nullptr;
+      std::array<float, 4> uv{0.0F, 0.0F, 1.0F, 1.0F};
+      if (!emitter.assetId.empty()) {
+        texture = assetManager.GetTexture(emitter.assetId);
+        if (texture == nullptr) return;
+        if (const auto slice = assetManager.GetAtlasSlice(emitter.assetId)) {
+          float w = 0.0F;
+          float h = 0.0F;
+          SDL_GetTextureSize(texture, &w, &h);
+          if (w > 0.0F && h > 0.0F) {
+            uv = {slice->x / w, slice->y / h, (slice->x + slice->w) / w, (slice->y + slice->h) / h};
+          }
+        }
+      }
+      state->Build(-camera.x, -camera.y, uv);
+
+      static_assert(sizeof(ParticleVertex) == 8 * sizeof(float), "ParticleVertex must stay xy + SDL_FColor + uv");
+      const ParticleVertex* vertices = state->vertices.data();
+      GeometryCommand& cmd = renderQueue.EmplaceGeometry(static_cast<unsigned int>(emitter.layer),
+                                                         transform.position.y, texture, emitter.blendMode);
+      cmd.positions = &vertices->x;
+      cmd.colors = reinterpret_cast<const SDL_FColor*>(&vertices->r);
+      cmd.uvs = &vertices->u;
+      cmd.stride = static_cast<int>(sizeof(ParticleVertex));
+      cmd.vertexCount = static_cast<int>(state->vertices.size());
+      cmd.indices = indices.data();
+      cmd.indexCount = static_cast<int>(state->pool.Size() * 6);
+      cmd.texture = texture;
+      cmd.blendMode = octarine::ToSdlBlendMode(emitter.blendMode);
+      drawn += static_cast<long long>(state->pool.Size());
+    });
+    PROFILE_COUNTER_SET("Particles: Emitters", static_cast<long long>(store->EmitterCount()));
+    PROFILE_COUNTER_SET("Particles: Drawn", drawn);
+  }
+
+ private:
+  std::unique_ptr<ComponentQuery<ParticleEmitterComponent, GlobalTransformComponent>> query_;
+};
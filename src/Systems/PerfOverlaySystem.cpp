@@ -16,6 +16,9 @@
 #include "General/PerfUtils.h"
 #include "General/SystemMemory.h"
 #include "General/Utils.h"
+#include "Renderer/RenderStats.h"
+#include "Renderer/TextTextureCache.h"
+#include "Renderer/UICanvasCache.h"
 
 namespace {
 // Reserved catalog id for the overlay's embedded font. Underscore-prefixed so it can't collide with
@@ -79,8 +82,14 @@ Vec2 BlockOrigin(const PerfOverlayCorner corner, SDL_Renderer* sdlRenderer, cons
   if (!SDL_GetCurrentRenderOutputSize(sdlRenderer, &outW, &outH) || outW <= 0 || outH <= 0) {
     return {kMargin, kMargin};
   }
-  const float rightX = static_cast<float>(outW) - kMargin - blockW;
-  const float bottomY = static_cast<float>(outH) - kMargin - blockH;
+  // Draw coordinates are logical; under a dynamic-resolution render scale the target is smaller.
+  float scaleX = 1.0F;
+  float scaleY = 1.0F;
+  if (!SDL_GetRenderScale(sdlRenderer, &scaleX, &scaleY) || scaleX <= 0.0F || scaleY <= 0.0F) {
+    scaleX = scaleY = 1.0F;
+  }
+  const float rightX = static_cast<float>(outW) / scaleX - kMargin - blockW;
+  const float bottomY = static_cast<float>(outH) / scaleY - kMargin - blockH;
   switch (corner) {
     case PerfOverlayCorner::TopRight:
       return {rightX, kMargin};
@@ -195,6 +204,46 @@ bool PerfOverlaySystem::AppendWorldRows(TTF_Font* font, SDL_Renderer* sdlRendere
     std::snprintf(buf, sizeof(buf), "%.1f MB", static_cast<double>(resident_bytes_) / kBytesPerMb);
     if (!UpdateRow(kSlotMemory, font, sdlRenderer, "MEMORY", buf)) return false;
     active[count++] = {kSlotMemory, kSectionWorld, kNeutral};
+    // Only once some canvas has opted in, so projects without cached UI keep the row count.
+    if (const auto* canvases = registry.TryGet<UICanvasCache>(); canvases != nullptr) {
+      if (const UICanvasCache::Stats stats = canvases->GetStats(); stats.canvases > 0) {
+        std::snprintf(buf, sizeof(buf), "%.1f MB (%zu)", static_cast<double>(stats.bytes) / kBytesPerMb,
+                      stats.canvases);
+        if (!UpdateRow(kSlotUICanvas, font, sdlRenderer, "UI CACHE", buf)) return false;
+        active[count++] = {kSlotUICanvas, kSectionWorld, kNeutral};
+      }
+    }
+  }
+  const auto* textures = registry.TryGet<TextTextureCache>();
+  if (HasFlag(options.perfOverlayMetrics, PerfOverlayMetrics::Text) && textures != nullptr) {
+    const TextTextureCache::Stats stats = textures->GetStats();
+    std::snprintf(buf, sizeof(buf), "%llu/%llu/%llu", static_cast<unsigned long long>(stats.hits),
+                  static_cast<unsigned long long>(stats.misses), static_cast<unsigned long long>(stats.evictions));
+    if (!UpdateRow(kSlotTextCache, font, sdlRenderer, "TEXT H/M/E", buf)) return false;
+    active[count++] = {kSlotTextCache, kSectionWorld, kNeutral};
+    std::snprintf(buf, sizeof(buf), "%.1f MB (%zu)", static_cast<double>(stats.bytes) / kBytesPerMb, stats.entries);
+    if (!UpdateRow(kSlotTextMemory, font, sdlRenderer, "TEXT MEM", buf)) return false;
+    active[count++] = {kSlotTextMemory, kSectionWorld, kNeutral};
+  }
+  return true;
+}
+
+bool PerfOverlaySystem::AppendRenderRows(TTF_Font* font, SDL_Renderer* sdlRenderer, Registry& registry,
+                                         std::array<ActiveRow, kRowCount>& active, std::size_t& count) {
+  const auto* history = registry.TryGet<RenderStatsHistory>();
+  if (history == nullptr || history->Size() == 0) return true;
+  const RenderStats& stats = history->Recent(0);
+  std::array<std::array<char, kTextBufSize>, 5> values{};
+  std::snprintf(values[0].data(), kTextBufSize, "%u (%u runs)", stats.drawCalls, stats.spriteRuns);
+  std::snprintf(values[1].data(), kTextBufSize, "%u tex / %u blend", stats.textureSwitches, stats.blendChanges);
+  std::snprintf(values[2].data(), kTextBufSize, "%u / %u", stats.culled, stats.cullTested);
+  std::snprintf(values[3].data(), kTextBufSize, "%u", stats.commands);
+  std::snprintf(values[4].data(), kTextBufSize, "%.2f / %.2f ms", static_cast<double>(stats.sortMs),
+                static_cast<double>(stats.drawMs));
+  constexpr std::array<const char*, 5> kLabels{"DRAWS", "SWITCH", "CULLED", "QUEUE", "SORT/DRAW"};
+  for (std::size_t i = 0; i < kLabels.size(); ++i) {
+    if (!UpdateRow(kSlotRenderBase + i, font, sdlRenderer, kLabels[i], values[i].data())) return false;
+    active[count++] = {kSlotRenderBase + i, kSectionRender, kNeutral};
   }
   return true;
 }
@@ -233,6 +282,9 @@ void PerfOverlaySystem::Draw(Registry& registry, SDL_Renderer* sdlRenderer, cons
       !AppendFrameRows(font, sdlRenderer, frameMs, active, count))
     return;
   if (!AppendWorldRows(font, sdlRenderer, registry, options, deltaTime, active, count)) return;
+  if (HasFlag(options.perfOverlayMetrics, PerfOverlayMetrics::Render) &&
+      !AppendRenderRows(font, sdlRenderer, registry, active, count))
+    return;
   if (count == 0) return;
 
   // Measure: the block is two columns (widest label + widest value), rows stacked with a hairline
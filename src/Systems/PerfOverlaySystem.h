@@ -13,9 +13,9 @@ class Registry;
 class AssetManager;
 struct EngineOptions;
 
-// Draws a lightweight perf overlay (FPS, frame time, world stats) through the engine's own SDL
-// renderer (no ImGui), so packaged/shipped builds (ImGui compiled out) can still surface basic perf
-// metrics on screen. Owned by FrameLoop; keeps a tiny per-row text-texture cache across frames
+// Draws a lightweight perf overlay (FPS, frame time, world and render stats) through the engine's
+// own SDL renderer (no ImGui), so packaged/shipped builds (ImGui compiled out) can still surface
+// basic perf metrics on screen. Owned by FrameLoop; keeps a tiny per-row text-texture cache across frames
 // (re-rasterized only when the rendered string changes) and frees those textures on destruction.
 // Rows are laid out as two columns — dim label on the left, threshold-colored value right-aligned —
 // grouped into sections separated by hairlines. Colors are applied via SDL_SetTextureColorMod at
@@ -67,11 +67,16 @@ class PerfOverlaySystem {
   static constexpr std::size_t kSlotFrameBase = 5;  // FRAME / AVG / P95 (ms)
   static constexpr std::size_t kSlotEntities = 8;
   static constexpr std::size_t kSlotMemory = 9;
-  static constexpr std::size_t kRowCount = 10;
+  static constexpr std::size_t kSlotTextCache = 10;   // TextTextureCache hits / misses / evictions
+  static constexpr std::size_t kSlotTextMemory = 11;  // TextTextureCache resident bytes
+  static constexpr std::size_t kSlotUICanvas = 12;    // UICanvasCache resident textures + bytes
+  static constexpr std::size_t kSlotRenderBase = 13;  // DRAWS / SWITCH / CULLED / QUEUE / SORT+DRAW
+  static constexpr std::size_t kRowCount = 18;
 
   static constexpr std::uint8_t kSectionFps = 0;
   static constexpr std::uint8_t kSectionFrame = 1;
   static constexpr std::uint8_t kSectionWorld = 2;
+  static constexpr std::uint8_t kSectionRender = 3;
 
   // Rasterize `text` (white) into line.texture when line.text differs, updating its size. Returns
   // false on failure. The tint is applied separately at draw time.
@@ -94,11 +99,16 @@ class PerfOverlaySystem {
   bool AppendFrameRows(TTF_Font* font, SDL_Renderer* sdlRenderer, float frameMs,
                        std::array<ActiveRow, kRowCount>& active, std::size_t& count);
 
-  // Rasterize + activate the world-stats section rows (entity count, resident memory) for the
-  // metrics enabled in `options`. Returns false if any raster fails.
+  // Rasterize + activate the world-stats section rows (entity count, resident memory, text texture
+  // cache) for the metrics enabled in `options`. Returns false if any raster fails.
   bool AppendWorldRows(TTF_Font* font, SDL_Renderer* sdlRenderer, Registry& registry, const EngineOptions& options,
                        float deltaTime, std::array<ActiveRow, kRowCount>& active, std::size_t& count);
 
+  // Rasterize + activate the render section rows from the newest RenderStats frame. Draws nothing
+  // until collection has recorded one. Returns false if any raster fails.
+  bool AppendRenderRows(TTF_Font* font, SDL_Renderer* sdlRenderer, Registry& registry,
+                        std::array<ActiveRow, kRowCount>& active, std::size_t& count);
+
   // Push paired FPS / frame-ms samples into the fixed-size ring buffers backing the avg/percentile
   // readouts.
   void RecordSample(float fps, float frameMs);
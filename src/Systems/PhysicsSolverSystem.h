@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Components/BoxColliderComponent.h"
+#include "Components/GlobalTransformComponent.h"
+#include "Components/PositionComponent.h"
+#include "Components/RigidBodyComponent.h"
+#include "ECS/Entity.h"
+#include "ECS/Iterable.h"
+#include "ECS/Query.h"
+#include "ECS/Registry.h"
+#include "General/PerfUtils.h"
+#include "Systems/CollisionSystem.h"
+#include "Systems/ContactSolver.h"
+#include "Systems/TileCollisionGrid.h"
+
+// Impulse-based contact resolution for simulated rigid bodies (RigidBodyComponent::simulated).
+// Runs after CollisionSystem: takes its overlapping-pair list, keeps the pairs that involve a
+// simulated body, and hands them to ContactSolver as AABB contacts. Colliders without a
+// RigidBodyComponent (walls, floors) are static; non-simulated rigid bodies (projectiles, scripted
+// movers) are left out entirely so their pass-through behaviour is unchanged. Solid tiles
+// (TileCollisionGrid) are static too: each merged solid rect a simulated body overlaps becomes one
+// immovable body, so tile maps collide without per-tile entities or broadphase traffic.
+//
+// The pair list is the last completed detection pass, so it can trail positions by a frame; the
+// solver re-measures every contact from this frame's transforms and drops pairs that no longer
+// overlap. Results are written straight back: velocity into RigidBodyComponent, the position
+// correction into both PositionComponent and GlobalTransformComponent so this frame's render
+// already sees separated bodies.
+class PhysicsSolverSystem {
+ public:
+  void operator()(const ContextFacade& ctx, const Iterable& /*iter*/) {
+    Registry* registry = ctx.GetRegistry();
+    auto* const* collision = registry->TryGet<CollisionSystem*>();
+    if (collision == nullptr || *collision == nullptr) return;
+    const std::span<const SortedPair> overlapping = (*collision)->GetOverlappingPairs();
+    TileCollisionGrid* tiles = registry->TryGet<TileCollisionGrid>();
+    if (tiles != nullptr) {
+      tiles->Sync(*registry);
+      if (tiles->Empty()) tiles = nullptr;
+    }
+    if (overlapping.empty() && tiles == nullptr) return;
+
+    GatherBodies(*registry);
+    if (simulatedCount_ == 0) {
+      ResetSlots();
+      return;
+    }
+    GatherPairs(*registry, overlapping);
+    if (tiles != nullptr) GatherTilePairs(*tiles);
+    PROFILE_COUNTER_SET("Physics: Candidate pairs", static_cast<long long>(pairs_.size()));
+    if (!pairs_.empty()) {
+      solver_.Step(bodies_, pairs_, settings_);
+      WriteBack(*registry);
+    }
+    PROFILE_COUNTER_SET("Physics: Contacts", static_cast<long long>(solver_.ContactCount()));
+    PROFILE_COUNTER_SET("Physics: Islands", static_cast<long long>(solver_.IslandCount()));
+    ResetSlots();
+  }
+
+  ContactSolverSettings& Settings() { return settings_; }
+
+ private:
+  static constexpr std::uint32_t kNoSlot = UINT32_MAX;
+  // Slot marker for non-simulated rigid bodies: known, but not part of the solve.
+  static constexpr std::uint32_t kIgnored = UINT32_MAX - 1;
+  // Marks a body-vs-tile pair key. Entity indices stay far below 2^31, so no entity pair sets it.
+  static constexpr std::uint64_t kTilePairBit = std::uint64_t{1} << 63;
+
+  // Where a simulated body's solved state goes back to.
+  struct Binding {
+    Entity entity;
+    RigidBodyComponent* rigidBody;
+    PositionComponent* position;
+    GlobalTransformComponent* transform;
+    float startX, startY;
+  };
+
+  [[nodiscard]] static SolverBody MakeBody(const GlobalTransformComponent& transform,
+                                           const BoxColliderComponent& collider) {
+    // Same box as CollisionSystem's gather: position is top-left, offset scales with the entity,
+    // rotated colliders use their enclosing AABB.
+    const float hx = static_cast<float>(collider.width) * transform.scale.x * 0.5f;
+    const float hy = static_cast<float>(collider.height) * transform.scale.y * 0.5f;
+    const float cx = transform.position.x + collider.offset.x * transform.scale.x + hx;
+    const float cy = transform.position.y + collider.offset.y * transform.scale.y + hy;
+    const float rot = static_cast<float>(transform.rotation);
+    const float rc = std::abs(std::cos(rot));
+    const float rs = std::abs(std::sin(rot));
+    return {cx, cy, hx * rc + hy * rs, hx * rs + hy * rc, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+  }
+
+  std::uint32_t& SlotOf(const Entity entity) {
+    const std::uint32_t index = entity.GetId();
+    if (index >= slots_.size()) slots_.resize(static_cast<size_t>(index) + 1, kNoSlot);
+    return slots_[index];
+  }
+
+  // One slot per rigid body with a collider; only simulated ones get a solver body up front.
+  void GatherBodies(Registry& registry) {
+    PROFILE_NAMED_SCOPE("Gather Rigid Bodies");
+    if (!query_) {
+      query_ = registry.CreateQuery<GlobalTransformComponent, BoxColliderComponent, RigidBodyComponent,
+                                    PositionComponent>();
+    }
+    query_->Update();
+    bodies_.clear();
+    bindings_.clear();
+    query_->ForEach([&](const Entity entity, GlobalTransformComponent& transform, const BoxColliderComponent& collider,
+                        RigidBodyComponent& rigidBody, PositionComponent& position) {
+      std::uint32_t& slot = SlotOf(entity);
+      touched_.push_back(entity.GetId());
+      if (!rigidBody.simulated) {
+        slot = kIgnored;
+        return;
+      }
+      SolverBody body = MakeBody(transform, collider);
+      body.vx = rigidBody.velocity.x;
+      body.vy = rigidBody.velocity.y;
+      body.invMass = rigidBody.mass > 0.0f ? 1.0f / rigidBody.mass : 0.0f;
+      body.restitution = rigidBody.restitution;
+      body.friction = rigidBody.friction;
+      slot = static_cast<std::uint32_t>(bodies_.size());
+      bodies_.push_back(body);
+      bindings_.push_back({entity, &rigidBody, &position, &transform, body.cx, body.cy});
+    });
+    simulatedCount_ = bodies_.size();
+  }
+
+  // Keep pairs with a simulated side; the other side is either simulated or a static collider,
+  // which gets an immovable body the first time it is seen.
+  void GatherPairs(Registry& registry, const std::span<const SortedPair> overlapping) {
+    PROFILE_NAMED_SCOPE("Gather Contact Pairs");
+    pairs_.clear();
+    for (const SortedPair& pair : overlapping) {
+      const std::uint32_t a = Resolve(registry, pair.entities.first);
+      const std::uint32_t b = Resolve(registry, pair.entities.second);
+      if (a >= kIgnored || b >= kIgnored) continue;
+      if (a >= simulatedCount_ && b >= simulatedCount_) continue;
+      pairs_.push_back({pair.key, a, b});
+    }
+  }
+
+  // Pair every simulated body with the solid-tile rects it overlaps. Keys carry kTilePairBit, so they
+  // sort after every entity pair's (lower << 32 | higher) key, and pack the body's entity index with
+  // the rect id — stable while the grid is unchanged, which is what warm starting needs.
+  void GatherTilePairs(const TileCollisionGrid& tiles) {
+    PROFILE_NAMED_SCOPE("Gather Tile Pairs");
+    const size_t firstTilePair = pairs_.size();
+    for (size_t i = 0; i < simulatedCount_; ++i) {
+      const SolverBody body = bodies_[i];
+      const std::uint64_t bodyKey = kTilePairBit | (static_cast<std::uint64_t>(bindings_[i].entity.GetId()) << 32);
+      tiles.ForEachRectOverlapping(
+          body.cx - body.hx, body.cy - body.hy, body.cx + body.hx, body.cy + body.hy,
+          [&](const std::uint32_t rectId, const TileCollisionGrid::SolidRect& rect) {
+            const float hx = (rect.maxX - rect.minX) * 0.5f;
+            const float hy = (rect.maxY - rect.minY) * 0.5f;
+            const auto slot = static_cast<std::uint32_t>(bodies_.size());
+            bodies_.push_back({rect.minX + hx, rect.minY + hy, hx, hy, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+            pairs_.push_back({bodyKey | rectId, static_cast<std::uint32_t>(i), slot});
+          });
+    }
+    std::sort(pairs_.begin() + static_cast<std::ptrdiff_t>(firstTilePair), pairs_.end(),
+              [](const SolverPair& x, const SolverPair& y) { return x.key < y.key; });
+  }
+
+  std::uint32_t Resolve(Registry& registry, const Entity entity) {
+    std::uint32_t& slot = SlotOf(entity);
+    if (slot != kNoSlot) return slot;
+    touched_.push_back(entity.GetId());
+    if (!registry.IsAlive(entity) || registry.HasComponent<RigidBodyComponent>(entity)) {
+      slot = kIgnored;  // despawned since the pass, or a rigid body without a position
+      return slot;
+    }
+    slot = static_cast<std::uint32_t>(bodies_.size());
+    bodies_.push_back(MakeBody(registry.GetComponent<GlobalTransformComponent>(entity),
+                               registry.GetComponent<BoxColliderComponent>(entity)));
+    return slot;
+  }
+
+  void WriteBack(const Registry& registry) {
+    for (size_t i = 0; i < bindings_.size(); ++i) {
+      const SolverBody& body = bodies_[i];
+      const Binding& binding = bindings_[i];
+      if (body.invMass <= 0.0f) continue;
+      binding.rigidBody->velocity = {body.vx, body.vy};
+      const glm::vec2 correction(body.cx - binding.startX, body.cy - binding.startY);
+      binding.position->value += correction;
+      binding.transform->position += correction;
+      // The move lands after TransformSystem's chunk-bounds pass; drop the chunk's bounds so
+      // chunk culling can't skip the body at its corrected position this frame.
+      if (correction.x != 0.0f || correction.y != 0.0f) {
+        const EntityLocation location = registry.GetEntityLocation(binding.entity);
+        if (location.archetype) location.archetype->InvalidateChunkBounds(location.chunkIndex);
+      }
+    }
+  }
+
+  void ResetSlots() {
+    for (const std::uint32_t index : touched_) slots_[index] = kNoSlot;
+    touched_.clear();
+  }
+
+  ContactSolver solver_;
+  ContactSolverSettings settings_;
+  // Simulated bodies occupy [0, simulatedCount_) of bodies_ (parallel to bindings_); static
+  // colliders are appended after them as pairs reference them.
+  std::vector<SolverBody> bodies_;
+  std::vector<Binding> bindings_;
+  size_t simulatedCount_ = 0;
+  std::vector<SolverPair> pairs_;
+  // Entity index -> body slot for this frame; reset through touched_ so clearing is O(bodies).
+  std::vector<std::uint32_t> slots_;
+  std::vector<std::uint32_t> touched_;
+  std::unique_ptr<ComponentQuery<GlobalTransformComponent, BoxColliderComponent, RigidBodyComponent, PositionComponent>>
+      query_;
+};
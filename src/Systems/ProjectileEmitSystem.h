@@ -2,6 +2,8 @@
 
 #include <glm/glm.hpp>
 
+#include "AssetManager/AssetHandle.h"
+
 #include "Components/BoxColliderComponent.h"
 #include "Components/EntityMaskComponent.h"
 #include "Components/GlobalTransformComponent.h"
@@ -20,10 +22,14 @@
 
 class ProjectileEmitSystem {
  public:
-  void Init(Registry& registry) {
+  // `bulletTexture` is "bullet-texture" interned by the caller (left invalid where no AssetManager
+  // exists); every pooled projectile's sprite carries it.
+  void Init(Registry& registry, const AssetHandle bulletTexture = {}) {
     projectile_pool_id_ =
-        registry.Get<EntityPoolManager>().RegisterPool<ProjectileComponent>(registry, [](Registry& reg) {
+        registry.Get<EntityPoolManager>().RegisterPool<ProjectileComponent>(registry, [bulletTexture](Registry& reg) {
           reg.Tag<PoolableTag>();
+          SpriteComponent sprite("bullet-texture", 4.0f, 4.0f, 4);
+          sprite.texture = bulletTexture;
           reg.Tag<ProjectileTag>();
           // NameComponent baked into the archetype so emitter-assigned names take the cheap
           // re-add path in Registry::AddComponent (assign-over) instead of an archetype transition,
@@ -31,7 +37,7 @@ class ProjectileEmitSystem {
           return reg.CreateEntityWithBundle(EntityMaskComponent(), PositionComponent(), ScaleComponent(),
                                             RotationComponent(), GlobalTransformComponent{}, RigidBodyComponent(),
                                             BoxColliderComponent(4, 4, glm::vec2(0, 0), false, EntityMask{}),
-                                            ProjectileComponent(), SpriteComponent("bullet-texture", 4.0f, 4.0f, 4),
+                                            ProjectileComponent(), sprite,
                                             NameComponent(), PoolableTag{}, ProjectileTag{});
         });
   }
@@ -102,7 +108,11 @@ class ProjectileEmitSystem {
     registry.GetComponent<ScaleComponent>(projectile).value = glm::vec2(1.0f, 1.0f);
     registry.GetComponent<RotationComponent>(projectile).value = 0.0;
     registry.GetComponent<RigidBodyComponent>(projectile).velocity = velocity;
-    registry.GetComponent<BoxColliderComponent>(projectile).collisionMask = emitter.collisionMask;
+    auto& collider = registry.GetComponent<BoxColliderComponent>(projectile);
+    collider.collisionMask = emitter.collisionMask;
+    collider.continuous = emitter.continuousCollision;
+    // A pooled projectile must not sweep from where its previous life ended.
+    collider.hasLastCenter = false;
     auto& projectileComponent = registry.GetComponent<ProjectileComponent>(projectile);
     projectileComponent.damage = emitter.damage;
     projectileComponent.duration = emitter.duration;
@@ -11,6 +11,7 @@
 #include "General/Rect.h"
 #include "Renderer/RenderCulling.h"
 #include "Renderer/RenderQueue.h"
+#include "Renderer/RenderStats.h"
 
 class RenderPrimitiveSystem {
  public:
@@ -18,6 +19,9 @@ class RenderPrimitiveSystem {
     const auto& gameConfig = registry->Get<GameConfig>();
     camera_ = registry->Get<CameraComponent>().viewport;
     renderQueue_ = &registry->Get<RenderQueue>();
+    // Hosts without stats collection (tools, benchmarks) never Set the history: no tally then.
+    auto* statsHistory = registry->TryGet<RenderStatsHistory>();
+    cullTally_ = statsHistory != nullptr ? statsHistory->CullTally() : nullptr;
     windowWidth_ = static_cast<float>(gameConfig.windowWidth);
     windowHeight_ = static_cast<float>(gameConfig.windowHeight);
 #ifdef OCTARINE_PROFILING
@@ -31,6 +35,7 @@ class RenderPrimitiveSystem {
 
     const bool isOutsideCamera = IsRenderableOutsideViewport(origin.x, origin.y, square.width, square.height,
                                                              square.isFixed, camera_, windowWidth_, windowHeight_);
+    if (cullTally_ != nullptr) cullTally_->Record(isOutsideCamera);
 
     if (isOutsideCamera) {
       PROFILE_COUNTER_INC(culledCounter_);
@@ -52,6 +57,7 @@ class RenderPrimitiveSystem {
 
  private:
   RenderQueue* renderQueue_ = nullptr;
+  RenderCullTally* cullTally_ = nullptr;  // null unless RenderStats are being collected
   float windowWidth_ = 0;
   float windowHeight_ = 0;
   octarine::Rect camera_{};
@@ -3,8 +3,6 @@
 #include <SDL3/SDL.h>
 
 #include <atomic>
-#include <memory>
-#include <optional>
 
 #include "AssetManager/AssetManager.h"
 #include "Components/CameraComponents.h"
@@ -18,47 +16,55 @@
 #include "General/SpriteFlip.h"
 #include "Renderer/RenderCulling.h"
 #include "Renderer/RenderQueue.h"
-#include "Renderer/SpriteRenderCache.h"
+#include "Renderer/RenderStats.h"
+#include "Renderer/StaticSpriteLayer.h"
 
 class RenderSpriteSystem {
  public:
+  // Static-tagged sprites are drawn from the retained layer (RenderStaticSpriteSystem).
+  void ConfigureQuery(ComponentQuery<GlobalTransformComponent, SpriteComponent>& query) {
+    query.WithoutTag(StaticSpriteLayer::kTag);
+  }
+
   void Prepare(Registry* registry) {
     const auto& gameConfig = registry->Get<GameConfig>();
     camera_ = registry->Get<CameraComponent>().viewport;
     assetManager_ = &registry->Get<AssetManager>();
     renderQueue_ = &registry->Get<RenderQueue>();
-    spriteCache_ = &registry->Get<SpriteRenderCache>();
+    // Hosts without stats collection (tools, benchmarks) never Set the history: no tally then.
+    auto* statsHistory = registry->TryGet<RenderStatsHistory>();
+    cullTally_ = statsHistory != nullptr ? statsHistory->CullTally() : nullptr;
     windowWidth_ = static_cast<float>(gameConfig.windowWidth);
     windowHeight_ = static_cast<float>(gameConfig.windowHeight);
 
-    // Single-threaded cache warm: walk every sprite entity once and resolve the SDL_Texture* +
-    // atlas slice now. operator() (which runs in parallel via ParallelForEach) then does a
-    // race-free read-only Lookup. SpriteRenderCache is an std::unordered_map and cannot tolerate
-    // concurrent inserts.
-    if (!warmingQuery_) {
-      warmingQuery_ = registry->CreateQuery<SpriteComponent>();
-    }
-    warmingQuery_->Update();
-    const auto assetGen = assetManager_->TextureGeneration();
-    warmingQuery_->ForEach([this, assetGen](Entity entity, const SpriteComponent& sprite) {
-      if (spriteCache_->Lookup(entity, assetGen) == nullptr) {
-        SDL_Texture* texture = assetManager_->GetTexture(sprite.assetId);
-        const auto slice = assetManager_->GetAtlasSlice(sprite.assetId);
-        const SDL_FRect atlasOffset = slice.has_value() ? *slice : SDL_FRect{0, 0, 0, 0};
-        spriteCache_->Store(entity, texture, atlasOffset, assetGen);
-      }
-    });
+    // Sprites carry an interned AssetHandle, so the emit resolves textures with an array index.
+    // Refresh here, serially, in case a script loaded or dropped a texture earlier this frame;
+    // operator() (parallel) then only reads the handle table.
+    assetManager_->RefreshHandles();
 
 #ifdef OCTARINE_PROFILING
     if (!culledCounter_) culledCounter_ = PROFILE_COUNTER_HANDLE("RenderSprite: Culled");
     if (!emplacedCounter_) emplacedCounter_ = PROFILE_COUNTER_HANDLE("RenderSprite: Emplaced");
+    if (!culledChunksCounter_) culledChunksCounter_ = PROFILE_COUNTER_HANDLE("RenderSprite: Culled chunks");
 #endif
   }
 
-  void operator()(Entity entity, const GlobalTransformComponent& transform, const SpriteComponent& sprite) const {
+  // Coarse cull ahead of the per-entity test: skip a chunk whose bounds (kept by TransformSystem
+  // when chunk culling is on) lie outside the camera. Invalid bounds — culling off, or an entity
+  // landed in the chunk since the bounds pass — mean the chunk is visited.
+  bool AcceptChunk(const ChunkBounds& bounds) const {
+    if (!bounds.valid || !IsWorldBoundsOutsideCamera(bounds.minX, bounds.minY, bounds.maxX, bounds.maxY, camera_)) {
+      return true;
+    }
+    PROFILE_COUNTER_INC(culledChunksCounter_);
+    return false;
+  }
+
+  void operator()(Entity /*entity*/, const GlobalTransformComponent& transform, const SpriteComponent& sprite) const {
     const bool isOutsideCamera = IsRenderableOutsideViewport(
         transform.position.x, transform.position.y, sprite.width * transform.scale.x, sprite.height * transform.scale.y,
         sprite.isFixed, camera_, windowWidth_, windowHeight_);
+    if (cullTally_ != nullptr) cullTally_->Record(isOutsideCamera);
 
     if (isOutsideCamera) {
       PROFILE_COUNTER_INC(culledCounter_);
@@ -67,9 +73,11 @@ class RenderSpriteSystem {
 
     PROFILE_COUNTER_INC(emplacedCounter_);
 
-    const SpriteRenderCache::Entry* entry = spriteCache_->Lookup(entity, assetManager_->TextureGeneration());
-    SDL_Texture* texture = entry ? entry->texture : nullptr;
-    const SDL_FRect atlasOffset = entry ? entry->atlasOffset : SDL_FRect{0, 0, 0, 0};
+    // A sprite built without the Lua bind has no handle and resolves by id instead — the
+    // AssetManager lookups are const, so that stays race-free.
+    const ResolvedAsset resolved = assetManager_->ResolveTexture(sprite.texture, sprite.assetId);
+    SDL_Texture* texture = resolved.texture;
+    const SDL_FRect atlasOffset = resolved.atlasOffset;
 
     const float x = sprite.isFixed ? transform.position.x : transform.position.x - camera_.x;
     const float y = sprite.isFixed ? transform.position.y : transform.position.y - camera_.y;
@@ -98,13 +106,13 @@ class RenderSpriteSystem {
  private:
   AssetManager* assetManager_ = nullptr;
   RenderQueue* renderQueue_ = nullptr;
-  SpriteRenderCache* spriteCache_ = nullptr;
-  std::unique_ptr<ComponentQuery<SpriteComponent>> warmingQuery_;
+  RenderCullTally* cullTally_ = nullptr;  // null unless RenderStats are being collected
   float windowWidth_ = 0;
   float windowHeight_ = 0;
   octarine::Rect camera_{};
 #ifdef OCTARINE_PROFILING
   std::atomic<long long>* culledCounter_ = nullptr;
   std::atomic<long long>* emplacedCounter_ = nullptr;
+  std::atomic<long long>* culledChunksCounter_ = nullptr;
 #endif
 };
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <memory>
+#include <optional>
+
+#include "AssetManager/AssetManager.h"
+#include "Components/CameraComponents.h"
+#include "Components/GlobalTransformComponent.h"
+#include "Components/SpriteComponent.h"
+#include "ECS/Iterable.h"
+#include "ECS/Query.h"
+#include "ECS/Registry.h"
+#include "Game/GameConfig.h"
+#include "General/PerfUtils.h"
+#include "General/SpriteFlip.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/RenderStats.h"
+#include "Renderer/StaticSpriteLayer.h"
+
+// Producer for the retained static layer (see StaticSpriteLayer.h). Rebakes the layer when it
+// goes stale, then per frame culls the baked commands against the camera and appends the visible
+// ones to the RenderQueue's retained span — already in sort order, so no key is computed or
+// sorted for them. Serial: the retained span is single-producer.
+class RenderStaticSpriteSystem {
+ public:
+  // gridCellSize: world units per cell of the layer's cull grid; 0 culls the baked list linearly
+  // (EngineOptions::staticCullGridCell).
+  explicit RenderStaticSpriteSystem(const float gridCellSize = 0.0f) : gridCellSize_(gridCellSize) {}
+
+  void operator()(const ContextFacade& ctx, const Iterable& /*iter*/) {
+    auto* registry = ctx.GetRegistry();
+    auto* layer = registry->TryGet<StaticSpriteLayer>();
+    if (!layer) return;
+    layer->SetGridCellSize(gridCellSize_);
+
+    if (!query_) {
+      query_ = registry->CreateQuery<GlobalTransformComponent, SpriteComponent>();
+      query_->WithTag(StaticSpriteLayer::kTag);
+    }
+    query_->Update();
+
+    auto& assetManager = registry->Get<AssetManager>();
+    const auto assetGen = assetManager.TextureGeneration();
+    const auto membership = query_->MembershipVersion();
+    if (layer->IsStale(membership, assetGen)) {
+      PROFILE_NAMED_SCOPE("RenderStaticSprite: Rebuild");
+      Rebuild(*layer, assetManager, membership, assetGen);
+    }
+
+    const auto& gameConfig = registry->Get<GameConfig>();
+    const octarine::Rect camera = registry->Get<CameraComponent>().viewport;
+    const auto windowWidth = static_cast<float>(gameConfig.windowWidth);
+    const auto windowHeight = static_cast<float>(gameConfig.windowHeight);
+    auto& renderQueue = registry->Get<RenderQueue>();
+
+    long long emplaced = 0;
+    layer->ForEachVisible(camera, windowWidth, windowHeight, [&](const StaticSpriteLayer::Entry& entry) {
+      SpriteCommand& cmd = renderQueue.EmplaceRetainedSprite(entry.sortKey);
+      cmd = entry.command;
+      if (!entry.isFixed) {
+        cmd.destX -= camera.x;
+        cmd.destY -= camera.y;
+      }
+      ++emplaced;
+    });
+    // The grid walk skips most off-screen entries untested; they count as culled all the same.
+    auto* statsHistory = registry->TryGet<RenderStatsHistory>();
+    if (auto* cullTally = statsHistory != nullptr ? statsHistory->CullTally() : nullptr) {
+      cullTally->Add(static_cast<std::uint32_t>(layer->Size()),
+                     static_cast<std::uint32_t>(layer->Size() - static_cast<size_t>(emplaced)));
+    }
+    PROFILE_COUNTER_SET("RenderStaticSprite: Baked", static_cast<long long>(layer->Size()));
+    PROFILE_COUNTER_SET("RenderStaticSprite: Emplaced", emplaced);
+  }
+
+ private:
+  // Same command RenderSpriteSystem builds, in world space; sort keys depend only on world data,
+  // so the baked order holds for any camera.
+  void Rebuild(StaticSpriteLayer& layer, AssetManager& assetManager, const std::uint64_t membership,
+               const std::uint64_t assetGen) {
+    layer.BeginRebuild();
+    query_->ForEach([&](const GlobalTransformComponent& transform, const SpriteComponent& sprite) {
+      SDL_Texture* texture = assetManager.GetTexture(sprite.assetId);
+      const auto slice = assetManager.GetAtlasSlice(sprite.assetId);
+      const SDL_FRect atlasOffset = slice.has_value() ? *slice : SDL_FRect{0, 0, 0, 0};
+
+      auto& entry = layer.Add(RenderKey::ComputeSortKey(static_cast<unsigned int>(sprite.layer), transform.position.y,
+                                                        SPRITE, texture, static_cast<std::uint8_t>(sprite.blendMode)),
+                              sprite.isFixed);
+      SpriteCommand& cmd = entry.command;
+      cmd.destX = transform.position.x;
+      cmd.destY = transform.position.y;
+      cmd.destW = sprite.width * transform.scale.x;
+      cmd.destH = sprite.height * transform.scale.y;
+      cmd.srcRect.x = sprite.srcRect.x + atlasOffset.x;
+      cmd.srcRect.y = sprite.srcRect.y + atlasOffset.y;
+      cmd.srcRect.w = sprite.srcRect.w;
+      cmd.srcRect.h = sprite.srcRect.h;
+      cmd.rotation = transform.rotation;
+      cmd.pivot = {cmd.destW * 0.5f, cmd.destH * 0.5f};
+      cmd.flip = static_cast<SDL_FlipMode>(sprite.flip);
+      cmd.texture = texture;
+      cmd.colorMod = SDL_Color{sprite.colorMod.r, sprite.colorMod.g, sprite.colorMod.b, sprite.colorMod.a};
+      cmd.blendMode = octarine::ToSdlBlendMode(sprite.blendMode);
+    });
+    layer.EndRebuild(membership, assetGen);
+  }
+
+  std::unique_ptr<ComponentQuery<GlobalTransformComponent, SpriteComponent>> query_;
+  float gridCellSize_ = 0.0f;
+};
@@ -8,11 +8,13 @@
 #include <cmath>
 #include <cstdint>
 #include <glm/glm.hpp>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
 #include "AssetManager/AssetManager.h"
 #include "AssetManager/GlyphAtlas.h"
+#include "AssetManager/GlyphCache.h"
 #include "Components/CameraComponents.h"
 #include "Components/GlobalTransformComponent.h"
 #include "Components/TextLabelComponent.h"
@@ -25,9 +27,13 @@
 #include "General/Logger.h"
 #include "General/PerfUtils.h"
 #include "General/Rect.h"
+#include "Renderer/GlyphLayoutCache.h"
 #include "Renderer/RenderCommands.h"
 #include "Renderer/RenderCulling.h"
 #include "Renderer/RenderQueue.h"
+#include "Renderer/RenderStats.h"
+#include "Renderer/TextTextureCache.h"
+#include "Renderer/UICanvasCache.h"
 
 class RenderTextSystem {
  public:
@@ -37,14 +43,8 @@ class RenderTextSystem {
   RenderTextSystem& operator=(const RenderTextSystem&) = delete;
   RenderTextSystem(RenderTextSystem&&) = default;
   RenderTextSystem& operator=(RenderTextSystem&&) = default;
-
-  ~RenderTextSystem() {
-    for (auto& [key, entry] : text_cache_) {
-      if (entry.texture) {
-        SDL_DestroyTexture(entry.texture);
-      }
-    }
-  }
+  // Rasterized textures belong to the registry's TextTextureCache, which frees them itself.
+  ~RenderTextSystem() = default;
 
   void operator()(const ContextFacade& ctx, const TextLabelComponent& text) const {
     if (text.text.empty()) return;
@@ -53,40 +53,59 @@ class RenderTextSystem {
     const auto& assetManager = registry->Get<AssetManager>();
     auto* sdlRenderer = registry->Get<EngineContext>().sdlRenderer;
     auto& renderQueue = registry->Get<RenderQueue>();
+    auto& textures = registry->Get<TextTextureCache>();
     const octarine::Rect camera = registry->Get<CameraComponent>().viewport;
+    BeginFrame(renderQueue.Frame(), textures);
+
+    // A label laid out under a cached canvas draws only when the canvas texture is being redrawn,
+    // and then into the canvas's bake queue (see UICanvasCache). A label skipped because its canvas
+    // is clean still counts as visited, so its entry survives until the next re-bake.
+    const Entity entity = ctx.GetEntity();
+    const UIRectComponent* uiRect =
+        registry->HasComponent<UIRectComponent>(entity) ? &registry->GetComponent<UIRectComponent>(entity) : nullptr;
+    RenderQueue* target = &renderQueue;
+    if (auto* canvasCache = registry->TryGet<UICanvasCache>(); canvasCache != nullptr && uiRect != nullptr) {
+      target = canvasCache->Route(uiRect->cacheSlot, renderQueue);
+      if (target == nullptr) {
+        if (const auto it = text_cache_.find(entity.GetId()); it != text_cache_.end()) {
+          it->second.frame = renderQueue.Frame();
+          ++visited_;
+        }
+        return;
+      }
+    }
 
-    TTF_Font* font = assetManager.GetFont(text.fontId);
+    TTF_Font* font = assetManager.GetFont(text.font, text.fontId);
     if (!font) return;
 
     const auto packedColor = static_cast<Uint32>(text.color.r) << 24 | static_cast<Uint32>(text.color.g) << 16 |
                              static_cast<Uint32>(text.color.b) << 8 | static_cast<Uint32>(text.color.a);
 
-    // Entity-keyed cache (mirrors Renderer/SpriteRenderCache): one rasterized texture per text
-    // entity, re-rasterized only when its (fontId, text, color) changes. Steady-state lookups do
-    // no heap allocation, and a label that updates every frame (score/timer) frees its old texture
-    // instead of leaking a fresh one per frame.
-    const Entity entity = ctx.GetEntity();
+    // Entity-keyed cache: each text entity remembers how its current (fontId, text, color) draws —
+    // a shared glyph layout against the font's GlyphCache, or in the last resort a shared
+    // rasterized texture — and only redoes that when one of the three changes or the glyph cache
+    // recycled a page. Steady-state lookups do no heap allocation.
     auto it = text_cache_.find(entity.GetId());
-    const bool needsRaster = it == text_cache_.end() || it->second.color != packedColor ||
-                             it->second.fontId != text.fontId || it->second.text != text.text;
-    if (needsRaster) {
-      float w = 0;
-      float h = 0;
-      SDL_Texture* texture = RasterizeLabel(assetManager, sdlRenderer, font, text, w, h);
-      if (texture == nullptr) return;
-      it = StoreEntry(it, entity, text, packedColor, texture, w, h);
+    const bool stale = it == text_cache_.end() || it->second.color != packedColor ||
+                       it->second.fontId != text.fontId || it->second.text != text.text ||
+                       (it->second.glyphs != nullptr && it->second.generation != it->second.glyphs->Generation());
+    if (stale) {
+      it = Refresh(it, entity, assetManager, sdlRenderer, font, text, packedColor, renderQueue.Frame(), textures);
+      if (it == text_cache_.end()) return;
     }
+    TextCacheEntry& entry = it->second;
+    entry.frame = renderQueue.Frame();
+    ++visited_;
 
     // UIRectComponent (written by UILayoutSystem) takes priority over GlobalTransform for position.
     // text.position acts as a local pixel offset within the rect (e.g., padding).
     glm::vec2 origin = text.position;
     bool effectivelyFixed = text.isFixed;
     int renderLayer = text.layer;
-    if (registry->HasComponent<UIRectComponent>(entity)) {
-      const auto& rect = registry->GetComponent<UIRectComponent>(entity);
-      origin = glm::vec2(rect.left, rect.top) + text.position;
+    if (uiRect != nullptr) {
+      origin = glm::vec2(uiRect->left, uiRect->top) + text.position;
       effectivelyFixed = true;
-      renderLayer = rect.layer;
+      renderLayer = uiRect->layer;
     } else if (registry->HasComponent<GlobalTransformComponent>(entity)) {
       const auto& transform = registry->GetComponent<GlobalTransformComponent>(entity);
       origin += transform.position;
@@ -94,12 +113,16 @@ class RenderTextSystem {
 
     const auto& gameConfig = registry->Get<GameConfig>();
     const bool isOutsideCamera = IsRenderableOutsideViewport(
-        origin.x, origin.y, it->second.width, it->second.height, effectivelyFixed, camera,
+        origin.x, origin.y, entry.width, entry.height, effectivelyFixed, camera,
         static_cast<float>(gameConfig.windowWidth), static_cast<float>(gameConfig.windowHeight));
+    if (auto* statsHistory = registry->TryGet<RenderStatsHistory>()) {
+      if (auto* cullTally = statsHistory->CullTally()) cullTally->Record(isOutsideCamera);
+    }
 
 #ifdef OCTARINE_PROFILING
     static auto* culledCounter = PROFILE_COUNTER_HANDLE("RenderText: Culled");
     static auto* emplacedCounter = PROFILE_COUNTER_HANDLE("RenderText: Emplaced");
+    static auto* glyphCounter = PROFILE_COUNTER_HANDLE("RenderText: Glyph quads");
 #endif
 
     if (isOutsideCamera) {
@@ -110,10 +133,35 @@ class RenderTextSystem {
 
     const float x = effectivelyFixed ? origin.x : origin.x - camera.x;
     const float y = effectivelyFixed ? origin.y : origin.y - camera.y;
+    const auto layer = static_cast<unsigned int>(renderLayer);
 
-    auto& cmd = renderQueue.EmplaceText(static_cast<unsigned int>(renderLayer), text.position.y, it->second.texture);
-    cmd.destRect = {x, y, it->second.width, it->second.height};
-    cmd.texture = it->second.texture;
+    if (entry.layout != nullptr) {
+      // One sprite quad per glyph, sampling its glyph-cache page: quads on a page sort together and
+      // SpriteBatcher submits them (plus any same-font label in the band) as one geometry call.
+      // Touching the pages keeps them from being recycled while these commands are queued.
+      entry.glyphs->Touch(entry.layout->pages, renderQueue.Frame());
+      const SDL_Color tint{text.color.r, text.color.g, text.color.b, text.color.a};
+      for (const GlyphQuad& quad : entry.layout->quads) {
+        SDL_Texture* page = entry.glyphs->PageTexture(quad.page);
+        auto& cmd = target->EmplaceGlyph(layer, text.position.y, page);
+        cmd = SpriteCommand{};
+        cmd.destX = x + quad.x;
+        cmd.destY = y + quad.y;
+        cmd.destW = quad.w;
+        cmd.destH = quad.h;
+        cmd.srcRect = {quad.srcX, quad.srcY, quad.w, quad.h};
+        cmd.texture = page;
+        cmd.colorMod = tint;
+      }
+#ifdef OCTARINE_PROFILING
+      glyphCounter->fetch_add(static_cast<long long>(entry.layout->quads.size()), std::memory_order_relaxed);
+#endif
+      return;
+    }
+
+    auto& cmd = target->EmplaceText(layer, text.position.y, entry.rasterized->texture);
+    cmd.destRect = {x, y, entry.width, entry.height};
+    cmd.texture = entry.rasterized->texture;
   }
 
  private:
@@ -121,51 +169,125 @@ class RenderTextSystem {
     std::string fontId;
     std::string text;
     Uint32 color = 0;
-    SDL_Texture* texture = nullptr;
+    // Glyph path: the shared layout, the font's glyph cache it was made against and that cache's
+    // generation at the time (a newer one means a page the layout samples may have been recycled).
+    std::shared_ptr<const GlyphLayout> layout;
+    GlyphCache* glyphs = nullptr;
+    std::uint64_t generation = 0;
+    // Fallback path: a reference held on the shared TextTextureCache entry for this content.
+    const TextTextureCache::Entry* rasterized = nullptr;
     float width = 0.0F;
     float height = 0.0F;
+    std::uint64_t frame = 0;  // RenderQueue::Frame() this entity's label was last visited
   };
 
-  // Entity → last-rasterized label. Re-rasterized only when (fontId, text, color) changes, so a
-  // label that updates every frame holds a single texture rather than leaking one per frame. Two
-  // entities with identical text no longer share a texture (entity-keyed, not content-keyed) —
-  // fine for typical UI label counts. Entries for despawned text entities persist until the system
-  // is destroyed (its destructor frees every cached texture).
+  // Entity → how its label currently draws. Redone only when (fontId, text, color) changes, so a
+  // label that updates every frame reuses cached glyph layouts (or, on the fallback path, shares
+  // one texture per distinct string rather than holding one per entity). Entries not visited in
+  // the previous frame — the entity was despawned, pooled or lost its label — are dropped at the
+  // start of the next, releasing their texture reference.
   mutable std::unordered_map<EcsId, TextCacheEntry> text_cache_;
+  mutable std::uint64_t frame_ = 0;
+  mutable std::size_t visited_ = 0;
+
+  // Font id → its on-demand glyph atlas, seeded from the baked GlyphAtlas when there is one.
+  // Node-based, so the GlyphCache* held by entries and the metrics keying layout_cache_ stay put.
+  mutable std::unordered_map<std::string, GlyphCache> glyph_caches_;
+
+  // String content → glyph layout, shared across entities and fonts' glyph caches. Identical
+  // strings ("x2", "Miss!", a score a label returns to) are laid out once.
+  mutable GlyphLayoutCache layout_cache_;
+
+  // Rebuild this entity's entry for the label's current content: make its glyphs resident in the
+  // font's GlyphCache and lay it out there; a TTF-rasterized texture only when that fails (a glyph
+  // the face can't render, or more new glyphs in one frame than the cache's pages hold). `it` is
+  // the entity's current slot (text_cache_.end() if it had none). Returns the live entry, or end()
+  // when the label can't be drawn (the failure is logged; any previous entry is dropped).
+  std::unordered_map<EcsId, TextCacheEntry>::iterator Refresh(std::unordered_map<EcsId, TextCacheEntry>::iterator it,
+                                                              const Entity entity, const AssetManager& assetManager,
+                                                              SDL_Renderer* sdlRenderer, TTF_Font* font,
+                                                              const TextLabelComponent& text, const Uint32 color,
+                                                              const std::uint64_t frame,
+                                                              TextTextureCache& textures) const {
+    TextCacheEntry fresh;
+    fresh.fontId = text.fontId;
+    fresh.text = text.text;
+    fresh.color = color;
+    GlyphCache& glyphs = glyph_caches_[text.fontId];
+    if (glyphs.Bind(sdlRenderer, font, assetManager.GetGlyphAtlas(text.fontId))) {
+      layout_cache_.Forget(glyphs.Metrics());
+    }
+    const std::uint64_t generation = glyphs.Generation();
+    const bool resident = glyphs.Ensure(text.text, frame);
+    // Glyphs were dropped to make room: layouts that sampled them must not be served again.
+    if (glyphs.Generation() != generation) layout_cache_.Forget(glyphs.Metrics());
+    if (resident) fresh.layout = layout_cache_.Get(glyphs.Metrics(), text.text);
+    if (fresh.layout != nullptr) {
+      fresh.glyphs = &glyphs;
+      fresh.generation = glyphs.Generation();
+      fresh.width = fresh.layout->width;
+      fresh.height = fresh.layout->height;
+    } else {
+      fresh.rasterized = textures.Acquire(text.fontId, color, text.text);
+      if (fresh.rasterized == nullptr) {
+        float width = 0.0F;
+        float height = 0.0F;
+        if (SDL_Texture* texture = RasterizeLabel(sdlRenderer, font, text, width, height)) {
+          fresh.rasterized = textures.Insert(text.fontId, color, text.text, texture, width, height);
+        }
+      }
+      if (fresh.rasterized != nullptr) {
+        fresh.width = fresh.rasterized->width;
+        fresh.height = fresh.rasterized->height;
+      }
+    }
 
-  // Store the freshly rasterized texture as this entity's cache entry, freeing any texture it was
-  // previously holding, and return the iterator to the live entry. `it` is this entity's current
-  // slot (text_cache_.end() if it had none).
-  std::unordered_map<EcsId, TextCacheEntry>::iterator StoreEntry(std::unordered_map<EcsId, TextCacheEntry>::iterator it,
-                                                                 Entity entity, const TextLabelComponent& text,
-                                                                 Uint32 color, SDL_Texture* texture, float width,
-                                                                 float height) const {
+    const bool drawable = fresh.layout != nullptr || fresh.rasterized != nullptr;
     if (it != text_cache_.end()) {
-      if (it->second.texture != nullptr) SDL_DestroyTexture(it->second.texture);
-      it->second = {text.fontId, text.text, color, texture, width, height};
+      ReleaseTexture(it->second, textures);
+      if (!drawable) {
+        text_cache_.erase(it);
+        return text_cache_.end();
+      }
+      it->second = std::move(fresh);
       return it;
     }
-    return text_cache_.emplace(entity.GetId(), TextCacheEntry{text.fontId, text.text, color, texture, width, height})
-        .first;
+    if (!drawable) return text_cache_.end();
+    return text_cache_.emplace(entity.GetId(), std::move(fresh)).first;
   }
 
-  // Rasterize `text` to a freshly created SDL_Texture, writing its size into outW/outH. text.color
-  // is octarine::Color (Stage 2 POD-no-SDL); convert to SDL_Color once here at the render seam. The
-  // atlas fast path composes the surface by blitting resident glyphs from the font's GlyphAtlas and
-  // falls back to TTF_RenderText_Blended when no atlas is baked or the string hits an uncovered
-  // glyph (extended Latin, emoji, etc.). Returns nullptr (and logs) on failure; the caller owns the
-  // returned texture.
-  static SDL_Texture* RasterizeLabel(const AssetManager& assetManager, SDL_Renderer* sdlRenderer, TTF_Font* font,
-                                     const TextLabelComponent& text, float& outW, float& outH) {
-    const SDL_Color sdlColor{text.color.r, text.color.g, text.color.b, text.color.a};
-    SDL_Surface* surface = nullptr;
-    const GlyphAtlas* atlas = assetManager.GetGlyphAtlas(text.fontId);
-    if (atlas != nullptr && atlas->IsLoaded()) {
-      surface = ComposeFromAtlas(*atlas, text.text, sdlColor);
-    }
-    if (surface == nullptr) {
-      surface = TTF_RenderText_Blended(font, text.text.c_str(), 0, sdlColor);
+  // Once per frame, before the first label: drop the entries of entities that weren't visited in
+  // the previous frame. Skipped outright when every entry was visited, the steady state.
+  void BeginFrame(const std::uint64_t frame, TextTextureCache& textures) const {
+    if (frame == frame_) return;
+    if (visited_ < text_cache_.size()) {
+      for (auto it = text_cache_.begin(); it != text_cache_.end();) {
+        if (it->second.frame == frame_) {
+          ++it;
+          continue;
+        }
+        ReleaseTexture(it->second, textures);
+        it = text_cache_.erase(it);
+      }
     }
+    frame_ = frame;
+    visited_ = 0;
+  }
+
+  static void ReleaseTexture(TextCacheEntry& entry, TextTextureCache& textures) {
+    if (entry.rasterized == nullptr) return;
+    textures.Release(entry.fontId, entry.color, entry.text);
+    entry.rasterized = nullptr;
+  }
+
+  // Rasterize `text` through SDL_ttf to a freshly created SDL_Texture, writing its size into
+  // outW/outH — the last-resort path when the glyph cache can't hold the label's glyphs.
+  // text.color is octarine::Color (Stage 2 POD-no-SDL); convert to SDL_Color once here at the
+  // render seam. Returns nullptr (and logs) on failure; the caller owns the returned texture.
+  static SDL_Texture* RasterizeLabel(SDL_Renderer* sdlRenderer, TTF_Font* font, const TextLabelComponent& text,
+                                     float& outW, float& outH) {
+    const SDL_Color sdlColor{text.color.r, text.color.g, text.color.b, text.color.a};
+    SDL_Surface* surface = TTF_RenderText_Blended(font, text.text.c_str(), 0, sdlColor);
     if (surface == nullptr) {
       Logger::Error("RenderText: surface compose failed: " + std::string(SDL_GetError()));
       return nullptr;
@@ -181,44 +303,4 @@ class RenderTextSystem {
     SDL_GetTextureSize(texture, &outW, &outH);
     return texture;
   }
-
-  // Atlas compose: build an RGBA destination surface, blit each codepoint's rect from the atlas
-  // into it, color-mod the source surface to tint the white-rasterized atlas glyphs to the
-  // requested color. Returns nullptr on any missing codepoint (caller falls back to TTF). Layout
-  // is top-aligned — not pixel-perfect for descenders, but readable for ASCII at typical UI sizes;
-  // ascent-aware baseline alignment is a follow-up.
-  static SDL_Surface* ComposeFromAtlas(const GlyphAtlas& atlas, const std::string& text, SDL_Color color) {
-    float totalW = 0.0F;
-    for (const char c : text) {
-      const auto cp = static_cast<std::uint32_t>(static_cast<unsigned char>(c));
-      const auto* g = atlas.Find(cp);
-      if (g == nullptr) return nullptr;
-      totalW += g->advance;
-    }
-    const int destW = std::max(1, static_cast<int>(std::ceil(totalW)));
-    const int destH = std::max(1, atlas.LineSkip());
-    SDL_Surface* dst = SDL_CreateSurface(destW, destH, SDL_PIXELFORMAT_RGBA32);
-    if (dst == nullptr) return nullptr;
-
-    SDL_Surface* src = atlas.SourceSurface();
-    SDL_SetSurfaceColorMod(src, color.r, color.g, color.b);
-    SDL_SetSurfaceAlphaMod(src, color.a);
-    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
-
-    float pen = 0.0F;
-    for (const char c : text) {
-      const auto cp = static_cast<std::uint32_t>(static_cast<unsigned char>(c));
-      const auto* g = atlas.Find(cp);
-      SDL_Rect srcR{static_cast<int>(g->x), static_cast<int>(g->y), static_cast<int>(g->w), static_cast<int>(g->h)};
-      SDL_Rect dstR{static_cast<int>(pen), 0, static_cast<int>(g->w), static_cast<int>(g->h)};
-      SDL_BlitSurface(src, &srcR, dst, &dstR);
-      pen += g->advance;
-    }
-
-    // Reset mods so the next compose (or a parallel one for a differently-colored label) starts
-    // from a clean state on the shared atlas surface.
-    SDL_SetSurfaceColorMod(src, 255, 255, 255);
-    SDL_SetSurfaceAlphaMod(src, 255);
-    return dst;
-  }
 };
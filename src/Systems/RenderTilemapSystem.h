@@ -0,0 +1,86 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <memory>
+
+#include "AssetManager/AssetManager.h"
+#include "Components/CameraComponents.h"
+#include "Components/TilemapLayerComponent.h"
+#include "ECS/Entity.h"
+#include "ECS/Iterable.h"
+#include "ECS/Query.h"
+#include "ECS/Registry.h"
+#include "Engine/EngineContext.h"
+#include "General/PerfUtils.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/TilemapChunkCache.h"
+
+// Producer for tile layers (TilemapLayerComponent). Per visible layer, picks the chunks under the
+// camera, has TilemapChunkCache bake any that are missing or edited, and emits one SpriteCommand
+// per non-empty chunk — a screenful of tiles costs a few dozen queue entries instead of one per
+// tile. Chunks sort like sprites on the layer's render layer, at the chunk's top edge. Serial:
+// baking switches the render target.
+class RenderTilemapSystem {
+ public:
+  void operator()(const ContextFacade& ctx, const Iterable& /*iter*/) {
+    Registry* registry = ctx.GetRegistry();
+    if (!query_) query_ = registry->CreateQuery<TilemapLayerComponent>();
+    query_->Update();
+
+    SDL_Renderer* sdlRenderer = registry->Get<EngineContext>().sdlRenderer;
+    const auto& assetManager = registry->Get<AssetManager>();
+    const auto textureGeneration = assetManager.TextureGeneration();
+    const octarine::Rect camera = registry->Get<CameraComponent>().viewport;
+    auto& renderQueue = registry->Get<RenderQueue>();
+
+    [[maybe_unused]] long long emplaced = 0;
+    query_->ForEach([&](const Entity entity, const TilemapLayerComponent& layer) {
+      if (!layer.visible || sdlRenderer == nullptr) return;
+      const TileChunkRange range =
+          VisibleChunkRange(layer, camera.x, camera.y, camera.x + camera.w, camera.y + camera.h);
+      if (range.Empty()) return;
+      SDL_Texture* tileset = assetManager.GetTexture(layer.tilesetAssetId);
+      if (tileset == nullptr) return;
+      const auto slice = assetManager.GetAtlasSlice(layer.tilesetAssetId);
+      const SDL_FRect atlasOffset = slice.has_value() ? *slice : SDL_FRect{0, 0, 0, 0};
+
+      for (int cy = range.y0; cy <= range.y1; ++cy) {
+        for (int cx = range.x0; cx <= range.x1; ++cx) {
+          SDL_Texture* chunk =
+              cache_.Acquire(sdlRenderer, entity, layer, cx, cy, tileset, atlasOffset, textureGeneration);
+          if (chunk == nullptr) continue;
+          float w = 0.0f;
+          float h = 0.0f;
+          SDL_GetTextureSize(chunk, &w, &h);
+          const float worldX = layer.origin.x + static_cast<float>(cx) * layer.ChunkWorldWidth();
+          const float worldY = layer.origin.y + static_cast<float>(cy) * layer.ChunkWorldHeight();
+          EmitChunk(renderQueue, static_cast<unsigned int>(layer.layer), worldX, worldY, camera, chunk, w, h);
+          ++emplaced;
+        }
+      }
+    });
+    PROFILE_COUNTER_SET("RenderTilemap: Chunks emplaced", emplaced);
+    PROFILE_COUNTER_SET("RenderTilemap: Chunk bakes", static_cast<long long>(cache_.GetStats().bakes));
+    PROFILE_COUNTER_SET("RenderTilemap: Chunks resident", static_cast<long long>(cache_.GetStats().chunks));
+    cache_.EndFrame();
+  }
+
+  // One chunk's quad, drawn unrotated and untinted at its world position. The pool hands back
+  // last frame's payload in the slot, so every field is reset before the chunk's are written.
+  static void EmitChunk(RenderQueue& renderQueue, const unsigned int layer, const float worldX, const float worldY,
+                        const octarine::Rect& camera, SDL_Texture* chunk, const float w, const float h) {
+    SpriteCommand& cmd = renderQueue.EmplaceSprite(layer, worldY, chunk);
+    cmd = SpriteCommand{};
+    cmd.destX = worldX - camera.x;
+    cmd.destY = worldY - camera.y;
+    cmd.destW = w;
+    cmd.destH = h;
+    cmd.srcRect = {0.0f, 0.0f, w, h};
+    cmd.texture = chunk;
+  }
+
+ private:
+  TilemapChunkCache cache_;
+  std::unique_ptr<ComponentQuery<TilemapLayerComponent>> query_;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <string>
+
+#include "ECS/Iterable.h"
+#include "ECS/Registry.h"
+#include "Engine/EngineContext.h"
+#include "General/Logger.h"
+#include "General/PerfUtils.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/UICanvasCache.h"
+
+// Producer for cached UI canvases: one quad per canvas whose texture is current or is redrawn this
+// frame, creating the canvas's render-target texture on its first bake or a resize. Runs after
+// UILayoutSystem has settled each canvas's mode and before RenderUISpriteSystem / RenderTextSystem
+// route the canvases' entities; FrameLoop draws the frame's bake before the scene. Serial: the
+// cache is single-threaded.
+class RenderUICanvasSystem {
+ public:
+  void operator()(const ContextFacade& ctx, const Iterable& /*iter*/) const {
+    Registry* registry = ctx.GetRegistry();
+    auto* canvasCache = registry->TryGet<UICanvasCache>();
+    if (canvasCache == nullptr) return;
+    SDL_Renderer* sdlRenderer = registry->Get<EngineContext>().sdlRenderer;
+    canvasCache->Composite(registry->Get<RenderQueue>(),
+                           [sdlRenderer](const int width, const int height) {
+                             return CreateTarget(sdlRenderer, width, height);
+                           });
+    [[maybe_unused]] const UICanvasCache::Stats stats = canvasCache->GetStats();
+    PROFILE_COUNTER_SET("UICanvas: Resident", static_cast<long long>(stats.canvases));
+    PROFILE_COUNTER_SET("UICanvas: Bakes", static_cast<long long>(stats.bakes));
+  }
+
+ private:
+  // A transparent render target for a canvas. Its pixels end up premultiplied (see UICanvasCache),
+  // so it composites with the premultiplied blend. nullptr (logged) leaves the canvas uncached.
+  static SDL_Texture* CreateTarget(SDL_Renderer* sdlRenderer, const int width, const int height) {
+    if (sdlRenderer == nullptr) return nullptr;
+    SDL_Texture* texture =
+        SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (texture == nullptr) {
+      Logger::Error("RenderUICanvas: SDL_CreateTexture failed: " + std::string(SDL_GetError()));
+      return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    return texture;
+  }
+};
@@ -13,39 +13,32 @@
 #include "General/PerfUtils.h"
 #include "General/SpriteFlip.h"
 #include "Renderer/RenderQueue.h"
-#include "Renderer/SpriteRenderCache.h"
+#include "Renderer/UICanvasCache.h"
 
 // Renders SpriteComponent entities whose position is driven by UIRectComponent (layout-driven UI
 // sprites). Runs as a serial RegisterSystem after UILayoutSystem. World sprites without
-// UIRectComponent continue through the parallel RenderSpriteSystem path unchanged.
+// UIRectComponent continue through the parallel RenderSpriteSystem path unchanged. Sprites under
+// a cached canvas go where UICanvasCache routes them: nowhere while the canvas texture is current,
+// into its bake queue when it redraws.
 class RenderUISpriteSystem {
  public:
   void Prepare(Registry* registry) {
     assetManager_ = &registry->Get<AssetManager>();
     renderQueue_ = &registry->Get<RenderQueue>();
-    spriteCache_ = &registry->Get<SpriteRenderCache>();
+    canvasCache_ = registry->TryGet<UICanvasCache>();
   }
 
-  void operator()(Entity entity, const UIRectComponent& rect, const SpriteComponent& sprite) const {
-    const SpriteRenderCache::Entry* entry = spriteCache_->Lookup(entity, assetManager_->TextureGeneration());
-    if (!entry || !entry->texture) {
-      // Warm the cache entry on demand (should rarely happen; the world sprite warming path
-      // covers most entities, but pure-UI sprites without GlobalTransformComponent are missed).
-      SDL_Texture* texture = assetManager_->GetTexture(sprite.assetId);
-      const auto slice = assetManager_->GetAtlasSlice(sprite.assetId);
-      const SDL_FRect atlasOffset = slice.has_value() ? *slice : SDL_FRect{0, 0, 0, 0};
-      spriteCache_->Store(entity, texture, atlasOffset, assetManager_->TextureGeneration());
-      entry = spriteCache_->Lookup(entity, assetManager_->TextureGeneration());
-      if (!entry) return;
-    }
-
-    SDL_Texture* texture = entry->texture;
-    const SDL_FRect atlasOffset = entry->atlasOffset;
+  void operator()(Entity /*entity*/, const UIRectComponent& rect, const SpriteComponent& sprite) const {
+    RenderQueue* queue = canvasCache_ != nullptr ? canvasCache_->Route(rect.cacheSlot, *renderQueue_) : renderQueue_;
+    if (queue == nullptr) return;
+    const ResolvedAsset resolved = assetManager_->ResolveTexture(sprite.texture, sprite.assetId);
+    SDL_Texture* texture = resolved.texture;
+    const SDL_FRect atlasOffset = resolved.atlasOffset;
 
     const float destW = rect.Width();
     const float destH = rect.Height();
 
-    auto& cmd = renderQueue_->EmplaceSprite(static_cast<unsigned int>(rect.layer), rect.top, texture, sprite.blendMode);
+    auto& cmd = queue->EmplaceSprite(static_cast<unsigned int>(rect.layer), rect.top, texture, sprite.blendMode);
     cmd.destX = rect.left;
     cmd.destY = rect.top;
     cmd.destW = destW;
@@ -66,5 +59,5 @@ class RenderUISpriteSystem {
  private:
   AssetManager* assetManager_ = nullptr;
   RenderQueue* renderQueue_ = nullptr;
-  SpriteRenderCache* spriteCache_ = nullptr;
+  UICanvasCache* canvasCache_ = nullptr;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "Components/ScriptComponent.h"
@@ -8,21 +9,30 @@
 #include "Events/CollisionBatchEvent.h"
 #include "Events/CollisionExitBatchEvent.h"
 #include "General/Logger.h"
+#include "Systems/CollisionRouting.h"
 
 class ScriptCollisionSystem {
  public:
   void Init(Registry* registry, const std::unique_ptr<EventBus>& eventBus) {
     registry_ = registry;
+    router_ = &CollisionRouter::Instance(*registry_);
+    router_->DefineRole(kRoleScriptListener, registry_->Component<ScriptComponent>());
     enterSubscription_ = eventBus->SubscribeEvent<ScriptCollisionSystem, CollisionBatchEvent>(
         this, &ScriptCollisionSystem::OnCollisionBatch);
     exitSubscription_ = eventBus->SubscribeEvent<ScriptCollisionSystem, CollisionExitBatchEvent>(
         this, &ScriptCollisionSystem::OnCollisionExitBatch);
   }
 
+  // on_collision(self, entity, other, toi): toi is the pair's time of impact within the collision
+  // pass (< 1 only when a continuous collider was involved); scripts that don't take it ignore it.
+  // Only pairs CollisionRouter tagged as having a script on either side are visited.
   void OnCollisionBatch(const CollisionBatchEvent& event) {
-    for (const auto& [a, b] : event.pairs) {
-      FireEnterCallback(a, b);
-      FireEnterCallback(b, a);
+    const CollisionRoutes& routes = event.routes ? *event.routes : router_->Route(*registry_, event.entering);
+    for (const std::uint32_t i : routes.script) {
+      const auto& [a, b] = event.entering[i];
+      const float toi = i < event.enteringToi.size() ? event.enteringToi[i] : 1.0f;
+      FireEnterCallback(a, b, toi);
+      FireEnterCallback(b, a, toi);
     }
   }
 
@@ -34,7 +44,7 @@ class ScriptCollisionSystem {
   }
 
  private:
-  void FireEnterCallback(const Entity self, const Entity other) const {
+  void FireEnterCallback(const Entity self, const Entity other, const float toi) const {
     if (!registry_->HasComponent<ScriptComponent>(self)) {
       return;
     }
@@ -42,7 +52,7 @@ class ScriptCollisionSystem {
     if (script.onCollisionFunction == sol::lua_nil) {
       return;
     }
-    if (auto result = script.onCollisionFunction(script.scriptTable, self, other); !result.valid()) {
+    if (auto result = script.onCollisionFunction(script.scriptTable, self, other, toi); !result.valid()) {
       const sol::error err = result;
       Logger::ErrorLua(std::string(err.what()));
     }
@@ -63,6 +73,7 @@ class ScriptCollisionSystem {
   }
 
   Registry* registry_ = nullptr;
+  CollisionRouter* router_ = nullptr;
   EventBus::SubscriptionHandle enterSubscription_;
   EventBus::SubscriptionHandle exitSubscription_;
 };
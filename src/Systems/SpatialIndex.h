@@ -0,0 +1,361 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "ECS/Entity.h"
+#include "Systems/CollisionBox.h"
+
+// One hit from SpatialIndex::Raycast / RaycastAll: the entity, the distance along the ray (in world
+// units, 0 when the ray starts inside the collider) and the world-space entry point.
+struct RayHit {
+  Entity entity;
+  float distance;
+  float x;
+  float y;
+};
+
+// One result from SpatialIndex::Nearest: the entity and the distance from the query point to the
+// closest point of its collider (0 when the point is inside).
+struct NearestHit {
+  Entity entity;
+  float distance;
+};
+
+// Read-only spatial index over the collider boxes of the last completed collision pass, for
+// gameplay "what is near here" queries (AI target acquisition, line of sight, area damage).
+//
+// CollisionSystem builds it on the detection worker right after the broadphase, from the same box
+// set, using the same median cut (nth_element on the box centre, alternating to the wider axis) —
+// but kept as a flat bounding-volume tree instead of being thrown away, so queries are O(log n +
+// hits). The index is double-buffered: queries always see the last *completed* pass (the same
+// one-frame lag as CollisionSystem::IsOverlapping), and a build never touches the published copy.
+//
+// All queries are const and allocation-free past the caller's output vector, which is cleared and
+// refilled (its capacity kept), so one vector can be reused across calls. Queries may run
+// concurrently from parallel systems. Every query takes an EntityMask filter: a collider is a
+// candidate only if its entity mask shares at least one bit with `mask` (pass kAllMasks for no
+// filtering). Shapes are tested exactly against the collider OBB, not just its AABB.
+//
+// Handles come from last pass's snapshot; an entity despawned since then can still be returned, so
+// callers that touch components should check Registry::IsAlive first.
+class SpatialIndex {
+ public:
+  static inline const EntityMask kAllMasks = EntityMask{}.set();
+
+  // Take ownership of `boxes` and build the tree over them (reorders the boxes).
+  void Build(std::vector<Box> boxes) {
+    boxes_ = std::move(boxes);
+    nodes_.clear();
+    if (boxes_.empty()) return;
+    nodes_.reserve(2 * (boxes_.size() / kLeafSize + 1));
+    BuildNode(0, static_cast<std::uint32_t>(boxes_.size()), 0);
+  }
+
+  // Hand the box storage back (cleared, capacity kept) so the next gather reuses it, and empty the
+  // index. The node array keeps its capacity for the next Build.
+  std::vector<Box> TakeBoxes() {
+    std::vector<Box> boxes = std::move(boxes_);
+    boxes_.clear();
+    nodes_.clear();
+    boxes.clear();
+    return boxes;
+  }
+
+  [[nodiscard]] size_t Size() const { return boxes_.size(); }
+
+  // Every collider overlapping the axis-aligned rectangle [minX, maxX] x [minY, maxY].
+  void QueryAabb(const float minX, const float minY, const float maxX, const float maxY, const EntityMask mask,
+                 std::vector<Entity>& out) const {
+    out.clear();
+    if (nodes_.empty()) return;
+    const float hx = (maxX - minX) * 0.5f;
+    const float hy = (maxY - minY) * 0.5f;
+    const Box query{Entity{}, mask, mask, minX, minY, maxX, maxY, minX + hx, minY + hy, hx, hy, 1.0f, 0.0f, false};
+    Traverse(
+        [&](const Node& node) {
+          return node.minX <= maxX && node.maxX >= minX && node.minY <= maxY && node.maxY >= minY;
+        },
+        [&](const Box& box) {
+          if (!Matches(box, mask)) return;
+          if (box.rotated) {
+            if (box.maxX < minX || box.minX > maxX || box.maxY < minY || box.minY > maxY) return;
+            if (!box.obbIntersects(query)) return;
+          } else if (std::abs(box.cx - query.cx) > box.hx + hx || std::abs(box.cy - query.cy) > box.hy + hy) {
+            // Centre/extent form rather than box.minX..maxX: a continuous collider's AABB covers its
+            // whole sweep, but queries answer for where it is now.
+            return;
+          }
+          out.push_back(box.entity);
+        });
+  }
+
+  // Every collider overlapping the circle of `radius` around (x, y).
+  void QueryCircle(const float x, const float y, const float radius, const EntityMask mask,
+                   std::vector<Entity>& out) const {
+    out.clear();
+    if (nodes_.empty() || radius < 0.0f) return;
+    const float radiusSq = radius * radius;
+    Traverse([&](const Node& node) { return DistanceSqToNode(node, x, y) <= radiusSq; },
+             [&](const Box& box) {
+               if (Matches(box, mask) && DistanceSqToBox(box, x, y) <= radiusSq) out.push_back(box.entity);
+             });
+  }
+
+  // Closest collider hit by the ray from (ox, oy) along (dx, dy) within `maxDistance`, or nullopt.
+  // The direction need not be normalized; a zero direction hits nothing.
+  [[nodiscard]] std::optional<RayHit> Raycast(const float ox, const float oy, const float dx, const float dy,
+                                              const float maxDistance, const EntityMask mask) const {
+    return Raycast(ox, oy, dx, dy, maxDistance, mask, [](Entity) { return true; });
+  }
+
+  // Same, skipping colliders whose entity fails `accept(Entity)` — e.g. Registry::IsAlive, so an
+  // entity despawned since the last pass doesn't hide a live one behind it. The tree still prunes
+  // against the nearest accepted hit.
+  template <typename Accept>
+  [[nodiscard]] std::optional<RayHit> Raycast(const float ox, const float oy, const float dx, const float dy,
+                                              const float maxDistance, const EntityMask mask, Accept&& accept) const {
+    const std::optional<Ray> ray = MakeRay(ox, oy, dx, dy, maxDistance);
+    if (!ray || nodes_.empty()) return std::nullopt;
+
+    std::optional<RayHit> best;
+    float bestT = ray->maxT;
+    // Nearer child first, and anything entering beyond the current best hit is skipped.
+    std::array<std::uint32_t, kMaxStackDepth> stack{};
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+      const Node& node = nodes_[stack[--top]];
+      if (RayNodeEntry(*ray, node) > bestT) continue;
+      if (node.left == kNoChild) {
+        for (std::uint32_t i = node.begin; i < node.end; ++i) {
+          const Box& box = boxes_[i];
+          if (!Matches(box, mask)) continue;
+          const float t = RayBoxEntry(*ray, box);
+          if (t <= bestT && accept(box.entity)) {
+            bestT = t;
+            best = RayHit{box.entity, t, ray->ox + ray->dx * t, ray->oy + ray->dy * t};
+          }
+        }
+        continue;
+      }
+      const float tLeft = RayNodeEntry(*ray, nodes_[node.left]);
+      const float tRight = RayNodeEntry(*ray, nodes_[node.right]);
+      if (tLeft <= tRight) {
+        stack[top++] = node.right;
+        stack[top++] = node.left;
+      } else {
+        stack[top++] = node.left;
+        stack[top++] = node.right;
+      }
+    }
+    return best;
+  }
+
+  // Every collider hit by the ray within `maxDistance`, sorted nearest first.
+  void RaycastAll(const float ox, const float oy, const float dx, const float dy, const float maxDistance,
+                  const EntityMask mask, std::vector<RayHit>& out) const {
+    out.clear();
+    const std::optional<Ray> ray = MakeRay(ox, oy, dx, dy, maxDistance);
+    if (!ray || nodes_.empty()) return;
+    Traverse([&](const Node& node) { return RayNodeEntry(*ray, node) <= ray->maxT; },
+             [&](const Box& box) {
+               if (!Matches(box, mask)) return;
+               const float t = RayBoxEntry(*ray, box);
+               if (t <= ray->maxT) out.push_back({box.entity, t, ray->ox + ray->dx * t, ray->oy + ray->dy * t});
+             });
+    std::sort(out.begin(), out.end(), [](const RayHit& a, const RayHit& b) { return a.distance < b.distance; });
+  }
+
+  // The `k` colliders closest to (x, y), sorted nearest first. `out` doubles as the bounded max-heap
+  // during the search, so a k-sized vector is the only storage touched.
+  void Nearest(const float x, const float y, const size_t k, const EntityMask mask,
+               std::vector<NearestHit>& out) const {
+    out.clear();
+    if (k == 0 || nodes_.empty()) return;
+    const auto farther = [](const NearestHit& a, const NearestHit& b) { return a.distance < b.distance; };
+
+    // Squared distances during the search; converted once at the end.
+    std::array<std::uint32_t, kMaxStackDepth> stack{};
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+      const Node& node = nodes_[stack[--top]];
+      if (out.size() == k && DistanceSqToNode(node, x, y) > out.front().distance) continue;
+      if (node.left == kNoChild) {
+        for (std::uint32_t i = node.begin; i < node.end; ++i) {
+          const Box& box = boxes_[i];
+          if (!Matches(box, mask)) continue;
+          const float dSq = DistanceSqToBox(box, x, y);
+          if (out.size() < k) {
+            out.push_back({box.entity, dSq});
+            std::push_heap(out.begin(), out.end(), farther);
+          } else if (dSq < out.front().distance) {
+            std::pop_heap(out.begin(), out.end(), farther);
+            out.back() = {box.entity, dSq};
+            std::push_heap(out.begin(), out.end(), farther);
+          }
+        }
+        continue;
+      }
+      const float dLeft = DistanceSqToNode(nodes_[node.left], x, y);
+      const float dRight = DistanceSqToNode(nodes_[node.right], x, y);
+      if (dLeft <= dRight) {
+        stack[top++] = node.right;
+        stack[top++] = node.left;
+      } else {
+        stack[top++] = node.left;
+        stack[top++] = node.right;
+      }
+    }
+    std::sort_heap(out.begin(), out.end(), farther);
+    for (NearestHit& hit : out) hit.distance = std::sqrt(hit.distance);
+  }
+
+ private:
+  // Median splits halve the range each level, so depth is bounded by log2(n / kLeafSize) + 1; a
+  // DFS stack never holds more than depth + 1 entries.
+  static constexpr std::uint32_t kLeafSize = 8;
+  static constexpr size_t kMaxStackDepth = 64;
+  static constexpr std::uint32_t kNoChild = std::numeric_limits<std::uint32_t>::max();
+
+  struct Node {
+    float minX, minY, maxX, maxY;
+    std::uint32_t begin, end;  // box range (all nodes, so leaves need no extra lookup)
+    std::uint32_t left = kNoChild;
+    std::uint32_t right = kNoChild;
+  };
+
+  // Normalized ray; maxT is in world units along the normalized direction.
+  struct Ray {
+    float ox, oy;
+    float dx, dy;
+    float maxT;
+  };
+
+  std::vector<Box> boxes_;
+  std::vector<Node> nodes_;
+
+  // NOLINTNEXTLINE(misc-no-recursion)
+  std::uint32_t BuildNode(const std::uint32_t begin, const std::uint32_t end, const int depth) {
+    const auto index = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.push_back({});
+
+    Node node{boxes_[begin].minX, boxes_[begin].minY, boxes_[begin].maxX, boxes_[begin].maxY, begin, end};
+    for (std::uint32_t i = begin + 1; i < end; ++i) {
+      node.minX = std::min(node.minX, boxes_[i].minX);
+      node.minY = std::min(node.minY, boxes_[i].minY);
+      node.maxX = std::max(node.maxX, boxes_[i].maxX);
+      node.maxY = std::max(node.maxY, boxes_[i].maxY);
+    }
+
+    if (end - begin > kLeafSize && depth + 1 < static_cast<int>(kMaxStackDepth) - 1) {
+      // Same median cut as the broadphase, on the wider axis of this node.
+      const bool splitX = node.maxX - node.minX >= node.maxY - node.minY;
+      const std::uint32_t mid = begin + (end - begin) / 2;
+      std::nth_element(boxes_.begin() + begin, boxes_.begin() + mid, boxes_.begin() + end,
+                       [splitX](const Box& a, const Box& b) {
+                         return splitX ? a.minX + a.maxX < b.minX + b.maxX : a.minY + a.maxY < b.minY + b.maxY;
+                       });
+      node.left = BuildNode(begin, mid, depth + 1);
+      node.right = BuildNode(mid, end, depth + 1);
+    }
+    nodes_[index] = node;
+    return index;
+  }
+
+  // Depth-first walk visiting every box in every node accepted by `enterNode`.
+  template <typename NodeFn, typename BoxFn>
+  void Traverse(NodeFn&& enterNode, BoxFn&& visitBox) const {
+    std::array<std::uint32_t, kMaxStackDepth> stack{};
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+      const Node& node = nodes_[stack[--top]];
+      if (!enterNode(node)) continue;
+      if (node.left == kNoChild) {
+        for (std::uint32_t i = node.begin; i < node.end; ++i) visitBox(boxes_[i]);
+        continue;
+      }
+      stack[top++] = node.right;
+      stack[top++] = node.left;
+    }
+  }
+
+  [[nodiscard]] static bool Matches(const Box& box, const EntityMask& mask) { return (box.entityMask & mask).any(); }
+
+  [[nodiscard]] static float DistanceSqToNode(const Node& node, const float x, const float y) {
+    const float dx = std::max({node.minX - x, 0.0f, x - node.maxX});
+    const float dy = std::max({node.minY - y, 0.0f, y - node.maxY});
+    return dx * dx + dy * dy;
+  }
+
+  // Distance from a point to the OBB: rotate into the box frame, clamp to the half extents.
+  [[nodiscard]] static float DistanceSqToBox(const Box& box, const float x, const float y) {
+    const float px = x - box.cx;
+    const float py = y - box.cy;
+    const float lx = px * box.rotCos + py * box.rotSin;
+    const float ly = -px * box.rotSin + py * box.rotCos;
+    const float dx = std::max(std::abs(lx) - box.hx, 0.0f);
+    const float dy = std::max(std::abs(ly) - box.hy, 0.0f);
+    return dx * dx + dy * dy;
+  }
+
+  [[nodiscard]] static std::optional<Ray> MakeRay(const float ox, const float oy, const float dx, const float dy,
+                                                  const float maxDistance) {
+    const float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f || maxDistance < 0.0f) return std::nullopt;
+    // Keep maxT strictly below the slab test's miss sentinel so "unbounded" rays still reject misses.
+    constexpr float kMaxRayDistance = 1e30f;
+    return Ray{ox, oy, dx / length, dy / length, std::min(maxDistance, kMaxRayDistance)};
+  }
+
+  // Slab test against [minX, maxX] x [minY, maxY] for a ray in the same frame. Returns the entry t
+  // (clamped to 0 when starting inside), or FLT_MAX on a miss (finite, so it stays valid under
+  // -ffast-math).
+  [[nodiscard]] static float SlabEntry(const float ox, const float oy, const float dx, const float dy,
+                                       const float minX, const float minY, const float maxX, const float maxY) {
+    constexpr float kMiss = std::numeric_limits<float>::max();
+    float tMin = 0.0f;
+    float tMax = kMiss;
+    const float origin[2] = {ox, oy};
+    const float dir[2] = {dx, dy};
+    const float lo[2] = {minX, minY};
+    const float hi[2] = {maxX, maxY};
+    for (int axis = 0; axis < 2; ++axis) {
+      if (dir[axis] == 0.0f) {
+        if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) return kMiss;
+        continue;
+      }
+      const float inv = 1.0f / dir[axis];
+      float t0 = (lo[axis] - origin[axis]) * inv;
+      float t1 = (hi[axis] - origin[axis]) * inv;
+      if (t0 > t1) std::swap(t0, t1);
+      tMin = std::max(tMin, t0);
+      tMax = std::min(tMax, t1);
+      if (tMin > tMax) return kMiss;
+    }
+    return tMin;
+  }
+
+  [[nodiscard]] static float RayNodeEntry(const Ray& ray, const Node& node) {
+    return SlabEntry(ray.ox, ray.oy, ray.dx, ray.dy, node.minX, node.minY, node.maxX, node.maxY);
+  }
+
+  // Ray vs OBB: the same slab test with the ray rotated into the box frame (rotation preserves t).
+  [[nodiscard]] static float RayBoxEntry(const Ray& ray, const Box& box) {
+    const float px = ray.ox - box.cx;
+    const float py = ray.oy - box.cy;
+    const float lox = px * box.rotCos + py * box.rotSin;
+    const float loy = -px * box.rotSin + py * box.rotCos;
+    const float ldx = ray.dx * box.rotCos + ray.dy * box.rotSin;
+    const float ldy = -ray.dx * box.rotSin + ray.dy * box.rotCos;
+    return SlabEntry(lox, loy, ldx, ldy, -box.hx, -box.hy, box.hx, box.hy);
+  }
+};
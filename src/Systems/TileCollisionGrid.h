@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Components/TilemapLayerComponent.h"
+#include "ECS/Query.h"
+#include "ECS/Registry.h"
+#include "General/Logger.h"
+#include "General/PerfUtils.h"
+
+// Solid-tile occupancy for collision, built from the scene's solid TilemapLayerComponents — tiles
+// collide without becoming entities. Solid cells are merged greedily into maximal rectangles
+// (run right, then grow down over identical runs), so a floor is one box rather than a row of
+// tiles: fewer contacts, and a body sliding along it has no internal tile seams to catch on.
+//
+// PhysicsSolverSystem turns the rects overlapping each simulated body into static solver bodies,
+// and the Lua `tilemap.is_solid` binding reads cells directly. Registry singleton; Sync() rebuilds it
+// when a solid layer is added, removed or edited. Single-threaded — queries use a scratch list.
+class TileCollisionGrid {
+ public:
+  struct SolidRect {
+    float minX, minY, maxX, maxY;  // world space
+  };
+
+  static constexpr std::uint32_t kNoRect = UINT32_MAX;
+
+  // Rebuild from the registry's solid layers if any changed since the last Sync.
+  void Sync(Registry& registry) {
+    if (!query_) query_ = registry.CreateQuery<TilemapLayerComponent>();
+    query_->Update();
+    std::uint64_t version = query_->MembershipVersion() << 1;
+    solidLayers_.clear();
+    query_->ForEach([&](const TilemapLayerComponent& layer) {
+      if (!layer.solid) return;
+      version += (layer.revision << 1) | 1;
+      solidLayers_.push_back(&layer);
+    });
+    if (version == version_) return;
+    version_ = version;
+    PROFILE_NAMED_SCOPE("TileCollisionGrid: Build");
+    Build(solidLayers_);
+  }
+
+  // The first layer fixes the grid's origin and cell size; later layers with the same tile size
+  // and origin are OR'd in (the grid grows to the largest), anything else is skipped with a warning.
+  void Build(const std::span<const TilemapLayerComponent* const> layers) {
+    width_ = 0;
+    height_ = 0;
+    solid_.clear();
+    cellRect_.clear();
+    rects_.clear();
+    const TilemapLayerComponent* base = nullptr;
+    for (const TilemapLayerComponent* layer : layers) {
+      if (layer->tileWidth <= 0 || layer->tileHeight <= 0) continue;
+      if (base == nullptr) {
+        base = layer;
+      } else if (layer->tileWidth != base->tileWidth || layer->tileHeight != base->tileHeight ||
+                 layer->origin != base->origin) {
+        Logger::Warn("TileCollisionGrid: solid layer '" + layer->name + "' does not line up with '" + base->name +
+                     "' (tile size or origin differ); it will not collide.");
+        continue;
+      }
+      width_ = std::max(width_, layer->width);
+      height_ = std::max(height_, layer->height);
+    }
+    if (base == nullptr || width_ <= 0 || height_ <= 0) return;
+    origin_ = base->origin;
+    cellW_ = static_cast<float>(base->tileWidth);
+    cellH_ = static_cast<float>(base->tileHeight);
+    solid_.assign(CellCount(), 0);
+    for (const TilemapLayerComponent* layer : layers) {
+      if (layer->tileWidth != base->tileWidth || layer->tileHeight != base->tileHeight ||
+          layer->origin != base->origin) {
+        continue;
+      }
+      for (int y = 0; y < layer->height; ++y) {
+        for (int x = 0; x < layer->width; ++x) {
+          if (layer->TileAt(x, y) != TilemapLayerComponent::kEmptyTile) solid_[Index(x, y)] = 1;
+        }
+      }
+    }
+    MergeRects();
+  }
+
+  [[nodiscard]] bool Empty() const { return rects_.empty(); }
+  [[nodiscard]] const std::vector<SolidRect>& Rects() const { return rects_; }
+
+  [[nodiscard]] bool IsSolidCell(const int x, const int y) const {
+    return x >= 0 && y >= 0 && x < width_ && y < height_ && solid_[Index(x, y)] != 0;
+  }
+
+  [[nodiscard]] bool IsSolidAt(const float worldX, const float worldY) const {
+    if (rects_.empty()) return false;
+    return IsSolidCell(CellX(worldX), CellY(worldY));
+  }
+
+  // func(rectId, const SolidRect&) once per merged rect overlapping the world box. Rect ids are
+  // stable until the next rebuild, so callers can key per-contact state on them.
+  template <typename Func>
+  void ForEachRectOverlapping(const float minX, const float minY, const float maxX, const float maxY,
+                              Func&& func) const {
+    if (rects_.empty()) return;
+    const int x0 = std::max(0, CellX(minX));
+    const int y0 = std::max(0, CellY(minY));
+    const int x1 = std::min(width_ - 1, CellX(maxX));
+    const int y1 = std::min(height_ - 1, CellY(maxY));
+    scratch_.clear();
+    for (int y = y0; y <= y1; ++y) {
+      for (int x = x0; x <= x1; ++x) {
+        const std::uint32_t rect = cellRect_[Index(x, y)];
+        if (rect == kNoRect || std::ranges::find(scratch_, rect) != scratch_.end()) continue;
+        scratch_.push_back(rect);
+        func(rect, rects_[rect]);
+      }
+    }
+  }
+
+ private:
+  [[nodiscard]] size_t CellCount() const { return static_cast<size_t>(width_) * static_cast<size_t>(height_); }
+  [[nodiscard]] size_t Index(const int x, const int y) const {
+    return static_cast<size_t>(y) * static_cast<size_t>(width_) + static_cast<size_t>(x);
+  }
+
+  // World coordinate -> cell coordinate, clamped to [-1, size] so far-off boxes can't overflow the cast.
+  [[nodiscard]] int CellX(const float worldX) const {
+    return static_cast<int>(std::clamp(std::floor((worldX - origin_.x) / cellW_), -1.0f, static_cast<float>(width_)));
+  }
+  [[nodiscard]] int CellY(const float worldY) const {
+    return static_cast<int>(std::clamp(std::floor((worldY - origin_.y) / cellH_), -1.0f, static_cast<float>(height_)));
+  }
+
+  [[nodiscard]] bool Free(const int x, const int y) const {
+    return solid_[Index(x, y)] != 0 && cellRect_[Index(x, y)] == kNoRect;
+  }
+
+  void MergeRects() {
+    cellRect_.assign(CellCount(), kNoRect);
+    for (int y = 0; y < height_; ++y) {
+      for (int x = 0; x < width_; ++x) {
+        if (!Free(x, y)) continue;
+        int xEnd = x + 1;
+        while (xEnd < width_ && Free(xEnd, y)) ++xEnd;
+        int yEnd = y + 1;
+        for (; yEnd < height_; ++yEnd) {
+          bool fullRun = true;
+          for (int cx = x; cx < xEnd && fullRun; ++cx) fullRun = Free(cx, yEnd);
+          if (!fullRun) break;
+        }
+        const auto id = static_cast<std::uint32_t>(rects_.size());
+        for (int cy = y; cy < yEnd; ++cy) {
+          for (int cx = x; cx < xEnd; ++cx) cellRect_[Index(cx, cy)] = id;
+        }
+        rects_.push_back({origin_.x + static_cast<float>(x) * cellW_, origin_.y + static_cast<float>(y) * cellH_,
+                          origin_.x + static_cast<float>(xEnd) * cellW_,
+                          origin_.y + static_cast<float>(yEnd) * cellH_});
+      }
+    }
+  }
+
+  glm::vec2 origin_{0.0f, 0.0f};
+  float cellW_ = 1.0f;
+  float cellH_ = 1.0f;
+  int width_ = 0;
+  int height_ = 0;
+  std::vector<std::uint8_t> solid_;
+  std::vector<std::uint32_t> cellRect_;  // cell -> merged rect id, kNoRect for open cells
+  std::vector<SolidRect> rects_;
+  mutable std::vector<std::uint32_t> scratch_;  // rects already reported by the current query
+
+  std::unique_ptr<ComponentQuery<TilemapLayerComponent>> query_;
+  std::vector<const TilemapLayerComponent*> solidLayers_;
+  std::uint64_t version_ = 0;
+};
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <glm/glm.hpp>
+#include <limits>
 #include <stack>
 #include <vector>
 
@@ -9,6 +11,7 @@
 #include "Components/PositionComponent.h"
 #include "Components/RotationComponent.h"
 #include "Components/ScaleComponent.h"
+#include "Components/SpriteComponent.h"
 #include "ECS/Iterable.h"
 #include "ECS/Query.h"
 #include "ECS/Registry.h"
@@ -24,6 +27,10 @@ struct TransformUpdateJob {
 
 class TransformSystem {
  public:
+  // chunkBounds: after globals are resolved, also record each sprite chunk's world bounds so
+  // RenderSpriteSystem can reject off-camera chunks whole (EngineOptions::chunkCulling).
+  explicit TransformSystem(const bool chunkBounds = false) : chunkBounds_(chunkBounds) {}
+
   void operator()(const ContextFacade& ctx, const Iterable& /*iter*/) {
     auto* registry = ctx.GetRegistry();
     EnsureInitialized(registry);
@@ -34,6 +41,11 @@ class TransformSystem {
     } else {
       UpdateHierarchical(registry);
     }
+
+    if (boundsQuery_) {
+      boundsQuery_->Update();
+      UpdateChunkBounds();
+    }
   }
 
  private:
@@ -48,6 +60,7 @@ class TransformSystem {
     scaleEntity_ = registry->Component<ScaleComponent>();
     rotEntity_ = registry->Component<RotationComponent>();
     globalEntity_ = registry->Component<GlobalTransformComponent>();
+    if (chunkBounds_) boundsQuery_ = registry->CreateQuery<GlobalTransformComponent, SpriteComponent>();
   }
 
   // The per-entity body is a handful of copies, so thread-pool dispatch (~13.5 us fixed) only
@@ -57,9 +70,30 @@ class TransformSystem {
 
   // Fast path: no ChildOf hierarchy live. Unrelated relationship pairs do not disable it.
   // Each entity's global is its local (identity for missing slots), in a single parallel pass.
+  // With chunk bounds on, the pass runs chunk-at-a-time to note which chunks had an entity move
+  // or rescale — compared against the global it overwrites, so the check reads nothing extra —
+  // and invalidates only those chunks' bounds.
   void UpdateFlat() {
     PROFILE_NAMED_SCOPE("TransformSystem: Fast");
     LogPathOnce("TransformSystem: FAST path (no hierarchy)");
+    if (chunkBounds_) {
+      optionalQuery_->ParallelForEachChunk(
+          [](Archetype& archetype, const size_t chunkIdx, const size_t count, GlobalTransformComponent* globals,
+             const PositionComponent* p, const ScaleComponent* s, const RotationComponent* r) {
+            bool moved = false;
+            for (size_t i = 0; i < count; ++i) {
+              const glm::vec2 position = p ? p[i].value : glm::vec2(0.0f, 0.0f);
+              const glm::vec2 scale = s ? s[i].value : glm::vec2(1.0f, 1.0f);
+              moved |= globals[i].position != position || globals[i].scale != scale;
+              globals[i].position = position;
+              globals[i].scale = scale;
+              globals[i].rotation = r ? r[i].value : 0.0;
+            }
+            if (moved) archetype.InvalidateChunkBounds(chunkIdx);
+          },
+          kFlatSerialBelowEntities);
+      return;
+    }
     optionalQuery_->ParallelForEach(
         [](GlobalTransformComponent& global, const PositionComponent* p, const ScaleComponent* s,
            const RotationComponent* r) {
@@ -132,6 +166,72 @@ class TransformSystem {
     }
   }
 
+  // Recompute bounds for the sprite chunks that lost them: the union of the sprite rects
+  // (position + size*scale, rotation ignored — the same box the per-entity cull tests). A chunk
+  // holding any isFixed sprite stays invalid: those are screen-space and must never be culled
+  // against the camera. Bounds are lost when an entity arrives (IncrementActive), a component is
+  // replaced, the transform pass moves one, or a later writer of GlobalTransformComponent says so
+  // (see PhysicsSolverSystem).
+  //
+  // Sprite size and isFixed are edited in place (inspector widgets, GetComponent writes) with no
+  // hook to invalidate, so a chunk whose bounds are still valid is re-checked instead of skipped:
+  // every rect must still fit inside them and no sprite may have turned fixed. That is a read of
+  // the two columns the recompute reads, without the writes; a sprite that shrank leaves the
+  // bounds loose but still conservative, so only growth or isFixed forces the recompute.
+  void UpdateChunkBounds() {
+    PROFILE_NAMED_SCOPE("TransformSystem: Chunk bounds");
+    boundsQuery_->ParallelForEachChunk(
+        [](Archetype& archetype, const size_t chunkIdx, const size_t count, const GlobalTransformComponent* globals,
+           const SpriteComponent* sprites) {
+          if (const ChunkBounds& current = archetype.GetChunkBounds(chunkIdx);
+              current.valid && StillCovers(current, count, globals, sprites)) {
+            return;
+          }
+          ChunkBounds bounds;
+          bounds.minX = bounds.minY = std::numeric_limits<float>::max();
+          bounds.maxX = bounds.maxY = std::numeric_limits<float>::lowest();
+          for (size_t i = 0; i < count; ++i) {
+            if (sprites[i].isFixed) {
+              archetype.InvalidateChunkBounds(chunkIdx);
+              return;
+            }
+            const SpriteRect rect = RectOf(globals[i], sprites[i]);
+            bounds.minX = std::min(bounds.minX, rect.minX);
+            bounds.minY = std::min(bounds.minY, rect.minY);
+            bounds.maxX = std::max(bounds.maxX, rect.maxX);
+            bounds.maxY = std::max(bounds.maxY, rect.maxY);
+          }
+          bounds.valid = true;
+          archetype.SetChunkBounds(chunkIdx, bounds);
+        },
+        kFlatSerialBelowEntities);
+  }
+
+  struct SpriteRect {
+    float minX, minY, maxX, maxY;
+  };
+
+  static SpriteRect RectOf(const GlobalTransformComponent& global, const SpriteComponent& sprite) {
+    const float x0 = global.position.x;
+    const float y0 = global.position.y;
+    const float x1 = x0 + sprite.width * global.scale.x;
+    const float y1 = y0 + sprite.height * global.scale.y;
+    return {std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1)};
+  }
+
+  // True when `bounds` still hold every sprite rect in the chunk and none of them is fixed.
+  static bool StillCovers(const ChunkBounds& bounds, const size_t count, const GlobalTransformComponent* globals,
+                          const SpriteComponent* sprites) {
+    for (size_t i = 0; i < count; ++i) {
+      if (sprites[i].isFixed) return false;
+      const SpriteRect rect = RectOf(globals[i], sprites[i]);
+      if (rect.minX < bounds.minX || rect.minY < bounds.minY || rect.maxX > bounds.maxX || rect.maxY > bounds.maxY) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   struct LocalTransform {
     glm::vec2 position;
     glm::vec2 scale;
@@ -180,6 +280,7 @@ class TransformSystem {
   void WriteGlobal(Archetype* archetype, size_t chunkIdx, size_t indexInChunk, const GlobalTransform& g) const {
     auto* gArray = archetype->GetComponentArray<GlobalTransformComponent>(chunkIdx, globalEntity_.GetId());
     if (!gArray) return;
+    if (chunkBounds_) archetype->InvalidateChunkBounds(chunkIdx);
     auto& global = gArray[indexInChunk];
     global.position = g.position;
     global.scale = g.scale;
@@ -193,9 +294,11 @@ class TransformSystem {
   }
 
   std::unique_ptr<TransformQuery> optionalQuery_;
+  std::unique_ptr<ComponentQuery<GlobalTransformComponent, SpriteComponent>> boundsQuery_;
   Entity posEntity_ = {};
   Entity scaleEntity_ = {};
   Entity rotEntity_ = {};
   Entity globalEntity_ = {};
   bool loggedPath_ = false;
+  bool chunkBounds_ = false;
 };
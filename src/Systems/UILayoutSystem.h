@@ -1,9 +1,14 @@
 #pragma once
 
+#include <cmath>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "AssetManager/AssetManager.h"
+#include "Components/SpriteComponent.h"
+#include "Components/TextLabelComponent.h"
 #include "Components/UIAnchorComponent.h"
 #include "Components/UICanvasComponent.h"
 #include "Components/UIRectComponent.h"
@@ -12,7 +17,11 @@
 #include "ECS/Query.h"
 #include "ECS/Registry.h"
 #include "Game/GameConfig.h"
+#include "Renderer/UICanvasCache.h"
 
+// Resolves UIRectComponent for every canvas and its descendants, top-down from the canvas rect.
+// For a cached canvas it also stamps its UICanvasCache slot on each rect under it and fingerprints
+// what those entities draw (rect, sprite, label), which settles whether the canvas redraws.
 class UILayoutSystem {
  public:
   void operator()(const ContextFacade& ctx, const Iterable& /*iter*/) {
@@ -21,13 +30,26 @@ class UILayoutSystem {
     canvasQuery_->Update();
 
     const auto& gameConfig = registry->Get<GameConfig>();
+    auto* canvasCache = registry->TryGet<UICanvasCache>();
+    const auto* assetManager = registry->TryGet<AssetManager>();
+    if (canvasCache != nullptr) canvasCache->BeginFrame();
 
     canvasQuery_->ForEach([&](const Entity canvasEntity, const UICanvasComponent& canvas) {
       const float cw = (canvas.width > 0.f) ? canvas.width : static_cast<float>(gameConfig.windowWidth);
       const float ch = (canvas.height > 0.f) ? canvas.height : static_cast<float>(gameConfig.windowHeight);
-      const UIRectComponent canvasRect{0.f, 0.f, cw, ch, canvas.baseLayer};
+      UIRectComponent canvasRect{0.f, 0.f, cw, ch, canvas.baseLayer};
+      if (!canvas.cached || canvasCache == nullptr) {
+        WriteRect(registry, canvasEntity, canvasRect);
+        ResolveChildren(registry, canvasEntity, canvasRect, nullptr);
+        return;
+      }
+      canvasRect.cacheSlot = canvasCache->Open(canvasEntity);
+      UICanvasCache::Fingerprint fingerprint;
+      fingerprint.Mix(assetManager != nullptr ? assetManager->TextureGeneration() : 0);
       WriteRect(registry, canvasEntity, canvasRect);
-      ResolveChildren(registry, canvasEntity, canvasRect);
+      ResolveChildren(registry, canvasEntity, canvasRect, &fingerprint);
+      canvasCache->Close(canvasRect.cacheSlot, fingerprint.Value(), static_cast<int>(std::ceil(cw)),
+                         static_cast<int>(std::ceil(ch)), canvas.baseLayer);
     });
   }
 
@@ -47,7 +69,11 @@ class UILayoutSystem {
     }
   }
 
-  void ResolveChildren(Registry* registry, const Entity root, const UIRectComponent& rootRect) const {
+  // `fingerprint` is non-null under a cached canvas: every entity with a rect then takes the
+  // canvas's cacheSlot and is folded into the fingerprint, the root included.
+  void ResolveChildren(Registry* registry, const Entity root, const UIRectComponent& rootRect,
+                       UICanvasCache::Fingerprint* fingerprint) const {
+    if (fingerprint != nullptr) MixDrawState(registry, root, rootRect, *fingerprint);
     std::vector<std::pair<Entity, UIRectComponent>> pending;
     pending.emplace_back(root, rootRect);
     while (!pending.empty()) {
@@ -72,11 +98,53 @@ class UILayoutSystem {
         }
         if (modified) {
           WriteRect(registry, child, childRect);
+        } else if (registry->HasComponent<UIRectComponent>(child)) {
+          registry->GetComponent<UIRectComponent>(child).cacheSlot = childRect.cacheSlot;
+        }
+        if (fingerprint != nullptr && registry->HasComponent<UIRectComponent>(child)) {
+          MixDrawState(registry, child, registry->GetComponent<UIRectComponent>(child), *fingerprint);
         }
         pending.emplace_back(child, childRect);
       });
     }
   }
 
+  // Everything RenderUISpriteSystem / RenderTextSystem read from a UI entity, so a cached canvas
+  // redraws exactly when its drawn output could differ. Entities without a rect aren't drawn in
+  // canvas space and don't count.
+  static void MixDrawState(Registry* registry, const Entity entity, const UIRectComponent& rect,
+                           UICanvasCache::Fingerprint& fingerprint) {
+    fingerprint.Mix(static_cast<std::uint64_t>(entity.id));
+    fingerprint.Mix(static_cast<std::uint64_t>(registry->IsActive(entity)));
+    fingerprint.Mix(rect.left);
+    fingerprint.Mix(rect.top);
+    fingerprint.Mix(rect.right);
+    fingerprint.Mix(rect.bottom);
+    fingerprint.Mix(static_cast<std::uint64_t>(static_cast<std::uint32_t>(rect.layer)));
+    if (registry->HasComponent<SpriteComponent>(entity)) {
+      const auto& sprite = registry->GetComponent<SpriteComponent>(entity);
+      fingerprint.Mix(sprite.assetId);
+      fingerprint.Mix(sprite.srcRect.x);
+      fingerprint.Mix(sprite.srcRect.y);
+      fingerprint.Mix(sprite.srcRect.w);
+      fingerprint.Mix(sprite.srcRect.h);
+      fingerprint.Mix(PackColor(sprite.colorMod) << 16 | static_cast<std::uint64_t>(sprite.flip) << 8 |
+                      static_cast<std::uint64_t>(sprite.blendMode));
+    }
+    if (registry->HasComponent<TextLabelComponent>(entity)) {
+      const auto& label = registry->GetComponent<TextLabelComponent>(entity);
+      fingerprint.Mix(label.text);
+      fingerprint.Mix(label.fontId);
+      fingerprint.Mix(PackColor(label.color));
+      fingerprint.Mix(label.position.x);
+      fingerprint.Mix(label.position.y);
+    }
+  }
+
+  static std::uint64_t PackColor(const octarine::Color& color) {
+    return static_cast<std::uint64_t>(color.r) << 24 | static_cast<std::uint64_t>(color.g) << 16 |
+           static_cast<std::uint64_t>(color.b) << 8 | static_cast<std::uint64_t>(color.a);
+  }
+
   std::unique_ptr<CanvasQuery> canvasQuery_;
 };
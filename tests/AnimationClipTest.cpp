@@ -0,0 +1,186 @@
+// Tests for the baked AnimationClip that AnimationSystem plays: ping-pong unrolling, cumulative
+// step ends and the duration floor, and the Advance cursor across loop wraps, Once clips holding
+// their last frame, events firing per step entered (including the first on start), and the
+// whole-cycle skip on a large dt.
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only. Parsing `.anim` files needs
+// Lua and lives in AssetStoreTest.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AssetManager/AnimationClip.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+bool Near(const float a, const float b, const float eps = 1e-4F) { return std::fabs(a - b) <= eps; }
+
+// `count` frames on a row of 16 px cells, each `duration` long, with frame index encoded in rect.x.
+AnimationClipDesc Row(const std::size_t count, const AnimationPlayMode mode, const float duration = 0.1F) {
+  AnimationClipDesc desc;
+  desc.mode = mode;
+  for (std::size_t f = 0; f < count; ++f) {
+    desc.frames.push_back({{static_cast<float>(f) * 16.0F, 0.0F, 16.0F, 16.0F}, duration});
+  }
+  return desc;
+}
+
+// Frame index shown at `step`, recovered from the rect Row() gave it.
+std::size_t FrameAt(const AnimationClip& clip, const std::size_t step) {
+  return static_cast<std::size_t>(clip.Rect(step).x / 16.0F);
+}
+
+// A playback cursor plus the events it has fired, as AnimationComponent + a command buffer would hold.
+struct Cursor {
+  float time = 0.0F;
+  std::uint32_t step = AnimationClip::kUnstarted;
+  std::vector<std::string> fired;
+
+  bool Advance(const AnimationClip& clip, const float dt) {
+    return clip.Advance(time, step, dt, [this](const std::string& name) { fired.push_back(name); });
+  }
+};
+
+}  // namespace
+
+int main() {
+  std::cout << "[bake] steps, ends and the ping-pong unroll\n";
+  {
+    const AnimationClip loop(Row(4, AnimationPlayMode::Loop));
+    CheckEq(loop.Steps(), std::size_t{4}, "a looping clip has one step per frame");
+    Check(Near(loop.Length(), 0.4F), "length is the sum of the frame durations");
+    Check(loop.Mode() == AnimationPlayMode::Loop, "mode carried over");
+
+    const AnimationClip pingPong(Row(4, AnimationPlayMode::PingPong));
+    CheckEq(pingPong.Steps(), std::size_t{6}, "ping-pong unrolls 4 frames into 6 steps");
+    const std::size_t expected[] = {0, 1, 2, 3, 2, 1};
+    bool order = true;
+    for (std::size_t s = 0; s < pingPong.Steps(); ++s) order = order && FrameAt(pingPong, s) == expected[s];
+    Check(order, "forward, then back without repeating the end frames");
+    CheckEq(AnimationClip(Row(2, AnimationPlayMode::PingPong)).Steps(), std::size_t{2}, "two frames just alternate");
+    CheckEq(AnimationClip(Row(1, AnimationPlayMode::PingPong)).Steps(), std::size_t{1}, "one frame stays one step");
+
+    const AnimationClip zero(Row(3, AnimationPlayMode::Loop, 0.0F));
+    Check(Near(zero.Length(), 3.0F * AnimationClip::kMinFrameDuration), "zero durations are floored");
+    Check(AnimationClip().Empty() && AnimationClip(AnimationClipDesc{}).Empty(), "no frames bakes an empty clip");
+    float time = 0.0F;
+    std::uint32_t step = AnimationClip::kUnstarted;
+    Check(AnimationClip().Advance(time, step, 1.0F, [](const std::string&) {}), "an empty clip is always finished");
+
+    Check(AnimationPlayModeFromString("ping_pong") == AnimationPlayMode::PingPong, "mode names parse");
+    Check(AnimationPlayModeFromString("sideways") == AnimationPlayMode::Loop, "unknown names fall back");
+    CheckEq(std::string(ToString(AnimationPlayMode::Once)), std::string("once"), "and print back");
+  }
+
+  std::cout << "[loop] the cursor walks the steps and wraps\n";
+  {
+    const AnimationClip clip(Row(4, AnimationPlayMode::Loop));
+    Cursor cursor;
+    Check(!cursor.Advance(clip, 0.0F), "starting does not finish");
+    CheckEq(cursor.step, 0U, "an unstarted cursor starts at step 0");
+    cursor.Advance(clip, 0.15F);
+    CheckEq(cursor.step, 1U, "0.15s in shows the second frame");
+    cursor.Advance(clip, 0.2F);
+    CheckEq(cursor.step, 3U, "0.35s in shows the fourth");
+    Check(!cursor.Advance(clip, 0.1F), "a loop never finishes");
+    CheckEq(cursor.step, 0U, "0.45s wraps to the first frame");
+    Check(Near(cursor.time, 0.05F), "carrying the remainder into the next pass");
+
+    Cursor reversed;
+    reversed.Advance(clip, 0.0F);
+    reversed.Advance(clip, -1.0F);
+    CheckEq(reversed.step, 0U, "a negative dt does not move the step");
+  }
+
+  std::cout << "[once] a Once clip finishes on and holds its last frame\n";
+  {
+    const AnimationClip clip(Row(3, AnimationPlayMode::Once));
+    Cursor cursor;
+    Check(!cursor.Advance(clip, 0.25F), "mid-clip is not finished");
+    CheckEq(cursor.step, 2U, "0.25s in shows the last frame");
+    Check(cursor.Advance(clip, 0.1F), "running past the end finishes");
+    CheckEq(cursor.step, 2U, "and holds the last frame");
+    Check(Near(cursor.time, clip.Length()), "with the time clamped to the end");
+    Check(cursor.Advance(clip, 10.0F), "further advances stay finished");
+    CheckEq(cursor.step, 2U, "without moving");
+
+    Cursor skip;
+    Check(skip.Advance(clip, 100.0F), "a huge first dt finishes straight away");
+    CheckEq(skip.step, 2U, "on the last frame, not past it");
+  }
+
+  std::cout << "[ping pong] the unrolled steps play forward then back\n";
+  {
+    const AnimationClip clip(Row(3, AnimationPlayMode::PingPong));
+    Cursor cursor;
+    std::vector<std::size_t> shown;
+    for (int i = 0; i < 8; ++i) {
+      cursor.Advance(clip, i == 0 ? 0.0F : 0.1F);
+      shown.push_back(FrameAt(clip, cursor.step));
+    }
+    const std::vector<std::size_t> expected = {0, 1, 2, 1, 0, 1, 2, 1};
+    Check(shown == expected, "frames bounce 0 1 2 1 0 1 2 1");
+  }
+
+  std::cout << "[events] each step entered fires its events, once\n";
+  {
+    AnimationClipDesc desc = Row(4, AnimationPlayMode::Loop);
+    desc.events = {{0, "start"}, {2, "step"}, {2, "dust"}, {9, "out of range"}};
+    const AnimationClip clip(desc);
+
+    Cursor cursor;
+    cursor.Advance(clip, 0.0F);
+    Check(cursor.fired == std::vector<std::string>{"start"}, "starting fires the first step's events");
+    cursor.Advance(clip, 0.05F);
+    CheckEq(cursor.fired.size(), std::size_t{1}, "staying on a step fires nothing");
+    cursor.Advance(clip, 0.2F);
+    Check(cursor.fired == (std::vector<std::string>{"start", "step", "dust"}),
+          "entering a step fires all its events in authoring order");
+    cursor.Advance(clip, 0.2F);
+    Check(cursor.fired.size() == 4 && cursor.fired.back() == "start", "wrapping re-enters step 0 and fires it");
+
+    Cursor jump;
+    jump.Advance(clip, 0.0F);
+    jump.Advance(clip, 0.35F);
+    Check(jump.fired == (std::vector<std::string>{"start", "step", "dust"}),
+          "a dt spanning several steps fires every step it passes");
+
+    AnimationClipDesc bounce = Row(3, AnimationPlayMode::PingPong);
+    bounce.events = {{1, "mid"}};
+    const AnimationClip pingPong(bounce);
+    Cursor there;
+    there.Advance(pingPong, 0.0F);
+    there.Advance(pingPong, 0.35F);
+    CheckEq(there.fired.size(), std::size_t{2}, "a ping-pong middle frame fires going and coming back");
+  }
+
+  std::cout << "[cursor] restarts, and large dt skips whole cycles\n";
+  {
+    AnimationClipDesc desc = Row(4, AnimationPlayMode::Loop);
+    desc.events = {{1, "tick"}};
+    const AnimationClip clip(desc);
+
+    Cursor skip;
+    skip.Advance(clip, 0.0F);
+    skip.Advance(clip, 10.0F * clip.Length() + 0.25F);
+    CheckEq(skip.step, 2U, "the cursor lands where the remainder puts it");
+    Check(skip.time < clip.Length(), "with its time back inside one pass");
+    Check(skip.fired.empty(), "skipped cycles fire no events");
+
+    Cursor stale;
+    stale.step = 7;
+    stale.time = 3.0F;
+    stale.Advance(clip, 0.0F);
+    CheckEq(stale.step, 0U, "a cursor past the end of a shorter clip restarts");
+    Check(Near(stale.time, 0.0F), "from time 0");
+  }
+
+  return octarine::test::ReportSummary("AnimationClipTest");
+}
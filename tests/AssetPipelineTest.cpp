@@ -174,7 +174,10 @@ int main() {
     lua.open_libraries(sol::lib::base);
     const auto scene = lua.script(R"lua(
       return {
-        tilemap = { texture_asset_id = "tilemap-tex" },
+        tilemap = {
+          texture_asset_id = "tilemap-tex",
+          layers = { { name = "ground" }, { name = "deco", texture_asset_id = "deco-tiles" } },
+        },
         preload = { "bullet-tex", "spawn-font-10" },
         entities = {
           {
@@ -185,21 +188,25 @@ int main() {
             entities = {
               { components = { text_label = { font_id = "hud-font" } } },
               { components = { sprite = { texture_asset_id = "player-tex" } } },  -- dup
+              { components = { particle_emitter = { texture_asset_id = "spark-tex" } } },
             },
           },
-          { components = { sprite = { texture_asset_id = "enemy-tex" } } },
+          { components = { sprite = { texture_asset_id = "enemy-tex" }, animation = { clip = "enemy-walk" } } },
         },
       }
     )lua");
 
     const auto ids = SceneAssetScanner::Collect(scene);
     Check(ids.count("tilemap-tex") == 1, "scanner picks up tilemap texture");
+    Check(ids.count("deco-tiles") == 1, "scanner picks up a tilemap layer's own texture");
     Check(ids.count("bullet-tex") == 1 && ids.count("spawn-font-10") == 1, "scanner unions the preload list");
     Check(ids.count("player-tex") == 1, "scanner reads nested sprite texture_asset_id");
     Check(ids.count("enemy-tex") == 1, "scanner reads sibling-entity sprite");
     Check(ids.count("engine-hum") == 1, "scanner reads audio_source clip_id");
     Check(ids.count("hud-font") == 1, "scanner reads text_label font_id");
-    Check(ids.size() == 7, "scanner dedupes repeated ids (7 unique)");
+    Check(ids.count("enemy-walk") == 1, "scanner reads animation clip");
+    Check(ids.count("spark-tex") == 1, "scanner reads particle_emitter texture_asset_id");
+    Check(ids.size() == 10, "scanner dedupes repeated ids (10 unique)");
   }
 
 #ifdef ASSET_TEST_FIXTURE_DIR
@@ -339,7 +346,8 @@ int main() {
           << "  size = 16,\n  atlas_width = 4,\n  atlas_height = 4,\n  line_skip = 16,\n"
           << "  glyphs = {\n"
           << "    [65] = { x=0, y=0, w=4, h=4, advance=5, minx=0, miny=0 },\n"
-          << "  },\n}\n";
+          << "  },\n"
+          << "  kerning = { [65] = { [65]=-1 } },\n}\n";
     }
 
     GlyphAtlas atlas;
@@ -353,6 +361,8 @@ int main() {
 
     const GlyphAtlas::Glyph* gA = atlas.Find(static_cast<std::uint32_t>('A'));
     Check(gA != nullptr && gA->advance == 5.0F, "'A' glyph advance round-trips");
+    Check(atlas.Metrics().Kerning('A', 'A') == -1.0F, "'AA' kerning round-trips");
+    Check(atlas.Metrics().KerningPairs() == 1, "synthetic atlas reports exactly one kerning pair");
 
     // AtlasBaker's DefaultAsciiPrintable helper is independent of TTF availability.
     const auto cps = AtlasBaker::DefaultAsciiPrintable();
@@ -1,13 +1,16 @@
 // Typed-store lifecycle checks beyond AssetRefcounterTest's pure bookkeeping: TextureStore
 // handle ownership + generation bumps, and AssetManager's Acquire/Release orchestration,
-// hot-reload swap path, and missing-asset error paths — all against a real (software, headless)
-// SDL renderer and a temp-dir catalog built at runtime, since the checked-in fixture images are
-// placeholder bytes that don't decode. gtest-free; exit code is the number of failed checks.
+// hot-reload swap path, interned AssetHandles, `.anim` clip baking, and missing-asset error
+// paths — all against a real (software, headless) SDL renderer and a temp-dir catalog built at
+// runtime, since the checked-in fixture images are placeholder bytes that don't decode. gtest-free;
+// exit code is the number of failed checks.
 // Registered with ctest as AssetStoreTest.
 
 #include <SDL3/SDL.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
@@ -17,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "AssetManager/AnimationClip.h"
 #include "AssetManager/AssetCatalog.h"
 #include "AssetManager/AssetManager.h"
 #include "AssetManager/TextureStore.h"
@@ -190,6 +194,98 @@ int main() {
     CheckEq(manager.RefCount("clip"), 0, "failed audio Acquire leaves no refcount");
   }
 
+  std::cout << "[asset manager] interned handles resolve by index and follow the stores\n";
+  {
+    sol::state lua;
+    lua.open_libraries(sol::lib::base, sol::lib::table);
+
+    AssetManager manager;
+    Check(manager.GetCatalog().Build(tmpDir.string(), lua, std::optional<ScaleMode>(ScaleMode::Nearest)),
+          "catalog builds for the handle run");
+    Check(!AssetHandle{}.IsValid() && manager.Resolve(AssetHandle{}) == nullptr,
+          "a default handle is invalid and never resolves");
+
+    const AssetHandle handle = manager.Intern("sprite");
+    Check(handle.IsValid(), "Intern issues a valid handle");
+    Check(manager.Intern(std::string("sprite")) == handle, "interning the id again returns the same handle");
+    Check(manager.Intern("swap") != handle, "another id gets another slot");
+    CheckEq(std::string(manager.HandleId(handle)), std::string("sprite"), "the handle names its id");
+
+    const ResolvedAsset* unloaded = manager.Resolve(handle);
+    Check(unloaded != nullptr && unloaded->texture == nullptr, "an id interned before its load resolves to nothing");
+
+    Check(manager.Acquire("sprite", renderer, nullptr), "texture acquired after interning");
+    Check(manager.Resolve(handle) == nullptr, "the load leaves the slot stale until a refresh");
+    Check(manager.ResolveTexture(handle, "sprite").texture == manager.GetTexture("sprite"),
+          "a stale handle falls back to the id");
+    manager.RefreshHandles();
+    const ResolvedAsset* loaded = manager.Resolve(handle);
+    Check(loaded != nullptr && loaded->texture == manager.GetTexture("sprite") && loaded->texture != nullptr,
+          "RefreshHandles resolves the loaded texture");
+    Check(loaded != nullptr && loaded->font == nullptr && loaded->audio == nullptr, "and nothing of another type");
+
+    manager.Release("sprite");
+    manager.RefreshHandles();
+    const ResolvedAsset* released = manager.Resolve(handle);
+    Check(released != nullptr && released->texture == nullptr, "and follows the unload");
+
+    manager.ClearAssets();
+    Check(manager.Resolve(handle) == nullptr && manager.HandleId(handle).empty(),
+          "handles issued before ClearAssets no longer resolve");
+    Check(manager.Intern("sprite").generation != handle.generation, "re-interning issues a new generation");
+  }
+
+  std::cout << "[asset manager] animation clips parse, bake, reload and unload\n";
+  {
+    std::filesystem::create_directories(tmpDir / "anims", ec);
+    const std::string clipPath = (tmpDir / "anims" / "hero_walk.anim").string();
+    std::ofstream(clipPath, std::ios::binary) << R"lua(
+      return {
+        mode = "ping_pong", fps = 10, frame_width = 16, frame_height = 24, columns = 2,
+        frames = { 0, 1, { index = 2, duration = 0.5 }, { x = 64, y = 0, w = 8, h = 8 } },
+        events = { { frame = 3, name = "step" } },
+      }
+    )lua";
+    std::ofstream((tmpDir / "anims" / "broken.anim").string(), std::ios::binary) << "return { frames = {} }";
+
+    sol::state lua;
+    lua.open_libraries(sol::lib::base, sol::lib::table);
+
+    AssetManager manager;
+    Check(manager.GetCatalog().Build(tmpDir.string(), lua, std::optional<ScaleMode>(ScaleMode::Nearest)),
+          "catalog builds with the clip entries");
+    const CatalogEntry* entry = manager.GetCatalog().Find("hero_walk");
+    Check(entry != nullptr && entry->type == AssetType::AnimationClip, "`.anim` files catalog as animation clips");
+
+    const std::uint64_t genBefore = manager.AnimationClipGeneration();
+    Check(manager.Acquire("hero_walk", renderer, nullptr), "clip Acquire loads and bakes");
+    const AnimationClip* clip = manager.GetAnimationClip("hero_walk");
+    Check(clip != nullptr && manager.AnimationClipGeneration() > genBefore, "clip resident, generation bumped");
+    if (clip != nullptr) {
+      CheckEq(clip->Steps(), std::size_t{6}, "ping-pong unrolls four frames into six steps");
+      Check(clip->Rect(2).x == 0.0F && clip->Rect(2).y == 24.0F, "grid index 2 wraps to the second row");
+      Check(clip->Rect(3).w == 8.0F && clip->Rect(3).x == 64.0F, "explicit rects are taken as given");
+      Check(std::fabs(clip->Length() - 1.4F) < 1e-4F, "frames default to 1/fps, the override holds");
+    }
+
+    Check(!manager.Acquire("broken", renderer, nullptr), "a clip without frames fails to load");
+    CheckEq(manager.RefCount("broken"), 0, "and leaves no refcount");
+
+    std::ofstream(clipPath, std::ios::binary) << "return { frame_width = 16, frame_height = 16, frames = { 5 } }";
+    const std::uint64_t genBeforeReload = manager.AnimationClipGeneration();
+    Check(manager.Reload("hero_walk", renderer, nullptr), "Reload re-bakes the clip from disk");
+    clip = manager.GetAnimationClip("hero_walk");
+    Check(clip != nullptr && clip->Steps() == 1 && clip->Rect(0).x == 80.0F, "the new frames replace the old");
+    Check(manager.AnimationClipGeneration() > genBeforeReload, "reload bumps the clip generation");
+
+    const std::vector<std::string> resident = manager.ResidentSourcePaths();
+    Check(std::find(resident.begin(), resident.end(), entry != nullptr ? entry->fullPath : "") != resident.end(),
+          "ResidentSourcePaths reports the clip's source file");
+
+    manager.Release("hero_walk");
+    Check(manager.GetAnimationClip("hero_walk") == nullptr, "last Release drops the clip");
+  }
+
   SDL_DestroyRenderer(renderer);
   SDL_DestroySurface(surface);
   std::filesystem::remove_all(tmpDir, ec);
@@ -6,6 +6,7 @@
 // input, and asserts identical final state — the core race/parity guarantee. Part 2 exercises the
 // REAL systems' OnCollisionBatch (fixed threshold) against an independent analytic expectation,
 // covering both the serial and parallel sides of the real threshold and the no-dedup bounce parity.
+// Part 3 covers the CollisionRouter role table the real systems consume.
 // gtest-free; exit code = failed-check count. Links the ECS core only.
 
 #include <cstdint>
@@ -22,6 +23,7 @@
 #include "EventBus/EventBus.h"
 #include "Events/CollisionBatchEvent.h"
 #include "Systems/CollisionResponseParallel.h"
+#include "Systems/CollisionRouting.h"
 #include "Systems/DamageSystem.h"
 #include "Systems/ObstacleBounceSystem.h"
 #include "TestHarness.h"
@@ -216,5 +218,44 @@ int main() {
     Check(odd3001.x == -3.0F && odd3001.y == -4.0F, "bounce k=3001 (parallel, odd): velocity negated");
   }
 
+  // --- Part 3: CollisionRouter role table.
+  // Roles follow archetypes created after the first Route (incremental refresh), routed buckets
+  // handed over on the event are consumed as-is, and stale handles route to nothing.
+  {
+    Registry reg;
+    auto bus = std::make_unique<EventBus>();
+    DamageSystem damage;
+    damage.Init(&reg, bus);
+    ObstacleBounceSystem bounce;
+    bounce.Init(&reg, bus);
+    CollisionRouter& router = CollisionRouter::Instance(reg);
+
+    const Entity enemy = reg.CreateEntity();
+    reg.AddComponent(enemy, HealthComponent(100, 100));
+    reg.AddComponent(enemy, RigidBodyComponent(glm::vec2(1.0F, 0.0F)));
+    reg.AddTag(enemy, reg.TagId("enemies"));
+    const Entity rock = reg.CreateEntity();
+    CheckEq(router.Route(reg, Pairs{{enemy, rock}}).bounce.size(), size_t{0}, "router: untagged rock is no obstacle");
+
+    reg.AddTag(rock, reg.TagId("obstacles"));  // new archetype after the first Route
+    const CollisionRoutes& routes = router.Route(reg, Pairs{{rock, enemy}});
+    Check(routes.bounce.size() == 1 && routes.bounce.front() == enemy && routes.damage.empty(),
+          "router: archetype created later picks up its role; bouncer is the enemy side");
+
+    const Entity projectile = reg.CreateEntity();
+    reg.AddComponent(projectile, ProjectileComponent{30});
+    reg.AddTag(projectile, reg.Tag<ProjectileTag>());
+    const Pairs pairs{{enemy, projectile}, {enemy, rock}};
+    const CollisionRoutes& routed = router.Route(reg, pairs);
+    const CollisionBatchEvent event{pairs, {}, {}, {}, &routed};
+    damage.OnCollisionBatch(event);
+    bounce.OnCollisionBatch(event);
+    CheckEq(reg.GetComponent<HealthComponent>(enemy).currentHealth, 70, "router: damage consumed its bucket");
+    Check(reg.GetComponent<RigidBodyComponent>(enemy).velocity.x == -1.0F, "router: bounce consumed its bucket");
+
+    reg.Update(1.0F / 60.0F);  // despawns the projectile
+    Check(router.Route(reg, Pairs{{enemy, projectile}}).damage.empty(), "router: dead projectile routes nowhere");
+  }
+
   return octarine::test::Result();
 }
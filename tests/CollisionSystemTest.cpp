@@ -9,6 +9,7 @@
 // gtest-free; exit code = failed-check count. Links the ECS core only.
 
 #include <chrono>
+#include <cmath>
 #include <glm/glm.hpp>
 #include <thread>
 #include <utility>
@@ -30,13 +31,21 @@ using octarine::test::CheckEq;
 
 namespace {
 
-// Accumulates copies of every CollisionBatchEvent pair list received (pairs is a borrowed ref
-// valid only during dispatch, so it must be copied here).
+// Accumulates copies of every CollisionBatchEvent entering span received (the spans view
+// CollisionSystem-owned buffers valid only during dispatch, so they must be copied here).
 struct CollisionCapture {
   std::vector<std::vector<std::pair<Entity, Entity>>> batches;
+  std::vector<size_t> stayingCounts;
+  std::vector<size_t> exitingCounts;
+  std::vector<float> enteringToi;  // flattened across batches, in entering order
   EventBus::SubscriptionHandle subscription;
 
-  void OnBatch(const CollisionBatchEvent& evt) { batches.emplace_back(evt.pairs); }
+  void OnBatch(const CollisionBatchEvent& evt) {
+    batches.emplace_back(evt.entering.begin(), evt.entering.end());
+    enteringToi.insert(enteringToi.end(), evt.enteringToi.begin(), evt.enteringToi.end());
+    stayingCounts.push_back(evt.staying.size());
+    exitingCounts.push_back(evt.exiting.size());
+  }
 
   [[nodiscard]] int TotalPairs() const {
     int n = 0;
@@ -86,6 +95,15 @@ struct TestScene {
     return e;
   }
 
+  // Create a collider of the given size at top-left (x, y), optionally continuous (swept).
+  Entity MakeSizedBox(const float x, const float y, const int width, const int height, const bool continuous) {
+    const Entity e = reg.CreateEntity();
+    reg.AddComponent(e, GlobalTransformComponent{glm::vec2(x, y), glm::vec2(1.0f, 1.0f), 0.0});
+    reg.AddComponent(e, BoxColliderComponent{width, height, {}, false, Constants::kDefaultEntityMask, continuous});
+    reg.AddComponent(e, EntityMaskComponent{});
+    return e;
+  }
+
   void MoveTo(const Entity e, const float x, const float y) const {
     reg.GetComponent<GlobalTransformComponent>(e).position = glm::vec2(x, y);
   }
@@ -160,7 +178,7 @@ int main() {
     scene.Tick();                  // emit [] sustained (det_2 result); detection_3 gathers: b at 64 — no overlap
     scene.MoveTo(b, 16.0f, 0.0f);  // move b back before detection_4 gathers
     scene.Tick();                  // emit [] (det_3 no-overlap); detection_4 gathers: b at 16 — overlap
-    scene.Tick();                  // emit (a,b) entering again (det_4 result; prevPairSet_ was cleared)
+    scene.Tick();                  // emit (a,b) entering again (det_4 result; the pair left the previous frame's list)
 
     CheckEq(scene.capture.TotalPairs(), 2, "re-entry: pair emitted on first contact and again after separation");
     Check(scene.capture.Contains(a, b), "re-entry: (a, b) is in the captured batches");
@@ -182,7 +200,7 @@ int main() {
     scene.Tick();                   // emit (a,b) entering; detection_2: same positions
     scene.MoveTo(c, -20.0f, 0.0f);  // c now overlaps a but not b
     scene.Tick();                   // emit [] (det_2 a-b sustained); detection_3 gathers: a-b + a-c overlap
-    scene.Tick();                   // emit entering pairs from det_3: only (a,c) — (a,b) already in prevPairSet_
+    scene.Tick();                   // emit entering pairs from det_3: only (a,c) — (a,b) already in the previous frame's list
 
     CheckEq(scene.capture.TotalPairs(), 2,
             "new pair: (a,b) on first entry, (a,c) when c enters — (a,b) not re-emitted");
@@ -190,6 +208,69 @@ int main() {
     Check(scene.capture.Contains(a, c), "new pair: (a,c) entry captured when c moved in");
   }
 
+  // --- Sustained and separating pairs land in the staying / exiting spans.
+  // Batch 1 enters (a,b); batch 2 reports it as staying; b then moves away so batch 3 reports it as
+  // exiting. Each batch carries the pair in exactly one of the three spans.
+  {
+    TestScene scene;
+    scene.MakeBox(0.0f, 0.0f);
+    const Entity b = scene.MakeBox(16.0f, 0.0f);
+
+    scene.Tick();                  // detection_1 gathers: overlap
+    scene.Tick();                  // emit batch 1: (a,b) entering; detection_2 gathers: overlap
+    scene.MoveTo(b, 64.0f, 0.0f);  // separate before detection_3 gathers
+    scene.Tick();                  // emit batch 2: (a,b) staying; detection_3 gathers: no overlap
+    scene.Tick();                  // emit batch 3: (a,b) exiting
+
+    const auto& cap = scene.capture;
+    Check(cap.batches.size() >= 3, "spans: three batches captured");
+    if (cap.batches.size() >= 3) {
+      Check(cap.batches[0].size() == 1 && cap.stayingCounts[0] == 0 && cap.exitingCounts[0] == 0,
+            "spans: batch 1 has the pair entering only");
+      Check(cap.batches[1].empty() && cap.stayingCounts[1] == 1 && cap.exitingCounts[1] == 0,
+            "spans: batch 2 has the pair staying only");
+      Check(cap.batches[2].empty() && cap.stayingCounts[2] == 0 && cap.exitingCounts[2] == 1,
+            "spans: batch 3 has the pair exiting only");
+    }
+  }
+
+  // --- Continuous colliders catch a pass-through between two detection passes.
+  // A 32x32 bullet jumps from x=0 to x=400 across a 4px wall at x=200. Neither end position
+  // overlaps the wall, so only the swept test sees the hit. Relative to the wall the bullet's
+  // centre travels 16 -> 416 and first touches at 202 - (16 + 2) = 184, i.e. toi = 168 / 400.
+  // The same jump without CCD tunnels.
+  for (const bool continuous : {true, false}) {
+    TestScene scene;
+    const Entity bullet = scene.MakeSizedBox(0.0f, 0.0f, 32, 32, continuous);
+    const Entity wall = scene.MakeSizedBox(200.0f, 0.0f, 4, 32, false);
+
+    scene.Tick();                        // detection_1 gathers the bullet's start position
+    scene.MoveTo(bullet, 400.0f, 0.0f);  // past the wall in one step
+    scene.Tick();                        // emit batch 1 (empty); detection_2 gathers the swept box
+    scene.Tick();                        // emit batch 2
+
+    if (continuous) {
+      Check(scene.capture.Contains(bullet, wall), "ccd: swept bullet reports entering the wall it passed");
+      Check(scene.capture.enteringToi.size() == 1 && std::abs(scene.capture.enteringToi[0] - 0.42f) < 1e-4f,
+            "ccd: entering pair carries the time of impact");
+    } else {
+      CheckEq(scene.capture.TotalPairs(), 0, "ccd: the same jump without continuous tunnels");
+    }
+  }
+
+  // --- Discrete pairs report toi 1; a resting continuous collider behaves like a discrete one.
+  {
+    TestScene scene;
+    scene.MakeSizedBox(0.0f, 0.0f, 32, 32, true);
+    scene.MakeBox(16.0f, 0.0f);
+
+    scene.Tick();
+    scene.Tick();
+
+    Check(scene.capture.enteringToi.size() == 1 && scene.capture.enteringToi[0] == 1.0f,
+          "ccd: unswept pair reports toi 1");
+  }
+
   // --- Incompatible masks suppress pairs (W2.1 mask-pruning gate).
   // Two overlapping boxes whose layers do not match either entity's collision mask must produce
   // no pairs. Box::intersects gates on canInteract before the geometric test.
@@ -0,0 +1,180 @@
+// Tests for ContactSolver, the impulse solver behind PhysicsSolverSystem.
+//
+// Small hand-built scenes with known outcomes: an elastic head-on collision swaps velocities, a box
+// sunk into a static floor is pushed out and stops, friction slows a slide, and two piles on one
+// floor form two islands. The parallel island path is checked against the serial one by solving
+// the same large pile both ways.
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only (for the ThreadPool).
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Systems/ContactSolver.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+SolverBody Dynamic(const float cx, const float cy, const float half, const float vx = 0.0f, const float vy = 0.0f,
+                   const float restitution = 0.0f, const float friction = 0.0f) {
+  return {cx, cy, half, half, vx, vy, 1.0f, restitution, friction};
+}
+
+SolverBody Static(const float cx, const float cy, const float hx, const float hy, const float friction = 0.0f) {
+  return {cx, cy, hx, hy, 0.0f, 0.0f, 0.0f, 0.0f, friction};
+}
+
+SolverPair Pair(const std::uint32_t a, const std::uint32_t b) {
+  return {(static_cast<std::uint64_t>(a) << 32) | b, a, b};
+}
+
+bool Near(const float a, const float b, const float eps = 1e-3f) { return std::abs(a - b) < eps; }
+
+// Columns of boxes dropped slightly overlapping onto a shared floor (body 0); every neighbour pair
+// is a candidate. Pairs come out key-sorted because a < b and both loops ascend.
+void BuildPile(std::vector<SolverBody>& bodies, std::vector<SolverPair>& pairs, const int columns, const int height) {
+  bodies.clear();
+  pairs.clear();
+  bodies.push_back(Static(0.0f, 0.0f, 100000.0f, 10.0f, 0.5f));
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> jitter(-0.5f, 0.5f);
+  for (int c = 0; c < columns; ++c) {
+    for (int h = 0; h < height; ++h) {
+      bodies.push_back({static_cast<float>(c) * 12.0f + jitter(rng), -14.5f - static_cast<float>(h) * 9.5f, 5.0f,
+                        5.0f, jitter(rng), 50.0f, 1.0f, 0.0f, 0.5f});
+    }
+  }
+  const auto count = static_cast<std::uint32_t>(bodies.size());
+  for (std::uint32_t a = 0; a < count; ++a) {
+    for (std::uint32_t b = a + 1; b < count; ++b) {
+      const bool adjacent = std::abs(bodies[a].cx - bodies[b].cx) < bodies[a].hx + bodies[b].hx &&
+                            std::abs(bodies[a].cy - bodies[b].cy) < bodies[a].hy + bodies[b].hy;
+      if (adjacent) pairs.push_back(Pair(a, b));
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  // --- Equal masses, perfectly elastic, head-on: velocities swap.
+  {
+    std::vector<SolverBody> bodies{Dynamic(0.0f, 0.0f, 5.0f, 100.0f, 0.0f, 1.0f),
+                                   Dynamic(9.0f, 0.0f, 5.0f, -100.0f, 0.0f, 1.0f)};
+    const std::vector<SolverPair> pairs{Pair(0, 1)};
+    ContactSolver solver;
+    solver.Step(bodies, pairs);
+    CheckEq(solver.ContactCount(), size_t{1}, "elastic: one contact");
+    Check(Near(bodies[0].vx, -100.0f) && Near(bodies[1].vx, 100.0f), "elastic: equal masses swap velocities");
+    Check(Near(bodies[0].vy, 0.0f) && Near(bodies[1].vy, 0.0f), "elastic: no impulse off the contact normal");
+    Check(bodies[1].cx - bodies[0].cx > 9.0f, "elastic: position pass separates the overlap");
+  }
+
+  // --- Inelastic, heavy vs light: momentum conserved, both leave at the common speed.
+  {
+    std::vector<SolverBody> bodies{Dynamic(0.0f, 0.0f, 5.0f, 30.0f), Dynamic(9.0f, 0.0f, 5.0f, 0.0f)};
+    bodies[0].invMass = 1.0f / 3.0f;
+    const std::vector<SolverPair> pairs{Pair(0, 1)};
+    ContactSolver solver;
+    solver.Step(bodies, pairs);
+    Check(Near(bodies[0].vx, 22.5f) && Near(bodies[1].vx, 22.5f),
+          "inelastic: bodies share the momentum-weighted speed");
+  }
+
+  // --- Box sunk into a static floor: pushed out along the shallow axis and stopped.
+  {
+    std::vector<SolverBody> bodies{Static(0.0f, 0.0f, 100.0f, 10.0f), Dynamic(0.0f, -13.0f, 5.0f, 0.0f, 80.0f)};
+    const std::vector<SolverPair> pairs{Pair(0, 1)};
+    ContactSolver solver;
+    for (int step = 0; step < 10; ++step) solver.Step(bodies, pairs);
+    Check(Near(bodies[1].vy, 0.0f), "floor: downward velocity removed");
+    Check(bodies[1].cy <= -14.0f && bodies[1].cy > -15.0f, "floor: penetration resolved down to the slop");
+    Check(Near(bodies[0].cy, 0.0f) && Near(bodies[0].vy, 0.0f), "floor: static body never moves");
+    Check(solver.NormalImpulse(pairs[0].key) >= 0.0f, "floor: accumulated impulse is non-negative");
+    Check(solver.NormalImpulse(12345) == 0.0f, "floor: unknown key has no cached impulse");
+  }
+
+  // --- Friction: a box sliding on a rough floor while pressed into it slows down; a frictionless one doesn't.
+  {
+    std::vector<SolverBody> rough{Static(0.0f, 0.0f, 100.0f, 10.0f, 1.0f),
+                                  Dynamic(0.0f, -14.8f, 5.0f, 50.0f, 30.0f, 0.0f, 1.0f)};
+    std::vector<SolverBody> smooth = rough;
+    smooth[1].friction = 0.0f;
+    smooth[0].friction = 0.0f;
+    const std::vector<SolverPair> pairs{Pair(0, 1)};
+    ContactSolver roughSolver;
+    ContactSolver smoothSolver;
+    roughSolver.Step(rough, pairs);
+    smoothSolver.Step(smooth, pairs);
+    Check(Near(rough[1].vx, 20.0f), "friction: tangential impulse capped at mu * normal impulse");
+    Check(Near(smooth[1].vx, 50.0f), "friction: frictionless contact keeps its slide");
+  }
+
+  // --- Separated or all-static pairs produce no contacts.
+  {
+    std::vector<SolverBody> bodies{Dynamic(0.0f, 0.0f, 5.0f), Dynamic(20.0f, 0.0f, 5.0f),
+                                   Static(0.0f, 0.0f, 5.0f, 5.0f), Static(1.0f, 0.0f, 5.0f, 5.0f)};
+    const std::vector<SolverPair> pairs{Pair(0, 1), Pair(2, 3)};
+    ContactSolver solver;
+    solver.Step(bodies, pairs);
+    CheckEq(solver.ContactCount(), size_t{0}, "skip: stale and static-static pairs are dropped");
+    CheckEq(solver.IslandCount(), size_t{0}, "skip: no contacts, no islands");
+  }
+
+  // --- Two piles on one floor: the static floor doesn't join them.
+  {
+    std::vector<SolverBody> bodies{Static(0.0f, 0.0f, 1000.0f, 10.0f), Dynamic(0.0f, -14.0f, 5.0f),
+                                   Dynamic(0.0f, -23.0f, 5.0f), Dynamic(500.0f, -14.0f, 5.0f)};
+    const std::vector<SolverPair> pairs{Pair(0, 1), Pair(0, 3), Pair(1, 2)};
+    ContactSolver solver;
+    solver.Step(bodies, pairs);
+    CheckEq(solver.ContactCount(), size_t{3}, "islands: every overlapping pair is a contact");
+    CheckEq(solver.IslandCount(), size_t{2}, "islands: floor-sharing piles stay separate");
+  }
+
+  // --- Parallel islands match a serial solve of the same pile, over several warm-started steps.
+  {
+    std::vector<SolverBody> serialBodies;
+    std::vector<SolverPair> pairs;
+    BuildPile(serialBodies, pairs, 200, 8);
+    std::vector<SolverBody> parallelBodies = serialBodies;
+    Check(pairs.size() > 1024, "parity: pile is large enough to take the parallel path");
+
+    ContactSolver parallelSolver;
+    for (int step = 0; step < 4; ++step) parallelSolver.Step(parallelBodies, pairs);
+    Check(parallelSolver.IslandCount() >= 200, "parity: one island per column at least");
+
+    // Serial reference, one column at a time: each column is its own island, so the small
+    // per-column steps stay under the parallel threshold.
+    std::vector<ContactSolver> columnSolvers(200);
+    const std::uint32_t height = 8;
+    for (int step = 0; step < 4; ++step) {
+      for (std::uint32_t c = 0; c < 200; ++c) {
+        const std::uint32_t first = 1 + c * height;
+        std::vector<SolverPair> columnPairs;
+        for (const SolverPair& pair : pairs) {
+          const bool inColumn = pair.b >= first && pair.b < first + height && (pair.a == 0 || pair.a >= first);
+          if (inColumn) columnPairs.push_back(pair);
+        }
+        columnSolvers[c].Step(serialBodies, columnPairs);
+      }
+    }
+    bool same = true;
+    for (size_t i = 0; i < serialBodies.size(); ++i) {
+      same = same && serialBodies[i].cx == parallelBodies[i].cx && serialBodies[i].cy == parallelBodies[i].cy &&
+             serialBodies[i].vx == parallelBodies[i].vx && serialBodies[i].vy == parallelBodies[i].vy;
+    }
+    Check(same, "parity: parallel island solve is bit-identical to per-island serial solves");
+
+    bool settled = true;
+    for (size_t i = 1; i < parallelBodies.size(); ++i) settled = settled && parallelBodies[i].vy < 1.0f;
+    Check(settled, "parity: the pile's downward velocity is absorbed");
+  }
+
+  return octarine::test::Result();
+}
@@ -0,0 +1,105 @@
+// Tests for DebugDraw, the immediate-mode debug shape service: tessellation counts per shape,
+// world-space shapes shifted by the camera while screen-space ones aren't, per-thread buffers
+// merged by Gather with indices rebased, one buffer per thread per instance however a thread
+// alternates between instances, and buffers emptied after every gather.
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only. Only Gather is exercised —
+// Flush is the SDL half.
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "Renderer/DebugDraw.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+constexpr octarine::Color kRed{255, 0, 0, 255};
+}  // namespace
+
+int main() {
+  std::cout << "[shapes] everything is triangles\n";
+  {
+    DebugDraw draw;
+    draw.Line(0.0F, 0.0F, 10.0F, 0.0F, kRed);
+    draw.Rect(0.0F, 0.0F, 10.0F, 10.0F, kRed);
+    draw.FillRect(0.0F, 0.0F, 10.0F, 10.0F, kRed);
+    const DebugDraw::Batch& batch = draw.Gather(0.0F, 0.0F);
+    CheckEq(batch.vertices.size(), std::size_t{4 + 16 + 4}, "a line, a rect outline (4 edges) and a fill are quads");
+    CheckEq(batch.indices.size(), std::size_t{6 * 6}, "two triangles per quad");
+    Check(batch.vertices[0].y == 0.5F && batch.vertices[3].y == -0.5F, "a 1px line straddles its path");
+    Check(batch.vertices[0].r == 1.0F && batch.vertices[0].g == 0.0F, "colors are normalized");
+
+    draw.FillCircle(0.0F, 0.0F, 4.0F, kRed);
+    const auto segments = static_cast<std::size_t>(DebugDraw::kMinCircleSegments);
+    const DebugDraw::Batch& fan = draw.Gather(0.0F, 0.0F);
+    CheckEq(fan.vertices.size(), segments + 2, "a small filled circle is a minimum-segment fan (centre + rim)");
+    CheckEq(fan.indices.size(), segments * 3, "one triangle per segment");
+    Check(fan.vertices.back().x > 3.99F && fan.vertices.back().y < 0.01F, "the fan closes where it started");
+
+    const DebugDraw::Point triangle[3] = {{0.0F, 0.0F}, {4.0F, 0.0F}, {0.0F, 4.0F}};
+    draw.Polyline(triangle, true, kRed);
+    CheckEq(draw.Gather(0.0F, 0.0F).vertices.size(), std::size_t{12}, "a closed 3-point polyline is 3 segments");
+  }
+
+  std::cout << "[space] the camera moves world shapes only\n";
+  {
+    DebugDraw draw;
+    draw.FillRect(100.0F, 50.0F, 1.0F, 1.0F, kRed);
+    draw.FillRect(100.0F, 50.0F, 1.0F, 1.0F, kRed, DebugDraw::Space::Screen);
+    draw.Text(100.0F, 50.0F, "hp", kRed);
+    const DebugDraw::Batch& batch = draw.Gather(30.0F, 20.0F);
+    Check(batch.vertices[0].x == 70.0F && batch.vertices[0].y == 30.0F, "world shapes are camera-relative");
+    Check(batch.vertices[4].x == 100.0F && batch.vertices[4].y == 50.0F, "screen shapes stay put");
+    CheckEq(batch.labels.size(), std::size_t{1}, "text is gathered");
+    Check(batch.labels[0].x == 70.0F && batch.labels[0].text == "hp", "and world text moves with the camera");
+    CheckEq(batch.indices[6], std::uint32_t{4}, "the second shape's indices are rebased");
+    const DebugDraw::Batch& empty = draw.Gather(30.0F, 20.0F);
+    Check(empty.vertices.empty() && empty.labels.empty(), "a gather empties the buffers");
+  }
+
+  std::cout << "[threads] per-thread buffers merge in one gather\n";
+  {
+    DebugDraw draw;
+    constexpr int kThreads = 4;
+    constexpr int kLinesPerThread = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&draw, t] {
+        for (int i = 0; i < kLinesPerThread; ++i) {
+          draw.Line(static_cast<float>(t), static_cast<float>(i), static_cast<float>(t) + 1.0F, 0.0F, kRed);
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+    const DebugDraw::Batch& batch = draw.Gather(0.0F, 0.0F);
+    CheckEq(batch.vertices.size(), std::size_t{kThreads * kLinesPerThread * 4}, "no line is lost across threads");
+    bool inRange = true;
+    for (const std::uint32_t index : batch.indices) inRange = inRange && index < batch.vertices.size();
+    Check(inRange, "every rebased index points into the merged vertices");
+
+    draw.Line(0.0F, 0.0F, 1.0F, 1.0F, kRed);
+    draw.Clear();
+    Check(draw.Gather(0.0F, 0.0F).indices.empty(), "Clear drops unflushed shapes");
+  }
+
+  std::cout << "[instances] alternating instances reuse one buffer each\n";
+  {
+    DebugDraw first;
+    DebugDraw second;
+    for (int i = 0; i < 100; ++i) {
+      first.FillRect(0.0F, 0.0F, 1.0F, 1.0F, kRed);
+      second.Line(0.0F, 0.0F, 1.0F, 0.0F, kRed);
+    }
+    CheckEq(first.BufferCount(), std::size_t{1}, "switching back to an instance finds its buffer again");
+    CheckEq(second.BufferCount(), std::size_t{1}, "and the other instance's too");
+    CheckEq(first.Gather(0.0F, 0.0F).vertices.size(), std::size_t{100 * 4}, "every shape lands in its own instance");
+    CheckEq(second.Gather(0.0F, 0.0F).vertices.size(), std::size_t{100 * 4}, "on both sides of the switch");
+  }
+
+  return octarine::test::ReportSummary("DebugDrawTest");
+}
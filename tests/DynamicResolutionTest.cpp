@@ -0,0 +1,94 @@
+// Tests for DynamicResolution, the controller that picks the scene render target's scale from
+// frame time: stepping down over budget, holding within it, stepping back up only after sustained
+// headroom that the next step's predicted cost fits, the min-scale floor, and target sizing.
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only. Pure arithmetic, no renderer.
+
+#include <cstddef>
+
+#include "Renderer/DynamicResolution.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+constexpr float kBudgetMs = 16.0F;
+
+// Feed `frames` frames of `ms`; returns how many of them changed the scale.
+int Run(DynamicResolution& controller, const float ms, const int frames) {
+  int changes = 0;
+  for (int i = 0; i < frames; ++i) {
+    if (controller.Update(ms, kBudgetMs)) ++changes;
+  }
+  return changes;
+}
+
+// Frames fed until the scale changes (the changing frame included), or 0 if it never does.
+int FramesUntilChange(DynamicResolution& controller, const float ms) {
+  for (int i = 1; i <= 10'000; ++i) {
+    if (controller.Update(ms, kBudgetMs)) return i;
+  }
+  return 0;
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "[steps] quantized scales down to the floor\n";
+  {
+    DynamicResolution controller;
+    CheckEq(controller.StepCount(), std::size_t{5}, "default floor 0.5 gives 1, .875, .75, .625, .5");
+    Check(controller.Scale() == 1.0F, "starts at full scale");
+    controller.SetMinScale(0.1F);
+    CheckEq(controller.StepCount(), DynamicResolution::kMaxSteps, "the floor is clamped to kLowestMinScale");
+    controller.SetMinScale(0.8F);
+    CheckEq(controller.StepCount(), std::size_t{2}, "a floor between steps rounds up to one");
+    CheckEq(DynamicResolution::ScaledSize(1280, 0.75F), 960, "target size is the rounded scaled size");
+    CheckEq(DynamicResolution::ScaledSize(1, 0.5F), 1, "and never below one pixel");
+  }
+
+  std::cout << "[down] over budget steps down, within budget holds\n";
+  {
+    DynamicResolution controller;
+    CheckEq(Run(controller, 12.0F, 600), 0, "a frame inside the budget never changes scale");
+    const int frames = FramesUntilChange(controller, 30.0F);
+    Check(frames > 1 && frames < 10, "a few frames over budget step down; a single spike does not");
+    Check(controller.Scale() == 0.875F, "by one step");
+    CheckEq(Run(controller, 30.0F, DynamicResolution::kCooldownFrames), 0, "then waits out the cooldown");
+    Check(controller.Update(30.0F, kBudgetMs), "and steps again while still over");
+    Run(controller, 30.0F, 1000);
+    Check(controller.Scale() == 0.5F, "sustained overload settles at the floor");
+    CheckEq(Run(controller, 30.0F, 100), 0, "and stays there");
+  }
+
+  std::cout << "[up] headroom must last and the next step must fit\n";
+  {
+    DynamicResolution controller;
+    Run(controller, 40.0F, 200);
+    Check(controller.Scale() == 0.5F, "driven to the floor");
+    // At 0.5 the frame costs 10 ms; 0.625 predicts 10 * 1.5625 = 15.6 ms, over 85% of 16 ms.
+    CheckEq(Run(controller, 10.0F, 600), 0, "no step up whose predicted cost would break the budget");
+    controller.Reset();
+    Run(controller, 40.0F, 200);
+    // 6 ms predicts 9.4 ms at 0.625: headroom.
+    Check(FramesUntilChange(controller, 6.0F) >= DynamicResolution::kUpSustainFrames,
+          "stepping up waits for kUpSustainFrames of headroom");
+    Check(controller.Scale() == 0.625F, "by one step");
+    Run(controller, 1.0F, 2000);
+    Check(controller.Scale() == 1.0F, "and keeps climbing back to full scale");
+  }
+
+  std::cout << "[floor] raising the floor snaps the scale up\n";
+  {
+    DynamicResolution controller(0.25F);
+    Run(controller, 40.0F, 400);
+    Check(controller.Scale() == 0.25F, "a 0.25 floor reaches 0.25");
+    controller.SetMinScale(0.75F);
+    Check(controller.Scale() == 0.75F, "a raised floor clamps the current step");
+    Check(!controller.Update(5.0F, 0.0F), "no budget, no decision");
+  }
+
+  return octarine::test::ReportSummary("DynamicResolutionTest");
+}
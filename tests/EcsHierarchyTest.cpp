@@ -122,5 +122,35 @@ int main() {
           "entity created after first frame is resolved on the next frame");
   }
 
+  // TransformSystem chunk bounds follow in-place sprite edits: growing a sprite through
+  // GetComponent (as the inspector does) must un-cull its chunk, and turning it fixed must drop
+  // the bounds, even though nothing moved.
+  {
+    Registry registry;
+    registry.RegisterBulkSystem<GlobalTransformComponent>(TransformSystem(true));
+    const Entity sprite = registry.CreateEntityWithBundle(GlobalTransformComponent{}, PositionComponent{{0.0f, 0.0f}},
+                                                          SpriteComponent("tile", 10.0f, 10.0f));
+    registry.Update(1.0f / 60.0f);
+
+    const auto query = registry.CreateQuery<GlobalTransformComponent, SpriteComponent>();
+    const auto rejectLeftOfCamera = [](const ChunkBounds& b) { return !b.valid || b.maxX >= 50.0f; };
+    const auto countVisible = [&] {
+      query->Update();
+      int visible = 0;
+      query->ParallelForEach([&](GlobalTransformComponent&, SpriteComponent&) { ++visible; }, 0, rejectLeftOfCamera);
+      return visible;
+    };
+    Check(countVisible() == 0, "a sprite chunk left of the camera is culled");
+
+    registry.GetComponent<SpriteComponent>(sprite).width = 100.0f;
+    registry.Update(1.0f / 60.0f);
+    Check(countVisible() == 1, "growing a sprite in place recomputes its chunk's bounds");
+
+    registry.GetComponent<SpriteComponent>(sprite).width = 10.0f;
+    registry.GetComponent<SpriteComponent>(sprite).isFixed = true;
+    registry.Update(1.0f / 60.0f);
+    Check(countVisible() == 1, "a sprite turned fixed in place invalidates its chunk's bounds");
+  }
+
   return octarine::test::Result();
 }
@@ -180,6 +180,81 @@ int main() {
     Check(registry.ArchetypeGeneration() == gen1, "ArchetypeGeneration stable for a repeated shape");
   }
 
+  // Query membership version: moves on every add / remove / (de)activate of a matched entity,
+  // including ones landing in an existing archetype, but not on component writes.
+  {
+    Registry registry;
+    const auto query = registry.CreateQuery<Position>();
+    query->WithTag("static");
+    query->Update();
+    const uint64_t empty = query->MembershipVersion();
+
+    const Entity a = registry.CreateEntity();
+    registry.AddComponent(a, Position{0.0f, 0.0f});
+    registry.AddTag(a, "static");
+    query->Update();
+    const uint64_t added = query->MembershipVersion();
+    Check(added != empty, "membership version moves when a tagged entity appears");
+
+    const Entity b = registry.CreateEntity();
+    registry.AddComponent(b, Position{0.0f, 0.0f});
+    registry.AddTag(b, "static");  // same archetype as a: no generation bump
+    query->Update();
+    const uint64_t second = query->MembershipVersion();
+    Check(second != added, "membership version moves for an add into an existing archetype");
+
+    registry.GetComponent<Position>(a).x = 5.0f;
+    const Entity other = registry.CreateEntity();
+    registry.AddComponent(other, Position{0.0f, 0.0f});  // untagged: not matched
+    query->Update();
+    Check(query->MembershipVersion() == second, "component writes and unmatched entities leave it alone");
+
+    registry.Deactivate(b);
+    query->Update();
+    const uint64_t deactivated = query->MembershipVersion();
+    Check(deactivated != second, "membership version moves on Deactivate");
+
+    registry.QueueBlamEntity(a);
+    registry.Update(1.0f / 60.0f);
+    query->Update();
+    Check(query->MembershipVersion() != deactivated, "membership version moves on destruction");
+  }
+
+  // Chunk bounds: ParallelForEachChunk writes them, a chunk filter skips rejected chunks whole,
+  // and an entity arriving in the chunk invalidates them.
+  {
+    Registry registry;
+    for (int i = 0; i < 4; ++i) {
+      const Entity e = registry.CreateEntity();
+      registry.AddComponent(e, Position{static_cast<float>(i), 0.0f});
+    }
+    const auto query = registry.CreateQuery<Position>();
+    query->Update();
+
+    size_t chunkEntities = 0;
+    query->ParallelForEachChunk([&](Archetype& arch, const size_t chunkIdx, const size_t count, const Position* p) {
+      chunkEntities += count;
+      ChunkBounds bounds;
+      bounds.minX = p[0].x;
+      bounds.maxX = p[count - 1].x;
+      bounds.valid = true;
+      arch.SetChunkBounds(chunkIdx, bounds);
+    });
+    Check(chunkEntities == 4, "ParallelForEachChunk visits every entity's chunk once");
+
+    const auto rejectFarChunks = [](const ChunkBounds& b) { return !b.valid || b.maxX >= 10.0f; };
+    int visited = 0;
+    query->ParallelForEach([&](Position&) { ++visited; }, 0, rejectFarChunks);
+    Check(visited == 0, "a rejected chunk is skipped whole");
+
+    const Entity late = registry.CreateEntity();
+    registry.AddComponent(late, Position{50.0f, 0.0f});  // same chunk: bounds now stale
+    query->Update();
+    visited = 0;
+    query->ParallelForEach([&](Position&) { ++visited; }, 0, rejectFarChunks);
+    Check(visited == 5, "an added entity invalidates its chunk's bounds");
+  }
+
   // System ordering: unconstrained registration order, After edges, lazy re-sort.
   {
     Registry registry;
@@ -0,0 +1,131 @@
+// Tests for the glyph-quad text path's layout: NextUtf8Codepoint, LayoutGlyphs (advances,
+// kerning, line breaks, blank glyphs, multi-byte and missing codepoints, pages) and
+// GlyphLayoutCache (content keying, sharing, eviction, forgetting a font).
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only. Metrics are built by hand,
+// so no atlas, font or SDL is involved.
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include "AssetManager/GlyphMetrics.h"
+#include "General/Utils.h"
+#include "Renderer/GlyphLayoutCache.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+// A fixed-pitch face: every printable ASCII glyph is 6x10 with an 8px advance, packed 16 to an
+// atlas row. Line skip 12; 'A' followed by 'V' kerns in by 2.
+GlyphMetrics MakeMetrics() {
+  GlyphMetrics metrics;
+  metrics.SetLineSkip(12);
+  for (std::uint32_t cp = 0x20; cp <= 0x7E; ++cp) {
+    const auto slot = static_cast<float>(cp - 0x20);
+    metrics.Add(cp, {std::fmod(slot, 16.0F) * 8.0F, std::floor(slot / 16.0F) * 12.0F, 6.0F, 10.0F, 8.0F, 0.0F, 0.0F});
+  }
+  metrics.AddKerning('A', 'V', -2.0F);
+  return metrics;
+}
+
+}  // namespace
+
+int main() {
+  const GlyphMetrics metrics = MakeMetrics();
+
+  std::cout << "[utf8] decoding\n";
+  {
+    const std::string text = "A\xC3\xA9\xD0\x96\xE2\x82\xAC\xF0\x9F\x99\x82";
+    size_t i = 0;
+    CheckEq(NextUtf8Codepoint(text, i), std::uint32_t{'A'}, "ASCII decodes as itself");
+    CheckEq(NextUtf8Codepoint(text, i), std::uint32_t{0xE9}, "two-byte sequence");
+    CheckEq(NextUtf8Codepoint(text, i), std::uint32_t{0x416}, "two-byte Cyrillic");
+    CheckEq(NextUtf8Codepoint(text, i), std::uint32_t{0x20AC}, "three-byte sequence");
+    CheckEq(NextUtf8Codepoint(text, i), std::uint32_t{0x1F642}, "four-byte sequence");
+    CheckEq(i, text.size(), "every byte consumed");
+
+    const std::string bad = "\xFF\xC3(\xC0\x80\xED\xA0\x80";
+    i = 0;
+    CheckEq(NextUtf8Codepoint(bad, i), std::uint32_t{0xFFFD}, "an invalid lead byte is U+FFFD");
+    CheckEq(NextUtf8Codepoint(bad, i), std::uint32_t{0xFFFD}, "a truncated sequence is U+FFFD");
+    CheckEq(i, size_t{2}, "a bad sequence consumes only its lead byte");
+    CheckEq(NextUtf8Codepoint(bad, i), std::uint32_t{'('}, "decoding resumes at the next byte");
+    CheckEq(NextUtf8Codepoint(bad, i), std::uint32_t{0xFFFD}, "an overlong encoding is U+FFFD");
+    i = 5;
+    CheckEq(NextUtf8Codepoint(bad, i), std::uint32_t{0xFFFD}, "an encoded surrogate is U+FFFD");
+  }
+
+  std::cout << "[layout] advances, kerning, breaks\n";
+  {
+    const auto plain = LayoutGlyphs(metrics, "AB");
+    Check(plain.has_value(), "covered text lays out");
+    CheckEq(plain->quads.size(), size_t{2}, "one quad per visible glyph");
+    Check(plain->quads[0].x == 0.0F && plain->quads[1].x == 8.0F, "glyphs advance by their advance");
+    Check(plain->quads[1].srcX == 16.0F && plain->quads[1].srcY == 24.0F, "each quad samples its glyph's rect");
+    Check(plain->width == 16.0F && plain->height == 12.0F, "bounds are the pen width by one line skip");
+
+    const auto kerned = LayoutGlyphs(metrics, "AVA");
+    Check(kerned && kerned->quads[1].x == 6.0F, "a kerned pair pulls the second glyph in");
+    Check(kerned && kerned->quads[2].x == 14.0F, "kerning carries to the rest of the line");
+    CheckEq(kerned->width, 22.0F, "kerning shrinks the label");
+
+    const auto spaced = LayoutGlyphs(metrics, "A B");
+    Check(spaced && spaced->quads.size() == 2, "spaces advance the pen without a quad");
+    Check(spaced && spaced->quads[1].x == 16.0F, "the glyph after a space lands past it");
+
+    const auto lines = LayoutGlyphs(metrics, "ABC\nD");
+    Check(lines && lines->quads.size() == 4, "line breaks emit no quad");
+    Check(lines && lines->quads[3].x == 0.0F && lines->quads[3].y == 12.0F,
+          "a new line starts at the left, one skip down");
+    Check(lines && lines->width == 24.0F && lines->height == 24.0F, "bounds cover the widest line and every line");
+
+    Check(!LayoutGlyphs(metrics, "caf\xC3\xA9").has_value(), "an uncovered codepoint fails the whole layout");
+    const auto empty = LayoutGlyphs(metrics, "");
+    Check(empty && empty->quads.empty() && empty->height == 12.0F, "empty text is one empty line");
+  }
+
+  std::cout << "[layout] multi-byte glyphs and pages\n";
+  {
+    GlyphMetrics paged = MakeMetrics();
+    paged.Add(0xE9, {40.0F, 4.0F, 6.0F, 10.0F, 8.0F, 0.0F, 0.0F, 1});
+    const auto cafe = LayoutGlyphs(paged, "caf\xC3\xA9");
+    Check(cafe && cafe->quads.size() == 4, "a two-byte codepoint is one glyph");
+    Check(cafe && cafe->quads[3].x == 24.0F && cafe->quads[3].srcX == 40.0F, "it advances and samples like any glyph");
+    Check(cafe && cafe->quads[3].page == 1 && cafe->quads[0].page == 0, "each quad carries its glyph's page");
+    CheckEq(cafe->pages, std::uint32_t{0b11}, "the layout records every page it samples");
+    CheckEq(LayoutGlyphs(paged, "caf")->pages, std::uint32_t{0b01}, "pages it doesn't sample stay clear");
+  }
+
+  std::cout << "[cache] content keyed and shared\n";
+  {
+    GlyphLayoutCache cache(8);
+    const auto first = cache.Get(metrics, "Score: 10");
+    const auto again = cache.Get(metrics, std::string("Score: ") + "10");
+    Check(first != nullptr && first == again, "equal strings share one layout");
+    CheckEq(cache.GetStats().hits, std::uint64_t{1}, "the second lookup hits");
+    CheckEq(cache.GetStats().misses, std::uint64_t{1}, "only the first lays out");
+
+    GlyphMetrics other = MakeMetrics();
+    Check(cache.Get(other, "Score: 10") != first, "the same string in another font is its own entry");
+    Check(cache.Get(metrics, "\xE2\x82\xAC") == nullptr, "uncovered text returns nullptr");
+    CheckEq(cache.Size(), size_t{2}, "failed layouts are not cached");
+
+    for (int i = 0; i < 20; ++i) cache.Get(metrics, std::to_string(i));
+    Check(cache.Size() <= 8, "the cache stays within its capacity");
+    Check(cache.GetStats().evictions > 0, "overflow evicts");
+    Check(first->quads.size() == 8, "an evicted layout stays valid for the label holding it");
+    Check(cache.Get(metrics, "19") != nullptr && cache.GetStats().hits == 2, "the newest entry survives eviction");
+
+    const size_t before = cache.Size();
+    cache.Get(other, "x");
+    cache.Forget(metrics);
+    CheckEq(cache.Size(), size_t{1}, "forgetting a font drops only its layouts");
+    Check(before > 1 && cache.Get(other, "x") != nullptr && cache.GetStats().hits == 3, "other fonts still hit");
+  }
+
+  return octarine::test::ReportSummary("GlyphLayoutTest");
+}
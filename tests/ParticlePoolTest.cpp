@@ -0,0 +1,200 @@
+// Tests for the particle store behind ParticleSystem: curve sampling and baking, rate/burst/cap
+// spawning, integration under gravity and the velocity curve, stable compaction of expired
+// particles, the ThreadPool split matching the serial kernels, quad expansion and the shared index
+// buffer, and emitters being swept once their entity stops updating.
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only. ParticleSystem itself (queue
+// submission, textures) is SDL-side.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Components/ParticleEmitterComponent.h"
+#include "ECS/Entity.h"
+#include "Systems/ParticlePool.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+bool Near(const float a, const float b, const float eps = 1e-3F) { return std::fabs(a - b) <= eps; }
+
+// A fixed-direction emitter with no randomness: every particle launches along +x at 100 px/s.
+ParticleEmitterComponent Straight() {
+  ParticleEmitterComponent emitter;
+  emitter.rate = 0.0F;
+  emitter.direction = 0.0F;
+  emitter.spread = 0.0F;
+  emitter.speed = 100.0F;
+  emitter.lifetime = 1.0F;
+  emitter.maxParticles = 1'000'000;
+  return emitter;
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "[curves] keys interpolate, ends hold, tables bake\n";
+  {
+    const ParticleCurve curve({{0.0F, 10.0F}, {0.5F, 20.0F}, {1.0F, 0.0F}});
+    Check(Near(curve.Sample(0.25F), 15.0F), "linear between keys");
+    Check(Near(curve.Sample(0.75F), 10.0F), "on the falling segment too");
+    Check(Near(curve.Sample(-1.0F), 10.0F) && Near(curve.Sample(2.0F), 0.0F), "held flat past the ends");
+    Check(Near(ParticleCurve().Sample(0.3F), 1.0F), "no keys samples as 1");
+
+    ParticleEmitterComponent emitter;
+    emitter.size = ParticleCurve({{0.0F, 8.0F}, {1.0F, 0.0F}});
+    emitter.color = ParticleGradient({{0.0F, {255, 0, 0, 255}}, {1.0F, {0, 0, 255, 0}}});
+    ParticleLut lut;
+    lut.Bake(emitter);
+    Check(Near(lut.size.front(), 8.0F) && Near(lut.size.back(), 0.0F), "size table spans the curve");
+    Check(Near(lut.r.front(), 1.0F) && Near(lut.b.back(), 1.0F) && Near(lut.a.back(), 0.0F),
+          "gradient bakes to normalized channels, start to end");
+    const std::size_t mid = ParticleLut::Index(0.5F);
+    Check(Near(lut.r[mid], lut.b[mid], 0.02F), "and blends in between");
+    ParticleLut white;
+    white.Bake(ParticleEmitterComponent{});
+    Check(Near(white.r[10], 1.0F) && Near(white.a[10], 1.0F), "no gradient is opaque white");
+  }
+
+  std::cout << "[spawn] rate carries fractions, bursts add, the cap holds\n";
+  {
+    ParticleEmitterComponent emitter = Straight();
+    emitter.rate = 30.0F;
+    ParticleStore::Emitter state;
+    for (int frame = 0; frame < 6; ++frame) state.Step(emitter, 0.0F, 0.0F, 0.01F, 0);
+    CheckEq(state.pool.Size(), std::size_t{1}, "30/s over 60 ms is one particle, with 0.8 carried");
+    state.Step(emitter, 0.0F, 0.0F, 0.01F, 5);
+    CheckEq(state.pool.Size(), std::size_t{7}, "the carry completes a second and a burst adds five");
+    emitter.maxParticles = 10;
+    state.Step(emitter, 0.0F, 0.0F, 0.01F, 100);
+    CheckEq(state.pool.Size(), std::size_t{10}, "a burst past maxParticles is clipped");
+    emitter.emitting = false;
+    state.Step(emitter, 0.0F, 0.0F, 0.01F, 0);
+    Check(state.spawnCarry == 0.0F, "stopping drops the carry");
+  }
+
+  std::cout << "[integrate] velocity, gravity, the velocity curve and expiry\n";
+  {
+    ParticleEmitterComponent emitter = Straight();
+    ParticleStore::Emitter state;
+    state.Step(emitter, 10.0F, 20.0F, 0.1F, 1);
+    Check(state.pool.X(0) == 10.0F && state.pool.Age(0) == 0.0F, "spawned at the origin, drawn at birth");
+    state.Step(emitter, 10.0F, 20.0F, 0.1F, 0);
+    Check(Near(state.pool.X(0), 20.0F) && Near(state.pool.Y(0), 20.0F), "moves speed * dt along its direction");
+
+    emitter.gravity = {0.0F, 100.0F};
+    state.Step(emitter, 0.0F, 0.0F, 0.1F, 0);
+    Check(Near(state.pool.Y(0), 21.0F), "gravity accelerates before the move (semi-implicit)");
+
+    emitter.velocity = ParticleCurve(0.0F);
+    const float x = state.pool.X(0);
+    state.Step(emitter, 0.0F, 0.0F, 0.1F, 0);
+    Check(state.pool.X(0) == x, "a zero velocity curve holds particles in place");
+
+    for (int frame = 0; frame < 7; ++frame) state.Step(emitter, 0.0F, 0.0F, 0.1F, 0);
+    CheckEq(state.pool.Size(), std::size_t{0}, "expires once age reaches its lifetime");
+  }
+
+  std::cout << "[compact] expired particles go, survivors keep their order\n";
+  {
+    ParticleEmitterComponent emitter = Straight();
+    emitter.speed = 0.0F;
+    ParticlePool pool;
+    ParticleLut lut;
+    lut.Bake(emitter);
+    for (int i = 0; i < 6; ++i) {
+      emitter.lifetime = (i % 2 == 0) ? 0.05F : 1.0F;
+      pool.Emit(emitter, static_cast<float>(i), 0.0F, 1);
+    }
+    pool.Integrate(0, pool.Size(), 0.1F, 0.0F, 0.0F, lut);
+    CheckEq(pool.Compact(), std::size_t{3}, "every short-lived particle died");
+    Check(pool.X(0) == 1.0F && pool.X(1) == 3.0F && pool.X(2) == 5.0F, "the rest in spawn order");
+  }
+
+  std::cout << "[parallel] the ThreadPool split matches the serial kernels\n";
+  {
+    ParticleEmitterComponent emitter = Straight();
+    emitter.spread = 360.0F;
+    emitter.speedVariance = 40.0F;
+    emitter.lifetimeVariance = 0.5F;
+    emitter.gravity = {0.0F, 50.0F};
+    emitter.velocity = ParticleCurve({{0.0F, 1.0F}, {1.0F, 0.2F}});
+    const int count = static_cast<int>(ParticleStore::kParallelThreshold) * 4;
+
+    ParticleStore::Emitter split;
+    split.pool.Seed(7);
+    ParticlePool serial;
+    serial.Seed(7);
+    split.Step(emitter, 0.0F, 0.0F, 0.0F, count);
+    serial.Emit(emitter, 0.0F, 0.0F, count);
+    ParticleLut lut;
+    lut.Bake(emitter);
+    for (int frame = 0; frame < 5; ++frame) {
+      split.Step(emitter, 0.0F, 0.0F, 0.1F, 0);
+      serial.Integrate(0, serial.Size(), 0.1F, 0.0F, 50.0F, lut);
+      serial.Compact();
+    }
+    CheckEq(split.pool.Size(), serial.Size(), "same survivors");
+    bool same = split.pool.Size() == serial.Size();
+    for (std::size_t i = 0; same && i < serial.Size(); ++i) {
+      same = split.pool.X(i) == serial.X(i) && split.pool.Y(i) == serial.Y(i);
+    }
+    Check(same, "same positions, particle for particle");
+
+    split.Build(0.0F, 0.0F, {0.0F, 0.0F, 1.0F, 1.0F});
+    std::vector<ParticleVertex> quads(serial.Size() * 4);
+    serial.BuildQuads(0, serial.Size(), lut, 0.0F, 0.0F, {0.0F, 0.0F, 1.0F, 1.0F}, quads.data());
+    bool sameQuads = split.vertices.size() == quads.size();
+    for (std::size_t i = 0; sameQuads && i < quads.size(); ++i) sameQuads = split.vertices[i].x == quads[i].x;
+    Check(sameQuads, "and the same quads");
+  }
+
+  std::cout << "[quads] one square per particle, indexed as two triangles\n";
+  {
+    ParticleEmitterComponent emitter = Straight();
+    emitter.size = ParticleCurve(10.0F);
+    emitter.color = ParticleGradient(octarine::Color{255, 0, 0, 255});
+    ParticleStore::Emitter state;
+    state.Step(emitter, 100.0F, 50.0F, 0.0F, 2);
+    state.Build(-30.0F, -20.0F, {0.25F, 0.5F, 0.75F, 1.0F});
+    CheckEq(state.vertices.size(), std::size_t{8}, "four vertices per particle");
+    const ParticleVertex& corner = state.vertices[0];
+    Check(corner.x == 65.0F && corner.y == 25.0F, "centred on the particle, offset by the camera");
+    Check(state.vertices[2].x == 75.0F && state.vertices[2].u == 0.75F && state.vertices[2].v == 1.0F,
+          "the opposite corner maps the far end of the texture rect");
+    Check(corner.r == 1.0F && corner.g == 0.0F, "tinted by the gradient");
+
+    ParticleStore store;
+    const std::vector<std::uint32_t>& indices = store.QuadIndices(3);
+    CheckEq(indices.size(), std::size_t{18}, "six indices per quad");
+    Check(indices[6] == 4 && indices[8] == 6 && indices[11] == 7, "each quad's indices are based on its vertices");
+    const std::uint32_t* data = store.QuadIndices(2).data();
+    Check(data == indices.data(), "asking for fewer quads doesn't reallocate");
+  }
+
+  std::cout << "[store] emitters live while updated, keyed by generation\n";
+  {
+    ParticleStore store;
+    const Entity a(EntityID{1});
+    const Entity b(EntityID{2});
+    const Entity recycled(EntityID{1} | (EntityID{1} << kEntityGenerationOffset));
+    store.Acquire(a).Step(Straight(), 0.0F, 0.0F, 0.0F, 3);
+    store.Acquire(b).Step(Straight(), 0.0F, 0.0F, 0.0F, 2);
+    store.Sweep();
+    CheckEq(store.Count(a), std::size_t{3}, "counts per emitter");
+    CheckEq(store.TotalParticles(), std::size_t{5}, "and across them");
+    CheckEq(store.Count(recycled), std::size_t{0}, "a recycled id is a different emitter");
+
+    store.Acquire(a);
+    store.Sweep();
+    CheckEq(store.EmitterCount(), std::size_t{1}, "an emitter not updated is swept");
+    Check(store.Find(b) == nullptr && store.Find(a) != nullptr, "the updated one stays");
+  }
+
+  return octarine::test::ReportSummary("ParticlePoolTest");
+}
@@ -0,0 +1,105 @@
+// Tests for SkylinePacker, the online rect packer behind DynamicTextureAtlas's pages.
+//
+// Checks placements on a hand-sized page (bottom-left rest, lowest segment first, full-page
+// rejection) and that a found spot costs nothing until placed, then packs a few hundred random
+// sprite-sized rects and verifies none overlap or leave the page.
+//
+// gtest-free; exit code = failed-check count. Header-only under test. Links the ECS core only.
+
+#include <random>
+#include <vector>
+
+#include "AssetManager/SkylinePacker.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+struct Placed {
+  int x, y, w, h;
+};
+
+bool Overlaps(const Placed& a, const Placed& b) {
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "[placement] skyline bottom-left\n";
+  {
+    SkylinePacker packer(100, 100);
+    const auto a = packer.Insert(60, 40);
+    Check(a && a->x == 0 && a->y == 0, "first rect goes to the top-left corner");
+    const auto b = packer.Insert(40, 20);
+    Check(b && b->x == 60 && b->y == 0, "second rect rests beside it on the lower segment");
+    const auto c = packer.Insert(40, 10);
+    Check(c && c->x == 60 && c->y == 20, "the next one stacks on the lowest segment, not the tall one");
+    const auto d = packer.Insert(100, 30);
+    Check(d && d->x == 0 && d->y == 40, "a full-width rect rests on the tallest segment it spans");
+    CheckEq(packer.UsedArea(), size_t{60 * 40 + 40 * 20 + 40 * 10 + 100 * 30}, "used area sums the inserts");
+    Check(!packer.Insert(101, 1) && !packer.Insert(1, 101), "rects larger than the page are rejected");
+    Check(!packer.Insert(100, 31), "a rect taller than the space left is rejected");
+    Check(packer.Insert(100, 30).has_value(), "the exact remaining strip still fits");
+    Check(!packer.Insert(1, 1), "a full page rejects everything");
+
+    packer.Reset();
+    CheckEq(packer.UsedArea(), size_t{0}, "Reset clears the used area");
+    const auto again = packer.Insert(100, 100);
+    Check(again && again->x == 0 && again->y == 0, "after Reset the whole page is free");
+  }
+
+  // DynamicTextureAtlas finds a spot, uploads into it, and only then places it: a spot that is
+  // found but never placed (the upload failed) must leave the page exactly as it was.
+  std::cout << "[find/place] an unplaced spot costs nothing\n";
+  {
+    SkylinePacker packer(100, 100);
+    const auto spot = packer.Find(100, 60);
+    Check(spot && spot->at.x == 0 && spot->at.y == 0, "Find reports the spot Insert would use");
+    CheckEq(packer.UsedArea(), size_t{0}, "Find alone uses no area");
+    const auto full = packer.Insert(100, 100);
+    Check(full && full->x == 0 && full->y == 0, "an abandoned spot leaves the whole page free");
+
+    packer.Reset();
+    const auto found = packer.Find(100, 60);
+    Check(found.has_value(), "spot found on the reset page");
+    const SkylinePacker::Point at = packer.Place(*found);
+    Check(at.x == 0 && at.y == 0, "Place returns the found corner");
+    CheckEq(packer.UsedArea(), size_t{100 * 60}, "Place adds the rect's area");
+    Check(!packer.Insert(100, 41), "a placed spot is no longer free");
+  }
+
+  std::cout << "[packing] random sprites never overlap\n";
+  {
+    SkylinePacker packer(512, 512);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> size(4, 64);
+    std::vector<Placed> placed;
+    int rejected = 0;
+    for (int i = 0; i < 400; ++i) {
+      const int w = size(rng);
+      const int h = size(rng);
+      if (const auto at = packer.Insert(w, h)) {
+        placed.push_back({at->x, at->y, w, h});
+      } else {
+        ++rejected;
+      }
+    }
+    bool inside = true;
+    bool disjoint = true;
+    for (size_t i = 0; i < placed.size(); ++i) {
+      const Placed& p = placed[i];
+      inside &= p.x >= 0 && p.y >= 0 && p.x + p.w <= 512 && p.y + p.h <= 512;
+      for (size_t j = i + 1; j < placed.size(); ++j) disjoint &= !Overlaps(p, placed[j]);
+    }
+    Check(inside, "every rect lies within the page");
+    Check(disjoint, "no two rects overlap");
+    Check(rejected > 0, "the page eventually fills");
+    const double fill = static_cast<double>(packer.UsedArea()) / (512.0 * 512.0);
+    Check(fill > 0.7, "the page fills past 70% before rejecting (got " + std::to_string(fill) + ")");
+  }
+
+  return octarine::test::ReportSummary("SkylinePackerTest");
+}
@@ -0,0 +1,252 @@
+// Tests for SpatialIndex, the tree CollisionSystem publishes for gameplay spatial queries.
+//
+// Each query type runs against a brute-force scan of the same boxes over a few hundred random
+// colliders (seeded, so failures reproduce). Small hand-built cases cover rotated colliders, mask
+// filtering, rays starting inside a collider, rays past a despawned blocker, and empty/degenerate
+// inputs.
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "ECS/Registry.h"
+#include "Systems/CollisionBox.h"
+#include "Systems/SpatialIndex.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+Box MakeBox(const std::uint32_t id, const float cx, const float cy, const float hx, const float hy,
+            const EntityMask mask = EntityMask{1}, const float rotation = 0.0f) {
+  const float rc = std::cos(rotation);
+  const float rs = std::sin(rotation);
+  const float aabbHx = hx * std::abs(rc) + hy * std::abs(rs);
+  const float aabbHy = hx * std::abs(rs) + hy * std::abs(rc);
+  return {Entity{id}, mask, mask, cx - aabbHx, cy - aabbHy, cx + aabbHx, cy + aabbHy, cx, cy, hx, hy, rc, rs,
+          rotation != 0.0f};
+}
+
+std::vector<Box> RandomBoxes(const int count, const std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> pos(0.0f, 2000.0f);
+  std::uniform_real_distribution<float> half(2.0f, 24.0f);
+  std::uniform_real_distribution<float> rot(0.0f, 3.0f);
+  std::uniform_int_distribution<int> layer(0, 3);
+  std::vector<Box> boxes;
+  for (int i = 0; i < count; ++i) {
+    const float rotation = (i % 5 == 0) ? rot(rng) : 0.0f;
+    boxes.push_back(MakeBox(static_cast<std::uint32_t>(i), pos(rng), pos(rng), half(rng), half(rng),
+                            EntityMask{1u << layer(rng)}, rotation));
+  }
+  return boxes;
+}
+
+std::vector<std::uint32_t> Ids(const std::vector<Entity>& entities) {
+  std::vector<std::uint32_t> ids;
+  for (const Entity e : entities) ids.push_back(e.GetId());
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+// Brute-force references built from single-box indexes, so the exact shape tests are shared and
+// only the tree traversal is under test.
+std::vector<std::uint32_t> BruteAabb(const std::vector<Box>& boxes, const float minX, const float minY,
+                                     const float maxX, const float maxY, const EntityMask mask) {
+  std::vector<std::uint32_t> ids;
+  std::vector<Entity> hit;
+  for (const Box& box : boxes) {
+    SpatialIndex single;
+    single.Build({box});
+    single.QueryAabb(minX, minY, maxX, maxY, mask, hit);
+    if (!hit.empty()) ids.push_back(box.entity.GetId());
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+std::vector<std::uint32_t> BruteCircle(const std::vector<Box>& boxes, const float x, const float y, const float r,
+                                       const EntityMask mask) {
+  std::vector<std::uint32_t> ids;
+  std::vector<Entity> hit;
+  for (const Box& box : boxes) {
+    SpatialIndex single;
+    single.Build({box});
+    single.QueryCircle(x, y, r, mask, hit);
+    if (!hit.empty()) ids.push_back(box.entity.GetId());
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+}  // namespace
+
+int main() {
+  const EntityMask all = SpatialIndex::kAllMasks;
+
+  // --- Randomized parity against brute force.
+  {
+    const std::vector<Box> boxes = RandomBoxes(600, 1234);
+    SpatialIndex index;
+    index.Build(boxes);
+    CheckEq(index.Size(), boxes.size(), "build: index holds every box");
+
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> pos(-100.0f, 2100.0f);
+    std::uniform_real_distribution<float> ext(0.0f, 300.0f);
+    std::uniform_int_distribution<int> layer(0, 3);
+    std::vector<Entity> out;
+
+    bool aabbOk = true;
+    bool circleOk = true;
+    for (int q = 0; q < 200; ++q) {
+      const float x = pos(rng);
+      const float y = pos(rng);
+      const float w = ext(rng);
+      const float h = ext(rng);
+      const EntityMask mask = (q % 2 == 0) ? all : EntityMask{1u << layer(rng)};
+      index.QueryAabb(x, y, x + w, y + h, mask, out);
+      aabbOk = aabbOk && Ids(out) == BruteAabb(boxes, x, y, x + w, y + h, mask);
+      index.QueryCircle(x, y, w * 0.5f, mask, out);
+      circleOk = circleOk && Ids(out) == BruteCircle(boxes, x, y, w * 0.5f, mask);
+    }
+    Check(aabbOk, "parity: QueryAabb matches brute force over 200 random queries");
+    Check(circleOk, "parity: QueryCircle matches brute force over 200 random queries");
+
+    bool rayOk = true;
+    bool rayAllOk = true;
+    std::vector<RayHit> hits;
+    std::uniform_real_distribution<float> dir(-1.0f, 1.0f);
+    for (int q = 0; q < 200; ++q) {
+      const float ox = pos(rng);
+      const float oy = pos(rng);
+      const float dx = dir(rng);
+      const float dy = dir(rng);
+      index.RaycastAll(ox, oy, dx, dy, 800.0f, all, hits);
+      // Reference: every single-box raycast that hits.
+      std::vector<float> expected;
+      for (const Box& box : boxes) {
+        SpatialIndex single;
+        single.Build({box});
+        if (const auto hit = single.Raycast(ox, oy, dx, dy, 800.0f, all)) expected.push_back(hit->distance);
+      }
+      std::sort(expected.begin(), expected.end());
+      rayAllOk = rayAllOk && hits.size() == expected.size() &&
+                 std::is_sorted(hits.begin(), hits.end(),
+                                [](const RayHit& a, const RayHit& b) { return a.distance < b.distance; });
+      const auto first = index.Raycast(ox, oy, dx, dy, 800.0f, all);
+      if (expected.empty()) {
+        rayOk = rayOk && !first.has_value();
+      } else {
+        rayOk = rayOk && first.has_value() && std::abs(first->distance - expected.front()) < 1e-3f;
+      }
+    }
+    Check(rayOk, "parity: Raycast returns the nearest brute-force hit");
+    Check(rayAllOk, "parity: RaycastAll returns every hit, sorted by distance");
+
+    bool nearestOk = true;
+    std::vector<NearestHit> nearest;
+    for (int q = 0; q < 100; ++q) {
+      const float x = pos(rng);
+      const float y = pos(rng);
+      index.Nearest(x, y, 5, all, nearest);
+      std::vector<float> distances;
+      for (const Box& box : boxes) {
+        SpatialIndex single;
+        single.Build({box});
+        std::vector<NearestHit> one;
+        single.Nearest(x, y, 1, all, one);
+        distances.push_back(one.front().distance);
+      }
+      std::sort(distances.begin(), distances.end());
+      nearestOk = nearestOk && nearest.size() == 5;
+      for (size_t i = 0; nearestOk && i < nearest.size(); ++i) {
+        nearestOk = std::abs(nearest[i].distance - distances[i]) < 1e-3f;
+      }
+    }
+    Check(nearestOk, "parity: Nearest(5) returns the five closest distances in order");
+  }
+
+  // --- Rotated collider: the AABB overlaps the query but the OBB does not.
+  // A 40x4 bar rotated 45 degrees around (0,0); its AABB corner region near (12,-12) is empty.
+  {
+    SpatialIndex index;
+    index.Build({MakeBox(1, 0.0f, 0.0f, 20.0f, 2.0f, EntityMask{1}, 0.785398f)});
+    std::vector<Entity> out;
+    index.QueryAabb(10.0f, -14.0f, 14.0f, -10.0f, all, out);
+    Check(out.empty(), "rotated: query in the AABB corner misses the OBB");
+    index.QueryAabb(6.0f, 6.0f, 8.0f, 8.0f, all, out);
+    CheckEq(out.size(), size_t{1}, "rotated: query on the bar's diagonal hits it");
+    index.QueryCircle(12.0f, -12.0f, 2.0f, all, out);
+    Check(out.empty(), "rotated: circle in the AABB corner misses the OBB");
+  }
+
+  // --- Mask filtering.
+  {
+    SpatialIndex index;
+    index.Build(
+        {MakeBox(1, 0.0f, 0.0f, 5.0f, 5.0f, EntityMask{0b01}), MakeBox(2, 0.0f, 0.0f, 5.0f, 5.0f, EntityMask{0b10})});
+    std::vector<Entity> out;
+    index.QueryCircle(0.0f, 0.0f, 1.0f, EntityMask{0b10}, out);
+    Check(out.size() == 1 && out.front().GetId() == 2, "mask: only the matching layer is returned");
+    index.QueryCircle(0.0f, 0.0f, 1.0f, all, out);
+    CheckEq(out.size(), size_t{2}, "mask: kAllMasks returns both");
+  }
+
+  // --- Ray starting inside a collider reports distance 0; nearer collider wins.
+  {
+    SpatialIndex index;
+    index.Build({MakeBox(1, 0.0f, 0.0f, 5.0f, 5.0f), MakeBox(2, 50.0f, 0.0f, 5.0f, 5.0f)});
+    const auto inside = index.Raycast(0.0f, 0.0f, 1.0f, 0.0f, 100.0f, all);
+    Check(inside.has_value() && inside->entity.GetId() == 1 && inside->distance == 0.0f,
+          "ray: origin inside a collider hits it at distance 0");
+    const auto ahead = index.Raycast(20.0f, 0.0f, 1.0f, 0.0f, 100.0f, all);
+    Check(ahead.has_value() && ahead->entity.GetId() == 2 && std::abs(ahead->distance - 25.0f) < 1e-4f,
+          "ray: hits the collider ahead at its near face");
+    Check(!index.Raycast(20.0f, 0.0f, 1.0f, 0.0f, 10.0f, all).has_value(), "ray: maxDistance cuts the ray short");
+    Check(!index.Raycast(20.0f, 0.0f, 0.0f, 0.0f, 100.0f, all).has_value(), "ray: zero direction hits nothing");
+  }
+
+  // --- The index still holds last pass's colliders: a blocker despawned since then must not stop
+  // the ray from reaching the live target behind it.
+  {
+    Registry registry;
+    const Entity blocker = registry.CreateEntity();
+    const Entity target = registry.CreateEntity();
+    Box blockerBox = MakeBox(0, 20.0f, 0.0f, 5.0f, 5.0f);
+    Box targetBox = MakeBox(0, 50.0f, 0.0f, 5.0f, 5.0f);
+    blockerBox.entity = blocker;
+    targetBox.entity = target;
+    SpatialIndex index;
+    index.Build({blockerBox, targetBox});
+    registry.BlamEntity(blocker);
+    const auto alive = [&registry](const Entity e) { return registry.IsAlive(e); };
+    const auto unfiltered = index.Raycast(0.0f, 0.0f, 1.0f, 0.0f, 100.0f, all);
+    Check(unfiltered.has_value() && unfiltered->entity.GetId() == blocker.GetId(),
+          "ray: the despawned blocker is still the nearest collider in the index");
+    const auto live = index.Raycast(0.0f, 0.0f, 1.0f, 0.0f, 100.0f, all, alive);
+    Check(live.has_value() && live->entity.GetId() == target.GetId() && std::abs(live->distance - 45.0f) < 1e-4f,
+          "ray: filtering on IsAlive returns the live target behind it");
+    Check(!index.Raycast(0.0f, 0.0f, 1.0f, 0.0f, 40.0f, all, alive).has_value(),
+          "ray: with the blocker skipped, maxDistance still cuts the ray short");
+  }
+
+  // --- Empty index and recycled storage.
+  {
+    SpatialIndex index;
+    std::vector<Entity> out{Entity{7}};
+    index.QueryAabb(0.0f, 0.0f, 10.0f, 10.0f, all, out);
+    Check(out.empty(), "empty: query clears the output and returns nothing");
+    index.Build(RandomBoxes(50, 7));
+    const std::vector<Box> storage = index.TakeBoxes();
+    Check(storage.empty() && index.Size() == 0, "recycle: TakeBoxes empties the index and the returned storage");
+  }
+
+  return octarine::test::Result();
+}
@@ -0,0 +1,93 @@
+// Tests for TextTextureCache, the content-keyed store behind RenderTextSystem's rasterized labels:
+// sharing by (font, color, string), reference counting, LRU eviction of unreferenced entries
+// under the byte budget, and that referenced entries survive any budget.
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only. Textures are fake pointers
+// counted by the destroy callback, so no renderer is involved.
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+#include "Renderer/TextTextureCache.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+std::set<SDL_Texture*> g_destroyed;
+
+SDL_Texture* FakeTexture(const std::uintptr_t id) { return reinterpret_cast<SDL_Texture*>(id * 16); }
+
+// A 10x10 label: 400 bytes.
+const TextTextureCache::Entry* InsertLabel(TextTextureCache& cache, const char* text, const std::uintptr_t id) {
+  return cache.Insert("font", 0xFFFFFFFFu, text, FakeTexture(id), 10.0F, 10.0F);
+}
+
+}  // namespace
+
+int main() {
+  const auto destroy = [](SDL_Texture* texture) { g_destroyed.insert(texture); };
+
+  std::cout << "[share] one texture per content\n";
+  {
+    TextTextureCache cache(destroy);
+    Check(cache.Acquire("font", 0xFFFFFFFFu, "Miss!") == nullptr, "unknown content misses");
+    const auto* first = InsertLabel(cache, "Miss!", 1);
+    CheckEq(first->bytes, size_t{400}, "bytes are width x height x 4");
+    const auto* second = cache.Acquire("font", 0xFFFFFFFFu, std::string("Mi") + "ss!");
+    Check(second == first, "equal content shares the entry");
+    Check(cache.Acquire("font", 0xFF0000FFu, "Miss!") == nullptr, "another color is other content");
+    Check(cache.Acquire("other", 0xFFFFFFFFu, "Miss!") == nullptr, "another font is other content");
+    const auto stats = cache.GetStats();
+    CheckEq(stats.hits, std::uint64_t{1}, "one hit");
+    CheckEq(stats.misses, std::uint64_t{3}, "three misses");
+    CheckEq(stats.entries, size_t{1}, "one resident entry");
+  }
+
+  std::cout << "[refs] release keeps idle entries until the budget\n";
+  {
+    g_destroyed.clear();
+    TextTextureCache cache(destroy, 1000);
+    InsertLabel(cache, "a", 1);
+    cache.Acquire("font", 0xFFFFFFFFu, "a");
+    cache.Release("font", 0xFFFFFFFFu, "a");
+    CheckEq(cache.GetStats().idleBytes, size_t{0}, "an entry with a reference left is not idle");
+    cache.Release("font", 0xFFFFFFFFu, "a");
+    CheckEq(cache.GetStats().idleBytes, size_t{400}, "the last release makes it idle");
+    Check(g_destroyed.empty(), "an idle entry within budget stays resident");
+    Check(cache.Acquire("font", 0xFFFFFFFFu, "a") != nullptr, "and is revived by the next acquire");
+    cache.Release("font", 0xFFFFFFFFu, "a");
+
+    InsertLabel(cache, "b", 2);
+    cache.Release("font", 0xFFFFFFFFu, "b");
+    InsertLabel(cache, "c", 3);
+    cache.Release("font", 0xFFFFFFFFu, "c");
+    CheckEq(cache.GetStats().evictions, std::uint64_t{1}, "exceeding the budget evicts");
+    Check(g_destroyed.count(FakeTexture(1)) == 1, "the least recently released goes first");
+    CheckEq(cache.GetStats().bytes, size_t{800}, "the idle share is back within budget");
+    Check(cache.Acquire("font", 0xFFFFFFFFu, "a") == nullptr, "an evicted entry misses");
+  }
+
+  std::cout << "[live] referenced entries are never evicted\n";
+  {
+    g_destroyed.clear();
+    TextTextureCache cache(destroy, 0);
+    InsertLabel(cache, "hp", 1);
+    InsertLabel(cache, "mp", 2);
+    CheckEq(cache.GetStats().bytes, size_t{800}, "live text may exceed a zero budget");
+    Check(g_destroyed.empty(), "nothing held is destroyed");
+    cache.Release("font", 0xFFFFFFFFu, "hp");
+    Check(g_destroyed.count(FakeTexture(1)) == 1, "with no budget a released entry goes at once");
+    cache.Release("font", 0xFFFFFFFFu, "hp");
+    CheckEq(cache.GetStats().entries, size_t{1}, "releasing an unknown entry is a no-op");
+    cache.SetBudget(4096);
+    cache.Release("font", 0xFFFFFFFFu, "mp");
+    Check(g_destroyed.count(FakeTexture(2)) == 0, "a raised budget keeps idle entries");
+  }
+  Check(g_destroyed.count(FakeTexture(2)) == 1, "destruction frees every texture");
+
+  return octarine::test::ReportSummary("TextTextureCacheTest");
+}
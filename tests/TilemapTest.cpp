@@ -0,0 +1,183 @@
+// Tests for the engine-side tilemap pieces that don't need SDL or Lua: TilemapLayerComponent's
+// chunk bookkeeping and camera chunk range, the CSV layer parser, TileCollisionGrid's rect merge
+// and registry sync, and PhysicsSolverSystem resolving a simulated body against solid tiles.
+//
+// gtest-free; exit code = failed-check count. Links the ECS core only.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Components/BoxColliderComponent.h"
+#include "Components/GlobalTransformComponent.h"
+#include "Components/PositionComponent.h"
+#include "Components/RigidBodyComponent.h"
+#include "Components/TilemapLayerComponent.h"
+#include "ECS/Registry.h"
+#include "Engine/TileCsv.h"
+#include "Systems/CollisionSystem.h"
+#include "Systems/PhysicsSolverSystem.h"
+#include "Systems/TileCollisionGrid.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+// A layer from rows of '#' (tile 0) and '.' (empty), tiles 16x16 at the origin.
+TilemapLayerComponent LayerFromRows(const std::vector<std::string>& rows, const bool solid = true) {
+  const int width = static_cast<int>(rows.front().size());
+  const int height = static_cast<int>(rows.size());
+  std::vector<std::int32_t> tiles;
+  for (const std::string& row : rows) {
+    for (const char c : row) tiles.push_back(c == '#' ? 0 : TilemapLayerComponent::kEmptyTile);
+  }
+  TilemapLayerComponent layer("test", width, height, std::move(tiles));
+  layer.tileWidth = 16;
+  layer.tileHeight = 16;
+  layer.solid = solid;
+  return layer;
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "[component] chunk revisions and tile access\n";
+  {
+    TilemapLayerComponent layer("ground", 40, 20, {});
+    CheckEq(layer.tiles.size(), size_t{800}, "missing tiles are padded to width x height");
+    CheckEq(layer.ChunksX(), 3, "40 tiles wide -> 3 chunks across");
+    CheckEq(layer.ChunksY(), 2, "20 tiles tall -> 2 chunks down");
+    CheckEq(layer.TileAt(5, 5), TilemapLayerComponent::kEmptyTile, "padded tiles are empty");
+
+    const std::uint32_t before = layer.ChunkRevision(2, 1);
+    const std::uint64_t revisionBefore = layer.revision;
+    Check(layer.SetTile(35, 18, 7), "SetTile inside the grid succeeds");
+    CheckEq(layer.TileAt(35, 18), 7, "SetTile writes the tile");
+    Check(layer.ChunkRevision(2, 1) == before + 1, "SetTile bumps its chunk's revision");
+    Check(layer.ChunkRevision(0, 0) == 1 && layer.ChunkRevision(1, 1) == 1, "other chunks keep their revision");
+    Check(layer.revision == revisionBefore + 1, "SetTile bumps the layer revision");
+    Check(layer.SetTile(35, 18, 7) && layer.ChunkRevision(2, 1) == before + 1, "re-writing the same tile is a no-op");
+    Check(!layer.SetTile(40, 0, 1) && !layer.SetTile(-1, 0, 1), "SetTile outside the grid fails");
+    CheckEq(layer.TileAt(99, 99), TilemapLayerComponent::kEmptyTile, "TileAt outside the grid is empty");
+  }
+
+  std::cout << "[component] visible chunk range\n";
+  {
+    TilemapLayerComponent layer("ground", 64, 64, {});
+    layer.tileWidth = 16;
+    layer.tileHeight = 16;  // 256px chunks, 4 x 4 of them
+    TileChunkRange r = VisibleChunkRange(layer, 300.0f, 10.0f, 600.0f, 200.0f);
+    Check(r.x0 == 1 && r.x1 == 2 && r.y0 == 0 && r.y1 == 0, "camera inside the map picks the chunks it covers");
+    r = VisibleChunkRange(layer, -500.0f, -500.0f, 5000.0f, 5000.0f);
+    Check(r.x0 == 0 && r.x1 == 3 && r.y0 == 0 && r.y1 == 3, "oversized camera clamps to the map");
+    Check(VisibleChunkRange(layer, 1100.0f, 0.0f, 1400.0f, 100.0f).Empty(), "camera right of the map sees nothing");
+    Check(VisibleChunkRange(layer, -300.0f, -300.0f, -1.0f, -1.0f).Empty(), "camera above-left sees nothing");
+    layer.origin = {1000.0f, 0.0f};
+    r = VisibleChunkRange(layer, 1100.0f, 0.0f, 1200.0f, 100.0f);
+    Check(!r.Empty() && r.x0 == 0 && r.x1 == 0, "origin offsets the layer");
+  }
+
+  std::cout << "[csv] ParseTileCsv\n";
+  {
+    std::vector<std::int32_t> tiles;
+    int width = 0;
+    int height = 0;
+    std::string error;
+    Check(ParseTileCsv("0,1,2,\r\n-1, 3 ,4,\r\n5,6,-7\n\n", tiles, width, height, error),
+          "Tiled-style CSV (trailing commas, CRLF, blank tail) parses");
+    Check(width == 3 && height == 3, "CSV dimensions come from the rows");
+    Check(tiles == std::vector<std::int32_t>{0, 1, 2, -1, 3, 4, 5, 6, -1}, "negative indices become empty");
+    Check(!ParseTileCsv("1,2,3\n4,5\n", tiles, width, height, error), "ragged rows are rejected");
+    Check(error.find("line 2") != std::string::npos, "error names the bad line");
+    Check(!ParseTileCsv("1,x,3\n", tiles, width, height, error), "non-numeric cells are rejected");
+    Check(!ParseTileCsv("1,,3\n", tiles, width, height, error), "holes inside a row are rejected");
+    Check(!ParseTileCsv("\n\n", tiles, width, height, error), "empty input is rejected");
+  }
+
+  std::cout << "[grid] solid rect merge\n";
+  {
+    TileCollisionGrid grid;
+    const TilemapLayerComponent layer = LayerFromRows({
+        "#......#",
+        "#......#",
+        "########",
+    });
+    const TilemapLayerComponent* layers[] = {&layer};
+    grid.Build(layers);
+    // Greedy merge: each wall column runs down into the floor row, leaving the floor's middle.
+    CheckEq(grid.Rects().size(), size_t{3}, "U shape merges into three rects");
+    Check(grid.IsSolidAt(1.0f, 1.0f) && grid.IsSolidAt(64.0f, 40.0f), "walls and floor are solid");
+    Check(!grid.IsSolidAt(40.0f, 10.0f) && !grid.IsSolidAt(-5.0f, 5.0f), "open and outside cells are not");
+
+    int hits = 0;
+    float floorMinX = 0.0f;
+    grid.ForEachRectOverlapping(20.0f, 30.0f, 100.0f, 40.0f, [&](std::uint32_t, const TileCollisionGrid::SolidRect& r) {
+      ++hits;
+      floorMinX = r.minX;
+    });
+    CheckEq(hits, 1, "a box over many floor cells reports the floor rect once");
+    CheckEq(floorMinX, 16.0f, "the floor rect starts after the left wall column");
+
+    TilemapLayerComponent offset = LayerFromRows({"####"});
+    offset.origin = {8.0f, 0.0f};
+    const TilemapLayerComponent* mixed[] = {&layer, &offset};
+    grid.Build(mixed);
+    CheckEq(grid.Rects().size(), size_t{3}, "a layer off the first layer's grid is skipped");
+  }
+
+  std::cout << "[grid] Sync follows the registry's solid layers\n";
+  {
+    Registry registry;
+    TileCollisionGrid grid;
+    grid.Sync(registry);
+    Check(grid.Empty(), "no layers -> empty grid");
+
+    const Entity solid = registry.CreateEntity();
+    registry.AddComponent(solid, LayerFromRows({"##..", "...."}));
+    const Entity decor = registry.CreateEntity();
+    registry.AddComponent(decor, LayerFromRows({"....", "####"}, false));
+    grid.Sync(registry);
+    CheckEq(grid.Rects().size(), size_t{1}, "only the solid layer collides");
+    Check(!grid.IsSolidAt(5.0f, 20.0f), "non-solid layer tiles are open");
+
+    registry.GetComponent<TilemapLayerComponent>(solid).SetTile(3, 1, 0);
+    grid.Sync(registry);
+    Check(grid.IsSolidAt(50.0f, 20.0f), "an edited solid tile shows up after Sync");
+
+    registry.BlamEntity(solid);
+    grid.Sync(registry);
+    Check(grid.Empty(), "removing the solid layer empties the grid");
+  }
+
+  std::cout << "[physics] simulated body rests on solid tiles\n";
+  {
+    Registry registry;
+    CollisionSystem collision;  // never run: no entity pairs, tiles only
+    registry.Set<CollisionSystem*>(&collision);
+    registry.Set<TileCollisionGrid>(TileCollisionGrid());
+    registry.RegisterBulkSystem(PhysicsSolverSystem());
+
+    const Entity floor = registry.CreateEntity();
+    registry.AddComponent(floor, LayerFromRows({"........", "........", "########"}));
+
+    // 16x16 box sunk 4px into the floor's top (y = 32), falling.
+    const glm::vec2 start{40.0f, 20.0f};
+    GlobalTransformComponent transform;
+    transform.position = start;
+    const Entity body = registry.CreateEntityWithBundle(
+        transform, BoxColliderComponent(16, 16), RigidBodyComponent(glm::vec2(0.0f, 200.0f), 1.0f, 0.0f, 0.0f, true),
+        PositionComponent(start));
+    registry.Update(1.0f / 60.0f);
+
+    const auto& rigidBody = registry.GetComponent<RigidBodyComponent>(body);
+    const auto& position = registry.GetComponent<PositionComponent>(body);
+    Check(rigidBody.velocity.y <= 0.0f, "downward velocity into the floor is removed");
+    Check(position.value.y < start.y, "the body is pushed up out of the floor");
+    Check(position.value.y + 16.0f <= 32.0f + 4.0f, "penetration is reduced");
+    CheckEq(position.value.x, start.x, "a floor contact does not move the body sideways");
+  }
+
+  return octarine::test::ReportSummary("TilemapTest");
+}
@@ -0,0 +1,240 @@
+// Tests for UICanvasCache, the retained render targets behind cached UI canvases: the
+// Direct -> Bake -> Clean settle rule, Route sending a canvas's entities to the frame, the bake
+// queue or nowhere, the composited quad, one bake per frame, texture recreation on a resize, the
+// Direct fallback when a target can't be created, eviction of unvisited canvases, and the stats.
+//
+// gtest-free; exit code = failed-check count. Textures are fake pointers counted by the destroy
+// callback and Flush's draw is a lambda, so no renderer is involved.
+
+#include <SDL3/SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ECS/Entity.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/UICanvasCache.h"
+#include "TestHarness.h"
+
+using octarine::test::Check;
+using octarine::test::CheckEq;
+
+namespace {
+
+using Mode = UICanvasCache::Mode;
+
+std::set<SDL_Texture*> g_destroyed;
+
+SDL_Texture* FakeTexture(const std::uintptr_t id) { return reinterpret_cast<SDL_Texture*>(id * 16); }
+
+// Hands out fresh fake textures and counts the calls; `fail` makes it return nullptr.
+struct Factory {
+  std::uintptr_t next = 1;
+  int calls = 0;
+  bool fail = false;
+  SDL_Texture* operator()(int /*width*/, int /*height*/) {
+    ++calls;
+    return fail ? nullptr : FakeTexture(next++);
+  }
+};
+
+// Counts Flush's draws and remembers the last target and the size of the queue it was handed.
+struct Drawer {
+  int calls = 0;
+  SDL_Texture* target = nullptr;
+  std::size_t commands = 0;
+  void operator()(const RenderQueue& queue, SDL_Texture* texture) {
+    ++calls;
+    target = texture;
+    commands = queue.Size();
+  }
+};
+
+// One frame of the pipeline for a single 100x50 canvas on layer 3: layout (Open/Close), the
+// composite pass, one producer emit through Route, then the bake flush. Returns the mode it settled.
+Mode Frame(UICanvasCache& cache, RenderQueue& frame, Factory& create, Drawer& draw, const Entity canvas,
+           const std::uint64_t fingerprint, const int width = 100, const int height = 50) {
+  frame.Clear();
+  cache.BeginFrame();
+  const std::int32_t slot = cache.Open(canvas);
+  cache.Close(slot, fingerprint, width, height, 3);
+  cache.Composite(frame, create);
+  if (RenderQueue* target = cache.Route(slot, frame)) target->EmplaceSprite(3, 0.0F);
+  cache.Flush(draw);
+  return cache.ModeOf(slot);
+}
+
+}  // namespace
+
+int main() {
+  const auto destroy = [](SDL_Texture* texture) { g_destroyed.insert(texture); };
+  const Entity canvas(7);
+
+  std::cout << "[settle] a stable canvas goes Direct, Bake, then Clean\n";
+  {
+    UICanvasCache cache(destroy);
+    RenderQueue frame;
+    Factory create;
+    Drawer draw;
+
+    Check(Frame(cache, frame, create, draw, canvas, 42) == Mode::Direct, "the first frame draws directly");
+    CheckEq(frame.Size(), std::size_t{1}, "its entities go to the frame queue, no quad");
+    CheckEq(create.calls, 0, "and no texture is made yet");
+
+    Check(Frame(cache, frame, create, draw, canvas, 42) == Mode::Bake, "an unchanged second frame bakes");
+    CheckEq(create.calls, 1, "creating the target");
+    CheckEq(draw.calls, 1, "Flush draws the bake queue");
+    CheckEq(draw.commands, std::size_t{1}, "holding the entity routed there");
+    CheckEq(draw.target, FakeTexture(1), "into the canvas texture");
+    CheckEq(frame.Size(), std::size_t{1}, "the frame holds only the composited quad");
+
+    frame.Sort();
+    const SpriteCommand& quad = frame.Sprite(*frame.begin());
+    CheckEq(quad.texture, FakeTexture(1), "the quad samples the canvas texture");
+    Check(quad.destX == 0.0F && quad.destY == 0.0F && quad.destW == 100.0F && quad.destH == 50.0F,
+          "covering the canvas rect");
+    Check(quad.blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED, "with the premultiplied blend");
+    CheckEq(frame.begin()->sortKey >> 48, std::uint64_t{3}, "on the canvas layer");
+
+    Check(Frame(cache, frame, create, draw, canvas, 42) == Mode::Clean, "the third frame is clean");
+    CheckEq(frame.Size(), std::size_t{1}, "the quad alone: Route dropped the entity");
+    CheckEq(draw.calls, 1, "nothing is redrawn");
+    CheckEq(create.calls, 1, "and the texture is kept");
+    CheckEq(cache.GetStats().bakes, std::uint64_t{1}, "one bake counted");
+  }
+
+  std::cout << "[change] a changed canvas draws directly until it settles again\n";
+  {
+    UICanvasCache cache(destroy);
+    RenderQueue frame;
+    Factory create;
+    Drawer draw;
+    for (int i = 0; i < 3; ++i) Frame(cache, frame, create, draw, canvas, 1);
+
+    Check(Frame(cache, frame, create, draw, canvas, 2) == Mode::Direct, "a new fingerprint draws directly");
+    CheckEq(frame.Size(), std::size_t{1}, "without the stale quad");
+    Check(Frame(cache, frame, create, draw, canvas, 3) == Mode::Direct, "and keeps doing so while it changes");
+    Check(Frame(cache, frame, create, draw, canvas, 3) == Mode::Bake, "one stable frame re-bakes it");
+    CheckEq(create.calls, 1, "into the same texture");
+    Check(Frame(cache, frame, create, draw, canvas, 3) == Mode::Clean, "then it is clean again");
+
+    int bakes = 0;
+    for (std::uint64_t f = 10; f < 20; ++f) bakes += Frame(cache, frame, create, draw, canvas, f) == Mode::Bake;
+    CheckEq(bakes, 0, "a canvas changing every frame never bakes");
+  }
+
+  std::cout << "[one bake] two settling canvases bake on successive frames\n";
+  {
+    UICanvasCache cache(destroy);
+    RenderQueue frame;
+    Factory create;
+    Drawer draw;
+    const Entity other(8);
+    std::vector<Mode> modes;
+    for (int i = 0; i < 4; ++i) {
+      cache.BeginFrame();
+      const std::int32_t a = cache.Open(canvas);
+      const std::int32_t b = cache.Open(other);
+      cache.Close(a, 5, 10, 10, 0);
+      cache.Close(b, 6, 10, 10, 0);
+      cache.Composite(frame, create);
+      cache.Flush(draw);
+      modes.push_back(cache.ModeOf(a));
+      modes.push_back(cache.ModeOf(b));
+    }
+    Check(modes[2] == Mode::Bake && modes[3] == Mode::Direct, "the first canvas takes the frame's bake");
+    Check(modes[4] == Mode::Clean && modes[5] == Mode::Bake, "the second bakes the frame after");
+    Check(modes[6] == Mode::Clean && modes[7] == Mode::Clean, "then both are clean");
+    CheckEq(draw.calls, 2, "one draw per bake");
+    CheckEq(cache.GetStats().canvases, std::size_t{2}, "two resident canvases");
+    CheckEq(cache.GetStats().bytes, std::size_t{800}, "of 10x10x4 bytes each");
+  }
+
+  std::cout << "[resize] a new size recreates the texture\n";
+  {
+    UICanvasCache cache(destroy);
+    RenderQueue frame;
+    Factory create;
+    Drawer draw;
+    for (int i = 0; i < 3; ++i) Frame(cache, frame, create, draw, canvas, 9);
+    g_destroyed.clear();
+
+    Check(Frame(cache, frame, create, draw, canvas, 9, 200, 50) == Mode::Bake, "a resize with stable content re-bakes");
+    CheckEq(create.calls, 2, "into a new texture");
+    Check(g_destroyed.count(FakeTexture(1)) == 1, "the old one is destroyed");
+    CheckEq(cache.GetStats().bytes, std::size_t{200 * 50 * 4}, "bytes follow the new size");
+
+    Check(Frame(cache, frame, create, draw, canvas, 9, 0, 50) == Mode::Direct, "an empty canvas is never cached");
+  }
+
+  std::cout << "[fallback] a failed target leaves the canvas drawn directly\n";
+  {
+    UICanvasCache cache(destroy);
+    RenderQueue frame;
+    Factory create;
+    create.fail = true;
+    Drawer draw;
+    Frame(cache, frame, create, draw, canvas, 4);
+    Check(Frame(cache, frame, create, draw, canvas, 4) == Mode::Direct, "Composite demotes the bake");
+    CheckEq(frame.Size(), std::size_t{1}, "the entity reaches the frame queue");
+    CheckEq(draw.calls, 0, "and Flush draws nothing");
+
+    create.fail = false;
+    Check(Frame(cache, frame, create, draw, canvas, 4) == Mode::Bake, "a later frame retries");
+  }
+
+  std::cout << "[evict] unvisited canvases free their textures\n";
+  {
+    UICanvasCache cache(destroy);
+    RenderQueue frame;
+    Factory create;
+    Drawer draw;
+    for (int i = 0; i < 2; ++i) Frame(cache, frame, create, draw, canvas, 1);
+    g_destroyed.clear();
+
+    for (std::uint64_t i = 0; i < UICanvasCache::kEvictAfterFrames; ++i) cache.BeginFrame();
+    CheckEq(cache.GetStats().canvases, std::size_t{1}, "kept for kEvictAfterFrames unvisited frames");
+    cache.BeginFrame();
+    CheckEq(cache.GetStats().canvases, std::size_t{0}, "evicted after that");
+    Check(g_destroyed.count(FakeTexture(1)) == 1, "destroying its texture");
+    CheckEq(cache.Route(0, frame), &frame, "a slot from no open canvas routes to the frame");
+    CheckEq(cache.Route(UICanvasCache::kNoSlot, frame), &frame, "as does kNoSlot");
+
+    Frame(cache, frame, create, draw, canvas, 1);
+    Frame(cache, frame, create, draw, canvas, 1);
+    g_destroyed.clear();
+    {
+      UICanvasCache moved(std::move(cache));
+    }
+    Check(g_destroyed.count(FakeTexture(2)) == 1, "the destructor frees resident textures");
+  }
+
+  std::cout << "[fingerprint] order and content both count\n";
+  {
+    UICanvasCache::Fingerprint ab;
+    ab.Mix(std::uint64_t{1});
+    ab.Mix(std::uint64_t{2});
+    UICanvasCache::Fingerprint ba;
+    ba.Mix(std::uint64_t{2});
+    ba.Mix(std::uint64_t{1});
+    Check(ab.Value() != ba.Value(), "mixing is order dependent");
+
+    UICanvasCache::Fingerprint hi;
+    hi.Mix(std::string_view("hi"));
+    UICanvasCache::Fingerprint ho;
+    ho.Mix(std::string_view("ho"));
+    Check(hi.Value() != ho.Value(), "text changes the hash");
+
+    UICanvasCache::Fingerprint zero;
+    zero.Mix(0.0F);
+    UICanvasCache::Fingerprint negZero;
+    negZero.Mix(-0.0F);
+    Check(zero.Value() != negZero.Value(), "floats mix by bit pattern");
+  }
+
+  return octarine::test::ReportSummary("UICanvasCacheTest");
+}
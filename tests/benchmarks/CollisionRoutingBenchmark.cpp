@@ -0,0 +1,163 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Components/ProjectileComponent.h"
+#include "ECS/Registry.h"
+#include "Systems/CollisionRouting.h"
+
+// Pair throughput of collision-response classification at 50k entering contacts. The baseline is
+// what DamageSystem / ObstacleBounceSystem / ScriptCollisionSystem each did per pair before the
+// router: HasTag/HasComponent on both entities, once per system (three passes). The router pass
+// reads one role byte per entity from the per-archetype table and fills every system's bucket in a
+// single pass. Both run serially (the parallel split is identical for the two and would only hide
+// the per-pair cost). Items = pairs.
+
+namespace {
+constexpr int kEntityCount = 10'000;
+constexpr int kContactCount = 50'000;
+
+struct Scene {
+  Registry registry;
+  Entity projectiles{};
+  Entity enemies{};
+  Entity player{};
+  Entity obstacles{};
+  // Stands in for ScriptComponent, which would pull sol2/Lua into the benchmark.
+  Entity scripted{};
+  std::vector<std::pair<Entity, Entity>> pairs;
+};
+
+// A bullet-hell mix: mostly projectiles and enemies, some obstacles, a few scripted entities, and
+// untagged scenery. Contacts are random pairs, so most classify to nothing — the common case.
+void BuildScene(Scene& scene) {
+  Registry& registry = scene.registry;
+  scene.projectiles = registry.Tag<ProjectileTag>();
+  scene.enemies = registry.TagId("enemies");
+  scene.player = registry.TagId("player");
+  scene.obstacles = registry.TagId("obstacles");
+  scene.scripted = registry.TagId("scripted");
+
+  std::vector<Entity> entities;
+  entities.reserve(kEntityCount);
+  for (int i = 0; i < kEntityCount; ++i) {
+    const Entity e = registry.CreateEntity();
+    switch (i % 10) {
+      case 0:
+      case 1:
+      case 2:
+      case 3:
+        registry.AddComponent(e, ProjectileComponent{1});
+        registry.AddTag(e, scene.projectiles);
+        break;
+      case 4:
+      case 5:
+      case 6:
+        registry.AddTag(e, scene.enemies);
+        if (i % 20 == 4) registry.AddTag(e, scene.scripted);
+        break;
+      case 7:
+        registry.AddTag(e, scene.obstacles);
+        break;
+      default:
+        break;
+    }
+    entities.push_back(e);
+  }
+  registry.AddTag(entities[8], scene.player);
+
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> pick(0, kEntityCount - 1);
+  scene.pairs.reserve(kContactCount);
+  for (int i = 0; i < kContactCount; ++i) {
+    scene.pairs.emplace_back(entities[static_cast<size_t>(pick(rng))], entities[static_cast<size_t>(pick(rng))]);
+  }
+}
+}  // namespace
+
+static void BM_CollisionClassify_HasTag(benchmark::State& state) {
+  Scene scene;
+  BuildScene(scene);
+  const Registry& registry = scene.registry;
+  std::vector<std::pair<Entity, Entity>> damage;
+  std::vector<Entity> bounce;
+  std::vector<std::uint32_t> script;
+  for (auto _ : state) {
+    damage.clear();
+    bounce.clear();
+    script.clear();
+    // DamageSystem's pass.
+    for (const auto& [a, b] : scene.pairs) {
+      if (registry.HasTag(a, scene.projectiles) &&
+          (registry.HasTag(b, scene.player) || registry.HasTag(b, scene.enemies))) {
+        damage.emplace_back(a, b);
+      }
+      if (registry.HasTag(b, scene.projectiles) &&
+          (registry.HasTag(a, scene.player) || registry.HasTag(a, scene.enemies))) {
+        damage.emplace_back(b, a);
+      }
+    }
+    // ObstacleBounceSystem's pass.
+    for (const auto& [a, b] : scene.pairs) {
+      if (registry.HasTag(a, scene.enemies) && registry.HasTag(b, scene.obstacles)) bounce.push_back(a);
+      if (registry.HasTag(b, scene.enemies) && registry.HasTag(a, scene.obstacles)) bounce.push_back(b);
+    }
+    // ScriptCollisionSystem's pass.
+    for (size_t i = 0; i < scene.pairs.size(); ++i) {
+      const auto& [a, b] = scene.pairs[i];
+      if (registry.HasTag(a, scene.scripted) || registry.HasTag(b, scene.scripted)) {
+        script.push_back(static_cast<std::uint32_t>(i));
+      }
+    }
+    benchmark::DoNotOptimize(damage.data());
+    benchmark::DoNotOptimize(bounce.data());
+    benchmark::DoNotOptimize(script.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kContactCount);
+}
+BENCHMARK(BM_CollisionClassify_HasTag);
+
+static void BM_CollisionClassify_Router(benchmark::State& state) {
+  Scene scene;
+  BuildScene(scene);
+  CollisionRouter router;
+  router.DefineRole(kRoleDamageDealer, scene.projectiles);
+  router.DefineRole(kRoleDamageable, scene.enemies);
+  router.DefineRole(kRoleDamageable, scene.player);
+  router.DefineRole(kRoleBouncer, scene.enemies);
+  router.DefineRole(kRoleObstacle, scene.obstacles);
+  router.DefineRole(kRoleScriptListener, scene.scripted);
+  router.Refresh(scene.registry);
+  CollisionRoutes routes;
+  for (auto _ : state) {
+    routes.Clear();
+    router.RouteSerial(scene.registry, scene.pairs, routes);
+    benchmark::DoNotOptimize(routes.damage.data());
+    benchmark::DoNotOptimize(routes.bounce.data());
+    benchmark::DoNotOptimize(routes.script.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kContactCount);
+}
+BENCHMARK(BM_CollisionClassify_Router);
+
+// The production entry point: refresh + route, parallel across the ThreadPool at this density.
+static void BM_CollisionClassify_RouterParallel(benchmark::State& state) {
+  Scene scene;
+  BuildScene(scene);
+  CollisionRouter router;
+  router.DefineRole(kRoleDamageDealer, scene.projectiles);
+  router.DefineRole(kRoleDamageable, scene.enemies);
+  router.DefineRole(kRoleDamageable, scene.player);
+  router.DefineRole(kRoleBouncer, scene.enemies);
+  router.DefineRole(kRoleObstacle, scene.obstacles);
+  router.DefineRole(kRoleScriptListener, scene.scripted);
+  for (auto _ : state) {
+    const CollisionRoutes& routes = router.Route(scene.registry, scene.pairs);
+    benchmark::DoNotOptimize(routes.damage.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kContactCount);
+}
+BENCHMARK(BM_CollisionClassify_RouterParallel)->UseRealTime();
@@ -40,9 +40,9 @@ class StubContext final : public AnyContext {
 struct CollisionCounter {
   std::uint64_t count = 0;
   // CollisionSystem emits exactly one batched event per collect cycle, so counting events (not
-  // pairs) advances once per cycle — what the timing loop below keys on. Counting pairs would
-  // hang: only *entering* pairs are emitted, so a sustained overlap reports its pair on the
-  // first cycle and every later batch is empty.
+  // pairs) advances once per cycle — what the timing loop below keys on. Counting entering pairs
+  // would hang: a sustained overlap reports its pair as entering on the first cycle only, and
+  // every later batch carries it in the staying span instead.
   void OnCollisionBatch(const CollisionBatchEvent& /*e*/) { ++count; }
 };
 
@@ -104,10 +104,10 @@ BENCHMARK(BM_CollisionDispatch)->Range(8, 512)->UseRealTime();
 namespace {
 // Dense cluster: every box overlaps every other (all within a 16px span, boxes are 32px), so the
 // detection pass yields O(n^2) *sustained* pairs. After the first cycle no pairs enter or exit, but
-// the per-frame event-emission bookkeeping still runs over the full pair set every cycle:
-// currentSet construction, the entering-pair scan, and (under test) the exiting-pair scan +
-// CollisionExitBatchEvent emit. This isolates that bookkeeping at a realistic high pair count —
-// the broadphase/narrowphase cost is identical across builds, so any delta is the new exit path.
+// the per-frame enter/stay/exit bookkeeping still runs over the full pair set every cycle: the
+// worker-side radix sort of the pair keys and the main-thread linear merge against last frame's
+// sorted list. This isolates that bookkeeping at a realistic high pair count — the
+// broadphase/narrowphase cost is identical across builds, so any delta is the diffing path.
 void BuildDenseCluster(Registry& registry, int n) {
   EntityMask mask;
   mask.set(0);
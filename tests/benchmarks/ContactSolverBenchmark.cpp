@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Systems/ContactSolver.h"
+
+// ContactSolver::Step over 10k dynamic boxes on a static floor, warm-started step to step the way
+// PhysicsSolverSystem drives it. Two shapes:
+//   Stack: 1000 separate columns ten boxes high — many small islands, the parallel-friendly case.
+//   Pile:  boxes scattered over a 2000x390 strip with heavy overlap — few, large islands.
+// Candidate pairs are built once (grid broadphase, key-sorted) and reused, so only the solver is
+// timed. Items = contacts solved.
+
+namespace {
+constexpr int kBodyCount = 10'000;
+
+SolverPair MakePair(const std::uint32_t a, const std::uint32_t b) {
+  return {(static_cast<std::uint64_t>(a) << 32) | b, a, b};
+}
+
+// Uniform-grid pair finder; cells are at least one box wide, so neighbours only straddle one cell.
+std::vector<SolverPair> FindPairs(const std::vector<SolverBody>& bodies, const float cell) {
+  std::vector<std::pair<std::int64_t, std::uint32_t>> cells;
+  for (std::uint32_t i = 1; i < bodies.size(); ++i) {
+    const auto cx = static_cast<std::int64_t>(std::floor(bodies[i].cx / cell));
+    const auto cy = static_cast<std::int64_t>(std::floor(bodies[i].cy / cell));
+    cells.emplace_back((cx << 32) ^ (cy & 0xffffffff), i);
+  }
+  std::sort(cells.begin(), cells.end());
+  std::vector<SolverPair> pairs;
+  const auto overlaps = [&](const std::uint32_t a, const std::uint32_t b) {
+    return std::abs(bodies[a].cx - bodies[b].cx) < bodies[a].hx + bodies[b].hx &&
+           std::abs(bodies[a].cy - bodies[b].cy) < bodies[a].hy + bodies[b].hy;
+  };
+  for (const auto& [key, i] : cells) {
+    if (overlaps(0, i)) pairs.push_back(MakePair(0, i));
+    const std::int64_t cx = key >> 32;
+    const auto cy = static_cast<std::int32_t>(key & 0xffffffff);
+    for (std::int64_t dx = -1; dx <= 1; ++dx) {
+      for (std::int64_t dy = -1; dy <= 1; ++dy) {
+        const std::int64_t neighbour = ((cx + dx) << 32) ^ ((cy + dy) & 0xffffffff);
+        auto it = std::lower_bound(cells.begin(), cells.end(), std::pair{neighbour, std::uint32_t{0}});
+        for (; it != cells.end() && it->first == neighbour; ++it) {
+          if (it->second > i && overlaps(i, it->second)) pairs.push_back(MakePair(i, it->second));
+        }
+      }
+    }
+  }
+  std::sort(pairs.begin(), pairs.end(), [](const SolverPair& l, const SolverPair& r) { return l.key < r.key; });
+  return pairs;
+}
+
+// Body 0 is the floor (top edge at y = -10); boxes are 10x10 and fall in +y.
+void BuildStack(std::vector<SolverBody>& bodies) {
+  bodies.clear();
+  bodies.push_back({0.0f, 0.0f, 1.0e6f, 10.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.6f});
+  constexpr int kHeight = 10;
+  for (int i = 0; i < kBodyCount; ++i) {
+    const int column = i / kHeight;
+    const int level = i % kHeight;
+    bodies.push_back({static_cast<float>(column) * 14.0f, -14.6f - static_cast<float>(level) * 9.6f, 5.0f, 5.0f,
+                      0.0f, 60.0f, 1.0f, 0.0f, 0.6f});
+  }
+}
+
+void BuildPile(std::vector<SolverBody>& bodies) {
+  bodies.clear();
+  bodies.push_back({0.0f, 0.0f, 1.0e6f, 10.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.6f});
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> x(0.0f, 2000.0f);
+  std::uniform_real_distribution<float> y(-400.0f, -10.0f);
+  std::uniform_real_distribution<float> v(-40.0f, 40.0f);
+  for (int i = 0; i < kBodyCount; ++i) {
+    bodies.push_back({x(rng), y(rng), 5.0f, 5.0f, v(rng), 60.0f + v(rng), 1.0f, 0.2f, 0.6f});
+  }
+}
+
+void RunSolver(benchmark::State& state, void (*build)(std::vector<SolverBody>&)) {
+  std::vector<SolverBody> initial;
+  build(initial);
+  const std::vector<SolverPair> pairs = FindPairs(initial, 12.0f);
+  std::vector<SolverBody> bodies;
+  ContactSolver solver;
+  size_t contacts = 0;
+  for (auto _ : state) {
+    // Restart from the same state every iteration, keeping the warm-start cache from the last one.
+    state.PauseTiming();
+    bodies = initial;
+    state.ResumeTiming();
+    solver.Step(bodies, pairs);
+    contacts += solver.ContactCount();
+    benchmark::DoNotOptimize(bodies.data());
+  }
+  state.counters["contacts"] = static_cast<double>(solver.ContactCount());
+  state.counters["islands"] = static_cast<double>(solver.IslandCount());
+  state.SetItemsProcessed(static_cast<int64_t>(contacts));
+}
+}  // namespace
+
+static void BM_ContactSolver_Stack10k(benchmark::State& state) { RunSolver(state, BuildStack); }
+BENCHMARK(BM_ContactSolver_Stack10k)->UseRealTime();
+
+static void BM_ContactSolver_Pile10k(benchmark::State& state) { RunSolver(state, BuildPile); }
+BENCHMARK(BM_ContactSolver_Pile10k)->UseRealTime();
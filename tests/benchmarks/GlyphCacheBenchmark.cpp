@@ -0,0 +1,169 @@
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AssetManager/GlyphCache.h"
+#include "General/Fonts/Roboto_Medium.h"
+#include "Renderer/GlyphLayoutCache.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/SpriteBatcher.h"
+
+// Per-frame cost of changing non-ASCII labels on SDL's software renderer, before and after
+// RenderTextSystem drew every label through the font's GlyphCache. Companion to TextGlyphBenchmark,
+// whose synthetic atlas only covers printable ASCII.
+//
+// The font is the engine's embedded Roboto Medium at 18px with no baked atlas, so every glyph the
+// corpus needs is rasterized on demand. The corpus mixes Latin, accented Latin, Cyrillic and Greek
+// (Roboto has no CJK, so CJK can't be measured with it). WholeLabel is the old path for any label
+// outside the baked atlas: TTF_RenderText_Blended per changed label, one texture upload, one
+// SDL_RenderTexture per label. GlyphCache makes the label's glyphs resident (a no-op once warm),
+// lays it out through GlyphLayoutCache, and submits its quads through SpriteBatcher. Both end with
+// SDL_FlushRenderer so the draws are rasterised inside the timed region.
+//
+// Args: {labels}. Every label gets new text every frame. Counters: textures_created (glyph pages,
+// for GlyphCache) and draw_calls per frame, glyphs_rasterized over the run (bounded by the corpus's distinct
+// codepoints, not by frames), whole_label_fallbacks (labels the glyph cache could not serve —
+// expected 0). Items = labels.
+
+namespace {
+constexpr int kTargetW = 1280;
+constexpr int kTargetH = 720;
+constexpr float kFontSize = 18.0F;
+
+constexpr std::array<const char*, 6> kCorpus = {
+    "Score: ",
+    "Pok\xC3\xA9mon \xC3\x9C" "ber \xC3\xA7" "a ",
+    "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 ",
+    "\xCE\x93\xCE\xB5\xCE\xB9\xCE\xAC \xCF\x83\xCE\xBF\xCF\x85 ",
+    "\xC5\x81\xC3\xB3\xC4\x91\xC5\xBA \xC5\x99\xC3\xAD\xC5\xA1 ",
+    "\xD0\x96\xD0\xB8\xD0\xB7\xD0\xBD\xD1\x8C \xCE\xA9 ",
+};
+
+struct UnicodeScene {
+  SDL_Surface* target = nullptr;
+  SDL_Renderer* renderer = nullptr;
+  TTF_Font* font = nullptr;
+
+  UnicodeScene() {
+    if (!TTF_Init()) return;
+    target = SDL_CreateSurface(kTargetW, kTargetH, SDL_PIXELFORMAT_RGBA8888);
+    renderer = target != nullptr ? SDL_CreateSoftwareRenderer(target) : nullptr;
+    SDL_IOStream* io = SDL_IOFromConstMem(octarine::fonts::kRobotoMediumData, octarine::fonts::kRobotoMediumSize);
+    font = io != nullptr ? TTF_OpenFontIO(io, true, kFontSize) : nullptr;
+  }
+
+  ~UnicodeScene() {
+    if (font != nullptr) TTF_CloseFont(font);
+    if (renderer != nullptr) SDL_DestroyRenderer(renderer);
+    if (target != nullptr) SDL_DestroySurface(target);
+    TTF_Quit();
+  }
+
+  [[nodiscard]] bool Ready() const { return renderer != nullptr && font != nullptr; }
+
+  static std::string LabelText(const int i, const std::int64_t frame) {
+    return kCorpus[static_cast<size_t>(i) % kCorpus.size()] + std::to_string(1000 + i + frame * 7);
+  }
+
+  static SDL_FPoint LabelPosition(const int i) {
+    return {static_cast<float>((i % 8) * 160), static_cast<float>((i / 8) % 30 * 24)};
+  }
+};
+}  // namespace
+
+static void BM_UnicodeText_WholeLabel(benchmark::State& state) {
+  UnicodeScene scene;
+  if (!scene.Ready()) {
+    state.SkipWithError("software renderer or embedded font unavailable");
+    return;
+  }
+  const int labels = static_cast<int>(state.range(0));
+  std::vector<SDL_Texture*> textures(static_cast<size_t>(labels), nullptr);
+  std::int64_t frame = 0;
+  std::int64_t created = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < labels; ++i) {
+      const auto slot = static_cast<size_t>(i);
+      const std::string text = UnicodeScene::LabelText(i, frame);
+      SDL_Surface* surface = TTF_RenderText_Blended(scene.font, text.c_str(), 0, SDL_Color{255, 220, 120, 255});
+      if (textures[slot] != nullptr) SDL_DestroyTexture(textures[slot]);
+      textures[slot] = surface != nullptr ? SDL_CreateTextureFromSurface(scene.renderer, surface) : nullptr;
+      SDL_DestroySurface(surface);
+      ++created;
+      float w = 0.0F;
+      float h = 0.0F;
+      SDL_GetTextureSize(textures[slot], &w, &h);
+      const SDL_FPoint at = UnicodeScene::LabelPosition(i);
+      const SDL_FRect dest{at.x, at.y, w, h};
+      SDL_RenderTexture(scene.renderer, textures[slot], nullptr, &dest);
+    }
+    SDL_FlushRenderer(scene.renderer);
+    ++frame;
+  }
+  for (SDL_Texture* texture : textures) SDL_DestroyTexture(texture);
+  state.counters["textures_created"] =
+      benchmark::Counter(static_cast<double>(created), benchmark::Counter::kAvgIterations);
+  state.counters["draw_calls"] = static_cast<double>(labels);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * labels);
+}
+BENCHMARK(BM_UnicodeText_WholeLabel)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+static void BM_UnicodeText_GlyphCache(benchmark::State& state) {
+  UnicodeScene scene;
+  if (!scene.Ready()) {
+    state.SkipWithError("software renderer or embedded font unavailable");
+    return;
+  }
+  const int labels = static_cast<int>(state.range(0));
+  GlyphCache glyphs;
+  glyphs.Bind(scene.renderer, scene.font, nullptr);
+  GlyphLayoutCache layouts;
+  RenderQueue queue(16'384);
+  SpriteBatcher batcher;
+  std::int64_t frame = 0;
+  std::int64_t fallbacks = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < labels; ++i) {
+      const std::string text = UnicodeScene::LabelText(i, frame);
+      const auto layout = glyphs.Ensure(text, queue.Frame()) ? layouts.Get(glyphs.Metrics(), text) : nullptr;
+      if (layout == nullptr) {
+        ++fallbacks;
+        continue;
+      }
+      glyphs.Touch(layout->pages, queue.Frame());
+      const SDL_FPoint at = UnicodeScene::LabelPosition(i);
+      for (const GlyphQuad& quad : layout->quads) {
+        SDL_Texture* page = glyphs.PageTexture(quad.page);
+        auto& cmd = queue.EmplaceGlyph(0, 0.0F, page);
+        cmd = SpriteCommand{};
+        cmd.destX = at.x + quad.x;
+        cmd.destY = at.y + quad.y;
+        cmd.destW = quad.w;
+        cmd.destH = quad.h;
+        cmd.srcRect = {quad.srcX, quad.srcY, quad.w, quad.h};
+        cmd.texture = page;
+        cmd.colorMod = {255, 220, 120, 255};
+      }
+    }
+    queue.Sort();
+    batcher.Draw(scene.renderer, queue);
+    SDL_FlushRenderer(scene.renderer);
+    queue.Clear();
+    ++frame;
+  }
+  const GlyphCache::Stats stats = glyphs.GetStats();
+  state.counters["textures_created"] =
+      benchmark::Counter(static_cast<double>(stats.pages), benchmark::Counter::kAvgIterations);
+  state.counters["draw_calls"] = static_cast<double>(batcher.Stats().runs);
+  state.counters["glyphs_rasterized"] = static_cast<double>(stats.rasterized);
+  state.counters["glyph_pages"] = static_cast<double>(stats.pages);
+  state.counters["whole_label_fallbacks"] =
+      benchmark::Counter(static_cast<double>(fallbacks), benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * labels);
+}
+BENCHMARK(BM_UnicodeText_GlyphCache)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
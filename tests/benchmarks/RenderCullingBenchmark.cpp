@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "Components/GlobalTransformComponent.h"
+#include "Components/PositionComponent.h"
+#include "Components/SpriteComponent.h"
+#include "ECS/Registry.h"
+#include "Renderer/RenderCulling.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/StaticSpriteLayer.h"
+#include "Systems/TransformSystem.h"
+
+// Coarse render culling against the per-entity test, at several camera coverage ratios (camera
+// area as a percentage of the world's).
+//
+// ChunkCulling runs a frame of TransformSystem plus a RenderSpriteSystem-shaped producer (viewport
+// test, emplace into a RenderQueue) through Registry::Update over 200k sprites on a 40px grid.
+// Entities are created in 16x16 blocks, the spatial coherence a level load or tilemap gives, so
+// each chunk covers a compact patch of world. With chunked=1 TransformSystem also keeps chunk
+// bounds and the producer's AcceptChunk rejects off-camera chunks — bounds upkeep is in the
+// timed frame. moving=1 nudges every position each frame, so every chunk's bounds are recomputed
+// every frame (the worst case); moving=0 is a still world, where bounds are kept from the first
+// frame. Args: {coverage %, chunked, moving}. Items = sprites in the scene.
+//
+// StaticGrid times StaticSpriteLayer::ForEachVisible over 200k baked sprites scattered across the
+// same world, with the linear pass (cell=0) or a 256px cull grid. Args: {coverage %, cell}.
+// Counter visible = sprites that passed the cull.
+
+namespace {
+constexpr int kGridSide = 448;  // ~200k sprites
+constexpr float kSpacing = 40.0f;
+constexpr float kWorldSide = kGridSide * kSpacing;
+constexpr int kBlock = 16;
+
+octarine::Rect CameraForCoverage(const int64_t coveragePct) {
+  const float side = kWorldSide * std::sqrt(static_cast<float>(coveragePct) / 100.0f);
+  return {(kWorldSide - side) * 0.5f, (kWorldSide - side) * 0.5f, side, side};
+}
+
+struct CullProducer {
+  RenderQueue* queue;
+  octarine::Rect camera;
+  bool chunked;
+
+  bool AcceptChunk(const ChunkBounds& b) const {
+    return !chunked || !b.valid || !IsWorldBoundsOutsideCamera(b.minX, b.minY, b.maxX, b.maxY, camera);
+  }
+
+  void operator()(const GlobalTransformComponent& transform, const SpriteComponent& sprite) const {
+    const float w = sprite.width * transform.scale.x;
+    const float h = sprite.height * transform.scale.y;
+    if (IsRenderableOutsideViewport(transform.position.x, transform.position.y, w, h, sprite.isFixed, camera, 0.0f,
+                                    0.0f)) {
+      return;
+    }
+    SpriteCommand& cmd = queue->EmplaceSprite(static_cast<unsigned int>(sprite.layer), transform.position.y, nullptr);
+    cmd.destX = transform.position.x - camera.x;
+    cmd.destY = transform.position.y - camera.y;
+    cmd.destW = w;
+    cmd.destH = h;
+  }
+};
+
+// Alternates every position by one pixel, so each frame's transform pass sees every entity move.
+struct Wiggle {
+  int* frame;
+  void operator()(PositionComponent& position) const { position.value.x += (*frame & 1) ? 1.0f : -1.0f; }
+};
+}  // namespace
+
+static void BM_RenderCulling_ChunkCulling(benchmark::State& state) {
+  const bool chunked = state.range(1) != 0;
+  Registry registry;
+  RenderQueue queue(kGridSide * kGridSide);
+  int frame = 0;
+  if (state.range(2) != 0) registry.RegisterParallelSystem<PositionComponent>(Wiggle{&frame});
+  registry.RegisterBulkSystem<GlobalTransformComponent>(TransformSystem(chunked));
+  registry.RegisterParallelSystem<GlobalTransformComponent, SpriteComponent>(
+      CullProducer{&queue, CameraForCoverage(state.range(0)), chunked});
+
+  SpriteComponent sprite{};
+  sprite.width = 32.0f;
+  sprite.height = 32.0f;
+  for (int by = 0; by < kGridSide; by += kBlock) {
+    for (int bx = 0; bx < kGridSide; bx += kBlock) {
+      for (int y = by; y < by + kBlock && y < kGridSide; ++y) {
+        for (int x = bx; x < bx + kBlock && x < kGridSide; ++x) {
+          registry.CreateEntityWithBundle(GlobalTransformComponent{},
+                                          PositionComponent{glm::vec2(static_cast<float>(x) * kSpacing,
+                                                                      static_cast<float>(y) * kSpacing)},
+                                          sprite);
+        }
+      }
+    }
+  }
+
+  size_t visible = 0;
+  for (auto _ : state) {
+    ++frame;
+    registry.Update(1.0f / 60.0f);
+    visible = queue.Size();
+    queue.Clear();
+  }
+  state.SetItemsProcessed(state.iterations() * kGridSide * kGridSide);
+  state.counters["visible"] = static_cast<double>(visible);
+}
+BENCHMARK(BM_RenderCulling_ChunkCulling)
+    ->ArgsProduct({{1, 2, 10, 25, 100}, {0, 1}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+static void BM_RenderCulling_StaticGrid(benchmark::State& state) {
+  StaticSpriteLayer layer;
+  layer.SetGridCellSize(static_cast<float>(state.range(1)));
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> pos(0.0f, kWorldSide);
+  layer.BeginRebuild();
+  for (int i = 0; i < kGridSide * kGridSide; ++i) {
+    SpriteCommand& cmd = layer.Add(static_cast<std::uint64_t>(i), false).command;
+    cmd.destX = pos(rng);
+    cmd.destY = pos(rng);
+    cmd.destW = 32.0f;
+    cmd.destH = 32.0f;
+  }
+  layer.EndRebuild(1, 1);
+
+  const octarine::Rect camera = CameraForCoverage(state.range(0));
+  size_t visible = 0;
+  for (auto _ : state) {
+    visible = 0;
+    layer.ForEachVisible(camera, 0.0f, 0.0f, [&](const StaticSpriteLayer::Entry& entry) {
+      benchmark::DoNotOptimize(entry.command.destX);
+      ++visible;
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * kGridSide * kGridSide);
+  state.counters["visible"] = static_cast<double>(visible);
+}
+BENCHMARK(BM_RenderCulling_StaticGrid)
+    ->ArgsProduct({{1, 2, 10, 25, 100}, {0, 256}})
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,371 @@
+#include <SDL3/SDL.h>
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AssetManager/AssetManager.h"
+#include "Components/CameraComponents.h"
+#include "Components/GlobalTransformComponent.h"
+#include "Components/SpriteComponent.h"
+#include "Components/SquarePrimitiveComponent.h"
+#include "Components/TextLabelComponent.h"
+#include "ECS/Registry.h"
+#include "Game/GameConfig.h"
+#include "General/Rect.h"
+#include "Renderer/RenderCulling.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/RenderStats.h"
+#include "Renderer/Renderer.h"
+#include "Systems/RenderPrimitiveSystem.h"
+#include "Systems/RenderSpriteSystem.h"
+
+// The render pipeline a stage at a time, over synthetic scenes of 1k to 1M renderables scattered
+// across a 1280x720 view, so a frame-time regression can be pinned on one stage. Workloads (arg
+// kind): 0 sprites — RenderSpriteSystem over 8x8 sprites on 4 layers drawing from 16 textures;
+// 1 text — labels of kGlyphsPerLabel glyph quads from 4 atlas pages, emitted the way
+// RenderTextSystem's glyph path does (the system itself needs TTF fonts and a GlyphCache);
+// 2 primitives — RenderPrimitiveSystem over 8x8 squares.
+//
+// Emit runs the workload's producer through Registry::Update into the RenderQueue — viewport test
+// included, with every renderable on screen — then clears the queue. Items = renderables;
+// counter commands = queue entries per frame.
+//
+// Cull is the producers' viewport test alone over the same bounds, with the camera covering
+// {coverage}% of the view. Args: {kind, renderables, coverage %}. Counter visible.
+//
+// Sort times RenderQueue::Sort on the emitted frame. Counters: sort_key_entropy, the Shannon
+// entropy of the frame's sort keys in bits (0 when all are equal, log2(commands) when all differ)
+// and radix_passes, the key bytes that vary across the frame.
+//
+// Submit times Renderer::DrawQueue of the sorted frame on SDL's software renderer into an offscreen
+// surface — no window, no GPU — flushed so rasterization is inside the timed region. Counters are
+// the frame's RenderStats (queue fill plus draw_calls, sprite_runs, texture_switches, ...).
+//
+// Args for Emit, Sort and Submit: {kind, renderables}.
+
+namespace {
+constexpr int kTargetW = 1280;
+constexpr int kTargetH = 720;
+constexpr float kSize = 8.0F;
+constexpr int kLayers = 4;
+constexpr int kSpriteTextures = 16;
+constexpr int kGlyphPages = 4;
+constexpr int kGlyphPageSize = 256;
+constexpr int kGlyphsPerLabel = 8;
+constexpr float kGlyphW = 8.0F;
+constexpr float kGlyphH = 12.0F;
+
+enum Workload : std::int64_t { kSprites = 0, kText = 1, kPrimitives = 2 };
+
+// Top-left corner, layer and variant (texture, or label text) of every renderable.
+struct Placement {
+  float x;
+  float y;
+  int layer;
+  int variant;
+};
+
+std::vector<Placement> Layout(const std::size_t count) {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> x(0.0F, static_cast<float>(kTargetW) - kGlyphW * kGlyphsPerLabel);
+  std::uniform_real_distribution<float> y(0.0F, static_cast<float>(kTargetH) - kGlyphH);
+  std::uniform_int_distribution<int> layer(0, kLayers - 1);
+  std::uniform_int_distribution<int> variant(0, 1 << 16);
+  std::vector<Placement> placements(count);
+  for (Placement& p : placements) p = {x(rng), y(rng), layer(rng), variant(rng)};
+  return placements;
+}
+
+octarine::Rect Bounds(const Workload kind, const Placement& p) {
+  if (kind == kText) return {p.x, p.y, kGlyphW * kGlyphsPerLabel, kGlyphH};
+  return {p.x, p.y, kSize, kSize};
+}
+
+octarine::Rect CameraForCoverage(const std::int64_t coveragePct) {
+  const float scale = std::sqrt(static_cast<float>(coveragePct) / 100.0F);
+  const float w = static_cast<float>(kTargetW) * scale;
+  const float h = static_cast<float>(kTargetH) * scale;
+  return {(static_cast<float>(kTargetW) - w) * 0.5F, (static_cast<float>(kTargetH) - h) * 0.5F, w, h};
+}
+
+// RenderTextSystem's glyph-quad emit without the font machinery: each character is a kGlyphW x
+// kGlyphH cell of one of the pages, picked by its code. Serial like RenderTextSystem; serial
+// systems get no Prepare, so the queue and the (fixed) camera are bound up front.
+class GlyphLabelProducer {
+ public:
+  GlyphLabelProducer(Registry& registry, const std::vector<SDL_Texture*>* pages)
+      : pages_(pages),
+        renderQueue_(&registry.Get<RenderQueue>()),
+        camera_(registry.Get<CameraComponent>().viewport) {}
+
+  void operator()(const TextLabelComponent& text) const {
+    const auto width = static_cast<float>(text.text.size()) * kGlyphW;
+    if (IsRenderableOutsideViewport(text.position.x, text.position.y, width, kGlyphH, false, camera_, 0.0F, 0.0F)) {
+      return;
+    }
+    const SDL_Color tint{text.color.r, text.color.g, text.color.b, text.color.a};
+    float x = text.position.x - camera_.x;
+    const float y = text.position.y - camera_.y;
+    for (const char c : text.text) {
+      const auto code = static_cast<unsigned char>(c);
+      SDL_Texture* page = (*pages_)[code % kGlyphPages];
+      auto& cmd = renderQueue_->EmplaceGlyph(static_cast<unsigned int>(text.layer), text.position.y, page);
+      cmd = SpriteCommand{};
+      cmd.destX = x;
+      cmd.destY = y;
+      cmd.destW = kGlyphW;
+      cmd.destH = kGlyphH;
+      cmd.srcRect = {static_cast<float>(code % 16) * 16.0F, static_cast<float>(code / 16) * 16.0F, kGlyphW, kGlyphH};
+      cmd.texture = page;
+      cmd.colorMod = tint;
+      x += kGlyphW;
+    }
+  }
+
+ private:
+  const std::vector<SDL_Texture*>* pages_;
+  RenderQueue* renderQueue_;
+  octarine::Rect camera_;
+};
+
+// A registry holding one workload plus the singletons its producer reads, and a software renderer
+// over an offscreen surface. Sprite textures are owned by the AssetManager, glyph pages by `textures`.
+struct Scene {
+  Registry registry;
+  SDL_Surface* surface = nullptr;
+  SDL_Renderer* sdlRenderer = nullptr;
+  std::vector<SDL_Texture*> textures;
+  std::vector<std::pair<std::string, AssetHandle>> spriteTextures;
+  Renderer renderer;
+
+  Scene(const Workload kind, const std::size_t count) {
+    surface = SDL_CreateSurface(kTargetW, kTargetH, SDL_PIXELFORMAT_RGBA8888);
+    sdlRenderer = surface != nullptr ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (sdlRenderer == nullptr) return;
+    if (kind == kText) CreateTextures(kGlyphPages, kGlyphPageSize);
+
+    GameConfig config;
+    config.windowWidth = kTargetW;
+    config.windowHeight = kTargetH;
+    registry.Set<GameConfig>(config);
+    registry.Set<CameraComponent>(
+        CameraComponent{{0.0F, 0.0F, static_cast<float>(kTargetW), static_cast<float>(kTargetH)}});
+    registry.Set<RenderQueue>(RenderQueue(kind == kText ? count * kGlyphsPerLabel : count));
+    registry.Set<AssetManager>(AssetManager());
+
+    const std::vector<Placement> placements = Layout(count);
+    switch (kind) {
+      case kSprites:
+        registry.RegisterParallelSystem<GlobalTransformComponent, SpriteComponent>(RenderSpriteSystem());
+        LoadSpriteTextures();
+        AddSprites(placements);
+        break;
+      case kText:
+        registry.RegisterSystem<TextLabelComponent>(GlyphLabelProducer(registry, &textures));
+        AddLabels(placements);
+        break;
+      case kPrimitives:
+        registry.RegisterParallelSystem<SquarePrimitiveComponent, GlobalTransformComponent>(RenderPrimitiveSystem());
+        AddSquares(placements);
+        break;
+    }
+  }
+
+  ~Scene() {
+    registry.Get<AssetManager>().ClearAssets();
+    for (SDL_Texture* texture : textures) SDL_DestroyTexture(texture);
+    if (sdlRenderer != nullptr) SDL_DestroyRenderer(sdlRenderer);
+    if (surface != nullptr) SDL_DestroySurface(surface);
+  }
+
+  Scene(const Scene&) = delete;
+  Scene& operator=(const Scene&) = delete;
+
+  [[nodiscard]] bool Ok() const { return sdlRenderer != nullptr; }
+  RenderQueue& Queue() { return registry.Get<RenderQueue>(); }
+  void Emit() { registry.Update(1.0F / 60.0F); }
+
+ private:
+  void CreateTextures(const int count, const int size) {
+    const std::vector<Uint32> pixels(static_cast<std::size_t>(size * size), 0xFFFFFFFFu);
+    for (int t = 0; t < count; ++t) {
+      SDL_Texture* texture =
+          SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, size, size);
+      SDL_UpdateTexture(texture, nullptr, pixels.data(), size * static_cast<int>(sizeof(Uint32)));
+      textures.push_back(texture);
+    }
+  }
+
+  // kSpriteTextures 16x16 BMPs written to a temp dir and loaded under ids bench0..bench15, each
+  // interned once; sprites then carry the handle the Lua bind would have given them.
+  void LoadSpriteTextures() {
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "octarine_render_pipeline_bench";
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    SDL_Surface* image = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_RGBA8888);
+    SDL_FillSurfaceRect(image, nullptr, 0xFFFFFFFFu);
+    auto& assets = registry.Get<AssetManager>();
+    for (int t = 0; t < kSpriteTextures; ++t) {
+      const std::string id = "bench" + std::to_string(t);
+      const std::string path = (dir / (id + ".bmp")).string();
+      SDL_SaveBMP(image, path.c_str());
+      assets.AddTexture(sdlRenderer, id, path);
+      spriteTextures.emplace_back(id, assets.Intern(id));
+    }
+    SDL_DestroySurface(image);
+  }
+
+  void AddSprites(const std::vector<Placement>& placements) {
+    for (const Placement& p : placements) {
+      const auto& [id, handle] = spriteTextures[static_cast<std::size_t>(p.variant % kSpriteTextures)];
+      SpriteComponent sprite(id, kSize, kSize, p.layer, false);
+      sprite.texture = handle;
+      registry.CreateEntityWithBundle(GlobalTransformComponent{{p.x, p.y}, {1.0F, 1.0F}, 0.0}, std::move(sprite));
+    }
+  }
+
+  void AddLabels(const std::vector<Placement>& placements) {
+    for (const Placement& p : placements) {
+      std::string text = "x" + std::to_string(p.variant);
+      text.resize(kGlyphsPerLabel, ' ');
+      registry.CreateEntityWithBundle(
+          TextLabelComponent({p.x, p.y}, p.layer, std::move(text), "bench", {255, 255, 255, 255}, false));
+    }
+  }
+
+  void AddSquares(const std::vector<Placement>& placements) {
+    for (const Placement& p : placements) {
+      const auto shade = static_cast<std::uint8_t>(p.variant & 0xFF);
+      registry.CreateEntityWithBundle(
+          SquarePrimitiveComponent({0.0F, 0.0F}, p.layer, kSize, kSize, {shade, 128, 64, 255}, false),
+          GlobalTransformComponent{{p.x, p.y}, {1.0F, 1.0F}, 0.0});
+    }
+  }
+};
+
+// Shannon entropy, in bits, of the sort keys of a sorted queue: equal keys are adjacent, so each
+// run of them is one symbol.
+double SortKeyEntropy(const RenderQueue& queue) {
+  const auto n = static_cast<double>(queue.Size());
+  double entropy = 0.0;
+  for (auto run = queue.begin(); run != queue.end();) {
+    auto next = run;
+    while (next != queue.end() && next->sortKey == run->sortKey) ++next;
+    const double p = static_cast<double>(next - run) / n;
+    entropy -= p * std::log2(p);
+    run = next;
+  }
+  return entropy;
+}
+
+std::size_t RadixPasses(const RenderQueue& queue) {
+  if (queue.Size() == 0) return 0;
+  const std::uint64_t first = queue.begin()->sortKey;
+  std::uint64_t differs = 0;
+  for (const RenderKey& key : queue) differs |= key.sortKey ^ first;
+  std::size_t passes = 0;
+  for (std::size_t pass = 0; pass < 8; ++pass) passes += ((differs >> (pass * 8)) & 0xFFu) != 0 ? 1 : 0;
+  return passes;
+}
+
+const std::vector<std::int64_t> kRenderables = {1'000, 10'000, 100'000, 1'000'000};
+}  // namespace
+
+static void BM_RenderPipeline_Emit(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(1));
+  Scene scene(static_cast<Workload>(state.range(0)), count);
+  if (!scene.Ok()) {
+    state.SkipWithError("SDL software renderer unavailable");
+    return;
+  }
+  std::size_t commands = 0;
+  for (auto _ : state) {
+    scene.Emit();
+    commands = scene.Queue().Size();
+    scene.Queue().Clear();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(1));
+  state.counters["commands"] = static_cast<double>(commands);
+}
+BENCHMARK(BM_RenderPipeline_Emit)
+    ->ArgsProduct({{kSprites, kText, kPrimitives}, kRenderables})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+static void BM_RenderPipeline_Cull(benchmark::State& state) {
+  const auto kind = static_cast<Workload>(state.range(0));
+  std::vector<octarine::Rect> bounds;
+  for (const Placement& p : Layout(static_cast<std::size_t>(state.range(1)))) bounds.push_back(Bounds(kind, p));
+  const octarine::Rect camera = CameraForCoverage(state.range(2));
+  std::size_t visible = 0;
+  for (auto _ : state) {
+    visible = 0;
+    for (const octarine::Rect& b : bounds) {
+      visible += IsRenderableOutsideViewport(b.x, b.y, b.w, b.h, false, camera, 0.0F, 0.0F) ? 0 : 1;
+    }
+    benchmark::DoNotOptimize(visible);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(1));
+  state.counters["visible"] = static_cast<double>(visible);
+}
+BENCHMARK(BM_RenderPipeline_Cull)
+    ->ArgsProduct({{kSprites, kText, kPrimitives}, kRenderables, {10, 100}})
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_RenderPipeline_Sort(benchmark::State& state) {
+  Scene scene(static_cast<Workload>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+  if (!scene.Ok()) {
+    state.SkipWithError("SDL software renderer unavailable");
+    return;
+  }
+  scene.Emit();
+  RenderQueue& queue = scene.Queue();
+  for (auto _ : state) {
+    queue.Sort();
+    benchmark::DoNotOptimize(&*queue.begin());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queue.Size()));
+  state.counters["commands"] = static_cast<double>(queue.Size());
+  state.counters["sort_key_entropy"] = SortKeyEntropy(queue);
+  state.counters["radix_passes"] = static_cast<double>(RadixPasses(queue));
+}
+BENCHMARK(BM_RenderPipeline_Sort)
+    ->ArgsProduct({{kSprites, kText, kPrimitives}, kRenderables})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+static void BM_RenderPipeline_Submit(benchmark::State& state) {
+  Scene scene(static_cast<Workload>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+  if (!scene.Ok()) {
+    state.SkipWithError("SDL software renderer unavailable");
+    return;
+  }
+  scene.Emit();
+  RenderQueue& queue = scene.Queue();
+  queue.Sort();
+  for (auto _ : state) {
+    scene.renderer.ResetStats();
+    scene.renderer.DrawQueue(queue, scene.sdlRenderer);
+    SDL_FlushRenderer(scene.sdlRenderer);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queue.Size()));
+
+  RenderStats stats;
+  queue.FillStats(stats);
+  scene.renderer.FillStats(stats);
+  stats.ForEachCount([&state](const char* name, const std::uint32_t value) {
+    state.counters[name] = static_cast<double>(value);
+  });
+  state.counters["sort_key_entropy"] = SortKeyEntropy(queue);
+}
+BENCHMARK(BM_RenderPipeline_Submit)
+    ->ArgsProduct({{kSprites, kText, kPrimitives}, kRenderables})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,258 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Renderer/RenderQueue.h"
+
+// Multi-producer emplace throughput: P persistent producer threads each push a share of a fixed
+// frame of sprite keys, released together by a barrier so the timed region is pure contention on
+// the queue. Emplace runs the growable RenderQueue (per-thread 256-slot blocks, one shared
+// fetch_add per block); SharedCounter is the previous design, kept inline — one fetch_add on a
+// shared counter per key into a pre-sized vector. Clear is inside the timed frame, as in the game.
+//
+// Args: {producers}. Items = keys emplaced. Real time, since the work is on the producer threads.
+//
+// Sort times RenderQueue::Sort (slot gather, radix passes, key gather) on a frame of sprite keys
+// spread over 16 layers and a 4000px depth range with 64 textures — the shape a busy scene
+// produces, where about four radix passes survive the uniform-byte skip. The parallel arg sets the
+// queue's threshold to 0 or SIZE_MAX to force either path. Args: {keys, parallel}. Items = keys.
+//
+// Layout compares the queue's record layout (16-byte RenderKey records sorted, payloads left in
+// per-type pools) with the previous one, kept inline as LegacyQueue: 80-byte keys with the
+// payload in a union, sorted as (key, slot) entries and then gathered into a second 80-byte array.
+// Both sort serially on the same keys. With read=1 the timed region also walks the sorted queue
+// reading every sprite payload, as DrawQueue does — the record layout pays for its smaller sort
+// with indirect payload reads there. Counters: resident_mb is the storage the frame keeps
+// allocated (the peak; nothing is freed between frames); bytes_per_second is the sort's modelled
+// memory traffic (gather + 32 bytes per record per executed radix pass + the legacy payload
+// gather) over the measured time. Args: {keys, layout (0 legacy, 1 records), read}.
+
+namespace {
+constexpr int kKeysPerFrame = 128 * 1024;
+
+// The pre-record key layout: header plus the payload union, 80 bytes.
+struct LegacyKey {
+  std::uint64_t sortKey{};
+  RenderableType type{};
+  union Payload {
+    SpriteCommand sprite;
+    SquareCommand square;
+    TextCommand text;
+    Payload() {}
+  } payload;
+};
+
+// The pre-block queue's write path: every emplace bumps one contended counter.
+struct SharedCounterQueue {
+  std::vector<LegacyKey> keys = std::vector<LegacyKey>(kKeysPerFrame);
+  std::atomic<size_t> size{0};
+
+  SpriteCommand& EmplaceSprite(const unsigned int layer, const float depth) {
+    LegacyKey& key = keys[size.fetch_add(1, std::memory_order_relaxed)];
+    key.sortKey = RenderKey::ComputeSortKey(layer, depth, SPRITE, nullptr, 0);
+    key.type = SPRITE;
+    return key.payload.sprite;
+  }
+  void Clear() { size.store(0, std::memory_order_relaxed); }
+};
+
+// The pre-record sort: (key, slot) entries radix-sorted with the uniform-byte skip, then the
+// 80-byte keys gathered into a dense sorted copy.
+struct LegacyQueue {
+  struct Entry {
+    std::uint64_t key;
+    std::uint32_t slot;
+  };
+  std::vector<LegacyKey> keys;
+  std::vector<Entry> entries;
+  std::vector<Entry> scratch;
+  std::vector<LegacyKey> sorted;
+
+  SpriteCommand& EmplaceSprite(const unsigned int layer, const float depth, const void* batchKey) {
+    LegacyKey& key = keys.emplace_back();
+    key.sortKey = RenderKey::ComputeSortKey(layer, depth, SPRITE, batchKey, 0);
+    key.type = SPRITE;
+    return key.payload.sprite;
+  }
+
+  void Sort() {
+    const size_t n = keys.size();
+    entries.resize(n);
+    scratch.resize(n);
+    sorted.resize(n);
+    for (size_t i = 0; i < n; ++i) entries[i] = {keys[i].sortKey, static_cast<std::uint32_t>(i)};
+    std::array<std::array<size_t, 256>, 8> histograms{};
+    for (const Entry& entry : entries) {
+      for (size_t pass = 0; pass < 8; ++pass) histograms[pass][(entry.key >> (pass * 8)) & 0xFFu]++;
+    }
+    for (size_t pass = 0; pass < 8; ++pass) {
+      auto& counts = histograms[pass];
+      if (std::find(counts.begin(), counts.end(), n) != counts.end()) continue;
+      size_t sum = 0;
+      for (size_t& c : counts) sum += std::exchange(c, sum);
+      for (const Entry& entry : entries) scratch[counts[(entry.key >> (pass * 8)) & 0xFFu]++] = entry;
+      entries.swap(scratch);
+    }
+    for (size_t i = 0; i < n; ++i) sorted[i] = keys[entries[i].slot];
+  }
+
+  [[nodiscard]] size_t ResidentBytes() const {
+    return (keys.capacity() + sorted.capacity()) * sizeof(LegacyKey) +
+           (entries.capacity() + scratch.capacity()) * sizeof(Entry);
+  }
+};
+
+// The frame BM_RenderQueue_Sort and BM_RenderQueue_Layout sort: 16 layers, a 4000px depth range
+// and 64 textures, fed to `emplace(layer, depth, batchKey)`. Returns the number of radix passes
+// the keys need (bytes that aren't uniform across the frame).
+template <typename Emplace>
+size_t EmitFrame(const size_t keys, Emplace&& emplace) {
+  std::mt19937 rng(9);
+  std::uniform_int_distribution<unsigned int> layer(0, 15);
+  std::uniform_real_distribution<float> depth(0.0f, 4000.0f);
+  std::uniform_int_distribution<std::uintptr_t> texture(1, 64);
+  std::uint64_t first = 0;
+  std::uint64_t differs = 0;
+  for (size_t i = 0; i < keys; ++i) {
+    const unsigned int l = layer(rng);
+    const float d = depth(rng);
+    const auto* batchKey = reinterpret_cast<const void*>(texture(rng) << 12);
+    const std::uint64_t sortKey = RenderKey::ComputeSortKey(l, d, SPRITE, batchKey, 0);
+    if (i == 0) first = sortKey;
+    differs |= sortKey ^ first;
+    emplace(l, d, batchKey).destX = static_cast<float>(i);
+  }
+  size_t passes = 0;
+  for (size_t pass = 0; pass < 8; ++pass) passes += ((differs >> (pass * 8)) & 0xFFu) != 0 ? 1 : 0;
+  return passes;
+}
+
+template <typename Queue>
+void RunProducers(benchmark::State& state, Queue& queue) {
+  const auto producers = static_cast<int>(state.range(0));
+  const int share = kKeysPerFrame / producers;
+  std::atomic<bool> running{true};
+  // Phase 1: main thread + producers start a frame; phase 2: everyone has finished emplacing.
+  std::barrier sync(producers + 1);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      while (true) {
+        sync.arrive_and_wait();
+        if (!running.load(std::memory_order_relaxed)) return;
+        for (int i = 0; i < share; ++i) {
+          SpriteCommand& cmd = queue.EmplaceSprite(static_cast<unsigned int>(i & 3), 0.0f);
+          cmd.destX = static_cast<float>(p);
+          cmd.destY = static_cast<float>(i);
+        }
+        sync.arrive_and_wait();
+      }
+    });
+  }
+  for (auto _ : state) {
+    sync.arrive_and_wait();
+    sync.arrive_and_wait();
+    queue.Clear();
+  }
+  running.store(false, std::memory_order_relaxed);
+  sync.arrive_and_wait();
+  for (std::thread& thread : threads) thread.join();
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * share * producers);
+}
+}  // namespace
+
+static void BM_RenderQueue_Emplace(benchmark::State& state) {
+  // Start undersized so the first frames exercise mid-frame growth; the rest run pre-grown.
+  RenderQueue queue(1);
+  RunProducers(state, queue);
+  state.counters["high_water"] = static_cast<double>(queue.HighWaterMark());
+  state.counters["growth_events"] = static_cast<double>(queue.GrowthEvents());
+}
+BENCHMARK(BM_RenderQueue_Emplace)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime();
+
+static void BM_RenderQueue_SharedCounter(benchmark::State& state) {
+  SharedCounterQueue queue;
+  RunProducers(state, queue);
+}
+BENCHMARK(BM_RenderQueue_SharedCounter)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime();
+
+static void BM_RenderQueue_Sort(benchmark::State& state) {
+  const auto keys = static_cast<size_t>(state.range(0));
+  RenderQueue queue(keys);
+  queue.SetParallelSortThreshold(state.range(1) != 0 ? 0 : SIZE_MAX);
+  EmitFrame(keys, [&](const unsigned int layer, const float depth, const void* batchKey) -> SpriteCommand& {
+    return queue.EmplaceSprite(layer, depth, batchKey);
+  });
+  for (auto _ : state) {
+    queue.Sort();
+    benchmark::DoNotOptimize(&*queue.begin());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_RenderQueue_Sort)
+    ->Args({10'000, 0})
+    ->Args({10'000, 1})
+    ->Args({100'000, 0})
+    ->Args({100'000, 1})
+    ->Args({1'000'000, 0})
+    ->Args({1'000'000, 1})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+static void BM_RenderQueue_Layout(benchmark::State& state) {
+  const auto keys = static_cast<size_t>(state.range(0));
+  const bool records = state.range(1) != 0;
+  const bool read = state.range(2) != 0;
+  RenderQueue queue(records ? keys : 1);
+  LegacyQueue legacy;
+  queue.SetParallelSortThreshold(SIZE_MAX);
+  size_t passes = 0;
+  if (records) {
+    passes = EmitFrame(keys, [&](const unsigned int layer, const float depth, const void* batchKey) -> SpriteCommand& {
+      return queue.EmplaceSprite(layer, depth, batchKey);
+    });
+  } else {
+    legacy.keys.reserve(keys);
+    passes = EmitFrame(keys, [&](const unsigned int layer, const float depth, const void* batchKey) -> SpriteCommand& {
+      return legacy.EmplaceSprite(layer, depth, batchKey);
+    });
+  }
+
+  for (auto _ : state) {
+    float sum = 0.0f;
+    if (records) {
+      queue.Sort();
+      if (read) {
+        for (const RenderKey& key : queue) sum += queue.Sprite(key).destX;
+      }
+    } else {
+      legacy.Sort();
+      if (read) {
+        for (const LegacyKey& key : legacy.sorted) sum += key.payload.sprite.destX;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  // Modelled traffic per key: the gather reads the sort key (8 bytes from the record layout's
+  // key array, a whole 80-byte key in the legacy layout) and writes a 16-byte entry; each radix
+  // pass reads and writes 16 bytes; the legacy gather then reads and writes 80 bytes.
+  const size_t perKey = records ? 8 + 16 + passes * 32 : sizeof(LegacyKey) + 16 + passes * 32 + 2 * sizeof(LegacyKey);
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * keys * perKey));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  const size_t resident = records ? queue.ResidentBytes() : legacy.ResidentBytes();
+  state.counters["resident_mb"] = static_cast<double>(resident) / (1024.0 * 1024.0);
+  state.counters["radix_passes"] = static_cast<double>(passes);
+}
+BENCHMARK(BM_RenderQueue_Layout)
+    ->ArgsProduct({{10'000, 100'000, 1'000'000}, {0, 1}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Systems/CollisionBox.h"
+#include "Systems/SpatialIndex.h"
+
+// Query throughput of the SpatialIndex that CollisionSystem publishes, against the brute-force scan
+// gameplay scripts did before it existed (walk every collider, test each one). Each benchmark runs a
+// fixed batch of 256 queries over N uniformly scattered 16px colliders in a world that grows with N
+// (constant density, ~a screen's worth of neighbours per query), so the index numbers should stay
+// roughly flat with N while the scan grows linearly. Items = queries.
+
+namespace {
+constexpr int kQueriesPerIteration = 256;
+constexpr float kQueryRadius = 96.0f;
+
+struct Scene {
+  std::vector<Box> boxes;
+  std::vector<float> queryX;
+  std::vector<float> queryY;
+};
+
+Scene MakeScene(const int n) {
+  // ~1 collider per 64x64 cell.
+  const float world = std::sqrt(static_cast<float>(n)) * 64.0f;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> pos(0.0f, world);
+  Scene scene;
+  scene.boxes.reserve(static_cast<size_t>(n));
+  for (int i = 0; i < n; ++i) {
+    const float cx = pos(rng);
+    const float cy = pos(rng);
+    scene.boxes.push_back({Entity{static_cast<EntityID>(i)}, EntityMask{1}, EntityMask{1}, cx - 8.0f, cy - 8.0f,
+                           cx + 8.0f, cy + 8.0f, cx, cy, 8.0f, 8.0f, 1.0f, 0.0f, false});
+  }
+  for (int q = 0; q < kQueriesPerIteration; ++q) {
+    scene.queryX.push_back(pos(rng));
+    scene.queryY.push_back(pos(rng));
+  }
+  return scene;
+}
+
+float DistanceSq(const Box& box, const float x, const float y) {
+  const float dx = std::max({box.minX - x, 0.0f, x - box.maxX});
+  const float dy = std::max({box.minY - y, 0.0f, y - box.maxY});
+  return dx * dx + dy * dy;
+}
+}  // namespace
+
+static void BM_SpatialQueryCircle_Index(benchmark::State& state) {
+  const Scene scene = MakeScene(static_cast<int>(state.range(0)));
+  SpatialIndex index;
+  index.Build(scene.boxes);
+  std::vector<Entity> out;
+  for (auto _ : state) {
+    for (int q = 0; q < kQueriesPerIteration; ++q) {
+      index.QueryCircle(scene.queryX[q], scene.queryY[q], kQueryRadius, SpatialIndex::kAllMasks, out);
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kQueriesPerIteration);
+}
+BENCHMARK(BM_SpatialQueryCircle_Index)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_SpatialQueryCircle_BruteForce(benchmark::State& state) {
+  const Scene scene = MakeScene(static_cast<int>(state.range(0)));
+  const EntityMask mask = SpatialIndex::kAllMasks;
+  std::vector<Entity> out;
+  for (auto _ : state) {
+    for (int q = 0; q < kQueriesPerIteration; ++q) {
+      out.clear();
+      for (const Box& box : scene.boxes) {
+        if ((box.entityMask & mask).any() &&
+            DistanceSq(box, scene.queryX[q], scene.queryY[q]) <= kQueryRadius * kQueryRadius) {
+          out.push_back(box.entity);
+        }
+      }
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kQueriesPerIteration);
+}
+BENCHMARK(BM_SpatialQueryCircle_BruteForce)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_SpatialNearest8_Index(benchmark::State& state) {
+  const Scene scene = MakeScene(static_cast<int>(state.range(0)));
+  SpatialIndex index;
+  index.Build(scene.boxes);
+  std::vector<NearestHit> out;
+  for (auto _ : state) {
+    for (int q = 0; q < kQueriesPerIteration; ++q) {
+      index.Nearest(scene.queryX[q], scene.queryY[q], 8, SpatialIndex::kAllMasks, out);
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kQueriesPerIteration);
+}
+BENCHMARK(BM_SpatialNearest8_Index)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_SpatialNearest8_BruteForce(benchmark::State& state) {
+  const Scene scene = MakeScene(static_cast<int>(state.range(0)));
+  std::vector<NearestHit> out;
+  for (auto _ : state) {
+    for (int q = 0; q < kQueriesPerIteration; ++q) {
+      out.clear();
+      for (const Box& box : scene.boxes) {
+        out.push_back({box.entity, DistanceSq(box, scene.queryX[q], scene.queryY[q])});
+      }
+      std::partial_sort(out.begin(), out.begin() + 8, out.end(),
+                        [](const NearestHit& a, const NearestHit& b) { return a.distance < b.distance; });
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kQueriesPerIteration);
+}
+BENCHMARK(BM_SpatialNearest8_BruteForce)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Rays of 512px from each query point toward +x+y: the typical line-of-sight length.
+static void BM_SpatialRaycast_Index(benchmark::State& state) {
+  const Scene scene = MakeScene(static_cast<int>(state.range(0)));
+  SpatialIndex index;
+  index.Build(scene.boxes);
+  for (auto _ : state) {
+    for (int q = 0; q < kQueriesPerIteration; ++q) {
+      auto hit = index.Raycast(scene.queryX[q], scene.queryY[q], 1.0f, 1.0f, 512.0f, SpatialIndex::kAllMasks);
+      benchmark::DoNotOptimize(hit);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kQueriesPerIteration);
+}
+BENCHMARK(BM_SpatialRaycast_Index)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_SpatialRaycast_BruteForce(benchmark::State& state) {
+  const Scene scene = MakeScene(static_cast<int>(state.range(0)));
+  // Brute force = one single-box index per collider, so the per-box ray test is identical and only
+  // the lack of a tree is measured.
+  std::vector<SpatialIndex> singles(scene.boxes.size());
+  for (size_t i = 0; i < scene.boxes.size(); ++i) singles[i].Build({scene.boxes[i]});
+  for (auto _ : state) {
+    for (int q = 0; q < kQueriesPerIteration; ++q) {
+      float best = 512.0f;
+      for (const SpatialIndex& single : singles) {
+        if (auto hit = single.Raycast(scene.queryX[q], scene.queryY[q], 1.0f, 1.0f, best, SpatialIndex::kAllMasks)) {
+          best = hit->distance;
+        }
+      }
+      benchmark::DoNotOptimize(best);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kQueriesPerIteration);
+}
+// Capped at 10k: one brute-force batch at 100k takes over a second per iteration.
+BENCHMARK(BM_SpatialRaycast_BruteForce)->RangeMultiplier(10)->Range(1000, 10000);
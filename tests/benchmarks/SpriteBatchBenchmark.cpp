@@ -0,0 +1,235 @@
+#include <SDL3/SDL.h>
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AssetManager/DynamicTextureAtlas.h"
+#include "General/BlendMode.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/SpriteBatcher.h"
+
+// Sprite submission cost on SDL's software renderer (no window, no GPU — runs headless anywhere).
+// PerSprite is the pre-batching DrawQueue body: colour/alpha/blend state plus one
+// SDL_RenderTextureRotated per sprite. Batched walks the same sorted queue through SpriteBatcher,
+// one SDL_RenderGeometry per same-texture run. Both end with SDL_FlushRenderer so the queued
+// commands are actually rasterised inside the timed region.
+//
+// Args: {sprites, textures}. Sprites are small (8x8) and scattered over a 1280x720 target so
+// submission overhead, not fill rate, dominates. Items = sprites.
+//
+// Expand isolates SpriteBatcher::Build (run planning + vertex expansion, no SDL submit) with the
+// expansion forced serial or forced onto the ThreadPool. Args: {sprites, parallel}.
+//
+// DynamicAtlas draws a y-sorted scene (depth = y, as RenderSpriteSystem emits) from {textures}
+// distinct 16x16 images, either as loose textures (atlas=0) or packed into DynamicTextureAtlas
+// pages (atlas=1). Sorting by y band interleaves the loose textures inside every band, so runs
+// break on nearly every texture change; atlased, a band is one run. Counters texture_breaks and
+// draw_calls are the before/after. Args: {sprites, textures, atlas}.
+
+namespace {
+constexpr int kTargetW = 1280;
+constexpr int kTargetH = 720;
+constexpr int kTextureSize = 16;
+
+struct Scene {
+  SDL_Surface* surface = nullptr;
+  SDL_Renderer* renderer = nullptr;
+  std::vector<SDL_Texture*> textures;
+  RenderQueue queue{200'000};
+
+  Scene(const int sprites, const int textureCount) {
+    surface = SDL_CreateSurface(kTargetW, kTargetH, SDL_PIXELFORMAT_RGBA8888);
+    renderer = surface != nullptr ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (renderer == nullptr) return;
+    const std::vector<Uint32> pixels(kTextureSize * kTextureSize, 0xFFFFFFFFu);
+    for (int t = 0; t < textureCount; ++t) {
+      SDL_Texture* texture =
+          SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, kTextureSize, kTextureSize);
+      SDL_UpdateTexture(texture, nullptr, pixels.data(), kTextureSize * static_cast<int>(sizeof(Uint32)));
+      textures.push_back(texture);
+    }
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> x(0.0f, kTargetW - 8.0f);
+    std::uniform_real_distribution<float> y(0.0f, kTargetH - 8.0f);
+    std::uniform_real_distribution<float> rotation(0.0f, 6.28f);
+    std::uniform_int_distribution<int> pick(0, textureCount - 1);
+    for (int i = 0; i < sprites; ++i) {
+      SDL_Texture* texture = textures[static_cast<size_t>(pick(rng))];
+      auto& cmd = queue.EmplaceSprite(0, 0.0f, texture, octarine::BlendMode::Blend);
+      cmd = SpriteCommand{};
+      cmd.destX = x(rng);
+      cmd.destY = y(rng);
+      cmd.destW = 8.0f;
+      cmd.destH = 8.0f;
+      cmd.srcRect = {0.0f, 0.0f, static_cast<float>(kTextureSize), static_cast<float>(kTextureSize)};
+      cmd.pivot = {4.0f, 4.0f};
+      cmd.rotation = (i % 4 == 0) ? rotation(rng) : 0.0;
+      cmd.flip = (i % 3 == 0) ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
+      cmd.colorMod = {255, static_cast<Uint8>(i & 0xFF), 200, 255};
+      cmd.texture = texture;
+    }
+    queue.Sort();
+  }
+
+  ~Scene() {
+    for (SDL_Texture* texture : textures) SDL_DestroyTexture(texture);
+    if (renderer != nullptr) SDL_DestroyRenderer(renderer);
+    if (surface != nullptr) SDL_DestroySurface(surface);
+  }
+};
+}  // namespace
+
+static void BM_SpriteSubmit_PerSprite(benchmark::State& state) {
+  Scene scene(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+  if (scene.renderer == nullptr) {
+    state.SkipWithError("software renderer unavailable");
+    return;
+  }
+  for (auto _ : state) {
+    for (const RenderKey& key : scene.queue) {
+      const auto& cmd = scene.queue.Sprite(key);
+      const SDL_FRect destRect = {cmd.destX, cmd.destY, cmd.destW, cmd.destH};
+      const auto deg = static_cast<float>(cmd.rotation * (180.0 / 3.14159265358979323846));
+      SDL_SetTextureColorMod(cmd.texture, cmd.colorMod.r, cmd.colorMod.g, cmd.colorMod.b);
+      SDL_SetTextureAlphaMod(cmd.texture, cmd.colorMod.a);
+      SDL_SetTextureBlendMode(cmd.texture, cmd.blendMode);
+      SDL_RenderTextureRotated(scene.renderer, cmd.texture, &cmd.srcRect, &destRect, deg, &cmd.pivot, cmd.flip);
+    }
+    SDL_FlushRenderer(scene.renderer);
+  }
+  state.counters["draw_calls"] = static_cast<double>(scene.queue.Size());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_SpriteSubmit_PerSprite)
+    ->Args({10'000, 1})
+    ->Args({10'000, 8})
+    ->Args({50'000, 8})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_SpriteSubmit_Batched(benchmark::State& state) {
+  Scene scene(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+  if (scene.renderer == nullptr) {
+    state.SkipWithError("software renderer unavailable");
+    return;
+  }
+  SpriteBatcher batcher;
+  for (auto _ : state) {
+    batcher.Draw(scene.renderer, scene.queue);
+    SDL_FlushRenderer(scene.renderer);
+  }
+  state.counters["draw_calls"] = static_cast<double>(batcher.Stats().runs);
+  state.counters["texture_breaks"] = static_cast<double>(batcher.Stats().textureBreaks);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_SpriteSubmit_Batched)
+    ->Args({10'000, 1})
+    ->Args({10'000, 8})
+    ->Args({50'000, 8})
+    ->Unit(benchmark::kMillisecond);
+
+namespace {
+struct AtlasScene {
+  SDL_Surface* surface = nullptr;
+  SDL_Renderer* renderer = nullptr;
+  std::vector<SDL_Texture*> loose;
+  DynamicTextureAtlas atlas;
+  RenderQueue queue{200'000};
+
+  AtlasScene(const int sprites, const int textureCount, const bool atlased) {
+    surface = SDL_CreateSurface(kTargetW, kTargetH, SDL_PIXELFORMAT_RGBA8888);
+    renderer = surface != nullptr ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (renderer == nullptr) return;
+    atlas.Configure(atlased, DynamicTextureAtlas::kDefaultBudgetBytes);
+    std::vector<DynamicTextureAtlas::Slice> sources;
+    for (int t = 0; t < textureCount; ++t) {
+      SDL_Surface* image = SDL_CreateSurface(kTextureSize, kTextureSize, SDL_PIXELFORMAT_RGBA32);
+      SDL_FillSurfaceRect(image, nullptr, 0xFF000000u | static_cast<Uint32>(t * 0x10203));
+      const std::string id = "sprite" + std::to_string(t);
+      if (atlased && atlas.Add(renderer, id, image, SDL_SCALEMODE_NEAREST)) {
+        sources.push_back(*atlas.Find(id));
+      } else {
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, image);
+        loose.push_back(texture);
+        sources.push_back({texture, {0.0f, 0.0f, static_cast<float>(kTextureSize), static_cast<float>(kTextureSize)}});
+      }
+      SDL_DestroySurface(image);
+    }
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> x(0.0f, kTargetW - 8.0f);
+    std::uniform_real_distribution<float> y(0.0f, kTargetH - 8.0f);
+    std::uniform_int_distribution<int> pick(0, textureCount - 1);
+    for (int i = 0; i < sprites; ++i) {
+      const DynamicTextureAtlas::Slice& source = sources[static_cast<size_t>(pick(rng))];
+      const float destY = y(rng);
+      auto& cmd = queue.EmplaceSprite(0, destY, source.texture, octarine::BlendMode::Blend);
+      cmd = SpriteCommand{};
+      cmd.destX = x(rng);
+      cmd.destY = destY;
+      cmd.destW = 8.0f;
+      cmd.destH = 8.0f;
+      cmd.srcRect = source.rect;
+      cmd.pivot = {4.0f, 4.0f};
+      cmd.colorMod = {255, 255, 255, 255};
+      cmd.texture = source.texture;
+    }
+    queue.Sort();
+  }
+
+  ~AtlasScene() {
+    for (SDL_Texture* texture : loose) SDL_DestroyTexture(texture);
+    atlas.Clear();
+    if (renderer != nullptr) SDL_DestroyRenderer(renderer);
+    if (surface != nullptr) SDL_DestroySurface(surface);
+  }
+};
+}  // namespace
+
+static void BM_SpriteSubmit_DynamicAtlas(benchmark::State& state) {
+  AtlasScene scene(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)), state.range(2) != 0);
+  if (scene.renderer == nullptr) {
+    state.SkipWithError("software renderer unavailable");
+    return;
+  }
+  SpriteBatcher batcher;
+  for (auto _ : state) {
+    batcher.Draw(scene.renderer, scene.queue);
+    SDL_FlushRenderer(scene.renderer);
+  }
+  state.counters["draw_calls"] = static_cast<double>(batcher.Stats().runs);
+  state.counters["texture_breaks"] = static_cast<double>(batcher.Stats().textureBreaks);
+  state.counters["atlas_pages"] = static_cast<double>(scene.atlas.GetStats().pages);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_SpriteSubmit_DynamicAtlas)
+    ->Args({10'000, 8, 0})
+    ->Args({10'000, 8, 1})
+    ->Args({10'000, 64, 0})
+    ->Args({10'000, 64, 1})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_SpriteExpand(benchmark::State& state) {
+  Scene scene(static_cast<int>(state.range(0)), 8);
+  if (scene.renderer == nullptr) {
+    state.SkipWithError("software renderer unavailable");
+    return;
+  }
+  SpriteBatcher batcher;
+  batcher.SetParallelThreshold(state.range(1) != 0 ? 0 : SIZE_MAX);
+  for (auto _ : state) {
+    batcher.Build(scene.queue);
+    benchmark::DoNotOptimize(batcher.Vertices().data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_SpriteExpand)
+    ->Args({10'000, 0})
+    ->Args({10'000, 1})
+    ->Args({100'000, 0})
+    ->Args({100'000, 1})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -1,10 +1,14 @@
 #include <benchmark/benchmark.h>
 
+#include <array>
 #include <cstdint>
+#include <deque>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "Renderer/TextTextureCache.h"
+
 // Head-to-head micro-bench for the RenderTextSystem cache-key change. The old path rebuilt a
 // "fontId|text|color" std::string every frame for every visible label (even on a cache hit) and
 // looked it up in an unordered_map<string>. The new path keys the cache by entity id and only
@@ -13,9 +17,17 @@
 //
 // This is an in-build A/B of the two lookup strategies — it does not rely on the with/without
 // source toggle, since both strategies live side by side here. It isolates the CPU the change
-// removes (the per-frame string build + hash). The change's other benefit — bounding GPU texture
-// memory for text that changes every frame — is a memory property, not a CPU metric, so it is out
-// of scope for this bench.
+// removes (the per-frame string build + hash).
+//
+// The Churn pair is the regression bench for TextTextureCache, RenderTextSystem's shared store of
+// whole-label rasterizations: a damage-number scene where labels spawn and despawn every frame
+// with strings drawn from a small pool. PerEntity is the entity-keyed cache before the shared
+// store: every spawn rasterizes its own texture and a despawned entity's texture is never freed.
+// Shared acquires from TextTextureCache, rasterizes only on a miss and releases on despawn, so
+// idle textures stay within the byte budget. Rasterization is modelled as composing the label's
+// RGBA pixels on the CPU (no renderer); texture handles are fake and only counted. Counters:
+// rasterized per frame, resident_mb at the end of the run (PerEntity's grows with run length),
+// hits and evictions (Shared only).
 
 namespace {
 struct Label {
@@ -94,3 +106,106 @@ static void BM_TextCache_EntityKeyed(benchmark::State& state) {
   state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
 }
 BENCHMARK(BM_TextCache_EntityKeyed)->Range(8, 1024);
+
+namespace {
+constexpr int kChurnLabelW = 48;
+constexpr int kChurnLabelH = 24;
+constexpr std::size_t kChurnLabelBytes = std::size_t{kChurnLabelW} * kChurnLabelH * 4;
+
+// 32 distinct damage values, as a combat scene shows them.
+const std::array<std::string, 32>& DamagePool() {
+  static const std::array<std::string, 32> pool = [] {
+    std::array<std::string, 32> strings;
+    for (std::size_t i = 0; i < strings.size(); ++i) strings[i] = "-" + std::to_string(7 * i + 3);
+    return strings;
+  }();
+  return pool;
+}
+
+// Stand-in for TTF_RenderText_Blended + upload: compose the label's pixels, hand back a handle.
+SDL_Texture* RasterizeFake(const std::string& text, std::uintptr_t& nextHandle) {
+  std::vector<std::uint32_t> pixels(static_cast<std::size_t>(kChurnLabelW) * kChurnLabelH);
+  for (std::size_t i = 0; i < pixels.size(); ++i) pixels[i] = static_cast<std::uint32_t>(text[i % text.size()]);
+  benchmark::DoNotOptimize(pixels.data());
+  return reinterpret_cast<SDL_Texture*>(++nextHandle * 16);
+}
+
+// Each frame the oldest eighth of the labels despawns and as many spawn with pooled strings.
+struct ChurnScene {
+  std::deque<std::uint32_t> alive;
+  std::uint32_t nextEntity = 0;
+  std::size_t nextString = 0;
+
+  explicit ChurnScene(const int labels) {
+    for (int i = 0; i < labels; ++i) alive.push_back(nextEntity++);
+  }
+  [[nodiscard]] static const std::string& TextOf(const std::uint32_t entity) {
+    return DamagePool()[(entity * 2654435761u >> 8) % DamagePool().size()];
+  }
+  [[nodiscard]] std::size_t Turnover() const { return alive.size() / 8 + 1; }
+};
+}  // namespace
+
+static void BM_TextCache_Churn_PerEntity(benchmark::State& state) {
+  ChurnScene scene(static_cast<int>(state.range(0)));
+  std::unordered_map<std::uint32_t, SDL_Texture*> textures;
+  std::uintptr_t handles = 0;
+  std::int64_t rasterized = 0;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < scene.Turnover(); ++i) {
+      scene.alive.pop_front();  // the entity goes; its entry and texture stay behind
+      scene.alive.push_back(scene.nextEntity++);
+    }
+    for (const std::uint32_t entity : scene.alive) {
+      auto [it, inserted] = textures.try_emplace(entity, nullptr);
+      if (inserted) {
+        it->second = RasterizeFake(ChurnScene::TextOf(entity), handles);
+        ++rasterized;
+      }
+      benchmark::DoNotOptimize(it->second);
+    }
+  }
+  state.counters["rasterized"] =
+      benchmark::Counter(static_cast<double>(rasterized), benchmark::Counter::kAvgIterations);
+  state.counters["resident_mb"] = static_cast<double>(textures.size() * kChurnLabelBytes) / (1024.0 * 1024.0);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_TextCache_Churn_PerEntity)->Arg(64)->Arg(512);
+
+static void BM_TextCache_Churn_Shared(benchmark::State& state) {
+  ChurnScene scene(static_cast<int>(state.range(0)));
+  // A tight budget (half the pool): every pooled string stays held or idle-resident regardless.
+  TextTextureCache cache([](SDL_Texture*) {}, kChurnLabelBytes * 16);
+  std::unordered_map<std::uint32_t, const TextTextureCache::Entry*> labels;
+  std::uintptr_t handles = 0;
+  std::int64_t rasterized = 0;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < scene.Turnover(); ++i) {
+      const std::uint32_t gone = scene.alive.front();
+      scene.alive.pop_front();
+      if (labels.erase(gone) != 0) cache.Release("damage", 0xFF4040FFu, ChurnScene::TextOf(gone));
+      scene.alive.push_back(scene.nextEntity++);
+    }
+    for (const std::uint32_t entity : scene.alive) {
+      auto [it, inserted] = labels.try_emplace(entity, nullptr);
+      if (inserted) {
+        const std::string& text = ChurnScene::TextOf(entity);
+        it->second = cache.Acquire("damage", 0xFF4040FFu, text);
+        if (it->second == nullptr) {
+          it->second = cache.Insert("damage", 0xFF4040FFu, text, RasterizeFake(text, handles),
+                                    static_cast<float>(kChurnLabelW), static_cast<float>(kChurnLabelH));
+          ++rasterized;
+        }
+      }
+      benchmark::DoNotOptimize(it->second);
+    }
+  }
+  const TextTextureCache::Stats stats = cache.GetStats();
+  state.counters["rasterized"] =
+      benchmark::Counter(static_cast<double>(rasterized), benchmark::Counter::kAvgIterations);
+  state.counters["resident_mb"] = static_cast<double>(stats.bytes) / (1024.0 * 1024.0);
+  state.counters["hits"] = static_cast<double>(stats.hits);
+  state.counters["evictions"] = static_cast<double>(stats.evictions);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_TextCache_Churn_Shared)->Arg(64)->Arg(512);
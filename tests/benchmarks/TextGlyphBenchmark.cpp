@@ -0,0 +1,186 @@
+#include <SDL3/SDL.h>
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AssetManager/GlyphMetrics.h"
+#include "Renderer/GlyphLayoutCache.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/SpriteBatcher.h"
+
+// Per-frame text cost on SDL's software renderer, before and after RenderTextSystem drew labels as
+// glyph-atlas quads. Companion to TextCacheBenchmark, which isolates the cache lookup alone.
+//
+// Rasterized is the old atlas path: each label whose text changed composes a surface by blitting
+// its glyphs out of the CPU atlas, uploads it with SDL_CreateTextureFromSurface, frees the label's
+// previous texture, and draws with one SDL_RenderTexture per label. GlyphQuads lays the string out
+// through GlyphLayoutCache, emits one RenderQueue glyph per character, and submits through
+// SpriteBatcher — one geometry call for every label, no texture created. Both end with
+// SDL_FlushRenderer so the draws are rasterised inside the timed region.
+//
+// Args: {labels, changing}. changing=1 gives every label new text every frame (a score / timer /
+// damage-number HUD); changing=0 keeps it fixed, which the old path served from its texture cache.
+// Counters: textures_created and draw_calls per frame. Items = labels.
+
+namespace {
+constexpr int kTargetW = 1280;
+constexpr int kTargetH = 720;
+constexpr int kCellW = 8;
+constexpr int kCellH = 12;
+constexpr int kColumns = 16;
+
+struct TextScene {
+  SDL_Surface* target = nullptr;
+  SDL_Renderer* renderer = nullptr;
+  SDL_Surface* atlasSurface = nullptr;
+  SDL_Texture* atlasTexture = nullptr;
+  GlyphMetrics metrics;
+
+  TextScene() {
+    target = SDL_CreateSurface(kTargetW, kTargetH, SDL_PIXELFORMAT_RGBA8888);
+    renderer = target != nullptr ? SDL_CreateSoftwareRenderer(target) : nullptr;
+    if (renderer == nullptr) return;
+    // Printable ASCII as solid 6x10 white glyphs on an 8x12 grid — pixel content doesn't matter
+    // to either path's cost, only sizes and counts do.
+    atlasSurface = SDL_CreateSurface(kColumns * kCellW, 6 * kCellH, SDL_PIXELFORMAT_RGBA32);
+    metrics.SetLineSkip(kCellH);
+    for (std::uint32_t cp = 0x20; cp <= 0x7E; ++cp) {
+      const int slot = static_cast<int>(cp - 0x20);
+      const SDL_Rect cell{(slot % kColumns) * kCellW, (slot / kColumns) * kCellH, 6, 10};
+      SDL_FillSurfaceRect(atlasSurface, &cell, 0xFFFFFFFFu);
+      metrics.Add(cp, {static_cast<float>(cell.x), static_cast<float>(cell.y), 6.0f, 10.0f, 7.0f, 0.0f, 0.0f});
+    }
+    atlasTexture = SDL_CreateTextureFromSurface(renderer, atlasSurface);
+    SDL_SetTextureBlendMode(atlasTexture, SDL_BLENDMODE_BLEND);
+  }
+
+  ~TextScene() {
+    if (atlasTexture != nullptr) SDL_DestroyTexture(atlasTexture);
+    if (atlasSurface != nullptr) SDL_DestroySurface(atlasSurface);
+    if (renderer != nullptr) SDL_DestroyRenderer(renderer);
+    if (target != nullptr) SDL_DestroySurface(target);
+  }
+
+  // Label i's text on `frame`: a short HUD string, new every frame when `changing`.
+  static std::string LabelText(const int i, const std::int64_t frame, const bool changing) {
+    return "Score: " + std::to_string(1000 + i + (changing ? frame * 7 : 0));
+  }
+
+  static SDL_FPoint LabelPosition(const int i) {
+    return {static_cast<float>((i % 16) * 80), static_cast<float>((i / 16) % 60 * kCellH)};
+  }
+
+  // The old RenderTextSystem::ComposeFromAtlas: one blit per glyph into a fresh surface.
+  SDL_Surface* Compose(const std::string& text) const {
+    float width = 0.0f;
+    for (const char c : text) width += metrics.Find(static_cast<unsigned char>(c))->advance;
+    SDL_Surface* dst = SDL_CreateSurface(static_cast<int>(width) + 1, kCellH, SDL_PIXELFORMAT_RGBA32);
+    SDL_SetSurfaceColorMod(atlasSurface, 255, 220, 120);
+    SDL_SetSurfaceBlendMode(atlasSurface, SDL_BLENDMODE_BLEND);
+    float pen = 0.0f;
+    for (const char c : text) {
+      const auto* g = metrics.Find(static_cast<unsigned char>(c));
+      const SDL_Rect src{static_cast<int>(g->x), static_cast<int>(g->y), static_cast<int>(g->w),
+                         static_cast<int>(g->h)};
+      SDL_Rect dstRect{static_cast<int>(pen), 0, src.w, src.h};
+      SDL_BlitSurface(atlasSurface, &src, dst, &dstRect);
+      pen += g->advance;
+    }
+    SDL_SetSurfaceColorMod(atlasSurface, 255, 255, 255);
+    return dst;
+  }
+};
+}  // namespace
+
+static void BM_TextLabels_Rasterized(benchmark::State& state) {
+  TextScene scene;
+  if (scene.renderer == nullptr) {
+    state.SkipWithError("software renderer unavailable");
+    return;
+  }
+  const int labels = static_cast<int>(state.range(0));
+  const bool changing = state.range(1) != 0;
+  std::vector<std::string> cachedText(static_cast<size_t>(labels));
+  std::vector<SDL_Texture*> textures(static_cast<size_t>(labels), nullptr);
+  std::int64_t frame = 0;
+  std::int64_t created = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < labels; ++i) {
+      const auto slot = static_cast<size_t>(i);
+      std::string text = TextScene::LabelText(i, frame, changing);
+      if (textures[slot] == nullptr || text != cachedText[slot]) {
+        SDL_Surface* surface = scene.Compose(text);
+        if (textures[slot] != nullptr) SDL_DestroyTexture(textures[slot]);
+        textures[slot] = SDL_CreateTextureFromSurface(scene.renderer, surface);
+        SDL_DestroySurface(surface);
+        cachedText[slot] = std::move(text);
+        ++created;
+      }
+      float w = 0.0f;
+      float h = 0.0f;
+      SDL_GetTextureSize(textures[slot], &w, &h);
+      const SDL_FPoint at = TextScene::LabelPosition(i);
+      const SDL_FRect dest{at.x, at.y, w, h};
+      SDL_RenderTexture(scene.renderer, textures[slot], nullptr, &dest);
+    }
+    SDL_FlushRenderer(scene.renderer);
+    ++frame;
+  }
+  for (SDL_Texture* texture : textures) SDL_DestroyTexture(texture);
+  state.counters["textures_created"] =
+      benchmark::Counter(static_cast<double>(created), benchmark::Counter::kAvgIterations);
+  state.counters["draw_calls"] = static_cast<double>(labels);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * labels);
+}
+BENCHMARK(BM_TextLabels_Rasterized)
+    ->Args({64, 0})
+    ->Args({64, 1})
+    ->Args({512, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_TextLabels_GlyphQuads(benchmark::State& state) {
+  TextScene scene;
+  if (scene.renderer == nullptr) {
+    state.SkipWithError("software renderer unavailable");
+    return;
+  }
+  const int labels = static_cast<int>(state.range(0));
+  const bool changing = state.range(1) != 0;
+  GlyphLayoutCache cache;
+  RenderQueue queue(16'384);
+  SpriteBatcher batcher;
+  std::int64_t frame = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < labels; ++i) {
+      const auto layout = cache.Get(scene.metrics, TextScene::LabelText(i, frame, changing));
+      const SDL_FPoint at = TextScene::LabelPosition(i);
+      for (const GlyphQuad& quad : layout->quads) {
+        auto& cmd = queue.EmplaceGlyph(0, 0.0f, scene.atlasTexture);
+        cmd = SpriteCommand{};
+        cmd.destX = at.x + quad.x;
+        cmd.destY = at.y + quad.y;
+        cmd.destW = quad.w;
+        cmd.destH = quad.h;
+        cmd.srcRect = {quad.srcX, quad.srcY, quad.w, quad.h};
+        cmd.texture = scene.atlasTexture;
+        cmd.colorMod = {255, 220, 120, 255};
+      }
+    }
+    queue.Sort();
+    batcher.Draw(scene.renderer, queue);
+    SDL_FlushRenderer(scene.renderer);
+    queue.Clear();
+    ++frame;
+  }
+  state.counters["textures_created"] = 0.0;
+  state.counters["draw_calls"] = static_cast<double>(batcher.Stats().runs);
+  state.counters["glyph_quads"] = static_cast<double>(batcher.Stats().sprites);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * labels);
+}
+BENCHMARK(BM_TextLabels_GlyphQuads)
+    ->Args({64, 0})
+    ->Args({64, 1})
+    ->Args({512, 1})
+    ->Unit(benchmark::kMicrosecond);